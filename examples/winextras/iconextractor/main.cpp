@@ -60,6 +60,7 @@
 #include <QScopedArrayPointer>
 #include <QStringList>
 #include <QSysInfo>
+#include <QVector>
 
 #include <iostream>
 
@@ -119,9 +120,14 @@ static PixmapEntryList extractIcons(const QString &sourceFile, bool large)
 
     std::wcout << sourceFile << " contains " << extractedIconCount << " icon(s).\n";
 
+    // Convert all icons in one go, which spreads the pixel work over all cores.
+    const QVector<QPixmap> pixmaps = QtWin::fromHICONs(icons.data(), int(extractedIconCount));
+    for (UINT i = 0; i < extractedIconCount; ++i)
+        DestroyIcon(icons[i]);
+
     for (UINT i = 0; i < extractedIconCount; ++i) {
         PixmapEntry entry;
-        entry.pixmap = QtWin::fromHICON(icons[i]);
+        entry.pixmap = pixmaps.at(int(i));
         if (entry.pixmap.isNull()) {
             std::wcerr << "Error converting icons.\n";
             return PixmapEntryList();
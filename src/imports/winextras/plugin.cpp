@@ -76,6 +76,7 @@ public:
         qmlRegisterType<QQuickJumpList>(uri, 1, 0, "JumpList");
         qmlRegisterType<QQuickJumpListItem>(uri, 1, 0, "JumpListItem");
         qmlRegisterType<QQuickJumpListCategory>(uri, 1, 0, "JumpListCategory");
+        qmlRegisterType<QQuickJumpListCategory, 1>(uri, 1, 1, "JumpListCategory");
         qmlRegisterType<QQuickThumbnailToolBar>(uri, 1, 0, "ThumbnailToolBar");
         qmlRegisterType<QQuickThumbnailToolButton>(uri, 1, 0, "ThumbnailToolButton");
     }
@@ -40,7 +40,6 @@
 
 #include "qquickjumplist_p.h"
 #include "qquickjumplistcategory_p.h"
-#include <QWinJumpList>
 
 QT_BEGIN_NAMESPACE
 
@@ -57,6 +56,10 @@ QT_BEGIN_NAMESPACE
 
     An application can use Jump Lists to provide users with faster access to
     files or to display shortcuts to tasks or commands.
+
+    Once the JumpList is complete, changes to its categories and items are
+    applied to the Jump List one property at a time, and the Jump List is
+    rebuilt at most once per frame.
  */
 
 /*!
@@ -69,8 +72,13 @@ QQuickJumpList::QQuickJumpList(QObject *parent) :
 {
 }
 
+// The categories may outlive the backend, which commits pending changes.
 QQuickJumpList::~QQuickJumpList()
 {
+    if (m_tasks)
+        m_tasks->detach();
+    for (QQuickJumpListCategory *category : qAsConst(m_categories))
+        category->detach();
 }
 
 /*!
@@ -84,7 +92,7 @@ QQuickJumpListCategory *QQuickJumpList::recent() const
     if (!m_recent) {
         QQuickJumpList *that = const_cast<QQuickJumpList *>(this);
         that->m_recent = new QQuickJumpListCategory(that);
-        connect(m_recent, &QQuickJumpListCategory::visibilityChanged, that, &QQuickJumpList::rebuild);
+        connect(m_recent, &QQuickJumpListCategory::visibilityChanged, that, &QQuickJumpList::updateKnownCategories);
         m_recent->setVisible(false);
     }
     return m_recent;
@@ -101,7 +109,7 @@ QQuickJumpListCategory *QQuickJumpList::frequent() const
     if (!m_frequent) {
         QQuickJumpList *that = const_cast<QQuickJumpList *>(this);
         that->m_frequent = new QQuickJumpListCategory(that);
-        connect(m_frequent, &QQuickJumpListCategory::visibilityChanged, that, &QQuickJumpList::rebuild);
+        connect(m_frequent, &QQuickJumpListCategory::visibilityChanged, that, &QQuickJumpList::updateKnownCategories);
         m_frequent->setVisible(false);
     }
     return m_frequent;
@@ -117,7 +125,8 @@ QQuickJumpListCategory *QQuickJumpList::tasks() const
     if (!m_tasks) {
         QQuickJumpList *that = const_cast<QQuickJumpList *>(this);
         that->m_tasks = new QQuickJumpListCategory(that);
-        connect(m_tasks, &QQuickJumpListCategory::visibilityChanged, that, &QQuickJumpList::rebuild);
+        if (m_backend)
+            m_tasks->attach(m_backend->tasks());
     }
     return m_tasks;
 }
@@ -126,11 +135,16 @@ void QQuickJumpList::setTasks(QQuickJumpListCategory *tasks)
 {
     if (m_tasks != tasks) {
         if (m_tasks)
-            disconnect(m_tasks, &QQuickJumpListCategory::visibilityChanged, this, &QQuickJumpList::rebuild);
+            m_tasks->detach();
         delete m_tasks;
         m_tasks = tasks;
-        if (m_tasks)
-            connect(m_tasks, &QQuickJumpListCategory::visibilityChanged, this, &QQuickJumpList::rebuild);
+        if (m_backend) {
+            m_backend->tasks()->clear();
+            if (m_tasks)
+                m_tasks->attach(m_backend->tasks());
+            else
+                m_backend->tasks()->setVisible(false);
+        }
         emit tasksChanged();
     }
 }
@@ -158,34 +172,33 @@ void QQuickJumpList::classBegin()
 {
 }
 
+// Every category and item is attached to its counterpart in the backend
+// once, which then follows their changes.
 void QQuickJumpList::componentComplete()
 {
-    rebuild();
+    m_backend.reset(QQuickJumpListBackend::create());
+    updateKnownCategories();
+    if (m_tasks)
+        m_tasks->attach(m_backend->tasks());
+    for (QQuickJumpListCategory *category : qAsConst(m_categories))
+        category->attach(m_backend->addCategory());
 }
 
-void QQuickJumpList::rebuild()
+void QQuickJumpList::updateKnownCategories()
 {
-    QWinJumpList jumpList;
-    jumpList.recent()->setVisible(m_recent && m_recent->isVisible());
-    jumpList.frequent()->setVisible(m_frequent && m_frequent->isVisible());
-    if (m_tasks && m_tasks->isVisible()) {
-        jumpList.tasks()->setVisible(true);
-        const auto items = m_tasks->toItemList();
-        for (QWinJumpListItem *item : items)
-            jumpList.tasks()->addItem(item);
-    }
-    for (QQuickJumpListCategory *category : qAsConst(m_categories)) {
-        if (category->isVisible())
-            jumpList.addCategory(category->title(), category->toItemList())->setVisible(true);
-    }
+    if (!m_backend)
+        return;
+    m_backend->recent()->setVisible(m_recent && m_recent->isVisible());
+    m_backend->frequent()->setVisible(m_frequent && m_frequent->isVisible());
 }
 
 void QQuickJumpList::data_append(QQmlListProperty<QObject> *property, QObject *object)
 {
     if (QQuickJumpListCategory *category = qobject_cast<QQuickJumpListCategory *>(object)) {
         QQuickJumpList *jumpList = static_cast<QQuickJumpList *>(property->object);
-        connect(category, &QQuickJumpListCategory::visibilityChanged, jumpList, &QQuickJumpList::rebuild);
         jumpList->m_categories.append(category);
+        if (jumpList->m_backend)
+            category->attach(jumpList->m_backend->addCategory());
         emit jumpList->categoriesChanged();
     }
 }
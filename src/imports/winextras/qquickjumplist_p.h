@@ -52,9 +52,12 @@
 // We mean it.
 //
 
+#include "qquickjumplistbackend_p.h"
+
 #include <QObject>
 #include <QQmlParserStatus>
 #include <QQmlListProperty>
+#include <QScopedPointer>
 
 QT_BEGIN_NAMESPACE
 
@@ -92,7 +95,7 @@ Q_SIGNALS:
     void categoriesChanged();
 
 private Q_SLOTS:
-    void rebuild();
+    void updateKnownCategories();
 
 private:
     static void data_append(QQmlListProperty<QObject> *property, QObject *object);
@@ -103,6 +106,7 @@ private:
     QQuickJumpListCategory *m_frequent;
     QQuickJumpListCategory *m_tasks;
     QList<QQuickJumpListCategory *> m_categories;
+    QScopedPointer<QQuickJumpListBackend> m_backend;
 };
 
 QT_END_NAMESPACE
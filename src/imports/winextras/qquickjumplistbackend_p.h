@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKJUMPLISTBACKEND_P_H
+#define QQUICKJUMPLISTBACKEND_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QAbstractItemModel;
+
+// The jump list behind a QML JumpList. It lives as long as the JumpList and
+// is updated item by item: every QML category and item is attached to one
+// category and item of the backend. create() makes the backend of the
+// shell; tests and benchmarks link stand-ins instead.
+class QQuickJumpListBackend
+{
+public:
+    // Mirrors QWinJumpListItem::Type.
+    enum ItemType { Destination, Link, Separator };
+
+    class Item
+    {
+    public:
+        virtual ~Item() {}
+        virtual void setFilePath(const QString &filePath) = 0;
+        virtual void setArguments(const QStringList &arguments) = 0;
+        virtual void setDescription(const QString &description) = 0;
+        virtual void setTitle(const QString &title) = 0;
+        virtual void setIconPath(const QString &iconPath) = 0;
+    };
+
+    // Owns its items; the recent and frequent categories have none.
+    class Category
+    {
+    public:
+        virtual ~Category() {}
+        virtual void setTitle(const QString &title) = 0;
+        virtual void setVisible(bool visible) = 0;
+        virtual Item *addItem(ItemType type) = 0;
+        // Lists the rows of the model before the items; a role of -1 reads
+        // nothing. Also called again when only the roles changed.
+        virtual void setModel(QAbstractItemModel *model, int filePathRole, int titleRole,
+                              int argumentsRole, int iconRole) = 0;
+        // Also unsets the model.
+        virtual void clear() = 0;
+    };
+
+    static QQuickJumpListBackend *create();
+
+    // Commits pending changes.
+    virtual ~QQuickJumpListBackend() {}
+
+    // Categories are owned by the backend; custom ones are appended.
+    virtual Category *recent() = 0;
+    virtual Category *frequent() = 0;
+    virtual Category *tasks() = 0;
+    virtual Category *addCategory() = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKJUMPLISTBACKEND_P_H
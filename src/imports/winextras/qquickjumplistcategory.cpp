@@ -40,6 +40,8 @@
 
 #include "qquickjumplistcategory_p.h"
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -61,8 +63,13 @@ QT_BEGIN_NAMESPACE
  */
 
 QQuickJumpListCategory::QQuickJumpListCategory(QObject *parent) :
-    QObject(parent), m_visible(true)
+    QObject(parent), m_visible(true), m_backend(0)
 {
+    m_roleNames[FilePathRole] = QStringLiteral("filePath");
+    m_roleNames[TitleRole] = QStringLiteral("title");
+    m_roleNames[ArgumentsRole] = QStringLiteral("arguments");
+    m_roleNames[IconRole] = QStringLiteral("iconPath");
+    std::fill(m_roles, m_roles + ModelRoleCount, -1);
 }
 
 QQuickJumpListCategory::~QQuickJumpListCategory()
@@ -102,6 +109,8 @@ void QQuickJumpListCategory::setTitle(const QString &title)
 {
     if (m_title != title) {
         m_title = title;
+        if (m_backend)
+            m_backend->setTitle(title);
         emit titleChanged();
     }
 }
@@ -120,16 +129,168 @@ void QQuickJumpListCategory::setVisible(bool visible)
 {
     if (m_visible != visible) {
         m_visible = visible;
+        if (m_backend)
+            m_backend->setVisible(visible);
         emit visibilityChanged();
     }
 }
 
-QList<QWinJumpListItem *> QQuickJumpListCategory::toItemList() const
+/*!
+    \qmlproperty QAbstractItemModel JumpListCategory::model
+    \since QtWinExtras 1.1
+
+    A model whose rows are listed as links, before the declared items. Each
+    row takes its file path, title, arguments, and icon from the roles named
+    by \l filePathRole, \l titleRole, \l argumentsRole, and \l iconRole.
+    A link without a file path starts the application.
+
+    Rows that are inserted, removed, or changed only update the affected
+    links, and the changes made in one pass of the event loop are
+    committed together. Only the tasks and custom categories support models.
+ */
+QAbstractItemModel *QQuickJumpListCategory::model() const
+{
+    return m_model;
+}
+
+void QQuickJumpListCategory::setModel(QAbstractItemModel *model)
+{
+    if (m_model == model)
+        return;
+    if (m_model)
+        disconnect(m_model, nullptr, this, nullptr);
+    m_model = model;
+    // Models such as ListModel only know their role names once they have rows.
+    if (m_model) {
+        connect(m_model, &QAbstractItemModel::rowsInserted, this, [this]() { updateModel(false); });
+        connect(m_model, &QAbstractItemModel::modelReset, this, [this]() { updateModel(false); });
+    }
+    updateModel(true);
+    emit modelChanged();
+}
+
+/*!
+    \qmlproperty string JumpListCategory::filePathRole
+    \since QtWinExtras 1.1
+
+    The name of the model role holding the file paths of the links. The
+    default is \c filePath.
+ */
+QString QQuickJumpListCategory::filePathRole() const
+{
+    return m_roleNames[FilePathRole];
+}
+
+void QQuickJumpListCategory::setFilePathRole(const QString &role)
+{
+    if (m_roleNames[FilePathRole] != role) {
+        setModelRole(FilePathRole, role);
+        emit filePathRoleChanged();
+    }
+}
+
+/*!
+    \qmlproperty string JumpListCategory::titleRole
+    \since QtWinExtras 1.1
+
+    The name of the model role holding the titles of the links. The default
+    is \c title.
+ */
+QString QQuickJumpListCategory::titleRole() const
+{
+    return m_roleNames[TitleRole];
+}
+
+void QQuickJumpListCategory::setTitleRole(const QString &role)
+{
+    if (m_roleNames[TitleRole] != role) {
+        setModelRole(TitleRole, role);
+        emit titleRoleChanged();
+    }
+}
+
+/*!
+    \qmlproperty string JumpListCategory::argumentsRole
+    \since QtWinExtras 1.1
+
+    The name of the model role holding the arguments of the links, as a
+    list of strings or a single string. The default is \c arguments.
+ */
+QString QQuickJumpListCategory::argumentsRole() const
+{
+    return m_roleNames[ArgumentsRole];
+}
+
+void QQuickJumpListCategory::setArgumentsRole(const QString &role)
+{
+    if (m_roleNames[ArgumentsRole] != role) {
+        setModelRole(ArgumentsRole, role);
+        emit argumentsRoleChanged();
+    }
+}
+
+/*!
+    \qmlproperty string JumpListCategory::iconRole
+    \since QtWinExtras 1.1
+
+    The name of the model role holding the icons of the links, as the paths
+    of icon files. The default is \c iconPath.
+ */
+QString QQuickJumpListCategory::iconRole() const
+{
+    return m_roleNames[IconRole];
+}
+
+void QQuickJumpListCategory::setIconRole(const QString &role)
+{
+    if (m_roleNames[IconRole] != role) {
+        setModelRole(IconRole, role);
+        emit iconRoleChanged();
+    }
+}
+
+void QQuickJumpListCategory::setModelRole(ModelRole role, const QString &name)
+{
+    m_roleNames[role] = name;
+    updateModel(false);
+}
+
+int QQuickJumpListCategory::resolveRole(ModelRole role) const
+{
+    return m_model ? m_model->roleNames().key(m_roleNames[role].toUtf8(), -1) : -1;
+}
+
+// Passes the model on when forced or when one of its roles changed.
+void QQuickJumpListCategory::updateModel(bool force)
+{
+    int roles[ModelRoleCount];
+    for (int role = 0; role < ModelRoleCount; ++role)
+        roles[role] = resolveRole(ModelRole(role));
+    const bool rolesChanged = !std::equal(roles, roles + ModelRoleCount, m_roles);
+    std::copy(roles, roles + ModelRoleCount, m_roles);
+    if (m_backend && (force || rolesChanged))
+        m_backend->setModel(m_model, m_roles[FilePathRole], m_roles[TitleRole],
+                            m_roles[ArgumentsRole], m_roles[IconRole]);
+}
+
+// Items declared later are attached as they are appended.
+void QQuickJumpListCategory::attach(QQuickJumpListBackend::Category *category)
+{
+    m_backend = category;
+    m_backend->setTitle(m_title);
+    m_backend->setVisible(m_visible);
+    if (m_model)
+        m_backend->setModel(m_model, m_roles[FilePathRole], m_roles[TitleRole],
+                            m_roles[ArgumentsRole], m_roles[IconRole]);
+    for (QQuickJumpListItem *item : qAsConst(m_items))
+        item->attach(m_backend);
+}
+
+void QQuickJumpListCategory::detach()
 {
-    QList<QWinJumpListItem *> items;
-    for (QQuickJumpListItem *item : m_items)
-        items.append(item->toJumpListItem());
-    return items;
+    for (QQuickJumpListItem *item : qAsConst(m_items))
+        item->detach();
+    m_backend = 0;
 }
 
 void QQuickJumpListCategory::data_append(QQmlListProperty<QObject> *property, QObject *object)
@@ -137,6 +298,8 @@ void QQuickJumpListCategory::data_append(QQmlListProperty<QObject> *property, QO
     if (QQuickJumpListItem *item = qobject_cast<QQuickJumpListItem *>(object)) {
         QQuickJumpListCategory *category = static_cast<QQuickJumpListCategory *>(property->object);
         category->m_items.append(item);
+        if (category->m_backend)
+            item->attach(category->m_backend);
         emit category->itemsChanged();
     }
 }
@@ -54,10 +54,10 @@
 
 #include "qquickjumplistitem_p.h"
 
+#include <QAbstractItemModel>
 #include <QObject>
+#include <QPointer>
 #include <QQmlListProperty>
-#include <QWinJumpListCategory>
-#include <QWinJumpListItem>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,6 +68,11 @@ class QQuickJumpListCategory : public QObject
     Q_PROPERTY(QQmlListProperty<QQuickJumpListItem> items READ items)
     Q_PROPERTY(QString title READ title WRITE setTitle NOTIFY titleChanged)
     Q_PROPERTY(bool visible READ isVisible WRITE setVisible NOTIFY visibilityChanged)
+    Q_PROPERTY(QAbstractItemModel *model READ model WRITE setModel NOTIFY modelChanged REVISION 1)
+    Q_PROPERTY(QString filePathRole READ filePathRole WRITE setFilePathRole NOTIFY filePathRoleChanged REVISION 1)
+    Q_PROPERTY(QString titleRole READ titleRole WRITE setTitleRole NOTIFY titleRoleChanged REVISION 1)
+    Q_PROPERTY(QString argumentsRole READ argumentsRole WRITE setArgumentsRole NOTIFY argumentsRoleChanged REVISION 1)
+    Q_PROPERTY(QString iconRole READ iconRole WRITE setIconRole NOTIFY iconRoleChanged REVISION 1)
     Q_CLASSINFO("DefaultProperty", "data")
 
 public:
@@ -80,17 +85,41 @@ public:
     bool isVisible() const;
     void setVisible(bool visible);
 
+    QAbstractItemModel *model() const;
+    void setModel(QAbstractItemModel *model);
+
+    QString filePathRole() const;
+    void setFilePathRole(const QString &role);
+    QString titleRole() const;
+    void setTitleRole(const QString &role);
+    QString argumentsRole() const;
+    void setArgumentsRole(const QString &role);
+    QString iconRole() const;
+    void setIconRole(const QString &role);
+
     QQmlListProperty<QObject> data();
     QQmlListProperty<QQuickJumpListItem> items();
 
-    QList<QWinJumpListItem *> toItemList() const;
+    void attach(QQuickJumpListBackend::Category *category);
+    void detach();
 
 Q_SIGNALS:
     void itemsChanged();
     void titleChanged();
     void visibilityChanged();
+    Q_REVISION(1) void modelChanged();
+    Q_REVISION(1) void filePathRoleChanged();
+    Q_REVISION(1) void titleRoleChanged();
+    Q_REVISION(1) void argumentsRoleChanged();
+    Q_REVISION(1) void iconRoleChanged();
 
 private:
+    enum ModelRole { FilePathRole, TitleRole, ArgumentsRole, IconRole, ModelRoleCount };
+
+    void setModelRole(ModelRole role, const QString &name);
+    int resolveRole(ModelRole role) const;
+    void updateModel(bool force);
+
     static void data_append(QQmlListProperty<QObject> *property, QObject *object);
     static int items_count(QQmlListProperty<QQuickJumpListItem> *property);
     static QQuickJumpListItem *items_at(QQmlListProperty<QQuickJumpListItem> *property, int index);
@@ -98,6 +127,10 @@ private:
     bool m_visible;
     QString m_title;
     QList<QQuickJumpListItem *> m_items;
+    QPointer<QAbstractItemModel> m_model;
+    QString m_roleNames[ModelRoleCount];
+    int m_roles[ModelRoleCount];
+    QQuickJumpListBackend::Category *m_backend;
 };
 
 QT_END_NAMESPACE
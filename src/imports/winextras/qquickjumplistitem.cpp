@@ -39,12 +39,13 @@
  ****************************************************************************/
 
 #include "qquickjumplistitem_p.h"
+#include <QMetaProperty>
 #include <QVariant>
 
 QT_BEGIN_NAMESPACE
 
 QQuickJumpListItem::QQuickJumpListItem(QObject *parent) :
-    QObject(parent)
+    QObject(parent), m_type(ItemTypeSeparator), m_item(0)
 {
 }
 
@@ -62,25 +63,101 @@ void QQuickJumpListItem::setType(int type)
     m_type = type;
 }
 
-QWinJumpListItem *QQuickJumpListItem::toJumpListItem() const
+// The properties are declared in QML by JumpListLink and JumpListDestination.
+// They are looked up once, when the item is attached; afterwards a change
+// updates its own field of the backend item only.
+void QQuickJumpListItem::attach(QQuickJumpListBackend::Category *category)
 {
-    QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Separator);
+    static const char *const linkProperties[FieldCount] = {
+        "executablePath", "arguments", "description", "title", "iconPath"
+    };
+    static const char *const destinationProperties[FieldCount] = { "filePath" };
+    static const int firstUpdater = staticMetaObject.indexOfSlot("updateFilePath()");
+
+    const char *const *names = 0;
+    QQuickJumpListBackend::ItemType type = QQuickJumpListBackend::Separator;
     switch (m_type) {
     case ItemTypeDestination:
-        item->setType(QWinJumpListItem::Destination);
-        item->setFilePath(property("filePath").toString());
+        type = QQuickJumpListBackend::Destination;
+        names = destinationProperties;
         break;
     case ItemTypeLink:
-        item->setType(QWinJumpListItem::Link);
-        item->setFilePath(property("executablePath").toString());
-        item->setArguments(QStringList(property("arguments").toStringList()));
-        item->setDescription(property("description").toString());
-        item->setTitle(property("title").toString());
-        item->setIcon(QIcon(property("iconPath").toString()));
+        type = QQuickJumpListBackend::Link;
+        names = linkProperties;
         break;
     }
 
-    return item;
+    m_item = category->addItem(type);
+    const QMetaObject *metaObject = this->metaObject();
+    for (int field = 0; field < FieldCount; ++field) {
+        m_properties[field] = names && names[field] ? metaObject->indexOfProperty(names[field]) : -1;
+        if (m_properties[field] < 0)
+            continue;
+        const QMetaProperty property = metaObject->property(m_properties[field]);
+        if (property.hasNotifySignal())
+            connect(this, property.notifySignal(), this, staticMetaObject.method(firstUpdater + field));
+        update(Field(field));
+    }
+}
+
+// The backend item is gone, or about to be.
+void QQuickJumpListItem::detach()
+{
+    if (m_item) {
+        disconnect(this, 0, this, 0);
+        m_item = 0;
+    }
+}
+
+void QQuickJumpListItem::updateFilePath()
+{
+    update(FilePath);
+}
+
+void QQuickJumpListItem::updateArguments()
+{
+    update(Arguments);
+}
+
+void QQuickJumpListItem::updateDescription()
+{
+    update(Description);
+}
+
+void QQuickJumpListItem::updateTitle()
+{
+    update(Title);
+}
+
+void QQuickJumpListItem::updateIconPath()
+{
+    update(IconPath);
+}
+
+void QQuickJumpListItem::update(Field field)
+{
+    if (!m_item || m_properties[field] < 0)
+        return;
+    const QVariant value = metaObject()->property(m_properties[field]).read(this);
+    switch (field) {
+    case FilePath:
+        m_item->setFilePath(value.toString());
+        break;
+    case Arguments:
+        m_item->setArguments(value.toStringList());
+        break;
+    case Description:
+        m_item->setDescription(value.toString());
+        break;
+    case Title:
+        m_item->setTitle(value.toString());
+        break;
+    case IconPath:
+        m_item->setIconPath(value.toString());
+        break;
+    case FieldCount:
+        break;
+    }
 }
 
 QT_END_NAMESPACE
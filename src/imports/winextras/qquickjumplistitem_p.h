@@ -52,8 +52,9 @@
 // We mean it.
 //
 
+#include "qquickjumplistbackend_p.h"
+
 #include <QObject>
-#include <QWinJumpListItem>
 
 QT_BEGIN_NAMESPACE
 
@@ -76,10 +77,25 @@ public:
     int type() const;
     void setType(int type);
 
-    QWinJumpListItem *toJumpListItem() const;
+    void attach(QQuickJumpListBackend::Category *category);
+    void detach();
+
+private Q_SLOTS:
+    // In the order of Field.
+    void updateFilePath();
+    void updateArguments();
+    void updateDescription();
+    void updateTitle();
+    void updateIconPath();
 
 private:
+    enum Field { FilePath, Arguments, Description, Title, IconPath, FieldCount };
+
+    void update(Field field);
+
     int m_type; // 1 - link, 2 - destination
+    QQuickJumpListBackend::Item *m_item;
+    int m_properties[FieldCount];
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,167 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickjumplistshellbackend_p.h"
+
+#include <QIcon>
+#include <QWinJumpListCategory>
+#include <QWinJumpListItem>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_ASSERT(int(QQuickJumpListBackend::Link) == int(QWinJumpListItem::Link));
+Q_STATIC_ASSERT(int(QQuickJumpListBackend::Separator) == int(QWinJumpListItem::Separator));
+
+// The setters of QWinJumpListItem only invalidate the jump list when the
+// value changes.
+class QQuickJumpListShellItem : public QQuickJumpListBackend::Item
+{
+public:
+    explicit QQuickJumpListShellItem(QWinJumpListItem *item) : m_item(item) {}
+
+    void setFilePath(const QString &filePath) override { m_item->setFilePath(filePath); }
+    void setArguments(const QStringList &arguments) override { m_item->setArguments(arguments); }
+    void setDescription(const QString &description) override { m_item->setDescription(description); }
+    void setTitle(const QString &title) override { m_item->setTitle(title); }
+
+    // Icons are compared by their cache keys, which differ for every QIcon.
+    void setIconPath(const QString &iconPath) override
+    {
+        if (m_iconPath != iconPath) {
+            m_iconPath = iconPath;
+            m_item->setIcon(iconPath.isEmpty() ? QIcon() : QIcon(iconPath));
+        }
+    }
+
+private:
+    QWinJumpListItem *m_item;
+    QString m_iconPath;
+};
+
+class QQuickJumpListShellCategory : public QQuickJumpListBackend::Category
+{
+public:
+    explicit QQuickJumpListShellCategory(QWinJumpListCategory *category) : m_category(category) {}
+    ~QQuickJumpListShellCategory() { qDeleteAll(m_items); }
+
+    void setTitle(const QString &title) override
+    {
+        if (m_category->type() == QWinJumpListCategory::Custom)
+            m_category->setTitle(title);
+    }
+
+    void setVisible(bool visible) override { m_category->setVisible(visible); }
+
+    QQuickJumpListBackend::Item *addItem(QQuickJumpListBackend::ItemType type) override
+    {
+        QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Type(type));
+        m_category->addItem(item);
+        m_items.append(new QQuickJumpListShellItem(item));
+        return m_items.constLast();
+    }
+
+    // The roles go first, so that a new model is read once.
+    void setModel(QAbstractItemModel *model, int filePathRole, int titleRole,
+                  int argumentsRole, int iconRole) override
+    {
+        m_category->setFilePathRole(filePathRole);
+        m_category->setTitleRole(titleRole);
+        m_category->setArgumentsRole(argumentsRole);
+        m_category->setIconRole(iconRole);
+        m_category->setModel(model);
+    }
+
+    void clear() override
+    {
+        m_category->setModel(nullptr);
+        m_category->clear();
+        qDeleteAll(m_items);
+        m_items.clear();
+    }
+
+private:
+    QWinJumpListCategory *m_category;
+    QVector<QQuickJumpListShellItem *> m_items;
+};
+
+QQuickJumpListBackend *QQuickJumpListBackend::create()
+{
+    return new QQuickJumpListShellBackend;
+}
+
+QQuickJumpListShellBackend::QQuickJumpListShellBackend()
+{
+    m_jumpList.setMinimumRebuildInterval(FrameInterval);
+}
+
+// Only the wrappers go here; the jump list commits pending changes when it
+// is destroyed after them.
+QQuickJumpListShellBackend::~QQuickJumpListShellBackend()
+{
+    qDeleteAll(m_categories);
+}
+
+QQuickJumpListBackend::Category *QQuickJumpListShellBackend::recent()
+{
+    if (!m_recent)
+        m_recent.reset(new QQuickJumpListShellCategory(m_jumpList.recent()));
+    return m_recent.data();
+}
+
+QQuickJumpListBackend::Category *QQuickJumpListShellBackend::frequent()
+{
+    if (!m_frequent)
+        m_frequent.reset(new QQuickJumpListShellCategory(m_jumpList.frequent()));
+    return m_frequent.data();
+}
+
+QQuickJumpListBackend::Category *QQuickJumpListShellBackend::tasks()
+{
+    if (!m_tasks)
+        m_tasks.reset(new QQuickJumpListShellCategory(m_jumpList.tasks()));
+    return m_tasks.data();
+}
+
+QQuickJumpListBackend::Category *QQuickJumpListShellBackend::addCategory()
+{
+    m_categories.append(new QQuickJumpListShellCategory(m_jumpList.addCategory(QString())));
+    return m_categories.constLast();
+}
+
+QT_END_NAMESPACE
@@ -1,7 +1,7 @@
 CXX_MODULE = qml
 TARGET  = qml_winextras
 TARGETPATH = QtWinExtras
-IMPORT_VERSION = 1.0
+IMPORT_VERSION = 1.1
 
 QT += qml quick winextras winextras-private
 
@@ -19,6 +19,8 @@ HEADERS += \
     qquickjumplist_p.h \
     qquickjumplistitem_p.h \
     qquickjumplistcategory_p.h \
+    qquickjumplistbackend_p.h \
+    qquickjumplistshellbackend_p.h \
     qquickthumbnailtoolbar_p.h \
     qquickthumbnailtoolbutton_p.h \
     qquickiconloader_p.h \
@@ -31,6 +33,7 @@ SOURCES += \
     qquickjumplist.cpp \
     qquickjumplistitem.cpp \
     qquickjumplistcategory.cpp \
+    qquickjumplistshellbackend.cpp \
     qquickthumbnailtoolbar.cpp \
     qquickthumbnailtoolbutton.cpp \
     qquickiconloader.cpp
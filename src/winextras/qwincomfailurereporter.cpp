@@ -0,0 +1,280 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwincomfailurereporter_p.h"
+#include "qwinhresultnames_p.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qglobalstatic.h>
+#include <QtCore/qlogging.h>
+#include <QtCore/qtimer.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_ASSERT((QWinComFailureReporter::HistorySize & (QWinComFailureReporter::HistorySize - 1)) == 0);
+
+bool operator==(const QWinComFailureReporter::Key &a, const QWinComFailureReporter::Key &b)
+{
+    return a.hresult == b.hresult && qstrcmp(a.site, b.site) == 0 && qstrcmp(a.component, b.component) == 0;
+}
+
+// Hashes the strings rather than their addresses, as equal literals in
+// different translation units need not be merged.
+uint qHash(const QWinComFailureReporter::Key &key, uint seed)
+{
+    seed = qHashBits(key.component, qstrlen(key.component), seed);
+    seed = qHashBits(key.site, qstrlen(key.site), seed);
+    return qHash(key.hresult, seed);
+}
+
+Q_GLOBAL_STATIC(QWinComFailureReporter, comFailureReporter)
+
+QWinComFailureReporter::QWinComFailureReporter()
+    : m_clock(&QDateTime::currentMSecsSinceEpoch)
+    , m_sink([](const QByteArray &message) { qWarning("%s", message.constData()); })
+{
+}
+
+static void flushExpiredComFailures()
+{
+    if (comFailureReporter.exists())
+        comFailureReporter()->flushExpired();
+}
+
+static void flushComFailures()
+{
+    if (comFailureReporter.exists())
+        comFailureReporter()->flush();
+}
+
+// Failures are mostly reported on worker threads without an event loop.
+static void startComFailureTimer(int msecs)
+{
+    if (QCoreApplication *application = QCoreApplication::instance()) {
+        QMetaObject::invokeMethod(application, [msecs]() {
+            QTimer::singleShot(msecs, Qt::PreciseTimer, &flushExpiredComFailures);
+        }, Qt::QueuedConnection);
+    }
+}
+
+QWinComFailureReporter *QWinComFailureReporter::instance()
+{
+    static const bool initialized = []() {
+        comFailureReporter()->setTimer(&startComFailureTimer);
+        qAddPostRoutine(&flushComFailures);
+        return true;
+    }();
+    Q_UNUSED(initialized);
+    return comFailureReporter();
+}
+
+void QWinComFailureReporter::setClock(const Clock &clock)
+{
+    QMutexLocker locker(&m_mutex);
+    m_clock = clock;
+}
+
+void QWinComFailureReporter::setSink(const Sink &sink)
+{
+    QMutexLocker locker(&m_mutex);
+    m_sink = sink;
+}
+
+void QWinComFailureReporter::setTimer(const Timer &timer)
+{
+    QMutexLocker locker(&m_mutex);
+    m_timer = timer;
+}
+
+void QWinComFailureReporter::setInitialBackoff(int milliseconds)
+{
+    QMutexLocker locker(&m_mutex);
+    m_initialBackoff = qMax(milliseconds, 0);
+}
+
+void QWinComFailureReporter::setMaximumBackoff(int milliseconds)
+{
+    QMutexLocker locker(&m_mutex);
+    m_maximumBackoff = qMax(milliseconds, 0);
+}
+
+bool QWinComFailureReporter::report(const char *component, const char *site, quint32 hresult)
+{
+    const Key key = { component, site, hresult };
+    QMutexLocker locker(&m_mutex);
+    const qint64 now = m_clock();
+    record(key, now);
+
+    State &state = m_states[key];
+    const bool fresh = state.backoff == 0 || now - state.last >= m_maximumBackoff;
+    state.last = now;
+    if (!fresh && now < state.nextAllowed) {
+        ++m_statistics.suppressed;
+        // The first suppressed failure asks for a summary when the backoff
+        // expires, in case no later failure logs it.
+        if (++state.suppressed == 1 && m_timer) {
+            const Timer timer = m_timer;
+            const int delay = int(state.nextAllowed - now);
+            locker.unlock();
+            timer(delay);
+        }
+        return false;
+    }
+
+    ++m_statistics.logged;
+    const QByteArray text = message(key, state.suppressed);
+    state.backoff = fresh ? qMax(m_initialBackoff, 1) : qMin(state.backoff * 2, qMax(m_maximumBackoff, 1));
+    state.nextAllowed = now + state.backoff;
+    state.suppressed = 0;
+    const Sink sink = m_sink;
+    locker.unlock();
+    sink(text);
+    return true;
+}
+
+int QWinComFailureReporter::flush()
+{
+    return summarize(false);
+}
+
+int QWinComFailureReporter::flushExpired()
+{
+    return summarize(true);
+}
+
+int QWinComFailureReporter::summarize(bool expiredOnly)
+{
+    QMutexLocker locker(&m_mutex);
+    const qint64 now = expiredOnly ? m_clock() : 0;
+    qint64 nextExpiry = 0;
+    QVector<QByteArray> summaries;
+    for (auto it = m_states.begin(), end = m_states.end(); it != end; ++it) {
+        if (it.value().suppressed == 0)
+            continue;
+        if (expiredOnly && now < it.value().nextAllowed) {
+            if (nextExpiry == 0 || it.value().nextAllowed < nextExpiry)
+                nextExpiry = it.value().nextAllowed;
+            continue;
+        }
+        const Key &key = it.key();
+        QByteArray summary = QByteArray(key.component) + ": " + key.site + " failed "
+                             + QByteArray::number(it.value().suppressed) + " more time";
+        if (it.value().suppressed > 1)
+            summary += 's';
+        char value[11];
+        qsnprintf(value, sizeof(value), "0x%08x", key.hresult);
+        summary += " with " + QByteArray(value);
+        const QLatin1String name = QWinHResultNames::name(key.hresult);
+        if (!name.isEmpty())
+            summary += ", " + QByteArray(name.data(), name.size());
+        summary += '.';
+        summaries.append(summary);
+        it.value().suppressed = 0;
+    }
+    const Sink sink = m_sink;
+    const Timer timer = nextExpiry && m_timer ? m_timer : Timer();
+    locker.unlock();
+
+    for (const QByteArray &summary : qAsConst(summaries))
+        sink(summary);
+    if (timer)
+        timer(int(nextExpiry - now));
+    return summaries.size();
+}
+
+QByteArray QWinComFailureReporter::message(const Key &key, int suppressed)
+{
+    char value[11];
+    qsnprintf(value, sizeof(value), "0x%08x", key.hresult);
+    QByteArray result = QByteArray(key.component) + ": " + key.site + " failed: " + value;
+    const QLatin1String name = QWinHResultNames::name(key.hresult);
+    if (!name.isEmpty())
+        result += ", " + QByteArray(name.data(), name.size());
+    if (suppressed)
+        result += " (" + QByteArray::number(suppressed) + " similar failures suppressed)";
+    result += '.';
+    return result;
+}
+
+// Writers claim a slot by incrementing the head; the slot's sequence is odd
+// while it is written and 2 * (index + 1) once complete, so that readers can
+// detect slots that were overwritten while they read them. Writers are
+// serialized by the mutex; readers never block.
+void QWinComFailureReporter::record(const Key &key, qint64 now)
+{
+    const quint32 index = m_head.fetchAndAddRelaxed(1);
+    Slot &slot = m_history[index % HistorySize];
+    slot.sequence.storeRelease(2 * index + 1);
+    slot.component.storeRelease(key.component);
+    slot.site.storeRelease(key.site);
+    slot.hresult.storeRelease(key.hresult);
+    slot.timestamp.storeRelease(now);
+    slot.sequence.storeRelease(2 * index + 2);
+}
+
+QVector<QWinComFailureReporter::Failure> QWinComFailureReporter::recentFailures() const
+{
+    QVector<Failure> result;
+    const quint32 head = m_head.loadAcquire();
+    const quint32 count = qMin(head, quint32(HistorySize));
+    result.reserve(int(count));
+    for (quint32 index = head - count; index != head; ++index) {
+        const Slot &slot = m_history[index % HistorySize];
+        const quint32 sequence = slot.sequence.loadAcquire();
+        if (sequence != 2 * index + 2)
+            continue; // still being written, or already overwritten
+        const Failure failure = { slot.component.loadAcquire(), slot.site.loadAcquire(),
+                                  slot.hresult.loadAcquire(), slot.timestamp.loadAcquire() };
+        if (slot.sequence.loadAcquire() != sequence)
+            continue;
+        result.append(failure);
+    }
+    return result;
+}
+
+QWinComFailureReporter::Statistics QWinComFailureReporter::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_statistics;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,182 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINCOMFAILUREREPORTER_P_H
+#define QWINCOMFAILUREREPORTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+// Logs failed COM and shell calls without flooding the log: repeats of a
+// failure at the same call site are suppressed with exponentially growing
+// intervals, and the next message logged for it says how many were
+// suppressed, or a summary says so once the backoff expired without another
+// failure. Every failure, logged or not, is recorded in a ring buffer of
+// the most recent ones; writers are serialized by the lock, while
+// recentFailures() reads it without taking the lock. component and site
+// must be string literals or otherwise outlive the reporter. Thread-safe;
+// the sink and the timer are called without holding the lock.
+class QWinComFailureReporter
+{
+public:
+    struct Failure
+    {
+        const char *component;
+        const char *site;
+        quint32 hresult;
+        qint64 timestamp; // milliseconds, as returned by the clock
+    };
+
+    struct Statistics
+    {
+        quint64 logged = 0;
+        quint64 suppressed = 0;
+    };
+
+    typedef std::function<qint64()> Clock;
+    typedef std::function<void(const QByteArray &message)> Sink;
+    // Asks for flushExpired() to be called after msecs milliseconds.
+    typedef std::function<void(int msecs)> Timer;
+
+    enum {
+        HistorySize = 64,
+        DefaultInitialBackoff = 1000,  // milliseconds
+        DefaultMaximumBackoff = 60000
+    };
+
+    QWinComFailureReporter();
+
+    static QWinComFailureReporter *instance();
+
+    // Defaults to QDateTime::currentMSecsSinceEpoch() and qWarning().
+    void setClock(const Clock &clock);
+    void setSink(const Sink &sink);
+    // None by default; instance() uses a single-shot timer on the thread of
+    // the application, and flushes when the application exits.
+    void setTimer(const Timer &timer);
+
+    int initialBackoff() const { return m_initialBackoff; }
+    void setInitialBackoff(int milliseconds);
+    // Also the quiet period after which a call site starts over.
+    int maximumBackoff() const { return m_maximumBackoff; }
+    void setMaximumBackoff(int milliseconds);
+
+    // Records a failure of site and logs "component: site failed: hresult,
+    // name." unless it is suppressed. Returns whether it was logged.
+    bool report(const char *component, const char *site, quint32 hresult);
+
+    // Logs a summary for every call site with suppressed failures that were
+    // not mentioned yet; returns the number of summaries.
+    int flush();
+    // Logs the summaries of the call sites whose backoff expired, and asks
+    // the timer again for those whose backoff did not.
+    int flushExpired();
+
+    // The most recent failures, oldest first.
+    QVector<Failure> recentFailures() const;
+
+    Statistics statistics() const;
+
+private:
+    Q_DISABLE_COPY(QWinComFailureReporter)
+
+    struct Key
+    {
+        const char *component;
+        const char *site;
+        quint32 hresult;
+    };
+    friend bool operator==(const Key &a, const Key &b);
+    friend uint qHash(const Key &key, uint seed);
+
+    struct State
+    {
+        qint64 last = 0;
+        qint64 nextAllowed = 0;
+        int backoff = 0;
+        int suppressed = 0;
+    };
+
+    struct Slot
+    {
+        QAtomicInteger<quint32> sequence;
+        QAtomicPointer<const char> component;
+        QAtomicPointer<const char> site;
+        QAtomicInteger<quint32> hresult;
+        QAtomicInteger<qint64> timestamp;
+    };
+
+    void record(const Key &key, qint64 now);
+    static QByteArray message(const Key &key, int suppressed);
+    int summarize(bool expiredOnly);
+
+    mutable QMutex m_mutex;
+    Clock m_clock;
+    Sink m_sink;
+    Timer m_timer;
+    int m_initialBackoff = DefaultInitialBackoff;
+    int m_maximumBackoff = DefaultMaximumBackoff;
+    QHash<Key, State> m_states;
+    Statistics m_statistics;
+
+    QAtomicInteger<quint32> m_head;
+    Slot m_history[HistorySize];
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINCOMFAILUREREPORTER_P_H
@@ -0,0 +1,210 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwincommandline_p.h"
+
+QT_BEGIN_NAMESPACE
+
+namespace QWinCommandLine {
+
+static inline bool isSpace(ushort c)
+{
+    return c == ' ' || c == '\t';
+}
+
+static bool needsQuotes(const QChar *begin, const QChar *end)
+{
+    if (begin == end)
+        return true;
+    for (const QChar *c = begin; c != end; ++c) {
+        if (isSpace(c->unicode()))
+            return true;
+    }
+    return false;
+}
+
+// The number of characters appendQuoted() writes. Backslashes are doubled
+// when they precede a quote, or the closing quote of a quoted argument.
+static int quotedSize(const QChar *begin, const QChar *end, bool quoted)
+{
+    int size = int(end - begin) + (quoted ? 2 : 0);
+    int backslashes = 0;
+    for (const QChar *c = begin; c != end; ++c) {
+        const ushort u = c->unicode();
+        if (u == '\\') {
+            ++backslashes;
+            continue;
+        }
+        if (u == '"')
+            size += backslashes + 1;
+        backslashes = 0;
+    }
+    if (quoted)
+        size += backslashes;
+    return size;
+}
+
+static QChar *appendQuoted(QChar *out, const QChar *begin, const QChar *end, bool quoted)
+{
+    if (quoted)
+        *out++ = QLatin1Char('"');
+    int backslashes = 0;
+    for (const QChar *c = begin; c != end; ++c) {
+        const ushort u = c->unicode();
+        if (u == '\\') {
+            ++backslashes;
+        } else {
+            if (u == '"') {
+                for (int i = 0; i <= backslashes; ++i)
+                    *out++ = QLatin1Char('\\');
+            }
+            backslashes = 0;
+        }
+        *out++ = *c;
+    }
+    if (quoted) {
+        for (int i = 0; i < backslashes; ++i)
+            *out++ = QLatin1Char('\\');
+        *out++ = QLatin1Char('"');
+    }
+    return out;
+}
+
+QString quoteArgument(const QString &argument)
+{
+    const QChar *begin = argument.constData();
+    const QChar *end = begin + argument.size();
+    const bool quoted = needsQuotes(begin, end);
+    const int size = quotedSize(begin, end, quoted);
+    if (!quoted && size == argument.size())
+        return argument;
+    QString result(size, Qt::Uninitialized);
+    appendQuoted(result.data(), begin, end, quoted);
+    return result;
+}
+
+int joinedSize(const QStringList &arguments)
+{
+    if (arguments.isEmpty())
+        return 0;
+    int size = arguments.size() - 1;
+    for (const QString &argument : arguments) {
+        const QChar *begin = argument.constData();
+        const QChar *end = begin + argument.size();
+        size += quotedSize(begin, end, needsQuotes(begin, end));
+    }
+    return size;
+}
+
+QChar *join(const QStringList &arguments, QChar *out)
+{
+    for (int i = 0; i < arguments.size(); ++i) {
+        if (i)
+            *out++ = QLatin1Char(' ');
+        const QString &argument = arguments.at(i);
+        const QChar *begin = argument.constData();
+        const QChar *end = begin + argument.size();
+        out = appendQuoted(out, begin, end, needsQuotes(begin, end));
+    }
+    return out;
+}
+
+// Two passes: one to size the result exactly, one to write it.
+QString join(const QStringList &arguments)
+{
+    if (arguments.isEmpty())
+        return QString();
+    const int size = joinedSize(arguments);
+    QString result(size, Qt::Uninitialized);
+    QChar *end = join(arguments, result.data());
+    Q_ASSERT(end == result.constData() + size);
+    Q_UNUSED(end);
+    return result;
+}
+
+QStringList split(const QString &commandLine)
+{
+    QStringList arguments;
+    const QChar *c = commandLine.constData();
+    const QChar *end = c + commandLine.size();
+    QString argument;
+    for (;;) {
+        while (c != end && isSpace(c->unicode()))
+            ++c;
+        if (c == end)
+            break;
+
+        argument.clear();
+        bool inQuotes = false;
+        while (c != end && (inQuotes || !isSpace(c->unicode()))) {
+            const ushort u = c->unicode();
+            if (u == '\\') {
+                const QChar *run = c;
+                while (c != end && c->unicode() == '\\')
+                    ++c;
+                const int backslashes = int(c - run);
+                if (c != end && c->unicode() == '"') {
+                    argument.append(QString(backslashes / 2, QLatin1Char('\\')));
+                    if (backslashes % 2) {
+                        argument.append(QLatin1Char('"'));
+                        ++c;
+                    }
+                } else {
+                    argument.append(run, backslashes);
+                }
+            } else if (u == '"') {
+                ++c;
+                if (inQuotes && c != end && c->unicode() == '"') {
+                    argument.append(QLatin1Char('"'));
+                    ++c;
+                } else {
+                    inQuotes = !inQuotes;
+                }
+            } else {
+                argument.append(*c++);
+            }
+        }
+        arguments.append(argument);
+    }
+    return arguments;
+}
+
+} // namespace QWinCommandLine
+
+QT_END_NAMESPACE
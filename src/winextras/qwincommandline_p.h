@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINCOMMANDLINE_P_H
+#define QWINCOMMANDLINE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+// Command lines as parsed by the Microsoft C runtime: arguments are
+// separated by spaces and tabs unless quoted, 2n backslashes followed by a
+// quote are n backslashes and a quote delimiter, 2n + 1 backslashes followed
+// by a quote are n backslashes and a literal quote, other backslashes are
+// literal, and "" within quotes is a literal quote. The program name, which
+// follows different rules, is not part of the command lines handled here.
+namespace QWinCommandLine
+{
+    // Joins arguments with spaces, quoting and escaping only where needed,
+    // so that split() returns them unchanged.
+    QString join(const QStringList &arguments);
+    // The same in two steps, for writing into storage of the caller: join()
+    // writes joinedSize() characters, without a terminator, and returns the
+    // end of what it wrote.
+    int joinedSize(const QStringList &arguments);
+    QChar *join(const QStringList &arguments, QChar *out);
+    QString quoteArgument(const QString &argument);
+
+    QStringList split(const QString &commandLine);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINCOMMANDLINE_P_H
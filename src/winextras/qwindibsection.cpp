@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwindibsection_p.h"
+
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+void *QWinMallocDibAllocator::allocate(const QWinDibLayout &layout, uchar **bits)
+{
+    if (!layout.isValid())
+        return nullptr;
+    void *memory = malloc(size_t(layout.byteCount()));
+    *bits = static_cast<uchar *>(memory);
+    return memory;
+}
+
+void QWinMallocDibAllocator::release(void *handle)
+{
+    free(handle);
+}
+
+namespace {
+struct DibSectionRef
+{
+    QWinDibAllocator *allocator;
+    void *handle;
+};
+} // namespace
+
+static void releaseDibSection(void *info)
+{
+    DibSectionRef *ref = static_cast<DibSectionRef *>(info);
+    ref->allocator->release(ref->handle);
+    delete ref;
+}
+
+QImage QWinDibSection::wrap(uchar *bits, const QWinDibLayout &layout, QImage::Format format,
+                            QWinDibAllocator *allocator, void *handle)
+{
+    if (!bits || !layout.isValid())
+        return QImage();
+    if (!allocator)
+        return QImage(bits, layout.width, layout.height, layout.bytesPerLine(), format);
+
+    DibSectionRef *ref = new DibSectionRef;
+    ref->allocator = allocator;
+    ref->handle = handle;
+    QImage image(bits, layout.width, layout.height, layout.bytesPerLine(), format,
+                 releaseDibSection, ref);
+    if (image.isNull()) // QImage does not call the cleanup function; the caller keeps handle
+        delete ref;
+    return image;
+}
+
+QImage QWinDibSection::create(const QWinDibLayout &layout, QImage::Format format,
+                              QWinDibAllocator *allocator, void **handle)
+{
+    uchar *bits = nullptr;
+    void *newHandle = allocator->allocate(layout, &bits);
+    if (!newHandle) {
+        *handle = nullptr;
+        return QImage();
+    }
+    const QImage image = wrap(bits, layout, format, allocator, newHandle);
+    if (image.isNull()) {
+        allocator->release(newHandle);
+        *handle = nullptr;
+        return image;
+    }
+    *handle = newHandle;
+    return image;
+}
+
+QT_END_NAMESPACE
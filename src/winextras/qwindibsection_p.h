@@ -0,0 +1,122 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINDIBSECTION_P_H
+#define QWINDIBSECTION_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtGui/qimage.h>
+
+QT_BEGIN_NAMESPACE
+
+// Layout of the pixel buffer of a 32bpp DIB section. DIB scan lines are
+// DWORD aligned, which for 32bpp matches QImage's scan line alignment.
+struct QWinDibLayout
+{
+    int width = 0;
+    int height = 0;
+    bool bottomUp = false;
+
+    static QWinDibLayout fromBitmapInfo(int biWidth, int biHeight)
+    {
+        QWinDibLayout layout;
+        layout.width = biWidth;
+        layout.height = biHeight < 0 ? -biHeight : biHeight;
+        layout.bottomUp = biHeight > 0;
+        return layout;
+    }
+
+    bool isValid() const { return width > 0 && height > 0; }
+    int bytesPerLine() const { return ((width * 32 + 31) / 32) * 4; }
+    qsizetype byteCount() const { return qsizetype(bytesPerLine()) * height; }
+
+    // Scan line y counted from the top of the picture.
+    uchar *scanLine(uchar *bits, int y) const
+        { return bits + qsizetype(bottomUp ? height - 1 - y : y) * bytesPerLine(); }
+};
+
+// Allocates and frees DIB memory. The Windows implementation uses
+// CreateDIBSection()/DeleteObject(), QWinMallocDibAllocator stands in for it
+// on other platforms.
+class QWinDibAllocator
+{
+public:
+    virtual ~QWinDibAllocator() {}
+
+    // Returns an opaque handle of a new buffer and stores its bits in *bits,
+    // or returns nullptr on failure.
+    virtual void *allocate(const QWinDibLayout &layout, uchar **bits) = 0;
+    virtual void release(void *handle) = 0;
+};
+
+class QWinMallocDibAllocator : public QWinDibAllocator
+{
+public:
+    void *allocate(const QWinDibLayout &layout, uchar **bits) override;
+    void release(void *handle) override;
+};
+
+namespace QWinDibSection
+{
+    // Returns a QImage aliasing bits. If allocator is set, handle is released
+    // through it once the last copy of the image has been destroyed, so the
+    // buffer lives exactly as long as the view; a null image leaves handle
+    // to the caller. Scan lines of bottom-up layouts appear in reverse order.
+    QImage wrap(uchar *bits, const QWinDibLayout &layout, QImage::Format format,
+                QWinDibAllocator *allocator = nullptr, void *handle = nullptr);
+
+    // Allocates a buffer and returns an image aliasing it together with the
+    // handle, which stays valid as long as the image or any copy of it exists.
+    QImage create(const QWinDibLayout &layout, QImage::Format format,
+                  QWinDibAllocator *allocator, void **handle);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINDIBSECTION_P_H
@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwindocumentlist_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QWinDocumentList::QWinDocumentList(Type type, Provider *provider) :
+    m_type(type), m_provider(provider)
+{
+}
+
+void QWinDocumentList::setAppId(const QString &appId)
+{
+    if (m_appId != appId) {
+        m_appId = appId;
+        invalidate();
+    }
+}
+
+// The shell returns the most recent or most frequent entries first, so
+// entries read with a larger limit contain those of a smaller one.
+void QWinDocumentList::setLimit(int limit)
+{
+    limit = qMax(limit, 0);
+    if (m_limit == limit)
+        return;
+    m_limit = limit;
+    if (!m_loaded)
+        return;
+    if (limit && m_entries.size() >= limit) {
+        if (m_entries.size() > limit) {
+            m_entries.resize(limit);
+            m_complete = false;
+            ++m_generation;
+        }
+    } else if (!m_complete) {
+        invalidate();
+    }
+}
+
+const QVector<QWinDocumentList::Entry> &QWinDocumentList::entries()
+{
+    if (!m_loaded) {
+        // A failure is not retried until the list is invalidated.
+        ++m_readCount;
+        m_entries.clear();
+        if (!m_provider || !m_provider->read(m_type, m_appId, m_limit, &m_entries))
+            m_entries.clear();
+        if (m_limit && m_entries.size() > m_limit)
+            m_entries.resize(m_limit);
+        m_complete = !m_limit || m_entries.size() < m_limit;
+        m_loaded = true;
+        ++m_generation;
+    }
+    return m_entries;
+}
+
+void QWinDocumentList::setCleared()
+{
+    m_entries.clear();
+    m_loaded = true;
+    m_complete = true;
+    ++m_generation;
+}
+
+void QWinDocumentList::invalidate()
+{
+    if (!m_loaded)
+        return;
+    m_loaded = false;
+    m_complete = false;
+    m_entries.clear();
+    ++m_generation;
+}
+
+QT_END_NAMESPACE
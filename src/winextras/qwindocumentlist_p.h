@@ -0,0 +1,129 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINDOCUMENTLIST_P_H
+#define QWINDOCUMENTLIST_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// The recent or frequent documents the shell keeps for an application,
+// read the first time they are asked for and kept until invalidated.
+// Changing the application ID invalidates the list; changing the limit
+// only does so when the entries read so far do not cover the new limit.
+class QWinDocumentList
+{
+public:
+    enum Type { Recent, Frequent };
+
+    // Icons are kept as locations, so that only the items whose icon is
+    // asked for load one.
+    struct Entry
+    {
+        bool isLink = false; // a shell link, otherwise a file
+        QString filePath;
+        QString description;
+        QStringList arguments;
+        QString iconLocation;
+    };
+
+    class Provider
+    {
+    public:
+        virtual ~Provider() {}
+        // Reads at most limit entries, all of them for a limit of 0.
+        virtual bool read(Type type, const QString &appId, int limit, QVector<Entry> *entries) = 0;
+    };
+
+    // Does not take ownership of provider.
+    QWinDocumentList(Type type, Provider *provider);
+
+    Type type() const { return m_type; }
+
+    QString appId() const { return m_appId; }
+    void setAppId(const QString &appId);
+
+    // The maximum number of entries read, 0 for all.
+    int limit() const { return m_limit; }
+    void setLimit(int limit);
+
+    bool isLoaded() const { return m_loaded; }
+    const QVector<Entry> &entries();
+
+    // Takes the list as empty without reading it, as after the shell was
+    // told to remove all entries.
+    void setCleared();
+    void invalidate();
+
+    // Changes whenever the entries may have, so that objects made from
+    // them can tell when to be remade.
+    quint64 generation() const { return m_generation; }
+    quint64 readCount() const { return m_readCount; }
+
+private:
+    Type m_type;
+    Provider *m_provider;
+    QString m_appId;
+    int m_limit = 0;
+    bool m_loaded = false;
+    bool m_complete = false; // the entries are all there are
+    QVector<Entry> m_entries;
+    quint64 m_generation = 0;
+    quint64 m_readCount = 0;
+};
+
+Q_DECLARE_TYPEINFO(QWinDocumentList::Entry, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QWINDOCUMENTLIST_P_H
@@ -45,8 +45,11 @@
 #endif
 
 #include <QtCore/qobject.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
 #include <QtCore/qt_windows.h>
 #include <QtWinExtras/qwinextrasglobal.h>
+#include <QtWinExtras/qwinhresultinfo.h>
 #ifdef QT_WIDGETS_LIB
 #include <QtWidgets/qwidget.h>
 #endif
@@ -55,10 +58,10 @@ QT_BEGIN_NAMESPACE
 
 class QPixmap;
 class QImage;
+class QSize;
 class QBitmap;
 class QColor;
 class QWindow;
-class QString;
 class QMargins;
 
 namespace QtWin
@@ -78,16 +81,33 @@ namespace QtWin
     };
 
     Q_WINEXTRAS_EXPORT HBITMAP createMask(const QBitmap &bitmap);
+    Q_WINEXTRAS_EXPORT HBITMAP createMask(const QImage &image, int alphaThreshold = 128);
     Q_WINEXTRAS_EXPORT HBITMAP toHBITMAP(const QPixmap &p, HBitmapFormat format = HBitmapNoAlpha);
     Q_WINEXTRAS_EXPORT QPixmap fromHBITMAP(HBITMAP bitmap, HBitmapFormat format = HBitmapNoAlpha);
     Q_WINEXTRAS_EXPORT HICON toHICON(const QPixmap &p);
     Q_WINEXTRAS_EXPORT QImage imageFromHBITMAP(HDC hdc, HBITMAP bitmap, int width, int height);
+    Q_WINEXTRAS_EXPORT QImage imageFromDibSection(HBITMAP bitmap, HBitmapFormat format = HBitmapPremultipliedAlpha,
+                                                  bool *bottomUp = nullptr);
+    Q_WINEXTRAS_EXPORT HBITMAP createDibSection(const QSize &size, QImage *image,
+                                                HBitmapFormat format = HBitmapPremultipliedAlpha);
     Q_WINEXTRAS_EXPORT QPixmap fromHICON(HICON icon);
+    Q_WINEXTRAS_EXPORT QVector<HICON> toHICONs(const QVector<QPixmap> &pixmaps);
+    Q_WINEXTRAS_EXPORT QVector<QPixmap> fromHICONs(const HICON *icons, int count);
+    inline QVector<QPixmap> fromHICONs(const QVector<HICON> &icons)
+    {
+        return fromHICONs(icons.constData(), icons.size());
+    }
     Q_WINEXTRAS_EXPORT HRGN toHRGN(const QRegion &region);
     Q_WINEXTRAS_EXPORT QRegion fromHRGN(HRGN hrgn);
+    Q_WINEXTRAS_EXPORT QRegion simplifiedRegion(const QRegion &region, int maxRects, int tolerance = 0);
+    Q_WINEXTRAS_EXPORT QRegion regionFromAlpha(const QImage &image, int alphaThreshold = 128);
 
     Q_WINEXTRAS_EXPORT QString stringFromHresult(HRESULT hresult);
     Q_WINEXTRAS_EXPORT QString errorStringFromHresult(HRESULT hresult);
+    Q_WINEXTRAS_EXPORT QLatin1String errorLatin1StringFromHresult(HRESULT hresult);
+    Q_WINEXTRAS_EXPORT HRESULT hresultFromErrorString(QLatin1String errorString, bool *ok = nullptr);
+    Q_WINEXTRAS_EXPORT HRESULT hresultFromErrorString(const QString &errorString, bool *ok = nullptr);
+    Q_WINEXTRAS_EXPORT bool registerErrorString(HRESULT hresult, const QString &errorString);
 
     Q_WINEXTRAS_EXPORT QColor colorizationColor(bool *opaqueBlend = nullptr);
     Q_WINEXTRAS_EXPORT QColor realColorizationColor();
@@ -104,6 +124,9 @@ namespace QtWin
     Q_WINEXTRAS_EXPORT void resetExtendedFrame(QWindow *window);
 
     Q_WINEXTRAS_EXPORT void enableBlurBehindWindow(QWindow *window, const QRegion &region);
+    Q_WINEXTRAS_EXPORT void enableBlurBehindWindow(QWindow *window, const QRegion &region, int maxRects,
+                                                   int tolerance = 0);
+    Q_WINEXTRAS_EXPORT void enableBlurBehindWindow(QWindow *window, const QImage &alphaMask, int alphaThreshold = 128);
     Q_WINEXTRAS_EXPORT void enableBlurBehindWindow(QWindow *window);
     Q_WINEXTRAS_EXPORT void disableBlurBehindWindow(QWindow *window);
 
@@ -187,6 +210,18 @@ namespace QtWin
         enableBlurBehindWindow(window->windowHandle(), region);
     }
 
+    inline void enableBlurBehindWindow(QWidget *window, const QRegion &region, int maxRects, int tolerance = 0)
+    {
+        window->createWinId();
+        enableBlurBehindWindow(window->windowHandle(), region, maxRects, tolerance);
+    }
+
+    inline void enableBlurBehindWindow(QWidget *window, const QImage &alphaMask, int alphaThreshold = 128)
+    {
+        window->createWinId();
+        enableBlurBehindWindow(window->windowHandle(), alphaMask, alphaThreshold);
+    }
+
     inline void enableBlurBehindWindow(QWidget *window)
     {
         window->createWinId();
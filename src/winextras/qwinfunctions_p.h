@@ -76,6 +76,9 @@ namespace QtDwmApiDll
         { setWindowAttribute<BOOL>(hwnd, attribute, BOOL(value ? TRUE : FALSE)); }
 };
 
+void qt_initBitmapInfoHeader(int width, int height, BITMAPINFOHEADER *bih);
+HBITMAP qt_createDibSection(int width, int height, uchar **bits);
+
 inline void qt_qstringToNullTerminated(const QString &src, wchar_t *dst)
 {
     dst[src.toWCharArray(dst)] = 0;
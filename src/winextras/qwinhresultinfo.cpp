@@ -0,0 +1,310 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinhresultinfo.h"
+#include "qwinhresultnames_p.h"
+
+#include <QtCore/qdebug.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+struct FacilityName
+{
+    int facility;
+    const char *name;
+};
+
+} // namespace
+
+// The FACILITY_ macros of winerror.h without their prefix, sorted by value.
+// Where several macros share a value, the more common one is listed.
+static const FacilityName facilityNames[] = {
+    { 0, "NULL" },
+    { 1, "RPC" },
+    { 2, "DISPATCH" },
+    { 3, "STORAGE" },
+    { 4, "ITF" },
+    { 7, "WIN32" },
+    { 8, "WINDOWS" },
+    { 9, "SECURITY" },
+    { 10, "CONTROL" },
+    { 11, "CERT" },
+    { 12, "INTERNET" },
+    { 13, "MEDIASERVER" },
+    { 14, "MSMQ" },
+    { 15, "SETUPAPI" },
+    { 16, "SCARD" },
+    { 17, "COMPLUS" },
+    { 18, "AAF" },
+    { 19, "URT" },
+    { 20, "ACS" },
+    { 21, "DPLAY" },
+    { 22, "UMI" },
+    { 23, "SXS" },
+    { 24, "WINDOWS_CE" },
+    { 25, "HTTP" },
+    { 26, "USERMODE_COMMONLOG" },
+    { 27, "WER" },
+    { 31, "USERMODE_FILTER_MANAGER" },
+    { 32, "BACKGROUNDCOPY" },
+    { 33, "CONFIGURATION" },
+    { 34, "STATE_MANAGEMENT" },
+    { 35, "METADIRECTORY" },
+    { 36, "WINDOWSUPDATE" },
+    { 37, "DIRECTORYSERVICE" },
+    { 38, "GRAPHICS" },
+    { 39, "SHELL" },
+    { 40, "TPM_SERVICES" },
+    { 41, "TPM_SOFTWARE" },
+    { 48, "PLA" },
+    { 49, "FVE" },
+    { 50, "FWP" },
+    { 51, "WINRM" },
+    { 52, "NDIS" },
+    { 53, "USERMODE_HYPERVISOR" },
+    { 54, "CMI" },
+    { 55, "USERMODE_VIRTUALIZATION" },
+    { 56, "USERMODE_VOLMGR" },
+    { 57, "BCD" },
+    { 58, "USERMODE_VHD" },
+    { 60, "SDIAG" },
+    { 61, "WEBSERVICES" },
+    { 80, "WINDOWS_DEFENDER" },
+    { 81, "OPC" },
+    { 0x879, "DIRECT3D10" },
+    { 0x87a, "DXGI" },
+    { 0x87c, "DIRECT3D11" },
+    { 0x889, "AUDCLNT" },
+    { 0x898, "WINCODEC_ERR" },
+    { 0x899, "D2D" }
+};
+
+/*!
+    \class QtWin::HResultInfo
+    \inmodule QtWinExtras
+    \since 5.11.4
+    \brief The HResultInfo class decodes the fields of an HRESULT.
+
+    HResultInfo splits an HRESULT error id into its severity, customer bit,
+    facility and code, as the \c HRESULT_SEVERITY(), \c HRESULT_FACILITY()
+    and \c HRESULT_CODE() macros do. All accessors are \c constexpr and none
+    of the functions allocate memory, so the class can be used in constant
+    expressions and in logging or metrics code on hot paths.
+
+    \code
+    const QtWin::HResultInfo info(hresult);
+    if (info.isWin32Error() && info.code() == ERROR_FILE_NOT_FOUND)
+        ...
+    qCWarning(lcApp) << "Saving failed:" << info;
+    \endcode
+
+    The header does not depend on \c windows.h.
+
+    \sa QtWin::errorStringFromHresult()
+ */
+
+/*!
+    \enum QtWin::HResultInfo::Facility
+
+    Some of the facilities an HRESULT can belong to. facility() may return
+    other values as well.
+
+    \value FacilityNull     \c FACILITY_NULL, general codes such as \c E_FAIL.
+    \value FacilityRpc      \c FACILITY_RPC
+    \value FacilityDispatch \c FACILITY_DISPATCH, COM dispatch errors.
+    \value FacilityStorage  \c FACILITY_STORAGE, structured storage errors.
+    \value FacilityItf      \c FACILITY_ITF, interface specific codes.
+    \value FacilityWin32    \c FACILITY_WIN32, Win32 error codes.
+    \value FacilityWindows  \c FACILITY_WINDOWS
+    \value FacilitySecurity \c FACILITY_SECURITY
+    \value FacilityControl  \c FACILITY_CONTROL
+    \value FacilityInternet \c FACILITY_INTERNET
+    \value FacilityShell    \c FACILITY_SHELL
+    \value FacilityDxgi     \c FACILITY_DXGI
+    \value FacilityDirect2D \c FACILITY_D2D
+ */
+
+/*!
+    \fn QtWin::HResultInfo::HResultInfo()
+
+    Constructs an HResultInfo for \c S_OK.
+ */
+
+/*!
+    \fn QtWin::HResultInfo::HResultInfo(quint32 hresult)
+
+    Constructs an HResultInfo for \a hresult. An \c HRESULT can be passed
+    directly.
+ */
+
+/*!
+    \fn quint32 QtWin::HResultInfo::value() const
+
+    Returns the HRESULT.
+ */
+
+/*!
+    \fn int QtWin::HResultInfo::severity() const
+
+    Returns 1 for failure codes and 0 for success codes.
+ */
+
+/*!
+    \fn bool QtWin::HResultInfo::isFailure() const
+
+    Returns \c true if the severity bit is set, like the \c FAILED() macro.
+ */
+
+/*!
+    \fn bool QtWin::HResultInfo::isSuccess() const
+
+    Returns \c true if the severity bit is not set, like the \c SUCCEEDED()
+    macro.
+ */
+
+/*!
+    \fn bool QtWin::HResultInfo::isCustomer() const
+
+    Returns \c true if the customer bit is set, which marks codes defined by
+    applications rather than Microsoft.
+ */
+
+/*!
+    \fn bool QtWin::HResultInfo::isNtStatus() const
+
+    Returns \c true if the bit marking a mapped \c NTSTATUS value is set.
+ */
+
+/*!
+    \fn int QtWin::HResultInfo::facility() const
+
+    Returns the facility, like the \c HRESULT_FACILITY() macro.
+ */
+
+/*!
+    \fn int QtWin::HResultInfo::code() const
+
+    Returns the code within the facility, like the \c HRESULT_CODE() macro.
+ */
+
+/*!
+    \fn bool QtWin::HResultInfo::isWin32Error() const
+
+    Returns \c true if this is a failure of facility \c FACILITY_WIN32, in
+    which case code() is the Win32 error code.
+ */
+
+/*!
+    \fn QtWin::HResultInfo QtWin::HResultInfo::fromWin32Error(quint32 error)
+
+    Returns the HResultInfo for the Win32 \a error code, like the
+    \c HRESULT_FROM_WIN32() macro.
+ */
+
+/*!
+    Returns the name of \a facility as used in the \c FACILITY_ macros of
+    the Windows SDK without that prefix, for example \c WIN32, or a null
+    string if the facility is unknown.
+ */
+QLatin1String QtWin::HResultInfo::facilityName(int facility) Q_DECL_NOTHROW
+{
+    const FacilityName *end = facilityNames + sizeof(facilityNames) / sizeof(facilityNames[0]);
+    const FacilityName *entry =
+        std::lower_bound(facilityNames, end, facility,
+                         [](const FacilityName &entry, int facility) { return entry.facility < facility; });
+    if (entry == end || entry->facility != facility)
+        return QLatin1String();
+    return QLatin1String(entry->name);
+}
+
+/*!
+    \fn QLatin1String QtWin::HResultInfo::facilityName() const
+    \overload
+
+    Returns the name of the facility of this HRESULT.
+ */
+
+/*!
+    Returns the name of the Windows SDK macro for this HRESULT, for example
+    \c E_INVALIDARG, or a null string if it is unknown. Names registered with
+    QtWin::registerErrorString() are included.
+
+    \sa QtWin::errorLatin1StringFromHresult()
+ */
+QLatin1String QtWin::HResultInfo::name() const Q_DECL_NOTHROW
+{
+    return QWinHResultNames::name(m_value);
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+/*!
+    \relates QtWin::HResultInfo
+
+    Writes \a info to \a debug, including its name and fields.
+ */
+QDebug operator<<(QDebug debug, QtWin::HResultInfo info)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace();
+    debug.noquote();
+    char value[11];
+    qsnprintf(value, sizeof(value), "0x%08x", info.value());
+    debug << "QtWin::HResultInfo(" << value;
+    const QLatin1String name = info.name();
+    if (!name.isEmpty())
+        debug << ' ' << name;
+    debug << (info.isFailure() ? ", failure" : ", success");
+    if (info.isCustomer())
+        debug << ", customer";
+    debug << ", facility=";
+    const QLatin1String facilityName = info.facilityName();
+    if (!facilityName.isEmpty())
+        debug << facilityName << ' ';
+    debug << '(' << info.facility() << "), code=" << info.code() << ')';
+    return debug;
+}
+
+#endif // !QT_NO_DEBUG_STREAM
+
+QT_END_NAMESPACE
@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINHRESULTINFO_H
+#define QWINHRESULTINFO_H
+
+#include <QtCore/qstring.h>
+#include <QtWinExtras/qwinextrasglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+class QDebug;
+
+namespace QtWin
+{
+    class HResultInfo
+    {
+    public:
+        enum Facility {
+            FacilityNull = 0,
+            FacilityRpc = 1,
+            FacilityDispatch = 2,
+            FacilityStorage = 3,
+            FacilityItf = 4,
+            FacilityWin32 = 7,
+            FacilityWindows = 8,
+            FacilitySecurity = 9,
+            FacilityControl = 10,
+            FacilityInternet = 12,
+            FacilityShell = 39,
+            FacilityDxgi = 0x87a,
+            FacilityDirect2D = 0x899
+        };
+
+        Q_DECL_CONSTEXPR HResultInfo() Q_DECL_NOTHROW : m_value(0) {}
+        Q_DECL_CONSTEXPR explicit HResultInfo(quint32 hresult) Q_DECL_NOTHROW : m_value(hresult) {}
+
+        Q_DECL_CONSTEXPR quint32 value() const Q_DECL_NOTHROW { return m_value; }
+
+        Q_DECL_CONSTEXPR int severity() const Q_DECL_NOTHROW { return int(m_value >> 31); }
+        Q_DECL_CONSTEXPR bool isFailure() const Q_DECL_NOTHROW { return (m_value & 0x80000000u) != 0; }
+        Q_DECL_CONSTEXPR bool isSuccess() const Q_DECL_NOTHROW { return !isFailure(); }
+        Q_DECL_CONSTEXPR bool isCustomer() const Q_DECL_NOTHROW { return (m_value & 0x20000000u) != 0; }
+        Q_DECL_CONSTEXPR bool isNtStatus() const Q_DECL_NOTHROW { return (m_value & 0x10000000u) != 0; }
+        Q_DECL_CONSTEXPR int facility() const Q_DECL_NOTHROW { return int((m_value >> 16) & 0x1fff); }
+        Q_DECL_CONSTEXPR int code() const Q_DECL_NOTHROW { return int(m_value & 0xffff); }
+        Q_DECL_CONSTEXPR bool isWin32Error() const Q_DECL_NOTHROW
+        { return isFailure() && facility() == FacilityWin32; }
+
+        Q_DECL_CONSTEXPR static HResultInfo fromWin32Error(quint32 error) Q_DECL_NOTHROW
+        {
+            return HResultInfo(error == 0 || (error & 0x80000000u)
+                               ? error : (error & 0xffff) | (FacilityWin32 << 16) | 0x80000000u);
+        }
+
+        Q_WINEXTRAS_EXPORT static QLatin1String facilityName(int facility) Q_DECL_NOTHROW;
+        QLatin1String facilityName() const Q_DECL_NOTHROW { return facilityName(facility()); }
+        Q_WINEXTRAS_EXPORT QLatin1String name() const Q_DECL_NOTHROW;
+
+        friend Q_DECL_CONSTEXPR bool operator==(HResultInfo lhs, HResultInfo rhs) Q_DECL_NOTHROW
+        { return lhs.m_value == rhs.m_value; }
+        friend Q_DECL_CONSTEXPR bool operator!=(HResultInfo lhs, HResultInfo rhs) Q_DECL_NOTHROW
+        { return lhs.m_value != rhs.m_value; }
+
+    private:
+        quint32 m_value;
+    };
+}
+
+Q_DECLARE_TYPEINFO(QtWin::HResultInfo, Q_PRIMITIVE_TYPE);
+
+#ifndef QT_NO_DEBUG_STREAM
+Q_WINEXTRAS_EXPORT QDebug operator<<(QDebug, QtWin::HResultInfo);
+#endif
+
+QT_END_NAMESPACE
+
+#endif // QWINHRESULTINFO_H
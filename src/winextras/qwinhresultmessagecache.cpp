@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinhresultmessagecache_p.h"
+
+#include <QtCore/qhash.h>
+
+QT_BEGIN_NAMESPACE
+
+QWinHResultMessageCache::QWinHResultMessageCache(const Formatter &formatter, int capacity,
+                                                 int stripeCount)
+    : m_formatter(formatter)
+{
+    stripeCount = qMax(stripeCount, 1);
+    const int perStripe = qMax((capacity + stripeCount - 1) / stripeCount, 1);
+    m_stripes.reserve(stripeCount);
+    for (int i = 0; i < stripeCount; ++i) {
+        Stripe *stripe = new Stripe;
+        stripe->messages.setMaxCost(perStripe);
+        m_stripes.append(stripe);
+    }
+}
+
+QWinHResultMessageCache::~QWinHResultMessageCache()
+{
+    qDeleteAll(m_stripes);
+}
+
+QWinHResultMessageCache::Stripe &QWinHResultMessageCache::stripe(quint64 key) const
+{
+    // Codes of one facility differ in the low bits only; mix before picking.
+    return *m_stripes.at(int(qHash(key, 0x9e3779b9u) % uint(m_stripes.size())));
+}
+
+QString QWinHResultMessageCache::message(quint32 hresult, quint32 language)
+{
+    const quint64 key = (quint64(language) << 32) | hresult;
+    Stripe &s = stripe(key);
+    {
+        QMutexLocker locker(&s.mutex);
+        if (const QString *cached = s.messages.object(key)) {
+            m_hits.fetchAndAddRelaxed(1);
+            return *cached;
+        }
+    }
+
+    m_misses.fetchAndAddRelaxed(1);
+    const QString message = m_formatter(hresult, language);
+    QMutexLocker locker(&s.mutex);
+    // Another thread may have formatted it meanwhile; either result is fine.
+    s.messages.insert(key, new QString(message));
+    return message;
+}
+
+int QWinHResultMessageCache::capacity() const
+{
+    return m_stripes.size() * m_stripes.constFirst()->messages.maxCost();
+}
+
+int QWinHResultMessageCache::size() const
+{
+    int result = 0;
+    for (Stripe *s : m_stripes) {
+        QMutexLocker locker(&s->mutex);
+        result += s->messages.size();
+    }
+    return result;
+}
+
+void QWinHResultMessageCache::clear()
+{
+    for (Stripe *s : m_stripes) {
+        QMutexLocker locker(&s->mutex);
+        s->messages.clear();
+    }
+}
+
+QWinHResultMessageCache::Statistics QWinHResultMessageCache::statistics() const
+{
+    Statistics result;
+    result.hits = m_hits.loadAcquire();
+    result.misses = m_misses.loadAcquire();
+    return result;
+}
+
+void QWinHResultMessageCache::resetStatistics()
+{
+    m_hits.storeRelease(0);
+    m_misses.storeRelease(0);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINHRESULTMESSAGECACHE_P_H
+#define QWINHRESULTMESSAGECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+// Caches the system messages of HRESULTs per UI language, since formatting
+// them (FormatMessage()) is slow and allocates. The entries are spread over
+// stripes with a lock and a least recently used QCache each, so that
+// threads looking up different codes rarely contend. The formatter runs
+// outside of the locks. Thread-safe.
+class QWinHResultMessageCache
+{
+public:
+    typedef std::function<QString(quint32 hresult, quint32 language)> Formatter;
+
+    struct Statistics
+    {
+        quint64 hits = 0;
+        quint64 misses = 0;
+    };
+
+    enum {
+        DefaultCapacity = 128,
+        DefaultStripeCount = 8
+    };
+
+    explicit QWinHResultMessageCache(const Formatter &formatter, int capacity = DefaultCapacity,
+                                     int stripeCount = DefaultStripeCount);
+    ~QWinHResultMessageCache();
+
+    QString message(quint32 hresult, quint32 language);
+
+    // Total capacity, rounded up to a multiple of the stripe count.
+    int capacity() const;
+    int stripeCount() const { return m_stripes.size(); }
+    int size() const;
+    void clear();
+
+    Statistics statistics() const;
+    void resetStatistics();
+
+private:
+    Q_DISABLE_COPY(QWinHResultMessageCache)
+
+    struct Stripe
+    {
+        QMutex mutex;
+        QCache<quint64, QString> messages;
+    };
+
+    Stripe &stripe(quint64 key) const;
+
+    const Formatter m_formatter;
+    QVector<Stripe *> m_stripes;
+    QAtomicInteger<quint64> m_hits;
+    QAtomicInteger<quint64> m_misses;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINHRESULTMESSAGECACHE_P_H
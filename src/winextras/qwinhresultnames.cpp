@@ -0,0 +1,179 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinhresultnames_p.h"
+#include "qwinhresultnames_data_p.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qreadwritelock.h>
+#include <QtCore/qvector.h>
+
+#include <algorithm>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+static inline QLatin1String entryName(const QWinHResultNameEntry &entry)
+{
+    return QLatin1String(qt_hresultNamePool + entry.offset, entry.size);
+}
+
+// Byte-wise ordering, as used by the generator to sort qt_hresultNameOrder.
+static inline bool nameLess(QLatin1String a, QLatin1String b)
+{
+    const int common = qMin(a.size(), b.size());
+    const int result = common ? memcmp(a.data(), b.data(), size_t(common)) : 0;
+    return result < 0 || (result == 0 && a.size() < b.size());
+}
+
+static const QWinHResultNameEntry *findBuiltIn(quint32 hresult)
+{
+    const QWinHResultNameEntry *end = qt_hresultNameTable + qt_hresultNameCount;
+    const QWinHResultNameEntry *entry =
+        std::lower_bound(qt_hresultNameTable, end, hresult,
+                         [](const QWinHResultNameEntry &entry, quint32 value) { return entry.hresult < value; });
+    return entry != end && entry->hresult == hresult ? entry : nullptr;
+}
+
+static const QWinHResultNameEntry *findBuiltIn(QLatin1String name)
+{
+    const quint16 *end = qt_hresultNameOrder + qt_hresultNameCount;
+    const quint16 *index =
+        std::lower_bound(qt_hresultNameOrder, end, name,
+                         [](quint16 index, QLatin1String name) {
+                             return nameLess(entryName(qt_hresultNameTable[index]), name);
+                         });
+    if (index == end || entryName(qt_hresultNameTable[*index]) != name)
+        return nullptr;
+    return qt_hresultNameTable + *index;
+}
+
+namespace {
+
+// Names registered by the application. Strings are never released, so that
+// the QLatin1Strings handed out stay valid.
+struct Registry
+{
+    QReadWriteLock lock;
+    QVector<QByteArray> storage;
+    QHash<quint32, int> names;   // HRESULT -> index in storage
+    QHash<QByteArray, quint32> values;
+    QAtomicInt count;
+};
+
+} // namespace
+
+Q_GLOBAL_STATIC(Registry, registry)
+
+QLatin1String QWinHResultNames::name(quint32 hresult)
+{
+    if (const QWinHResultNameEntry *entry = findBuiltIn(hresult))
+        return entryName(*entry);
+    Registry *r = registry();
+    if (!r || r->count.loadAcquire() == 0)
+        return QLatin1String();
+    QReadLocker locker(&r->lock);
+    const auto it = r->names.constFind(hresult);
+    if (it == r->names.constEnd())
+        return QLatin1String();
+    const QByteArray &name = r->storage.at(it.value());
+    return QLatin1String(name.constData(), name.size());
+}
+
+bool QWinHResultNames::value(QLatin1String name, quint32 *hresult)
+{
+    quint32 result = 0;
+    if (const QWinHResultNameEntry *entry = findBuiltIn(name)) {
+        result = entry->hresult;
+    } else {
+        Registry *r = registry();
+        if (!r || r->count.loadAcquire() == 0 || name.isEmpty())
+            return false;
+        QReadLocker locker(&r->lock);
+        // fromRawData() does not copy; the key only lives during the lookup.
+        const auto it = r->values.constFind(QByteArray::fromRawData(name.data(), name.size()));
+        if (it == r->values.constEnd())
+            return false;
+        result = it.value();
+    }
+    if (hresult)
+        *hresult = result;
+    return true;
+}
+
+bool QWinHResultNames::registerName(quint32 hresult, QLatin1String name)
+{
+    if (name.isEmpty() || findBuiltIn(hresult) || findBuiltIn(name))
+        return false;
+    Registry *r = registry();
+    if (!r)
+        return false;
+    const QByteArray key(name.data(), name.size());
+    QWriteLocker locker(&r->lock);
+    const auto existing = r->values.constFind(key);
+    if (existing != r->values.constEnd())
+        return existing.value() == hresult;
+    const auto previous = r->names.constFind(hresult);
+    if (previous != r->names.constEnd())
+        r->values.remove(r->storage.at(previous.value()));
+    r->storage.append(key);
+    r->names.insert(hresult, r->storage.size() - 1);
+    r->values.insert(key, hresult);
+    r->count.storeRelease(r->names.size());
+    return true;
+}
+
+int QWinHResultNames::builtInCount()
+{
+    return qt_hresultNameCount;
+}
+
+quint32 QWinHResultNames::builtInValue(int index)
+{
+    return qt_hresultNameTable[index].hresult;
+}
+
+QLatin1String QWinHResultNames::builtInName(int index)
+{
+    return entryName(qt_hresultNameTable[index]);
+}
+
+QT_END_NAMESPACE
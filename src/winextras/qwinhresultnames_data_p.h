@@ -0,0 +1,2538 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// This file was generated by util/hresultnames/generate.py from
+// util/hresultnames/hresultnames.txt. Do not edit.
+
+#ifndef QWINHRESULTNAMES_DATA_P_H
+#define QWINHRESULTNAMES_DATA_P_H
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+struct QWinHResultNameEntry
+{
+    quint32 hresult;
+    quint16 offset; // into qt_hresultNamePool
+    quint16 size;
+};
+
+static const int qt_hresultNameCount = 1178;
+
+// Sorted by HRESULT.
+static Q_DECL_CONSTEXPR const QWinHResultNameEntry qt_hresultNameTable[] = {
+    { 0x00030200,     0, 15 },
+    { 0x00030201,    16, 11 },
+    { 0x00030202,    28, 14 },
+    { 0x00030203,    43, 16 },
+    { 0x00030204,    60, 19 },
+    { 0x00030205,    80, 25 },
+    { 0x00030206,   106, 23 },
+    { 0x00040000,   130, 12 },
+    { 0x00040001,   143, 12 },
+    { 0x00040002,   156, 20 },
+    { 0x00040100,   177, 15 },
+    { 0x00040101,   193, 17 },
+    { 0x00040102,   211, 28 },
+    { 0x00040130,   240, 20 },
+    { 0x00040140,   261, 21 },
+    { 0x00040170,   283, 30 },
+    { 0x00040171,   314, 17 },
+    { 0x00040172,   332, 29 },
+    { 0x00040180,   362, 20 },
+    { 0x00040181,   383, 26 },
+    { 0x00040182,   410, 20 },
+    { 0x000401A0,   431, 19 },
+    { 0x000401C0,   451, 27 },
+    { 0x000401E2,   479, 20 },
+    { 0x000401E4,   500,  7 },
+    { 0x000401E5,   508,  8 },
+    { 0x000401E6,   517,  7 },
+    { 0x000401E7,   525, 29 },
+    { 0x00040200,   555, 31 },
+    { 0x00040202,   587, 21 },
+    { 0x00041300,   609, 18 },
+    { 0x00041301,   628, 20 },
+    { 0x00041302,   649, 21 },
+    { 0x00041303,   671, 24 },
+    { 0x00041304,   696, 25 },
+    { 0x00041305,   722, 26 },
+    { 0x00041306,   749, 23 },
+    { 0x00041307,   773, 30 },
+    { 0x00041308,   804, 21 },
+    { 0x0004D000,   826, 12 },
+    { 0x0004D001,   839, 13 },
+    { 0x0004D002,   853, 15 },
+    { 0x0004D003,   869, 19 },
+    { 0x0004D004,   889, 15 },
+    { 0x0004D005,   905, 25 },
+    { 0x0004D006,   931, 24 },
+    { 0x0004D007,   956, 18 },
+    { 0x0004D008,   975, 15 },
+    { 0x0004D009,   991, 18 },
+    { 0x0004D00A,  1010, 17 },
+    { 0x0004D010,  1028, 26 },
+    { 0x00080012,  1055, 21 },
+    { 0x00080013,  1077, 24 },
+    { 0x00090312,  1102, 21 },
+    { 0x00090313,  1124, 21 },
+    { 0x00090314,  1146, 27 },
+    { 0x00090315,  1174, 17 },
+    { 0x00090317,  1192, 21 },
+    { 0x00090320,  1214, 28 },
+    { 0x00090321,  1243, 17 },
+    { 0x00090323,  1261, 20 },
+    { 0x00091012,  1282, 31 },
+    { 0x8000000A,  1314,  9 },
+    { 0x80004001,  1324,  9 },
+    { 0x80004002,  1334, 13 },
+    { 0x80004003,  1348,  9 },
+    { 0x80004004,  1358,  7 },
+    { 0x80004005,  1366,  6 },
+    { 0x80004006,  1373, 13 },
+    { 0x80004007,  1387, 26 },
+    { 0x80004008,  1414, 26 },
+    { 0x80004009,  1441, 21 },
+    { 0x8000400A,  1463, 21 },
+    { 0x8000400B,  1485, 33 },
+    { 0x8000400C,  1519, 29 },
+    { 0x8000400D,  1549, 35 },
+    { 0x8000400E,  1585, 26 },
+    { 0x8000400F,  1612, 33 },
+    { 0x80004010,  1646, 30 },
+    { 0x80004011,  1677, 26 },
+    { 0x80004012,  1704, 30 },
+    { 0x80004013,  1735, 16 },
+    { 0x80004014,  1752, 20 },
+    { 0x80004015,  1773, 26 },
+    { 0x80004016,  1800, 21 },
+    { 0x80004017,  1822, 17 },
+    { 0x80004018,  1840, 26 },
+    { 0x80004019,  1867, 32 },
+    { 0x8000401A,  1900, 24 },
+    { 0x8000401B,  1925, 28 },
+    { 0x8000401C,  1954, 26 },
+    { 0x8000401D,  1981, 33 },
+    { 0x8000401E,  2015, 25 },
+    { 0x8000401F,  2041, 24 },
+    { 0x80004020,  2066, 24 },
+    { 0x80004021,  2091, 18 },
+    { 0x80004022,  2110, 15 },
+    { 0x80004023,  2126, 14 },
+    { 0x80004024,  2141, 45 },
+    { 0x80004025,  2187, 18 },
+    { 0x80004026,  2206, 22 },
+    { 0x80004027,  2229, 19 },
+    { 0x80004028,  2249, 20 },
+    { 0x80004029,  2270, 24 },
+    { 0x8000402A,  2295, 24 },
+    { 0x8000402B,  2320, 26 },
+    { 0x80004030,  2347, 19 },
+    { 0x80004031,  2367, 22 },
+    { 0x80004032,  2390, 15 },
+    { 0x80004033,  2406, 18 },
+    { 0x8000FFFF,  2425, 12 },
+    { 0x80010001,  2438, 19 },
+    { 0x80010002,  2458, 19 },
+    { 0x80010003,  2478, 25 },
+    { 0x80010004,  2504, 29 },
+    { 0x80010005,  2534, 32 },
+    { 0x80010006,  2567, 27 },
+    { 0x80010007,  2595, 17 },
+    { 0x80010008,  2613, 17 },
+    { 0x80010009,  2631, 24 },
+    { 0x8001000A,  2656, 23 },
+    { 0x8001000B,  2680, 29 },
+    { 0x8001000C,  2710, 31 },
+    { 0x8001000D,  2742, 29 },
+    { 0x8001000E,  2772, 31 },
+    { 0x8001000F,  2804, 18 },
+    { 0x80010010,  2823, 23 },
+    { 0x80010011,  2847, 23 },
+    { 0x80010012,  2871, 21 },
+    { 0x80010100,  2893, 21 },
+    { 0x80010101,  2915, 22 },
+    { 0x80010102,  2938, 27 },
+    { 0x80010103,  2966, 20 },
+    { 0x80010104,  2987, 11 },
+    { 0x80010105,  2999, 17 },
+    { 0x80010106,  3017, 18 },
+    { 0x80010107,  3036, 19 },
+    { 0x80010108,  3056, 18 },
+    { 0x80010109,  3075, 11 },
+    { 0x8001010A,  3087, 27 },
+    { 0x8001010B,  3115, 25 },
+    { 0x8001010C,  3141, 22 },
+    { 0x8001010D,  3164, 33 },
+    { 0x8001010E,  3198, 18 },
+    { 0x8001010F,  3217, 21 },
+    { 0x80010110,  3239, 22 },
+    { 0x80010111,  3262, 20 },
+    { 0x80010112,  3283, 23 },
+    { 0x80010113,  3307, 18 },
+    { 0x80010114,  3326, 20 },
+    { 0x80010115,  3347, 17 },
+    { 0x80010116,  3365, 17 },
+    { 0x80010117,  3383, 19 },
+    { 0x80010118,  3403, 19 },
+    { 0x80010119,  3423, 14 },
+    { 0x8001011A,  3438, 31 },
+    { 0x8001011B,  3470, 19 },
+    { 0x8001011C,  3490, 21 },
+    { 0x8001011D,  3512, 20 },
+    { 0x8001011E,  3533, 16 },
+    { 0x8001011F,  3550, 13 },
+    { 0x80010120,  3564, 13 },
+    { 0x80010121,  3578, 22 },
+    { 0x80010122,  3601, 22 },
+    { 0x80010123,  3624, 24 },
+    { 0x80010124,  3649, 22 },
+    { 0x80010125,  3672, 28 },
+    { 0x80010126,  3701, 25 },
+    { 0x80010127,  3727, 29 },
+    { 0x80010128,  3757, 31 },
+    { 0x80010129,  3789, 20 },
+    { 0x8001012A,  3810, 22 },
+    { 0x8001012B,  3833, 23 },
+    { 0x8001012C,  3857, 27 },
+    { 0x8001012D,  3885, 15 },
+    { 0x8001012E,  3901, 21 },
+    { 0x8001012F,  3923, 23 },
+    { 0x80010130,  3947, 23 },
+    { 0x80010131,  3971, 24 },
+    { 0x80010132,  3996, 24 },
+    { 0x80010133,  4021, 22 },
+    { 0x80010134,  4044, 22 },
+    { 0x80010135,  4067, 16 },
+    { 0x80010136,  4084, 20 },
+    { 0x80010137,  4105, 23 },
+    { 0x80010138,  4129, 24 },
+    { 0x80010139,  4154, 22 },
+    { 0x8001013A,  4177, 21 },
+    { 0x8001013B,  4199, 30 },
+    { 0x8001013C,  4230, 29 },
+    { 0x8001013D,  4260, 17 },
+    { 0x8001013F,  4278, 21 },
+    { 0x80010140,  4300, 20 },
+    { 0x8001FFFF,  4321, 16 },
+    { 0x80020001,  4338, 23 },
+    { 0x80020003,  4362, 21 },
+    { 0x80020004,  4384, 20 },
+    { 0x80020005,  4405, 19 },
+    { 0x80020006,  4425, 18 },
+    { 0x80020007,  4444, 18 },
+    { 0x80020008,  4463, 17 },
+    { 0x80020009,  4481, 16 },
+    { 0x8002000A,  4498, 15 },
+    { 0x8002000B,  4514, 15 },
+    { 0x8002000C,  4530, 18 },
+    { 0x8002000D,  4549, 20 },
+    { 0x8002000E,  4570, 20 },
+    { 0x8002000F,  4591, 23 },
+    { 0x80020010,  4615, 16 },
+    { 0x80020011,  4632, 21 },
+    { 0x80020012,  4654, 16 },
+    { 0x80020013,  4671, 21 },
+    { 0x80028016,  4693, 21 },
+    { 0x80028017,  4715, 20 },
+    { 0x80028018,  4736, 18 },
+    { 0x80028019,  4755, 18 },
+    { 0x8002801C,  4774, 21 },
+    { 0x8002801D,  4796, 23 },
+    { 0x80028027,  4820, 20 },
+    { 0x80028028,  4841, 30 },
+    { 0x80028029,  4872, 19 },
+    { 0x8002802A,  4892, 20 },
+    { 0x8002802B,  4913, 22 },
+    { 0x8002802C,  4936, 20 },
+    { 0x8002802D,  4957, 19 },
+    { 0x8002802E,  4977, 18 },
+    { 0x8002802F,  4996, 26 },
+    { 0x800288BD,  5023, 20 },
+    { 0x800288C5,  5044, 17 },
+    { 0x800288C6,  5062, 18 },
+    { 0x800288CF,  5081, 16 },
+    { 0x80028CA0,  5098, 19 },
+    { 0x80028CA1,  5118, 18 },
+    { 0x80028CA2,  5137, 14 },
+    { 0x80028CA3,  5152, 24 },
+    { 0x80029C4A,  5177, 22 },
+    { 0x80029C83,  5200, 28 },
+    { 0x80029C84,  5229, 19 },
+    { 0x80030001,  5249, 21 },
+    { 0x80030002,  5271, 18 },
+    { 0x80030003,  5290, 18 },
+    { 0x80030004,  5309, 22 },
+    { 0x80030005,  5332, 18 },
+    { 0x80030006,  5351, 19 },
+    { 0x80030008,  5371, 24 },
+    { 0x80030009,  5396, 20 },
+    { 0x80030012,  5417, 17 },
+    { 0x80030013,  5435, 26 },
+    { 0x80030019,  5462, 15 },
+    { 0x8003001D,  5478, 16 },
+    { 0x8003001E,  5495, 15 },
+    { 0x80030020,  5511, 20 },
+    { 0x80030021,  5532, 19 },
+    { 0x80030050,  5552, 23 },
+    { 0x80030057,  5576, 22 },
+    { 0x80030070,  5599, 16 },
+    { 0x800300F0,  5616, 23 },
+    { 0x800300FA,  5640, 21 },
+    { 0x800300FB,  5662, 19 },
+    { 0x800300FC,  5682, 17 },
+    { 0x800300FD,  5700, 13 },
+    { 0x800300FE,  5714, 27 },
+    { 0x800300FF,  5742, 17 },
+    { 0x80030100,  5760, 11 },
+    { 0x80030101,  5772, 16 },
+    { 0x80030102,  5789, 14 },
+    { 0x80030103,  5804, 14 },
+    { 0x80030104,  5819, 15 },
+    { 0x80030105,  5835, 12 },
+    { 0x80030106,  5848, 19 },
+    { 0x80030107,  5868, 25 },
+    { 0x80030108,  5894, 24 },
+    { 0x80030109,  5919, 20 },
+    { 0x80030110,  5940, 20 },
+    { 0x80030111,  5961, 21 },
+    { 0x80030112,  5983, 21 },
+    { 0x80030201,  6005, 16 },
+    { 0x80030202,  6022, 16 },
+    { 0x80030305,  6039, 36 },
+    { 0x80030306,  6076, 32 },
+    { 0x80030307,  6109, 25 },
+    { 0x80030308,  6135, 29 },
+    { 0x80030309,  6165, 26 },
+    { 0x8003030A,  6192, 25 },
+    { 0x8003030B,  6218, 22 },
+    { 0x80040000,  6241, 13 },
+    { 0x80040001,  6255, 10 },
+    { 0x80040002,  6266, 17 },
+    { 0x80040003,  6284, 24 },
+    { 0x80040004,  6309, 18 },
+    { 0x80040005,  6328, 16 },
+    { 0x80040006,  6345, 13 },
+    { 0x80040007,  6359, 11 },
+    { 0x80040008,  6371, 15 },
+    { 0x80040009,  6387, 21 },
+    { 0x8004000A,  6409, 23 },
+    { 0x8004000B,  6433, 12 },
+    { 0x8004000C,  6446, 25 },
+    { 0x8004000D,  6472, 17 },
+    { 0x8004000E,  6490, 18 },
+    { 0x8004000F,  6509, 17 },
+    { 0x80040010,  6527, 23 },
+    { 0x80040011,  6551, 17 },
+    { 0x80040012,  6569, 15 },
+    { 0x80040064,  6585, 14 },
+    { 0x80040065,  6600, 19 },
+    { 0x80040066,  6620, 14 },
+    { 0x80040067,  6635, 13 },
+    { 0x80040068,  6649, 11 },
+    { 0x80040069,  6661, 10 },
+    { 0x8004006A,  6672, 15 },
+    { 0x8004006B,  6688, 13 },
+    { 0x8004006C,  6702, 24 },
+    { 0x8004006D,  6727, 18 },
+    { 0x80040100,  6746, 24 },
+    { 0x80040101,  6771, 28 },
+    { 0x80040102,  6800, 22 },
+    { 0x80040110,  6823, 21 },
+    { 0x80040111,  6845, 25 },
+    { 0x80040112,  6871, 19 },
+    { 0x80040140,  6891, 11 },
+    { 0x80040150,  6903, 17 },
+    { 0x80040151,  6921, 18 },
+    { 0x80040152,  6940, 18 },
+    { 0x80040153,  6959, 20 },
+    { 0x80040154,  6980, 19 },
+    { 0x80040155,  7000, 17 },
+    { 0x80040156,  7018, 25 },
+    { 0x80040160,  7044, 18 },
+    { 0x80040161,  7063, 19 },
+    { 0x80040164,  7083, 21 },
+    { 0x80040165,  7105, 18 },
+    { 0x80040166,  7124, 19 },
+    { 0x80040167,  7144, 20 },
+    { 0x80040168,  7165, 18 },
+    { 0x80040169,  7184, 20 },
+    { 0x8004016A,  7205, 26 },
+    { 0x8004016B,  7232, 17 },
+    { 0x8004016C,  7250, 18 },
+    { 0x8004016D,  7269, 25 },
+    { 0x8004016E,  7295, 20 },
+    { 0x8004016F,  7316, 19 },
+    { 0x80040170,  7336, 23 },
+    { 0x80040180,  7360, 16 },
+    { 0x80040181,  7377, 20 },
+    { 0x800401A0,  7398, 21 },
+    { 0x800401A1,  7420, 21 },
+    { 0x800401C0,  7442, 25 },
+    { 0x800401C1,  7468, 25 },
+    { 0x800401C2,  7494, 25 },
+    { 0x800401C3,  7520, 35 },
+    { 0x800401C4,  7556, 19 },
+    { 0x800401C5,  7576, 29 },
+    { 0x800401C6,  7606, 29 },
+    { 0x800401D0,  7636, 19 },
+    { 0x800401D1,  7656, 20 },
+    { 0x800401D2,  7677, 18 },
+    { 0x800401D3,  7696, 18 },
+    { 0x800401D4,  7715, 20 },
+    { 0x800401E0,  7736, 20 },
+    { 0x800401E1,  7757, 21 },
+    { 0x800401E2,  7779, 16 },
+    { 0x800401E3,  7796, 16 },
+    { 0x800401E4,  7813, 11 },
+    { 0x800401E5,  7825, 13 },
+    { 0x800401E6,  7839, 21 },
+    { 0x800401E7,  7861, 38 },
+    { 0x800401E8,  7900, 16 },
+    { 0x800401E9,  7917, 13 },
+    { 0x800401EA,  7931, 17 },
+    { 0x800401EB,  7949, 19 },
+    { 0x800401EC,  7969, 14 },
+    { 0x800401ED,  7984, 14 },
+    { 0x800401EE,  7999, 13 },
+    { 0x800401EF,  8013, 23 },
+    { 0x800401F0,  8037, 19 },
+    { 0x800401F1,  8057, 23 },
+    { 0x800401F2,  8081, 23 },
+    { 0x800401F3,  8105, 16 },
+    { 0x800401F4,  8122, 14 },
+    { 0x800401F5,  8137, 16 },
+    { 0x800401F6,  8154, 17 },
+    { 0x800401F7,  8172, 15 },
+    { 0x800401F8,  8188, 16 },
+    { 0x800401F9,  8205, 15 },
+    { 0x800401FA,  8221, 18 },
+    { 0x800401FB,  8240, 14 },
+    { 0x800401FC,  8255, 13 },
+    { 0x800401FD,  8269, 20 },
+    { 0x800401FE,  8290, 16 },
+    { 0x800401FF,  8307, 13 },
+    { 0x80040201,  8321, 30 },
+    { 0x80040203,  8352, 19 },
+    { 0x80040204,  8372, 18 },
+    { 0x80040205,  8391, 25 },
+    { 0x80040206,  8417, 21 },
+    { 0x80040207,  8439, 28 },
+    { 0x80040208,  8468, 22 },
+    { 0x80040209,  8491, 24 },
+    { 0x8004020A,  8516, 26 },
+    { 0x8004020B,  8543, 23 },
+    { 0x8004020C,  8567, 29 },
+    { 0x8004020D,  8597, 49 },
+    { 0x8004020E,  8647, 47 },
+    { 0x8004020F,  8695, 37 },
+    { 0x80040210,  8733, 34 },
+    { 0x80041309,  8768, 25 },
+    { 0x8004130A,  8794, 22 },
+    { 0x8004130B,  8817, 24 },
+    { 0x8004130C,  8842, 29 },
+    { 0x8004130D,  8872, 24 },
+    { 0x8004130E,  8897, 20 },
+    { 0x8004130F,  8918, 35 },
+    { 0x80041310,  8954, 30 },
+    { 0x80041311,  8985, 29 },
+    { 0x80041312,  9015, 28 },
+    { 0x80041313,  9044, 30 },
+    { 0x80041314,  9075, 34 },
+    { 0x80041315,  9110, 27 },
+    { 0x80042301,  9138, 15 },
+    { 0x80042302,  9154, 16 },
+    { 0x80042304,  9171, 29 },
+    { 0x80042306,  9201, 19 },
+    { 0x80042308,  9221, 22 },
+    { 0x8004230C,  9244, 26 },
+    { 0x8004230D,  9271, 27 },
+    { 0x8004230E,  9299, 38 },
+    { 0x8004230F,  9338, 31 },
+    { 0x80042311,  9370, 26 },
+    { 0x80042312,  9397, 39 },
+    { 0x80042317,  9437, 41 },
+    { 0x8004232A,  9479, 23 },
+    { 0x8004232B,  9503, 25 },
+    { 0x8004232C,  9529, 25 },
+    { 0x800423F7,  9555, 21 },
+    { 0x800423FE,  9577, 26 },
+    { 0x800423FF,  9604, 24 },
+    { 0x8004D000,  9629, 30 },
+    { 0x8004D001,  9660, 17 },
+    { 0x8004D002,  9678, 19 },
+    { 0x8004D003,  9698, 22 },
+    { 0x8004D004,  9721, 21 },
+    { 0x8004D005,  9743, 22 },
+    { 0x8004D006,  9766, 22 },
+    { 0x8004D007,  9789, 22 },
+    { 0x8004D008,  9812, 21 },
+    { 0x8004D009,  9834, 14 },
+    { 0x8004D00A,  9849, 15 },
+    { 0x8004D00B,  9865, 18 },
+    { 0x8004D00C,  9884, 17 },
+    { 0x8004D00D,  9902, 17 },
+    { 0x8004D00E,  9920, 20 },
+    { 0x8004D00F,  9941, 19 },
+    { 0x8004D010,  9961, 20 },
+    { 0x8004D011,  9982, 17 },
+    { 0x8004D012, 10000, 15 },
+    { 0x8004D013, 10016, 18 },
+    { 0x8004D014, 10035, 21 },
+    { 0x8004D015, 10057, 20 },
+    { 0x8004D016, 10078, 14 },
+    { 0x8004D017, 10093, 16 },
+    { 0x8004D018, 10110, 24 },
+    { 0x8004D019, 10135, 14 },
+    { 0x8004D01A, 10150, 14 },
+    { 0x8004D01B, 10165, 21 },
+    { 0x8004D01C, 10187, 22 },
+    { 0x8004D01D, 10210, 24 },
+    { 0x8004D01E, 10235, 22 },
+    { 0x8004D01F, 10258, 25 },
+    { 0x8004D020, 10284, 25 },
+    { 0x8004D021, 10310, 22 },
+    { 0x8004D022, 10333, 26 },
+    { 0x8004D023, 10360, 19 },
+    { 0x8004D024, 10380, 26 },
+    { 0x8004D025, 10407, 34 },
+    { 0x8004D026, 10442, 21 },
+    { 0x8004D027, 10464, 32 },
+    { 0x8004D028, 10497, 31 },
+    { 0x8004D029, 10529, 15 },
+    { 0x8004D080, 10545, 20 },
+    { 0x8004D081, 10566, 18 },
+    { 0x8004D082, 10585, 25 },
+    { 0x8004D083, 10611, 24 },
+    { 0x8004D084, 10636, 17 },
+    { 0x8004D085, 10654, 20 },
+    { 0x8004E002, 10675, 17 },
+    { 0x8004E003, 10693, 18 },
+    { 0x8004E004, 10712, 19 },
+    { 0x8004E005, 10732, 24 },
+    { 0x8004E006, 10757, 23 },
+    { 0x8004E007, 10781, 16 },
+    { 0x8004E00C, 10798, 22 },
+    { 0x8004E00F, 10821, 24 },
+    { 0x8004E021, 10846, 21 },
+    { 0x8004E022, 10868, 33 },
+    { 0x8004E023, 10902, 34 },
+    { 0x8004E024, 10937, 29 },
+    { 0x8004E025, 10967, 25 },
+    { 0x8004E026, 10993, 15 },
+    { 0x8004E027, 11009, 23 },
+    { 0x8004E028, 11033, 27 },
+    { 0x8004E029, 11061, 20 },
+    { 0x8004E02A, 11082, 14 },
+    { 0x8004E02B, 11097, 12 },
+    { 0x8004E02C, 11110, 14 },
+    { 0x8004E02D, 11125, 19 },
+    { 0x8004E02E, 11145, 22 },
+    { 0x8004E02F, 11168, 21 },
+    { 0x80070005, 11190, 14 },
+    { 0x80070006, 11205,  8 },
+    { 0x8007000E, 11214, 13 },
+    { 0x80070057, 11228, 12 },
+    { 0x80080001, 11241, 24 },
+    { 0x80080002, 11266, 14 },
+    { 0x80080003, 11281, 20 },
+    { 0x80080004, 11302, 13 },
+    { 0x80080005, 11316, 24 },
+    { 0x80080006, 11341, 23 },
+    { 0x80080007, 11365, 18 },
+    { 0x80080008, 11384, 20 },
+    { 0x80080009, 11405, 18 },
+    { 0x80080010, 11424, 18 },
+    { 0x80080011, 11443, 18 },
+    { 0x80090001, 11462, 11 },
+    { 0x80090002, 11474, 12 },
+    { 0x80090003, 11487, 11 },
+    { 0x80090004, 11499, 11 },
+    { 0x80090005, 11511, 12 },
+    { 0x80090006, 11524, 17 },
+    { 0x80090007, 11542, 11 },
+    { 0x80090008, 11554, 13 },
+    { 0x80090009, 11568, 13 },
+    { 0x8009000A, 11582, 12 },
+    { 0x8009000B, 11595, 17 },
+    { 0x8009000C, 11613, 18 },
+    { 0x8009000D, 11632, 10 },
+    { 0x8009000E, 11643, 13 },
+    { 0x8009000F, 11657, 10 },
+    { 0x80090010, 11668,  8 },
+    { 0x80090011, 11677, 13 },
+    { 0x80090012, 11691, 18 },
+    { 0x80090013, 11710, 16 },
+    { 0x80090014, 11727, 17 },
+    { 0x80090015, 11745, 18 },
+    { 0x80090016, 11764, 14 },
+    { 0x80090017, 11779, 21 },
+    { 0x80090018, 11801, 23 },
+    { 0x80090019, 11825, 18 },
+    { 0x8009001A, 11844, 20 },
+    { 0x8009001B, 11865, 22 },
+    { 0x8009001C, 11888, 22 },
+    { 0x8009001D, 11911, 21 },
+    { 0x8009001E, 11933, 22 },
+    { 0x8009001F, 11956, 20 },
+    { 0x80090020, 11977,  8 },
+    { 0x80090021, 11986, 11 },
+    { 0x80090022, 11998, 18 },
+    { 0x80090023, 12017, 29 },
+    { 0x80090024, 12047, 21 },
+    { 0x80090025, 12069, 18 },
+    { 0x80090300, 12088, 25 },
+    { 0x80090301, 12114, 20 },
+    { 0x80090302, 12135, 26 },
+    { 0x80090303, 12162, 20 },
+    { 0x80090304, 12183, 20 },
+    { 0x80090305, 12204, 22 },
+    { 0x80090306, 12227, 15 },
+    { 0x80090307, 12243, 20 },
+    { 0x80090308, 12264, 19 },
+    { 0x80090309, 12284, 17 },
+    { 0x8009030A, 12302, 23 },
+    { 0x8009030B, 12326, 22 },
+    { 0x8009030C, 12349, 18 },
+    { 0x8009030D, 12368, 25 },
+    { 0x8009030E, 12394, 20 },
+    { 0x8009030F, 12415, 21 },
+    { 0x80090310, 12437, 21 },
+    { 0x80090311, 12459, 33 },
+    { 0x80090316, 12493, 15 },
+    { 0x80090317, 12509, 21 },
+    { 0x80090318, 12531, 24 },
+    { 0x80090320, 12556, 28 },
+    { 0x80090321, 12585, 22 },
+    { 0x80090322, 12608, 21 },
+    { 0x80090324, 12630, 15 },
+    { 0x80090325, 12646, 20 },
+    { 0x80090326, 12667, 21 },
+    { 0x80090327, 12689, 18 },
+    { 0x80090328, 12708, 18 },
+    { 0x80090329, 12727, 21 },
+    { 0x80090330, 12749, 21 },
+    { 0x80090331, 12771, 24 },
+    { 0x80090332, 12796, 25 },
+    { 0x80090333, 12822, 32 },
+    { 0x80090334, 12855, 18 },
+    { 0x80090335, 12874, 21 },
+    { 0x80090336, 12896, 29 },
+    { 0x80090337, 12926, 27 },
+    { 0x80090338, 12954, 28 },
+    { 0x80090339, 12983, 17 },
+    { 0x8009033A, 13001, 33 },
+    { 0x8009033B, 13035, 25 },
+    { 0x8009033C, 13061, 16 },
+    { 0x8009033D, 13078, 26 },
+    { 0x8009033E, 13105, 30 },
+    { 0x8009033F, 13136, 26 },
+    { 0x80090340, 13163, 25 },
+    { 0x80090341, 13189, 25 },
+    { 0x80090342, 13215, 23 },
+    { 0x80090343, 13239, 25 },
+    { 0x80090345, 13265, 25 },
+    { 0x80090346, 13291, 18 },
+    { 0x80090347, 13310, 23 },
+    { 0x80090348, 13334, 17 },
+    { 0x80090349, 13352, 22 },
+    { 0x80090350, 13375, 24 },
+    { 0x80090351, 13400, 28 },
+    { 0x80090352, 13429, 26 },
+    { 0x80090353, 13456, 26 },
+    { 0x80090354, 13483, 27 },
+    { 0x80090355, 13511, 28 },
+    { 0x80090356, 13540, 25 },
+    { 0x80090357, 13566, 35 },
+    { 0x80090358, 13602, 28 },
+    { 0x80090359, 13631, 30 },
+    { 0x8009035A, 13662, 22 },
+    { 0x8009035B, 13685, 22 },
+    { 0x80091001, 13708, 17 },
+    { 0x80091002, 13726, 20 },
+    { 0x80091003, 13747, 18 },
+    { 0x80091004, 13766, 24 },
+    { 0x80091005, 13791, 27 },
+    { 0x80091006, 13819, 25 },
+    { 0x80091007, 13845, 18 },
+    { 0x80091008, 13864, 21 },
+    { 0x80091009, 13886, 25 },
+    { 0x8009100A, 13912, 21 },
+    { 0x8009100B, 13934, 27 },
+    { 0x8009100C, 13962, 20 },
+    { 0x8009100D, 13983, 27 },
+    { 0x8009100E, 14011, 24 },
+    { 0x8009100F, 14036, 26 },
+    { 0x80091010, 14063, 28 },
+    { 0x80091011, 14092, 32 },
+    { 0x80092001, 14125, 15 },
+    { 0x80092002, 14141, 18 },
+    { 0x80092003, 14160, 18 },
+    { 0x80092004, 14179, 17 },
+    { 0x80092005, 14197, 14 },
+    { 0x80092006, 14212, 19 },
+    { 0x80092007, 14232, 19 },
+    { 0x80092008, 14252, 20 },
+    { 0x80092009, 14273, 16 },
+    { 0x8009200A, 14290, 27 },
+    { 0x8009200B, 14318, 23 },
+    { 0x8009200C, 14342, 23 },
+    { 0x8009200D, 14366, 15 },
+    { 0x8009200E, 14382, 17 },
+    { 0x8009200F, 14400, 21 },
+    { 0x80092010, 14422, 15 },
+    { 0x80092011, 14438, 25 },
+    { 0x80092012, 14464, 27 },
+    { 0x80092013, 14492, 26 },
+    { 0x80092014, 14519, 34 },
+    { 0x80092020, 14554, 30 },
+    { 0x80092021, 14585, 32 },
+    { 0x80092022, 14618, 26 },
+    { 0x80092023, 14645, 27 },
+    { 0x80092024, 14673, 23 },
+    { 0x80092025, 14697, 19 },
+    { 0x80092026, 14717, 25 },
+    { 0x80092027, 14743, 27 },
+    { 0x80092028, 14771, 29 },
+    { 0x80092029, 14801, 28 },
+    { 0x8009202A, 14830, 18 },
+    { 0x8009202B, 14849, 25 },
+    { 0x8009202C, 14875, 27 },
+    { 0x80093000, 14903, 17 },
+    { 0x80093001, 14921, 12 },
+    { 0x80093002, 14934, 21 },
+    { 0x80093003, 14956, 13 },
+    { 0x80093004, 14970, 14 },
+    { 0x80093005, 14985, 14 },
+    { 0x80093006, 15000, 11 },
+    { 0x80093007, 15012, 15 },
+    { 0x80093008, 15028, 14 },
+    { 0x80093009, 15043, 16 },
+    { 0x8009300A, 15060, 11 },
+    { 0x8009300B, 15072, 11 },
+    { 0x8009300C, 15084, 12 },
+    { 0x8009300D, 15097, 28 },
+    { 0x8009300E, 15126, 13 },
+    { 0x8009300F, 15140, 13 },
+    { 0x80093010, 15154, 12 },
+    { 0x80093011, 15167, 23 },
+    { 0x80093012, 15191, 15 },
+    { 0x80093013, 15207, 30 },
+    { 0x80093014, 15238, 12 },
+    { 0x80093015, 15251, 12 },
+    { 0x80093016, 15264, 16 },
+    { 0x80093017, 15281, 20 },
+    { 0x80093018, 15302, 26 },
+    { 0x80093019, 15329, 17 },
+    { 0x8009301A, 15347, 22 },
+    { 0x8009301B, 15370, 24 },
+    { 0x8009301C, 15395, 27 },
+    { 0x8009301D, 15423, 18 },
+    { 0x8009301E, 15442, 22 },
+    { 0x8009301F, 15465, 23 },
+    { 0x80093020, 15489, 24 },
+    { 0x80093021, 15514, 16 },
+    { 0x80093022, 15531, 25 },
+    { 0x80093023, 15557, 29 },
+    { 0x80093024, 15587, 29 },
+    { 0x80093025, 15617, 30 },
+    { 0x80093026, 15648, 26 },
+    { 0x80093027, 15675, 22 },
+    { 0x80093028, 15698, 23 },
+    { 0x80093029, 15722, 22 },
+    { 0x8009302A, 15745, 25 },
+    { 0x8009302B, 15771, 22 },
+    { 0x8009302C, 15794, 19 },
+    { 0x8009302D, 15814, 21 },
+    { 0x8009302E, 15836, 25 },
+    { 0x80093100, 15862, 18 },
+    { 0x80093101, 15881, 21 },
+    { 0x80093102, 15903, 16 },
+    { 0x80093103, 15920, 20 },
+    { 0x80093104, 15941, 18 },
+    { 0x80093105, 15960, 23 },
+    { 0x80093106, 15984, 19 },
+    { 0x80093107, 16004, 21 },
+    { 0x80093108, 16026, 19 },
+    { 0x80093109, 16046, 20 },
+    { 0x8009310A, 16067, 20 },
+    { 0x8009310B, 16088, 19 },
+    { 0x8009310C, 16108, 19 },
+    { 0x8009310D, 16128, 17 },
+    { 0x8009310E, 16146, 17 },
+    { 0x80093133, 16164, 21 },
+    { 0x80093134, 16186, 16 },
+    { 0x80093201, 16203, 21 },
+    { 0x80093202, 16225, 18 },
+    { 0x80094001, 16244, 28 },
+    { 0x80094002, 16273, 20 },
+    { 0x80094003, 16294, 27 },
+    { 0x80094004, 16322, 24 },
+    { 0x80094005, 16347, 32 },
+    { 0x80094006, 16380, 26 },
+    { 0x80094007, 16407, 25 },
+    { 0x80094008, 16433, 22 },
+    { 0x80094009, 16456, 27 },
+    { 0x8009400A, 16484, 37 },
+    { 0x8009400B, 16522, 22 },
+    { 0x8009400C, 16545, 34 },
+    { 0x8009400D, 16580, 28 },
+    { 0x8009400E, 16609, 36 },
+    { 0x8009400F, 16646, 24 },
+    { 0x80094010, 16671, 25 },
+    { 0x80094011, 16697, 23 },
+    { 0x80094012, 16721, 25 },
+    { 0x80094013, 16747, 37 },
+    { 0x80094800, 16785, 31 },
+    { 0x80094801, 16817, 22 },
+    { 0x80094802, 16840, 27 },
+    { 0x80094803, 16868, 35 },
+    { 0x80094804, 16904, 31 },
+    { 0x80094805, 16936, 24 },
+    { 0x80094806, 16961, 29 },
+    { 0x80094807, 16991, 30 },
+    { 0x80094808, 17022, 34 },
+    { 0x80094809, 17057, 35 },
+    { 0x8009480A, 17093, 25 },
+    { 0x8009480B, 17119, 28 },
+    { 0x8009480C, 17148, 34 },
+    { 0x8009480D, 17183, 30 },
+    { 0x8009480E, 17214, 41 },
+    { 0x8009480F, 17256, 30 },
+    { 0x80094810, 17287, 33 },
+    { 0x80094811, 17321, 20 },
+    { 0x80094812, 17342, 32 },
+    { 0x80094813, 17375, 27 },
+    { 0x80094814, 17403, 27 },
+    { 0x80095000, 17431, 28 },
+    { 0x80095001, 17460, 30 },
+    { 0x80095002, 17491, 36 },
+    { 0x80095003, 17528, 37 },
+    { 0x80095004, 17566, 35 },
+    { 0x80095005, 17602, 32 },
+    { 0x80096001, 17635, 20 },
+    { 0x80096002, 17656, 22 },
+    { 0x80096003, 17679, 22 },
+    { 0x80096004, 17702, 22 },
+    { 0x80096005, 17725, 18 },
+    { 0x80096010, 17744, 18 },
+    { 0x80096019, 17763, 25 },
+    { 0x8009601E, 17789, 26 },
+    { 0x80097001, 17816, 24 },
+    { 0x80097002, 17841, 24 },
+    { 0x80097003, 17866, 22 },
+    { 0x80097004, 17889, 26 },
+    { 0x80097005, 17916, 27 },
+    { 0x80097006, 17944, 25 },
+    { 0x80097007, 17970, 25 },
+    { 0x80097008, 17996, 36 },
+    { 0x80097009, 18033, 25 },
+    { 0x8009700A, 18059, 25 },
+    { 0x8009700B, 18085, 23 },
+    { 0x8009700C, 18109, 25 },
+    { 0x8009700D, 18135, 24 },
+    { 0x80097010, 18160, 24 },
+    { 0x80097011, 18185, 29 },
+    { 0x80097012, 18215, 23 },
+    { 0x80097013, 18239, 15 },
+    { 0x80097014, 18255, 16 },
+    { 0x80097015, 18272, 21 },
+    { 0x80097016, 18294, 25 },
+    { 0x80097017, 18320, 23 },
+    { 0x80097018, 18344, 20 },
+    { 0x800B0001, 18365, 24 },
+    { 0x800B0002, 18390, 22 },
+    { 0x800B0003, 18413, 28 },
+    { 0x800B0004, 18442, 27 },
+    { 0x800B0005, 18470, 15 },
+    { 0x800B0006, 18486, 15 },
+    { 0x800B0007, 18502, 22 },
+    { 0x800B0008, 18525, 15 },
+    { 0x800B0009, 18541, 22 },
+    { 0x800B000A, 18564, 24 },
+    { 0x800B000B, 18589, 23 },
+    { 0x800B0100, 18613, 19 },
+    { 0x800B0101, 18633, 14 },
+    { 0x800B0102, 18648, 28 },
+    { 0x800B0103, 18677, 11 },
+    { 0x800B0104, 18689, 19 },
+    { 0x800B0105, 18709, 15 },
+    { 0x800B0106, 18725, 14 },
+    { 0x800B0107, 18740, 21 },
+    { 0x800B0108, 18762, 16 },
+    { 0x800B0109, 18779, 20 },
+    { 0x800B010A, 18800, 15 },
+    { 0x800B010B, 18816, 12 },
+    { 0x800B010C, 18829, 14 },
+    { 0x800B010D, 18844, 24 },
+    { 0x800B010E, 18869, 25 },
+    { 0x800B010F, 18895, 18 },
+    { 0x800B0110, 18914, 18 },
+    { 0x800B0111, 18933, 25 },
+    { 0x800B0112, 18959, 18 },
+    { 0x800B0113, 18978, 21 },
+    { 0x800B0114, 19000, 19 },
+    { 0x800F0000, 19020, 29 },
+    { 0x800F0001, 19050, 29 },
+    { 0x800F0002, 19080, 29 },
+    { 0x800F0003, 19110, 22 },
+    { 0x800F0100, 19133, 23 },
+    { 0x800F0101, 19157, 25 },
+    { 0x800F0102, 19183, 22 },
+    { 0x800F0103, 19206, 17 },
+    { 0x800F0200, 19224, 27 },
+    { 0x800F0201, 19252, 22 },
+    { 0x800F0202, 19275, 23 },
+    { 0x800F0203, 19299, 26 },
+    { 0x800F0204, 19326, 26 },
+    { 0x800F0205, 19353, 28 },
+    { 0x800F0206, 19382, 21 },
+    { 0x800F0207, 19404, 30 },
+    { 0x800F0208, 19435, 30 },
+    { 0x800F0209, 19466, 28 },
+    { 0x800F020A, 19495, 14 },
+    { 0x800F020B, 19510, 23 },
+    { 0x800F020C, 19534, 28 },
+    { 0x800F020D, 19563, 31 },
+    { 0x800F020E, 19595, 21 },
+    { 0x800F020F, 19617, 21 },
+    { 0x800F0210, 19639, 25 },
+    { 0x800F0211, 19665, 26 },
+    { 0x800F0212, 19692, 27 },
+    { 0x800F0213, 19720, 27 },
+    { 0x800F0214, 19748, 19 },
+    { 0x800F0215, 19768, 30 },
+    { 0x800F0216, 19799, 24 },
+    { 0x800F0217, 19824, 31 },
+    { 0x800F0218, 19856, 28 },
+    { 0x800F0219, 19885, 29 },
+    { 0x800F021A, 19915, 35 },
+    { 0x800F021B, 19951, 31 },
+    { 0x800F021C, 19983, 32 },
+    { 0x800F021D, 20016, 33 },
+    { 0x800F021E, 20050, 31 },
+    { 0x800F021F, 20082, 32 },
+    { 0x800F0220, 20115, 27 },
+    { 0x800F0221, 20143, 27 },
+    { 0x800F0222, 20171, 27 },
+    { 0x800F0223, 20199, 29 },
+    { 0x800F0224, 20229, 33 },
+    { 0x800F0225, 20263, 32 },
+    { 0x800F0226, 20296, 34 },
+    { 0x800F0227, 20331, 27 },
+    { 0x800F0228, 20359, 25 },
+    { 0x800F0229, 20385, 22 },
+    { 0x800F022A, 20408, 29 },
+    { 0x800F022B, 20438, 23 },
+    { 0x800F022C, 20462, 29 },
+    { 0x800F022D, 20492, 29 },
+    { 0x800F022E, 20522, 26 },
+    { 0x800F022F, 20549, 30 },
+    { 0x800F0230, 20580, 34 },
+    { 0x800F0231, 20615, 23 },
+    { 0x800F0232, 20639, 27 },
+    { 0x800F0233, 20667, 22 },
+    { 0x800F0234, 20690, 24 },
+    { 0x800F0235, 20715, 16 },
+    { 0x800F0236, 20732, 32 },
+    { 0x800F0237, 20765, 30 },
+    { 0x800F0238, 20796, 20 },
+    { 0x800F0239, 20817, 25 },
+    { 0x800F023A, 20843, 26 },
+    { 0x800F023B, 20870, 34 },
+    { 0x800F023C, 20905, 32 },
+    { 0x800F023D, 20938, 29 },
+    { 0x800F023E, 20968, 28 },
+    { 0x800F023F, 20997, 31 },
+    { 0x800F0240, 21029, 31 },
+    { 0x800F0241, 21061, 38 },
+    { 0x800F0242, 21100, 42 },
+    { 0x800F0243, 21143, 42 },
+    { 0x800F0244, 21186, 38 },
+    { 0x800F0245, 21225, 38 },
+    { 0x800F0300, 21264, 36 },
+    { 0x800F1000, 21301, 27 },
+    { 0x80100001, 21329, 22 },
+    { 0x80100002, 21352, 17 },
+    { 0x80100003, 21370, 22 },
+    { 0x80100004, 21393, 25 },
+    { 0x80100005, 21419, 22 },
+    { 0x80100006, 21442, 17 },
+    { 0x80100007, 21460, 23 },
+    { 0x80100008, 21484, 27 },
+    { 0x80100009, 21512, 22 },
+    { 0x8010000A, 21535, 15 },
+    { 0x8010000B, 21551, 25 },
+    { 0x8010000C, 21577, 20 },
+    { 0x8010000D, 21598, 20 },
+    { 0x8010000E, 21619, 20 },
+    { 0x8010000F, 21640, 22 },
+    { 0x80100010, 21663, 17 },
+    { 0x80100011, 21681, 21 },
+    { 0x80100012, 21703, 24 },
+    { 0x80100013, 21728, 18 },
+    { 0x80100014, 21747, 21 },
+    { 0x80100015, 21769, 19 },
+    { 0x80100016, 21789, 22 },
+    { 0x80100017, 21812, 26 },
+    { 0x80100018, 21839, 16 },
+    { 0x80100019, 21856, 21 },
+    { 0x8010001A, 21878, 26 },
+    { 0x8010001B, 21905, 24 },
+    { 0x8010001C, 21930, 24 },
+    { 0x8010001D, 21955, 18 },
+    { 0x8010001E, 21974, 23 },
+    { 0x8010001F, 21998, 18 },
+    { 0x80100020, 22017, 24 },
+    { 0x80100021, 22042, 23 },
+    { 0x80100022, 22066, 27 },
+    { 0x80100023, 22094, 21 },
+    { 0x80100024, 22116, 22 },
+    { 0x80100025, 22139, 14 },
+    { 0x80100026, 22154, 15 },
+    { 0x80100027, 22170, 17 },
+    { 0x80100028, 22188, 22 },
+    { 0x80100029, 22211, 16 },
+    { 0x8010002A, 22228, 19 },
+    { 0x8010002B, 22248, 23 },
+    { 0x8010002C, 22272, 27 },
+    { 0x8010002D, 22300, 31 },
+    { 0x8010002E, 22332, 28 },
+    { 0x8010002F, 22361, 22 },
+    { 0x80100030, 22384, 24 },
+    { 0x80100031, 22409, 23 },
+    { 0x80100065, 22433, 24 },
+    { 0x80100066, 22458, 25 },
+    { 0x80100067, 22484, 22 },
+    { 0x80100068, 22507, 18 },
+    { 0x80100069, 22526, 20 },
+    { 0x8010006A, 22547, 26 },
+    { 0x8010006B, 22574, 17 },
+    { 0x8010006C, 22592, 19 },
+    { 0x8010006D, 22612, 11 },
+    { 0x8010006E, 22624, 25 },
+    { 0x8010006F, 22650, 30 },
+    { 0x80100070, 22681, 28 },
+    { 0x80100071, 22710, 24 },
+    { 0x80110401, 22735, 23 },
+    { 0x80110402, 22759, 24 },
+    { 0x80110403, 22784, 21 },
+    { 0x80110404, 22806, 27 },
+    { 0x80110407, 22834, 29 },
+    { 0x80110408, 22864, 28 },
+    { 0x80110409, 22893, 27 },
+    { 0x8011040A, 22921, 18 },
+    { 0x8011040B, 22940, 28 },
+    { 0x8011040C, 22969, 21 },
+    { 0x8011040D, 22991, 23 },
+    { 0x8011040F, 23015, 17 },
+    { 0x80110410, 23033, 25 },
+    { 0x80110411, 23059, 26 },
+    { 0x80110412, 23086, 28 },
+    { 0x80110413, 23115, 30 },
+    { 0x80110414, 23146, 29 },
+    { 0x80110418, 23176, 29 },
+    { 0x80110419, 23206, 26 },
+    { 0x8011041A, 23233, 28 },
+    { 0x8011041B, 23262, 24 },
+    { 0x8011041D, 23287, 24 },
+    { 0x8011041E, 23312, 27 },
+    { 0x8011041F, 23340, 25 },
+    { 0x80110423, 23366, 26 },
+    { 0x80110424, 23393, 32 },
+    { 0x80110425, 23426, 31 },
+    { 0x80110426, 23458, 31 },
+    { 0x80110427, 23490, 33 },
+    { 0x80110428, 23524, 26 },
+    { 0x80110429, 23551, 34 },
+    { 0x8011042A, 23586, 24 },
+    { 0x8011042B, 23611, 24 },
+    { 0x8011042C, 23636, 18 },
+    { 0x8011042D, 23655, 27 },
+    { 0x8011042E, 23683, 29 },
+    { 0x80110430, 23713, 22 },
+    { 0x80110433, 23736, 20 },
+    { 0x80110434, 23757, 31 },
+    { 0x80110435, 23789, 29 },
+    { 0x80110436, 23819, 30 },
+    { 0x80110437, 23850, 29 },
+    { 0x80110438, 23880, 23 },
+    { 0x80110439, 23904, 26 },
+    { 0x8011043B, 23931, 26 },
+    { 0x8011043C, 23958, 28 },
+    { 0x8011043E, 23987, 24 },
+    { 0x8011043F, 24012, 28 },
+    { 0x80110446, 24041, 31 },
+    { 0x80110447, 24073, 30 },
+    { 0x80110448, 24104, 37 },
+    { 0x80110449, 24142, 38 },
+    { 0x8011044A, 24181, 35 },
+    { 0x8011044B, 24217, 28 },
+    { 0x8011044C, 24246, 33 },
+    { 0x8011044D, 24280, 38 },
+    { 0x8011044E, 24319, 40 },
+    { 0x8011044F, 24360, 37 },
+    { 0x80110450, 24398, 30 },
+    { 0x80110451, 24429, 29 },
+    { 0x80110457, 24459, 39 },
+    { 0x80110458, 24499, 37 },
+    { 0x80110459, 24537, 31 },
+    { 0x8011045A, 24569, 41 },
+    { 0x8011045B, 24611, 46 },
+    { 0x8011045C, 24658, 37 },
+    { 0x8011045D, 24696, 35 },
+    { 0x80110472, 24732, 31 },
+    { 0x80110473, 24764, 24 },
+    { 0x80110474, 24789, 26 },
+    { 0x80110475, 24816, 31 },
+    { 0x80110480, 24848, 34 },
+    { 0x80110481, 24883, 29 },
+    { 0x80110482, 24913, 30 },
+    { 0x80110483, 24944, 34 },
+    { 0x80110484, 24979, 30 },
+    { 0x80110485, 25010, 41 },
+    { 0x80110486, 25052, 26 },
+    { 0x80110600, 25079, 30 },
+    { 0x80110601, 25110, 31 },
+    { 0x80110602, 25142, 37 },
+    { 0x80110603, 25180, 25 },
+    { 0x80110604, 25206, 19 },
+    { 0x80110605, 25226, 23 },
+    { 0x80110606, 25250, 26 },
+    { 0x80110701, 25277, 26 },
+    { 0x80110808, 25304, 32 },
+    { 0x80110809, 25337, 32 },
+    { 0x8011080A, 25370, 26 },
+    { 0x8011080B, 25397, 28 },
+    { 0x8011080D, 25426, 44 },
+    { 0x8011080E, 25471, 22 },
+    { 0x8011080F, 25494, 33 },
+    { 0x80110811, 25528, 33 },
+    { 0x80110812, 25562, 33 },
+    { 0x80110813, 25596, 40 },
+    { 0x80110814, 25637, 32 },
+    { 0x80110815, 25670, 29 },
+    { 0x80110816, 25700, 39 },
+    { 0x80110817, 25740, 40 },
+    { 0x80110818, 25781, 33 },
+    { 0x80110819, 25815, 29 },
+    { 0x8011081A, 25845, 48 },
+    { 0x8011081B, 25894, 56 },
+    { 0x8011081C, 25951, 27 },
+    { 0x8011081D, 25979, 25 },
+    { 0x8011081E, 26005, 28 },
+    { 0x8011081F, 26034, 40 },
+    { 0x80110820, 26075, 34 },
+    { 0x80110821, 26110, 31 },
+    { 0x80110822, 26142, 23 },
+    { 0x80110823, 26166, 32 },
+    { 0x80110824, 26199, 30 },
+    { 0x80284001, 26230, 20 },
+    { 0x80284002, 26251, 19 },
+    { 0x80284003, 26271, 28 },
+    { 0x80284005, 26300, 25 },
+    { 0x80284006, 26326, 13 },
+    { 0x80284007, 26340, 27 },
+    { 0x80284008, 26368, 25 },
+    { 0x80284009, 26394, 27 },
+    { 0x8028400B, 26422, 27 },
+    { 0x8028400E, 26450, 22 },
+    { 0x8028400F, 26473, 19 },
+    { 0x80284010, 26493, 22 },
+    { 0x80284016, 26516, 17 },
+    { 0x80320001, 26534, 23 },
+    { 0x80320002, 26558, 25 },
+    { 0x80320003, 26584, 22 },
+    { 0x80320004, 26607, 21 },
+    { 0x80320005, 26629, 24 },
+    { 0x80320006, 26654, 32 },
+    { 0x80320007, 26687, 24 },
+    { 0x80320008, 26712, 15 },
+    { 0x80320009, 26728, 20 },
+    { 0x8032000A, 26749, 12 },
+    { 0x8032000B, 26762, 33 },
+    { 0x8032000C, 26796, 19 },
+    { 0x8032000D, 26816, 24 },
+    { 0x8032000E, 26841, 21 },
+    { 0x8032000F, 26863, 17 },
+    { 0x80320010, 26881, 21 },
+    { 0x80320011, 26903, 22 },
+    { 0x80320012, 26926, 13 },
+    { 0x80320013, 26940, 25 },
+    { 0x80320014, 26966, 24 },
+    { 0x80320015, 26991, 21 },
+    { 0x80320016, 27013, 23 },
+    { 0x80320017, 27037, 20 },
+    { 0x80320018, 27058, 23 },
+    { 0x80320019, 27082, 26 },
+    { 0x8032001A, 27109, 22 },
+    { 0x8032001B, 27132, 27 },
+    { 0x8032001C, 27160, 18 },
+    { 0x8032001D, 27179, 24 },
+    { 0x8032001E, 27204, 19 },
+    { 0x8032001F, 27224, 22 },
+    { 0x80320020, 27247, 19 },
+    { 0x80320021, 27267, 22 },
+    { 0x80320022, 27290, 23 },
+    { 0x80320023, 27314, 23 },
+    { 0x80320024, 27338, 25 },
+    { 0x80320025, 27364, 20 },
+    { 0x80320026, 27385, 25 },
+    { 0x80320027, 27411, 19 },
+    { 0x80320028, 27431, 19 },
+    { 0x80320029, 27451, 14 },
+    { 0x8032002A, 27466, 25 },
+    { 0x8032002B, 27492, 22 },
+    { 0x8032002C, 27515, 36 },
+    { 0x8032002D, 27552, 39 },
+    { 0x8032002E, 27592, 37 },
+    { 0x8032002F, 27630, 39 },
+    { 0x80320030, 27670, 30 },
+    { 0x80320031, 27701, 27 },
+    { 0x80320032, 27729, 22 },
+    { 0x80320033, 27752, 17 },
+    { 0x80320034, 27770, 31 },
+    { 0x80320035, 27802, 23 },
+    { 0x80320036, 27826, 24 },
+    { 0x80320037, 27851, 33 },
+    { 0x80320038, 27885, 28 },
+    { 0x80320039, 27914, 30 },
+    { 0xC0090001, 27945, 23 },
+    { 0xC0090002, 27969, 23 },
+};
+
+// Indices into qt_hresultNameTable, sorted by name.
+static Q_DECL_CONSTEXPR const quint16 qt_hresultNameOrder[] = {
+     342,   15,   16,   17,  328,  329,  758,  766,  778,  756,  768,  745,
+     743,  754,  769,  782,  761,  749,  759,  747,  774,  752,  779,  755,
+     763,  757,  744,  753,  746,  751,  750,  748,  772,  771,  773,  767,
+     765,  776,  777,  780,  775,  764,  760,  770,  781,  762,  840,  845,
+     835,  831,  850,  849,  837,  838,  834,  836,  844,  842,  833,  848,
+     839,  843,  832,  846,  318,  317,  319,  357,  358,  355,  354,  356,
+     996, 1058, 1059, 1016, 1001, 1041,  998,  999,  997, 1081, 1008, 1000,
+    1015, 1007, 1100, 1051, 1101, 1003, 1089, 1085, 1086, 1048, 1045, 1047,
+    1046, 1066, 1053, 1057, 1054, 1055, 1069, 1070, 1067, 1068, 1010, 1022,
+    1021, 1018, 1020, 1019, 1031, 1023, 1036, 1028, 1098, 1027, 1099, 1097,
+    1032, 1091, 1014, 1012, 1049, 1056, 1005, 1082,  995, 1095, 1096, 1050,
+    1065, 1064, 1006, 1013, 1024, 1025, 1039, 1004,  993, 1035,  994, 1040,
+    1080, 1079, 1105, 1093, 1094, 1088, 1102, 1087, 1090, 1034, 1038, 1092,
+    1063, 1060, 1061, 1062, 1037, 1029, 1017, 1104, 1011, 1044, 1002, 1042,
+    1103, 1033, 1026, 1052, 1043, 1083, 1030, 1009, 1084, 1071, 1075, 1074,
+    1072, 1073, 1076, 1077,  485,  486,  487,  498,  499,  490,  491,  489,
+     492,  488,  350,  349,  347,  348,  353,  351,  352,   22,  171,  187,
+     191,  493,  495,  494,  496,  376,  389,  380,  381,  103,   98,  515,
+      82,  192,  377,   81,  378,  512,  101,  102,   93,  175,   86,  503,
+     190,  383,  382,  384,  186,  185,  184,  183,  165,  167,  181,  164,
+     189,  166,  169,  170,   94,  379,  188,  497,   71,   70,   80,   72,
+      79,   77,   78,   76,   69,   68,   74,   73,   75,  174,  507,   89,
+     179,  177,  109,   97,  172,  502,  501,  178,  176,  506,  505,  375,
+     504,   95,  105,  387,  388,  386,  517,   84,  182,  390,   96,   91,
+      87,   88,   85,  513,  514,  516,  104,  100,   99,   92,  519,  180,
+      90,  108,  500,  107,  106,  168,  385,  173,   83,   52,   51,  635,
+     733,  732,  734,  735,  736,  729,  727,  726,  724,  741,  725,  728,
+     730,  742,  740,  731,  739,  737,  738,  641,  632,  645,  644,  656,
+     638,  651,  648,  669,  646,  633,  666,  634,  630,  664,  665,  667,
+     639,  676,  627,  668,  636,  647,  674,  663,  655,  654,  652,  649,
+     661,  660,  657,  675,  672,  671,  629,  677,  658,  637,  662,  659,
+     670,  650,  640,  643,  642,  631,  653,  628,  673,   61,  339,  332,
+     341,  337,  333,  338,  331,  334,  336,  335,  330,  340,   13,  826,
+     824,  823,  825,  205,  208,  203,  206,  200,  211,  210,  201,  195,
+     199,  209,  202,  196,  207,  197,  194,  204,  198,  315,  316,  314,
+      11,   10,   12,  310,  311,  305,  312,  304,  308,  313,  307,  306,
+     309, 1177, 1176,  391,  403,  402,  401,  395,  394,  404,  396,  399,
+     400,  405,  393,  392,  398,  397,   29,   28,   66,  508,   67,  509,
+     511,   64,   63,  510,   62,   65,  110, 1162, 1163, 1127, 1141, 1173,
+    1119, 1120, 1165, 1164, 1160, 1161, 1129, 1168, 1121, 1166, 1167, 1138,
+    1145, 1135, 1154, 1174, 1175, 1147, 1148, 1151, 1149, 1171, 1150, 1155,
+    1128, 1139, 1122, 1140, 1156, 1137, 1169, 1143, 1126, 1131, 1153, 1146,
+    1158, 1170, 1124, 1123, 1159, 1134, 1125, 1136, 1142, 1172, 1144, 1133,
+    1132, 1157, 1130, 1152,  346,  345,   21,  521,  520,  522,  369,  359,
+     374,  360,  366,  365,  370,  361,  371,  364,  373,  372,  367,  368,
+     518,  363,  362,   25,   24,   27,   23,   26, 1078,  815,  804,  800,
+     801,  798,  814,  816,  811,  810,  813,  807,  809,  799,  812,  797,
+     817,  818,  805,  808,  803,  806,  802,  530,  527,  531,  524,  534,
+     525,  544,  553,  533,  526,  541,  542,  543,  528,  532,  523,  529,
+     540,  537,  554,  559,  548,  547,  539,  535,  536,  538,  551,  552,
+     546,  545,  549,  550,  556,  555,  558,  557,  344,  343,   19,   20,
+      18,  286,  288,  292,  302,  295,  294,  293,  287,  300,  298,  291,
+     289,  303,  290,  301,  285,  297,  296,  299,    9,    8,    7,  696,
+     718,  683,  699,  688,  692,  689,  684,  719,  723,  704,  701,  714,
+     713,  712,  694,  711,  682,  695,  690,  687,  691,  715,  678,  681,
+     722,  679,  698,  697,  703,  721,  685,  710,  686,  680,  717,  716,
+     720,  709,  708,  706,  693,  705,  707,  700,  702,  829,  827,  828,
+     327,  325,  326,  324,  323,  321,  322,  156,  131,  112,  152,  111,
+     127,  114,  115,  142,  113,  120,  135,  121,  122,  118,  116,  137,
+     133,  162,  136,  141,  125,  119,  147,  146,  148,  149,  158,  126,
+     163,  132,  159,  155,  161,  130,  157,  138,  140,  139,  134,  123,
+     124,  117,  128,  129,  144,  160,  154,  193,  153,  145,  143,  150,
+     151,  971,  932,  944,  958,  975,  977,  965,  957,  966,  963,  962,
+     938,  951,  972,  933,  934,  935,  947,  946,  952,  969,  967,  968,
+     978,  936,  976,  959,  942,  974,  955,  945,  953,  956,  979,  960,
+     941,  948,  940,  961,  943,  939,  973,  964,  970,  949,  931,  950,
+     937,  954,  991,  992,  989,  990,  987,  988,  984,  983,  985,  982,
+     981,  980,  986,  414,  412,  413,  410,  411,  415,  409,  418,  407,
+     408,  406,  416,  417,   38,   32,   33,   35,   34,   37,   30,   31,
+      36,  591,  611,  578,  582,  567,  569,  588,  587,  614,  579,  622,
+     597,  590,  610,  615,  589,  586,  581,  580,  560,  564,  561,  568,
+     617,  624,  625,  626,  606,  607,  608,  572,  598,  575,  612,  599,
+     566,  577,  574,  571,  595,  613,  602,  621,  594,  576,  619,  603,
+     570,  618,  623,  565,  592,  605,  620,  616,  604,  600,  563,  584,
+     601,  593,  573,  562,  609,  585,  596,  583,   55,   54,   57,   53,
+      58,   56,   60,   59,  923,  926,  924,  925,  888,  852,  882,  871,
+     909,  860,  886,  887,  878,  877,  867,  907,  866,  879,  902,  873,
+     921,  874,  897,  911,  861,  930,  851,  881,  854,  914,  920,  865,
+     872,  898,  864,  903,  875,  901,  891,  895,  890,  868,  910,  912,
+     863,  857,  893,  905,  904,  919,  908,  859,  884,  922,  858,  906,
+     880,  883,  899,  894,  885,  900,  876,  862,  869,  896,  870,  889,
+     928,  917,  892,  918,  915,  853,  856,  913,  927,  916,  929,  855,
+     257,  242,  273,  266,  279,  281,  280,  283,  282,  247,  272,  274,
+     271,  253,  239,  276,  244,  263,  262,  238,  243,  258,  259,  254,
+     245,  252,  255,  246,  264,  270,  275,  268,  267,  240,  256,  250,
+     284,  265,  248,  269,  251,  278,  277,  241,  261,  260,  249,    1,
+       6,    5,    0,    3,    4,    2, 1107, 1115, 1118, 1109, 1106, 1111,
+    1108, 1110, 1117, 1112, 1114, 1113, 1116,  820,  794,  795,  792,  791,
+     847,  841,  796,  830,  790,  819,  821,  822,  789,  793,  223,  227,
+     212,  234,  235,  237,  226,  229,  222,  213,  236,  230,  220,  214,
+     233,  217,  224,  232,  219,  216,  228,  231,  218,  225,  215,  221,
+     320,   14,  419,  435,  428,  434,  430,  429,  433,  425,  423,  421,
+     422,  436,  432,  420,  427,  431,  424,  426,  462,  478,  461,  437,
+     438,  480,  479,  439,  440,  466,  465,  471,  441,  442,  443,  444,
+     459,  458,  483,  445,  463,  473,  446,  447,  457,  448,  449,  450,
+     460,  451,  452,  474,  481,  467,  484,  468,  472,  469,  470,  464,
+     482,  477,  476,  453,  454,  455,  475,  456,   47,   46,   39,   40,
+      50,   49,   44,   45,   43,   41,   48,   42,  784,  788,  783,  787,
+     785,  786,
+};
+
+static const char qt_hresultNamePool[] =
+    "STG_S_CONVERTED\0"
+    "STG_S_BLOCK\0"
+    "STG_S_RETRYNOW\0"
+    "STG_S_MONITORING\0"
+    "STG_S_MULTIPLEOPENS\0"
+    "STG_S_CONSOLIDATIONFAILED\0"
+    "STG_S_CANNOTCONSOLIDATE\0"
+    "OLE_S_USEREG\0"
+    "OLE_S_STATIC\0"
+    "OLE_S_MAC_CLIPFORMAT\0"
+    "DRAGDROP_S_DROP\0"
+    "DRAGDROP_S_CANCEL\0"
+    "DRAGDROP_S_USEDEFAULTCURSORS\0"
+    "DATA_S_SAMEFORMATETC\0"
+    "VIEW_S_ALREADY_FROZEN\0"
+    "CACHE_S_FORMATETC_NOTSUPPORTED\0"
+    "CACHE_S_SAMECACHE\0"
+    "CACHE_S_SOMECACHES_NOTUPDATED\0"
+    "OLEOBJ_S_INVALIDVERB\0"
+    "OLEOBJ_S_CANNOT_DOVERB_NOW\0"
+    "OLEOBJ_S_INVALIDHWND\0"
+    "INPLACE_S_TRUNCATED\0"
+    "CONVERT10_S_NO_PRESENTATION\0"
+    "MK_S_REDUCED_TO_SELF\0"
+    "MK_S_ME\0"
+    "MK_S_HIM\0"
+    "MK_S_US\0"
+    "MK_S_MONIKERALREADYREGISTERED\0"
+    "EVENT_S_SOME_SUBSCRIBERS_FAILED\0"
+    "EVENT_S_NOSUBSCRIBERS\0"
+    "SCHED_S_TASK_READY\0"
+    "SCHED_S_TASK_RUNNING\0"
+    "SCHED_S_TASK_DISABLED\0"
+    "SCHED_S_TASK_HAS_NOT_RUN\0"
+    "SCHED_S_TASK_NO_MORE_RUNS\0"
+    "SCHED_S_TASK_NOT_SCHEDULED\0"
+    "SCHED_S_TASK_TERMINATED\0"
+    "SCHED_S_TASK_NO_VALID_TRIGGERS\0"
+    "SCHED_S_EVENT_TRIGGER\0"
+    "XACT_S_ASYNC\0"
+    "XACT_S_DEFECT\0"
+    "XACT_S_READONLY\0"
+    "XACT_S_SOMENORETAIN\0"
+    "XACT_S_OKINFORM\0"
+    "XACT_S_MADECHANGESCONTENT\0"
+    "XACT_S_MADECHANGESINFORM\0"
+    "XACT_S_ALLNORETAIN\0"
+    "XACT_S_ABORTING\0"
+    "XACT_S_SINGLEPHASE\0"
+    "XACT_S_LOCALLY_OK\0"
+    "XACT_S_LASTRESOURCEMANAGER\0"
+    "CO_S_NOTALLINTERFACES\0"
+    "CO_S_MACHINENAMENOTFOUND\0"
+    "SEC_I_CONTINUE_NEEDED\0"
+    "SEC_I_COMPLETE_NEEDED\0"
+    "SEC_I_COMPLETE_AND_CONTINUE\0"
+    "SEC_I_LOCAL_LOGON\0"
+    "SEC_I_CONTEXT_EXPIRED\0"
+    "SEC_I_INCOMPLETE_CREDENTIALS\0"
+    "SEC_I_RENEGOTIATE\0"
+    "SEC_I_NO_LSA_CONTEXT\0"
+    "CRYPT_I_NEW_PROTECTION_REQUIRED\0"
+    "E_PENDING\0"
+    "E_NOTIMPL\0"
+    "E_NOINTERFACE\0"
+    "E_POINTER\0"
+    "E_ABORT\0"
+    "E_FAIL\0"
+    "CO_E_INIT_TLS\0"
+    "CO_E_INIT_SHARED_ALLOCATOR\0"
+    "CO_E_INIT_MEMORY_ALLOCATOR\0"
+    "CO_E_INIT_CLASS_CACHE\0"
+    "CO_E_INIT_RPC_CHANNEL\0"
+    "CO_E_INIT_TLS_SET_CHANNEL_CONTROL\0"
+    "CO_E_INIT_TLS_CHANNEL_CONTROL\0"
+    "CO_E_INIT_UNACCEPTED_USER_ALLOCATOR\0"
+    "CO_E_INIT_SCM_MUTEX_EXISTS\0"
+    "CO_E_INIT_SCM_FILE_MAPPING_EXISTS\0"
+    "CO_E_INIT_SCM_MAP_VIEW_OF_FILE\0"
+    "CO_E_INIT_SCM_EXEC_FAILURE\0"
+    "CO_E_INIT_ONLY_SINGLE_THREADED\0"
+    "CO_E_CANT_REMOTE\0"
+    "CO_E_BAD_SERVER_NAME\0"
+    "CO_E_WRONG_SERVER_IDENTITY\0"
+    "CO_E_OLE1DDE_DISABLED\0"
+    "CO_E_RUNAS_SYNTAX\0"
+    "CO_E_CREATEPROCESS_FAILURE\0"
+    "CO_E_RUNAS_CREATEPROCESS_FAILURE\0"
+    "CO_E_RUNAS_LOGON_FAILURE\0"
+    "CO_E_LAUNCH_PERMSSION_DENIED\0"
+    "CO_E_START_SERVICE_FAILURE\0"
+    "CO_E_REMOTE_COMMUNICATION_FAILURE\0"
+    "CO_E_SERVER_START_TIMEOUT\0"
+    "CO_E_CLSREG_INCONSISTENT\0"
+    "CO_E_IIDREG_INCONSISTENT\0"
+    "CO_E_NOT_SUPPORTED\0"
+    "CO_E_RELOAD_DLL\0"
+    "CO_E_MSI_ERROR\0"
+    "CO_E_ATTEMPT_TO_CREATE_OUTSIDE_CLIENT_CONTEXT\0"
+    "CO_E_SERVER_PAUSED\0"
+    "CO_E_SERVER_NOT_PAUSED\0"
+    "CO_E_CLASS_DISABLED\0"
+    "CO_E_CLRNOTAVAILABLE\0"
+    "CO_E_ASYNC_WORK_REJECTED\0"
+    "CO_E_SERVER_INIT_TIMEOUT\0"
+    "CO_E_NO_SECCTX_IN_ACTIVATE\0"
+    "CO_E_TRACKER_CONFIG\0"
+    "CO_E_THREADPOOL_CONFIG\0"
+    "CO_E_SXS_CONFIG\0"
+    "CO_E_MALFORMED_SPN\0"
+    "E_UNEXPECTED\0"
+    "RPC_E_CALL_REJECTED\0"
+    "RPC_E_CALL_CANCELED\0"
+    "RPC_E_CANTPOST_INSENDCALL\0"
+    "RPC_E_CANTCALLOUT_INASYNCCALL\0"
+    "RPC_E_CANTCALLOUT_INEXTERNALCALL\0"
+    "RPC_E_CONNECTION_TERMINATED\0"
+    "RPC_E_SERVER_DIED\0"
+    "RPC_E_CLIENT_DIED\0"
+    "RPC_E_INVALID_DATAPACKET\0"
+    "RPC_E_CANTTRANSMIT_CALL\0"
+    "RPC_E_CLIENT_CANTMARSHAL_DATA\0"
+    "RPC_E_CLIENT_CANTUNMARSHAL_DATA\0"
+    "RPC_E_SERVER_CANTMARSHAL_DATA\0"
+    "RPC_E_SERVER_CANTUNMARSHAL_DATA\0"
+    "RPC_E_INVALID_DATA\0"
+    "RPC_E_INVALID_PARAMETER\0"
+    "RPC_E_CANTCALLOUT_AGAIN\0"
+    "RPC_E_SERVER_DIED_DNE\0"
+    "RPC_E_SYS_CALL_FAILED\0"
+    "RPC_E_OUT_OF_RESOURCES\0"
+    "RPC_E_ATTEMPTED_MULTITHREAD\0"
+    "RPC_E_NOT_REGISTERED\0"
+    "RPC_E_FAULT\0"
+    "RPC_E_SERVERFAULT\0"
+    "RPC_E_CHANGED_MODE\0"
+    "RPC_E_INVALIDMETHOD\0"
+    "RPC_E_DISCONNECTED\0"
+    "RPC_E_RETRY\0"
+    "RPC_E_SERVERCALL_RETRYLATER\0"
+    "RPC_E_SERVERCALL_REJECTED\0"
+    "RPC_E_INVALID_CALLDATA\0"
+    "RPC_E_CANTCALLOUT_ININPUTSYNCCALL\0"
+    "RPC_E_WRONG_THREAD\0"
+    "RPC_E_THREAD_NOT_INIT\0"
+    "RPC_E_VERSION_MISMATCH\0"
+    "RPC_E_INVALID_HEADER\0"
+    "RPC_E_INVALID_EXTENSION\0"
+    "RPC_E_INVALID_IPID\0"
+    "RPC_E_INVALID_OBJECT\0"
+    "RPC_S_CALLPENDING\0"
+    "RPC_S_WAITONTIMER\0"
+    "RPC_E_CALL_COMPLETE\0"
+    "RPC_E_UNSECURE_CALL\0"
+    "RPC_E_TOO_LATE\0"
+    "RPC_E_NO_GOOD_SECURITY_PACKAGES\0"
+    "RPC_E_ACCESS_DENIED\0"
+    "RPC_E_REMOTE_DISABLED\0"
+    "RPC_E_INVALID_OBJREF\0"
+    "RPC_E_NO_CONTEXT\0"
+    "RPC_E_TIMEOUT\0"
+    "RPC_E_NO_SYNC\0"
+    "RPC_E_FULLSIC_REQUIRED\0"
+    "RPC_E_INVALID_STD_NAME\0"
+    "CO_E_FAILEDTOIMPERSONATE\0"
+    "CO_E_FAILEDTOGETSECCTX\0"
+    "CO_E_FAILEDTOOPENTHREADTOKEN\0"
+    "CO_E_FAILEDTOGETTOKENINFO\0"
+    "CO_E_TRUSTEEDOESNTMATCHCLIENT\0"
+    "CO_E_FAILEDTOQUERYCLIENTBLANKET\0"
+    "CO_E_FAILEDTOSETDACL\0"
+    "CO_E_ACCESSCHECKFAILED\0"
+    "CO_E_NETACCESSAPIFAILED\0"
+    "CO_E_WRONGTRUSTEENAMESYNTAX\0"
+    "CO_E_INVALIDSID\0"
+    "CO_E_CONVERSIONFAILED\0"
+    "CO_E_NOMATCHINGSIDFOUND\0"
+    "CO_E_LOOKUPACCSIDFAILED\0"
+    "CO_E_NOMATCHINGNAMEFOUND\0"
+    "CO_E_LOOKUPACCNAMEFAILED\0"
+    "CO_E_SETSERLHNDLFAILED\0"
+    "CO_E_FAILEDTOGETWINDIR\0"
+    "CO_E_PATHTOOLONG\0"
+    "CO_E_FAILEDTOGENUUID\0"
+    "CO_E_FAILEDTOCREATEFILE\0"
+    "CO_E_FAILEDTOCLOSEHANDLE\0"
+    "CO_E_EXCEEDSYSACLLIMIT\0"
+    "CO_E_ACESINWRONGORDER\0"
+    "CO_E_INCOMPATIBLESTREAMVERSION\0"
+    "CO_E_FAILEDTOOPENPROCESSTOKEN\0"
+    "CO_E_DECODEFAILED\0"
+    "CO_E_ACNOTINITIALIZED\0"
+    "CO_E_CANCEL_DISABLED\0"
+    "RPC_E_UNEXPECTED\0"
+    "DISP_E_UNKNOWNINTERFACE\0"
+    "DISP_E_MEMBERNOTFOUND\0"
+    "DISP_E_PARAMNOTFOUND\0"
+    "DISP_E_TYPEMISMATCH\0"
+    "DISP_E_UNKNOWNNAME\0"
+    "DISP_E_NONAMEDARGS\0"
+    "DISP_E_BADVARTYPE\0"
+    "DISP_E_EXCEPTION\0"
+    "DISP_E_OVERFLOW\0"
+    "DISP_E_BADINDEX\0"
+    "DISP_E_UNKNOWNLCID\0"
+    "DISP_E_ARRAYISLOCKED\0"
+    "DISP_E_BADPARAMCOUNT\0"
+    "DISP_E_PARAMNOTOPTIONAL\0"
+    "DISP_E_BADCALLEE\0"
+    "DISP_E_NOTACOLLECTION\0"
+    "DISP_E_DIVBYZERO\0"
+    "DISP_E_BUFFERTOOSMALL\0"
+    "TYPE_E_BUFFERTOOSMALL\0"
+    "TYPE_E_FIELDNOTFOUND\0"
+    "TYPE_E_INVDATAREAD\0"
+    "TYPE_E_UNSUPFORMAT\0"
+    "TYPE_E_REGISTRYACCESS\0"
+    "TYPE_E_LIBNOTREGISTERED\0"
+    "TYPE_E_UNDEFINEDTYPE\0"
+    "TYPE_E_QUALIFIEDNAMEDISALLOWED\0"
+    "TYPE_E_INVALIDSTATE\0"
+    "TYPE_E_WRONGTYPEKIND\0"
+    "TYPE_E_ELEMENTNOTFOUND\0"
+    "TYPE_E_AMBIGUOUSNAME\0"
+    "TYPE_E_NAMECONFLICT\0"
+    "TYPE_E_UNKNOWNLCID\0"
+    "TYPE_E_DLLFUNCTIONNOTFOUND\0"
+    "TYPE_E_BADMODULEKIND\0"
+    "TYPE_E_SIZETOOBIG\0"
+    "TYPE_E_DUPLICATEID\0"
+    "TYPE_E_INVALIDID\0"
+    "TYPE_E_TYPEMISMATCH\0"
+    "TYPE_E_OUTOFBOUNDS\0"
+    "TYPE_E_IOERROR\0"
+    "TYPE_E_CANTCREATETMPFILE\0"
+    "TYPE_E_CANTLOADLIBRARY\0"
+    "TYPE_E_INCONSISTENTPROPFUNCS\0"
+    "TYPE_E_CIRCULARTYPE\0"
+    "STG_E_INVALIDFUNCTION\0"
+    "STG_E_FILENOTFOUND\0"
+    "STG_E_PATHNOTFOUND\0"
+    "STG_E_TOOMANYOPENFILES\0"
+    "STG_E_ACCESSDENIED\0"
+    "STG_E_INVALIDHANDLE\0"
+    "STG_E_INSUFFICIENTMEMORY\0"
+    "STG_E_INVALIDPOINTER\0"
+    "STG_E_NOMOREFILES\0"
+    "STG_E_DISKISWRITEPROTECTED\0"
+    "STG_E_SEEKERROR\0"
+    "STG_E_WRITEFAULT\0"
+    "STG_E_READFAULT\0"
+    "STG_E_SHAREVIOLATION\0"
+    "STG_E_LOCKVIOLATION\0"
+    "STG_E_FILEALREADYEXISTS\0"
+    "STG_E_INVALIDPARAMETER\0"
+    "STG_E_MEDIUMFULL\0"
+    "STG_E_PROPSETMISMATCHED\0"
+    "STG_E_ABNORMALAPIEXIT\0"
+    "STG_E_INVALIDHEADER\0"
+    "STG_E_INVALIDNAME\0"
+    "STG_E_UNKNOWN\0"
+    "STG_E_UNIMPLEMENTEDFUNCTION\0"
+    "STG_E_INVALIDFLAG\0"
+    "STG_E_INUSE\0"
+    "STG_E_NOTCURRENT\0"
+    "STG_E_REVERTED\0"
+    "STG_E_CANTSAVE\0"
+    "STG_E_OLDFORMAT\0"
+    "STG_E_OLDDLL\0"
+    "STG_E_SHAREREQUIRED\0"
+    "STG_E_NOTFILEBASEDSTORAGE\0"
+    "STG_E_EXTANTMARSHALLINGS\0"
+    "STG_E_DOCFILECORRUPT\0"
+    "STG_E_BADBASEADDRESS\0"
+    "STG_E_DOCFILETOOLARGE\0"
+    "STG_E_NOTSIMPLEFORMAT\0"
+    "STG_E_INCOMPLETE\0"
+    "STG_E_TERMINATED\0"
+    "STG_E_STATUS_COPY_PROTECTION_FAILURE\0"
+    "STG_E_CSS_AUTHENTICATION_FAILURE\0"
+    "STG_E_CSS_KEY_NOT_PRESENT\0"
+    "STG_E_CSS_KEY_NOT_ESTABLISHED\0"
+    "STG_E_CSS_SCRAMBLED_SECTOR\0"
+    "STG_E_CSS_REGION_MISMATCH\0"
+    "STG_E_RESETS_EXHAUSTED\0"
+    "OLE_E_OLEVERB\0"
+    "OLE_E_ADVF\0"
+    "OLE_E_ENUM_NOMORE\0"
+    "OLE_E_ADVISENOTSUPPORTED\0"
+    "OLE_E_NOCONNECTION\0"
+    "OLE_E_NOTRUNNING\0"
+    "OLE_E_NOCACHE\0"
+    "OLE_E_BLANK\0"
+    "OLE_E_CLASSDIFF\0"
+    "OLE_E_CANT_GETMONIKER\0"
+    "OLE_E_CANT_BINDTOSOURCE\0"
+    "OLE_E_STATIC\0"
+    "OLE_E_PROMPTSAVECANCELLED\0"
+    "OLE_E_INVALIDRECT\0"
+    "OLE_E_WRONGCOMPOBJ\0"
+    "OLE_E_INVALIDHWND\0"
+    "OLE_E_NOT_INPLACEACTIVE\0"
+    "OLE_E_CANTCONVERT\0"
+    "OLE_E_NOSTORAGE\0"
+    "DV_E_FORMATETC\0"
+    "DV_E_DVTARGETDEVICE\0"
+    "DV_E_STGMEDIUM\0"
+    "DV_E_STATDATA\0"
+    "DV_E_LINDEX\0"
+    "DV_E_TYMED\0"
+    "DV_E_CLIPFORMAT\0"
+    "DV_E_DVASPECT\0"
+    "DV_E_DVTARGETDEVICE_SIZE\0"
+    "DV_E_NOIVIEWOBJECT\0"
+    "DRAGDROP_E_NOTREGISTERED\0"
+    "DRAGDROP_E_ALREADYREGISTERED\0"
+    "DRAGDROP_E_INVALIDHWND\0"
+    "CLASS_E_NOAGGREGATION\0"
+    "CLASS_E_CLASSNOTAVAILABLE\0"
+    "CLASS_E_NOTLICENSED\0"
+    "VIEW_E_DRAW\0"
+    "REGDB_E_READREGDB\0"
+    "REGDB_E_WRITEREGDB\0"
+    "REGDB_E_KEYMISSING\0"
+    "REGDB_E_INVALIDVALUE\0"
+    "REGDB_E_CLASSNOTREG\0"
+    "REGDB_E_IIDNOTREG\0"
+    "REGDB_E_BADTHREADINGMODEL\0"
+    "CAT_E_CATIDNOEXIST\0"
+    "CAT_E_NODESCRIPTION\0"
+    "CS_E_PACKAGE_NOTFOUND\0"
+    "CS_E_NOT_DELETABLE\0"
+    "CS_E_CLASS_NOTFOUND\0"
+    "CS_E_INVALID_VERSION\0"
+    "CS_E_NO_CLASSSTORE\0"
+    "CS_E_OBJECT_NOTFOUND\0"
+    "CS_E_OBJECT_ALREADY_EXISTS\0"
+    "CS_E_INVALID_PATH\0"
+    "CS_E_NETWORK_ERROR\0"
+    "CS_E_ADMIN_LIMIT_EXCEEDED\0"
+    "CS_E_SCHEMA_MISMATCH\0"
+    "CS_E_INTERNAL_ERROR\0"
+    "CACHE_E_NOCACHE_UPDATED\0"
+    "OLEOBJ_E_NOVERBS\0"
+    "OLEOBJ_E_INVALIDVERB\0"
+    "INPLACE_E_NOTUNDOABLE\0"
+    "INPLACE_E_NOTOOLSPACE\0"
+    "CONVERT10_E_OLESTREAM_GET\0"
+    "CONVERT10_E_OLESTREAM_PUT\0"
+    "CONVERT10_E_OLESTREAM_FMT\0"
+    "CONVERT10_E_OLESTREAM_BITMAP_TO_DIB\0"
+    "CONVERT10_E_STG_FMT\0"
+    "CONVERT10_E_STG_NO_STD_STREAM\0"
+    "CONVERT10_E_STG_DIB_TO_BITMAP\0"
+    "CLIPBRD_E_CANT_OPEN\0"
+    "CLIPBRD_E_CANT_EMPTY\0"
+    "CLIPBRD_E_CANT_SET\0"
+    "CLIPBRD_E_BAD_DATA\0"
+    "CLIPBRD_E_CANT_CLOSE\0"
+    "MK_E_CONNECTMANUALLY\0"
+    "MK_E_EXCEEDEDDEADLINE\0"
+    "MK_E_NEEDGENERIC\0"
+    "MK_E_UNAVAILABLE\0"
+    "MK_E_SYNTAX\0"
+    "MK_E_NOOBJECT\0"
+    "MK_E_INVALIDEXTENSION\0"
+    "MK_E_INTERMEDIATEINTERFACENOTSUPPORTED\0"
+    "MK_E_NOTBINDABLE\0"
+    "MK_E_NOTBOUND\0"
+    "MK_E_CANTOPENFILE\0"
+    "MK_E_MUSTBOTHERUSER\0"
+    "MK_E_NOINVERSE\0"
+    "MK_E_NOSTORAGE\0"
+    "MK_E_NOPREFIX\0"
+    "MK_E_ENUMERATION_FAILED\0"
+    "CO_E_NOTINITIALIZED\0"
+    "CO_E_ALREADYINITIALIZED\0"
+    "CO_E_CANTDETERMINECLASS\0"
+    "CO_E_CLASSSTRING\0"
+    "CO_E_IIDSTRING\0"
+    "CO_E_APPNOTFOUND\0"
+    "CO_E_APPSINGLEUSE\0"
+    "CO_E_ERRORINAPP\0"
+    "CO_E_DLLNOTFOUND\0"
+    "CO_E_ERRORINDLL\0"
+    "CO_E_WRONGOSFORAPP\0"
+    "CO_E_OBJNOTREG\0"
+    "CO_E_OBJISREG\0"
+    "CO_E_OBJNOTCONNECTED\0"
+    "CO_E_APPDIDNTREG\0"
+    "CO_E_RELEASED\0"
+    "EVENT_E_ALL_SUBSCRIBERS_FAILED\0"
+    "EVENT_E_QUERYSYNTAX\0"
+    "EVENT_E_QUERYFIELD\0"
+    "EVENT_E_INTERNALEXCEPTION\0"
+    "EVENT_E_INTERNALERROR\0"
+    "EVENT_E_INVALID_PER_USER_SID\0"
+    "EVENT_E_USER_EXCEPTION\0"
+    "EVENT_E_TOO_MANY_METHODS\0"
+    "EVENT_E_MISSING_EVENTCLASS\0"
+    "EVENT_E_NOT_ALL_REMOVED\0"
+    "EVENT_E_COMPLUS_NOT_INSTALLED\0"
+    "EVENT_E_CANT_MODIFY_OR_DELETE_UNCONFIGURED_OBJECT\0"
+    "EVENT_E_CANT_MODIFY_OR_DELETE_CONFIGURED_OBJECT\0"
+    "EVENT_E_INVALID_EVENT_CLASS_PARTITION\0"
+    "EVENT_E_PER_USER_SID_NOT_LOGGED_ON\0"
+    "SCHED_E_TRIGGER_NOT_FOUND\0"
+    "SCHED_E_TASK_NOT_READY\0"
+    "SCHED_E_TASK_NOT_RUNNING\0"
+    "SCHED_E_SERVICE_NOT_INSTALLED\0"
+    "SCHED_E_CANNOT_OPEN_TASK\0"
+    "SCHED_E_INVALID_TASK\0"
+    "SCHED_E_ACCOUNT_INFORMATION_NOT_SET\0"
+    "SCHED_E_ACCOUNT_NAME_NOT_FOUND\0"
+    "SCHED_E_ACCOUNT_DBASE_CORRUPT\0"
+    "SCHED_E_NO_SECURITY_SERVICES\0"
+    "SCHED_E_UNKNOWN_OBJECT_VERSION\0"
+    "SCHED_E_UNSUPPORTED_ACCOUNT_OPTION\0"
+    "SCHED_E_SERVICE_NOT_RUNNING\0"
+    "VSS_E_BAD_STATE\0"
+    "VSS_E_UNEXPECTED\0"
+    "VSS_E_PROVIDER_NOT_REGISTERED\0"
+    "VSS_E_PROVIDER_VETO\0"
+    "VSS_E_OBJECT_NOT_FOUND\0"
+    "VSS_E_VOLUME_NOT_SUPPORTED\0"
+    "VSS_E_OBJECT_ALREADY_EXISTS\0"
+    "VSS_E_VOLUME_NOT_SUPPORTED_BY_PROVIDER\0"
+    "VSS_E_UNEXPECTED_PROVIDER_ERROR\0"
+    "VSS_E_INVALID_XML_DOCUMENT\0"
+    "VSS_E_MAXIMUM_NUMBER_OF_VOLUMES_REACHED\0"
+    "VSS_E_MAXIMUM_NUMBER_OF_SNAPSHOTS_REACHED\0"
+    "VSS_E_UNSELECTED_VOLUME\0"
+    "VSS_E_SNAPSHOT_NOT_IN_SET\0"
+    "VSS_E_NESTED_VOLUME_LIMIT\0"
+    "VSS_E_LEGACY_PROVIDER\0"
+    "VSS_E_CANNOT_REVERT_DISKID\0"
+    "VSS_E_RESYNC_IN_PROGRESS\0"
+    "XACT_E_ALREADYOTHERSINGLEPHASE\0"
+    "XACT_E_CANTRETAIN\0"
+    "XACT_E_COMMITFAILED\0"
+    "XACT_E_COMMITPREVENTED\0"
+    "XACT_E_HEURISTICABORT\0"
+    "XACT_E_HEURISTICCOMMIT\0"
+    "XACT_E_HEURISTICDAMAGE\0"
+    "XACT_E_HEURISTICDANGER\0"
+    "XACT_E_ISOLATIONLEVEL\0"
+    "XACT_E_NOASYNC\0"
+    "XACT_E_NOENLIST\0"
+    "XACT_E_NOISORETAIN\0"
+    "XACT_E_NORESOURCE\0"
+    "XACT_E_NOTCURRENT\0"
+    "XACT_E_NOTRANSACTION\0"
+    "XACT_E_NOTSUPPORTED\0"
+    "XACT_E_UNKNOWNRMGRID\0"
+    "XACT_E_WRONGSTATE\0"
+    "XACT_E_WRONGUOW\0"
+    "XACT_E_XTIONEXISTS\0"
+    "XACT_E_NOIMPORTOBJECT\0"
+    "XACT_E_INVALIDCOOKIE\0"
+    "XACT_E_INDOUBT\0"
+    "XACT_E_NOTIMEOUT\0"
+    "XACT_E_ALREADYINPROGRESS\0"
+    "XACT_E_ABORTED\0"
+    "XACT_E_LOGFULL\0"
+    "XACT_E_TMNOTAVAILABLE\0"
+    "XACT_E_CONNECTION_DOWN\0"
+    "XACT_E_CONNECTION_DENIED\0"
+    "XACT_E_REENLISTTIMEOUT\0"
+    "XACT_E_TIP_CONNECT_FAILED\0"
+    "XACT_E_TIP_PROTOCOL_ERROR\0"
+    "XACT_E_TIP_PULL_FAILED\0"
+    "XACT_E_DEST_TMNOTAVAILABLE\0"
+    "XACT_E_TIP_DISABLED\0"
+    "XACT_E_NETWORK_TX_DISABLED\0"
+    "XACT_E_PARTNER_NETWORK_TX_DISABLED\0"
+    "XACT_E_XA_TX_DISABLED\0"
+    "XACT_E_UNABLE_TO_READ_DTC_CONFIG\0"
+    "XACT_E_UNABLE_TO_LOAD_DTC_PROXY\0"
+    "XACT_E_ABORTING\0"
+    "XACT_E_CLERKNOTFOUND\0"
+    "XACT_E_CLERKEXISTS\0"
+    "XACT_E_RECOVERYINPROGRESS\0"
+    "XACT_E_TRANSACTIONCLOSED\0"
+    "XACT_E_INVALIDLSN\0"
+    "XACT_E_REPLAYREQUEST\0"
+    "CONTEXT_E_ABORTED\0"
+    "CONTEXT_E_ABORTING\0"
+    "CONTEXT_E_NOCONTEXT\0"
+    "CONTEXT_E_WOULD_DEADLOCK\0"
+    "CONTEXT_E_SYNCH_TIMEOUT\0"
+    "CONTEXT_E_OLDREF\0"
+    "CONTEXT_E_ROLENOTFOUND\0"
+    "CONTEXT_E_TMNOTAVAILABLE\0"
+    "CO_E_ACTIVATIONFAILED\0"
+    "CO_E_ACTIVATIONFAILED_EVENTLOGGED\0"
+    "CO_E_ACTIVATIONFAILED_CATALOGERROR\0"
+    "CO_E_ACTIVATIONFAILED_TIMEOUT\0"
+    "CO_E_INITIALIZATIONFAILED\0"
+    "CONTEXT_E_NOJIT\0"
+    "CONTEXT_E_NOTRANSACTION\0"
+    "CO_E_THREADINGMODEL_CHANGED\0"
+    "CO_E_NOIISINTRINSICS\0"
+    "CO_E_NOCOOKIES\0"
+    "CO_E_DBERROR\0"
+    "CO_E_NOTPOOLED\0"
+    "CO_E_NOTCONSTRUCTED\0"
+    "CO_E_NOSYNCHRONIZATION\0"
+    "CO_E_ISOLEVELMISMATCH\0"
+    "E_ACCESSDENIED\0"
+    "E_HANDLE\0"
+    "E_OUTOFMEMORY\0"
+    "E_INVALIDARG\0"
+    "CO_E_CLASS_CREATE_FAILED\0"
+    "CO_E_SCM_ERROR\0"
+    "CO_E_SCM_RPC_FAILURE\0"
+    "CO_E_BAD_PATH\0"
+    "CO_E_SERVER_EXEC_FAILURE\0"
+    "CO_E_OBJSRV_RPC_FAILURE\0"
+    "MK_E_NO_NORMALIZED\0"
+    "CO_E_SERVER_STOPPING\0"
+    "MEM_E_INVALID_ROOT\0"
+    "MEM_E_INVALID_LINK\0"
+    "MEM_E_INVALID_SIZE\0"
+    "NTE_BAD_UID\0"
+    "NTE_BAD_HASH\0"
+    "NTE_BAD_KEY\0"
+    "NTE_BAD_LEN\0"
+    "NTE_BAD_DATA\0"
+    "NTE_BAD_SIGNATURE\0"
+    "NTE_BAD_VER\0"
+    "NTE_BAD_ALGID\0"
+    "NTE_BAD_FLAGS\0"
+    "NTE_BAD_TYPE\0"
+    "NTE_BAD_KEY_STATE\0"
+    "NTE_BAD_HASH_STATE\0"
+    "NTE_NO_KEY\0"
+    "NTE_NO_MEMORY\0"
+    "NTE_EXISTS\0"
+    "NTE_PERM\0"
+    "NTE_NOT_FOUND\0"
+    "NTE_DOUBLE_ENCRYPT\0"
+    "NTE_BAD_PROVIDER\0"
+    "NTE_BAD_PROV_TYPE\0"
+    "NTE_BAD_PUBLIC_KEY\0"
+    "NTE_BAD_KEYSET\0"
+    "NTE_PROV_TYPE_NOT_DEF\0"
+    "NTE_PROV_TYPE_ENTRY_BAD\0"
+    "NTE_KEYSET_NOT_DEF\0"
+    "NTE_KEYSET_ENTRY_BAD\0"
+    "NTE_PROV_TYPE_NO_MATCH\0"
+    "NTE_SIGNATURE_FILE_BAD\0"
+    "NTE_PROVIDER_DLL_FAIL\0"
+    "NTE_PROV_DLL_NOT_FOUND\0"
+    "NTE_BAD_KEYSET_PARAM\0"
+    "NTE_FAIL\0"
+    "NTE_SYS_ERR\0"
+    "NTE_SILENT_CONTEXT\0"
+    "NTE_TOKEN_KEYSET_STORAGE_FULL\0"
+    "NTE_TEMPORARY_PROFILE\0"
+    "NTE_FIXEDPARAMETER\0"
+    "SEC_E_INSUFFICIENT_MEMORY\0"
+    "SEC_E_INVALID_HANDLE\0"
+    "SEC_E_UNSUPPORTED_FUNCTION\0"
+    "SEC_E_TARGET_UNKNOWN\0"
+    "SEC_E_INTERNAL_ERROR\0"
+    "SEC_E_SECPKG_NOT_FOUND\0"
+    "SEC_E_NOT_OWNER\0"
+    "SEC_E_CANNOT_INSTALL\0"
+    "SEC_E_INVALID_TOKEN\0"
+    "SEC_E_CANNOT_PACK\0"
+    "SEC_E_QOP_NOT_SUPPORTED\0"
+    "SEC_E_NO_IMPERSONATION\0"
+    "SEC_E_LOGON_DENIED\0"
+    "SEC_E_UNKNOWN_CREDENTIALS\0"
+    "SEC_E_NO_CREDENTIALS\0"
+    "SEC_E_MESSAGE_ALTERED\0"
+    "SEC_E_OUT_OF_SEQUENCE\0"
+    "SEC_E_NO_AUTHENTICATING_AUTHORITY\0"
+    "SEC_E_BAD_PKGID\0"
+    "SEC_E_CONTEXT_EXPIRED\0"
+    "SEC_E_INCOMPLETE_MESSAGE\0"
+    "SEC_E_INCOMPLETE_CREDENTIALS\0"
+    "SEC_E_BUFFER_TOO_SMALL\0"
+    "SEC_E_WRONG_PRINCIPAL\0"
+    "SEC_E_TIME_SKEW\0"
+    "SEC_E_UNTRUSTED_ROOT\0"
+    "SEC_E_ILLEGAL_MESSAGE\0"
+    "SEC_E_CERT_UNKNOWN\0"
+    "SEC_E_CERT_EXPIRED\0"
+    "SEC_E_ENCRYPT_FAILURE\0"
+    "SEC_E_DECRYPT_FAILURE\0"
+    "SEC_E_ALGORITHM_MISMATCH\0"
+    "SEC_E_SECURITY_QOS_FAILED\0"
+    "SEC_E_UNFINISHED_CONTEXT_DELETED\0"
+    "SEC_E_NO_TGT_REPLY\0"
+    "SEC_E_NO_IP_ADDRESSES\0"
+    "SEC_E_WRONG_CREDENTIAL_HANDLE\0"
+    "SEC_E_CRYPTO_SYSTEM_INVALID\0"
+    "SEC_E_MAX_REFERRALS_EXCEEDED\0"
+    "SEC_E_MUST_BE_KDC\0"
+    "SEC_E_STRONG_CRYPTO_NOT_SUPPORTED\0"
+    "SEC_E_TOO_MANY_PRINCIPALS\0"
+    "SEC_E_NO_PA_DATA\0"
+    "SEC_E_PKINIT_NAME_MISMATCH\0"
+    "SEC_E_SMARTCARD_LOGON_REQUIRED\0"
+    "SEC_E_SHUTDOWN_IN_PROGRESS\0"
+    "SEC_E_KDC_INVALID_REQUEST\0"
+    "SEC_E_KDC_UNABLE_TO_REFER\0"
+    "SEC_E_KDC_UNKNOWN_ETYPE\0"
+    "SEC_E_UNSUPPORTED_PREAUTH\0"
+    "SEC_E_DELEGATION_REQUIRED\0"
+    "SEC_E_BAD_BINDINGS\0"
+    "SEC_E_MULTIPLE_ACCOUNTS\0"
+    "SEC_E_NO_KERB_KEY\0"
+    "SEC_E_CERT_WRONG_USAGE\0"
+    "SEC_E_DOWNGRADE_DETECTED\0"
+    "SEC_E_SMARTCARD_CERT_REVOKED\0"
+    "SEC_E_ISSUING_CA_UNTRUSTED\0"
+    "SEC_E_REVOCATION_OFFLINE_C\0"
+    "SEC_E_PKINIT_CLIENT_FAILURE\0"
+    "SEC_E_SMARTCARD_CERT_EXPIRED\0"
+    "SEC_E_NO_S4U_PROT_SUPPORT\0"
+    "SEC_E_CROSSREALM_DELEGATION_FAILURE\0"
+    "SEC_E_REVOCATION_OFFLINE_KDC\0"
+    "SEC_E_ISSUING_CA_UNTRUSTED_KDC\0"
+    "SEC_E_KDC_CERT_EXPIRED\0"
+    "SEC_E_KDC_CERT_REVOKED\0"
+    "CRYPT_E_MSG_ERROR\0"
+    "CRYPT_E_UNKNOWN_ALGO\0"
+    "CRYPT_E_OID_FORMAT\0"
+    "CRYPT_E_INVALID_MSG_TYPE\0"
+    "CRYPT_E_UNEXPECTED_ENCODING\0"
+    "CRYPT_E_AUTH_ATTR_MISSING\0"
+    "CRYPT_E_HASH_VALUE\0"
+    "CRYPT_E_INVALID_INDEX\0"
+    "CRYPT_E_ALREADY_DECRYPTED\0"
+    "CRYPT_E_NOT_DECRYPTED\0"
+    "CRYPT_E_RECIPIENT_NOT_FOUND\0"
+    "CRYPT_E_CONTROL_TYPE\0"
+    "CRYPT_E_ISSUER_SERIALNUMBER\0"
+    "CRYPT_E_SIGNER_NOT_FOUND\0"
+    "CRYPT_E_ATTRIBUTES_MISSING\0"
+    "CRYPT_E_STREAM_MSG_NOT_READY\0"
+    "CRYPT_E_STREAM_INSUFFICIENT_DATA\0"
+    "CRYPT_E_BAD_LEN\0"
+    "CRYPT_E_BAD_ENCODE\0"
+    "CRYPT_E_FILE_ERROR\0"
+    "CRYPT_E_NOT_FOUND\0"
+    "CRYPT_E_EXISTS\0"
+    "CRYPT_E_NO_PROVIDER\0"
+    "CRYPT_E_SELF_SIGNED\0"
+    "CRYPT_E_DELETED_PREV\0"
+    "CRYPT_E_NO_MATCH\0"
+    "CRYPT_E_UNEXPECTED_MSG_TYPE\0"
+    "CRYPT_E_NO_KEY_PROPERTY\0"
+    "CRYPT_E_NO_DECRYPT_CERT\0"
+    "CRYPT_E_BAD_MSG\0"
+    "CRYPT_E_NO_SIGNER\0"
+    "CRYPT_E_PENDING_CLOSE\0"
+    "CRYPT_E_REVOKED\0"
+    "CRYPT_E_NO_REVOCATION_DLL\0"
+    "CRYPT_E_NO_REVOCATION_CHECK\0"
+    "CRYPT_E_REVOCATION_OFFLINE\0"
+    "CRYPT_E_NOT_IN_REVOCATION_DATABASE\0"
+    "CRYPT_E_INVALID_NUMERIC_STRING\0"
+    "CRYPT_E_INVALID_PRINTABLE_STRING\0"
+    "CRYPT_E_INVALID_IA5_STRING\0"
+    "CRYPT_E_INVALID_X500_STRING\0"
+    "CRYPT_E_NOT_CHAR_STRING\0"
+    "CRYPT_E_FILERESIZED\0"
+    "CRYPT_E_SECURITY_SETTINGS\0"
+    "CRYPT_E_NO_VERIFY_USAGE_DLL\0"
+    "CRYPT_E_NO_VERIFY_USAGE_CHECK\0"
+    "CRYPT_E_VERIFY_USAGE_OFFLINE\0"
+    "CRYPT_E_NOT_IN_CTL\0"
+    "CRYPT_E_NO_TRUSTED_SIGNER\0"
+    "CRYPT_E_MISSING_PUBKEY_PARA\0"
+    "CRYPT_E_OSS_ERROR\0"
+    "OSS_MORE_BUF\0"
+    "OSS_NEGATIVE_UINTEGER\0"
+    "OSS_PDU_RANGE\0"
+    "OSS_MORE_INPUT\0"
+    "OSS_DATA_ERROR\0"
+    "OSS_BAD_ARG\0"
+    "OSS_BAD_VERSION\0"
+    "OSS_OUT_MEMORY\0"
+    "OSS_PDU_MISMATCH\0"
+    "OSS_LIMITED\0"
+    "OSS_BAD_PTR\0"
+    "OSS_BAD_TIME\0"
+    "OSS_INDEFINITE_NOT_SUPPORTED\0"
+    "OSS_MEM_ERROR\0"
+    "OSS_BAD_TABLE\0"
+    "OSS_TOO_LONG\0"
+    "OSS_CONSTRAINT_VIOLATED\0"
+    "OSS_FATAL_ERROR\0"
+    "OSS_ACCESS_SERIALIZATION_ERROR\0"
+    "OSS_NULL_TBL\0"
+    "OSS_NULL_FCN\0"
+    "OSS_BAD_ENCRULES\0"
+    "OSS_UNAVAIL_ENCRULES\0"
+    "OSS_CANT_OPEN_TRACE_WINDOW\0"
+    "OSS_UNIMPLEMENTED\0"
+    "OSS_OID_DLL_NOT_LINKED\0"
+    "OSS_CANT_OPEN_TRACE_FILE\0"
+    "OSS_TRACE_FILE_ALREADY_OPEN\0"
+    "OSS_TABLE_MISMATCH\0"
+    "OSS_TYPE_NOT_SUPPORTED\0"
+    "OSS_REAL_DLL_NOT_LINKED\0"
+    "OSS_REAL_CODE_NOT_LINKED\0"
+    "OSS_OUT_OF_RANGE\0"
+    "OSS_COPIER_DLL_NOT_LINKED\0"
+    "OSS_CONSTRAINT_DLL_NOT_LINKED\0"
+    "OSS_COMPARATOR_DLL_NOT_LINKED\0"
+    "OSS_COMPARATOR_CODE_NOT_LINKED\0"
+    "OSS_MEM_MGR_DLL_NOT_LINKED\0"
+    "OSS_PDV_DLL_NOT_LINKED\0"
+    "OSS_PDV_CODE_NOT_LINKED\0"
+    "OSS_API_DLL_NOT_LINKED\0"
+    "OSS_BERDER_DLL_NOT_LINKED\0"
+    "OSS_PER_DLL_NOT_LINKED\0"
+    "OSS_OPEN_TYPE_ERROR\0"
+    "OSS_MUTEX_NOT_CREATED\0"
+    "OSS_CANT_CLOSE_TRACE_FILE\0"
+    "CRYPT_E_ASN1_ERROR\0"
+    "CRYPT_E_ASN1_INTERNAL\0"
+    "CRYPT_E_ASN1_EOD\0"
+    "CRYPT_E_ASN1_CORRUPT\0"
+    "CRYPT_E_ASN1_LARGE\0"
+    "CRYPT_E_ASN1_CONSTRAINT\0"
+    "CRYPT_E_ASN1_MEMORY\0"
+    "CRYPT_E_ASN1_OVERFLOW\0"
+    "CRYPT_E_ASN1_BADPDU\0"
+    "CRYPT_E_ASN1_BADARGS\0"
+    "CRYPT_E_ASN1_BADREAL\0"
+    "CRYPT_E_ASN1_BADTAG\0"
+    "CRYPT_E_ASN1_CHOICE\0"
+    "CRYPT_E_ASN1_RULE\0"
+    "CRYPT_E_ASN1_UTF8\0"
+    "CRYPT_E_ASN1_PDU_TYPE\0"
+    "CRYPT_E_ASN1_NYI\0"
+    "CRYPT_E_ASN1_EXTENDED\0"
+    "CRYPT_E_ASN1_NOEOD\0"
+    "CERTSRV_E_BAD_REQUESTSUBJECT\0"
+    "CERTSRV_E_NO_REQUEST\0"
+    "CERTSRV_E_BAD_REQUESTSTATUS\0"
+    "CERTSRV_E_PROPERTY_EMPTY\0"
+    "CERTSRV_E_INVALID_CA_CERTIFICATE\0"
+    "CERTSRV_E_SERVER_SUSPENDED\0"
+    "CERTSRV_E_ENCODING_LENGTH\0"
+    "CERTSRV_E_ROLECONFLICT\0"
+    "CERTSRV_E_RESTRICTEDOFFICER\0"
+    "CERTSRV_E_KEY_ARCHIVAL_NOT_CONFIGURED\0"
+    "CERTSRV_E_NO_VALID_KRA\0"
+    "CERTSRV_E_BAD_REQUEST_KEY_ARCHIVAL\0"
+    "CERTSRV_E_NO_CAADMIN_DEFINED\0"
+    "CERTSRV_E_BAD_RENEWAL_CERT_ATTRIBUTE\0"
+    "CERTSRV_E_NO_DB_SESSIONS\0"
+    "CERTSRV_E_ALIGNMENT_FAULT\0"
+    "CERTSRV_E_ENROLL_DENIED\0"
+    "CERTSRV_E_TEMPLATE_DENIED\0"
+    "CERTSRV_E_DOWNLEVEL_DC_SSL_OR_UPGRADE\0"
+    "CERTSRV_E_UNSUPPORTED_CERT_TYPE\0"
+    "CERTSRV_E_NO_CERT_TYPE\0"
+    "CERTSRV_E_TEMPLATE_CONFLICT\0"
+    "CERTSRV_E_SUBJECT_ALT_NAME_REQUIRED\0"
+    "CERTSRV_E_ARCHIVED_KEY_REQUIRED\0"
+    "CERTSRV_E_SMIME_REQUIRED\0"
+    "CERTSRV_E_BAD_RENEWAL_SUBJECT\0"
+    "CERTSRV_E_BAD_TEMPLATE_VERSION\0"
+    "CERTSRV_E_TEMPLATE_POLICY_REQUIRED\0"
+    "CERTSRV_E_SIGNATURE_POLICY_REQUIRED\0"
+    "CERTSRV_E_SIGNATURE_COUNT\0"
+    "CERTSRV_E_SIGNATURE_REJECTED\0"
+    "CERTSRV_E_ISSUANCE_POLICY_REQUIRED\0"
+    "CERTSRV_E_SUBJECT_UPN_REQUIRED\0"
+    "CERTSRV_E_SUBJECT_DIRECTORY_GUID_REQUIRED\0"
+    "CERTSRV_E_SUBJECT_DNS_REQUIRED\0"
+    "CERTSRV_E_ARCHIVED_KEY_UNEXPECTED\0"
+    "CERTSRV_E_KEY_LENGTH\0"
+    "CERTSRV_E_SUBJECT_EMAIL_REQUIRED\0"
+    "CERTSRV_E_UNKNOWN_CERT_TYPE\0"
+    "CERTSRV_E_CERT_TYPE_OVERLAP\0"
+    "XENROLL_E_KEY_NOT_EXPORTABLE\0"
+    "XENROLL_E_CANNOT_ADD_ROOT_CERT\0"
+    "XENROLL_E_RESPONSE_KA_HASH_NOT_FOUND\0"
+    "XENROLL_E_RESPONSE_UNEXPECTED_KA_HASH\0"
+    "XENROLL_E_RESPONSE_KA_HASH_MISMATCH\0"
+    "XENROLL_E_KEYSPEC_SMIME_MISMATCH\0"
+    "TRUST_E_SYSTEM_ERROR\0"
+    "TRUST_E_NO_SIGNER_CERT\0"
+    "TRUST_E_COUNTER_SIGNER\0"
+    "TRUST_E_CERT_SIGNATURE\0"
+    "TRUST_E_TIME_STAMP\0"
+    "TRUST_E_BAD_DIGEST\0"
+    "TRUST_E_BASIC_CONSTRAINTS\0"
+    "TRUST_E_FINANCIAL_CRITERIA\0"
+    "MSSIPOTF_E_OUTOFMEMRANGE\0"
+    "MSSIPOTF_E_CANTGETOBJECT\0"
+    "MSSIPOTF_E_NOHEADTABLE\0"
+    "MSSIPOTF_E_BAD_MAGICNUMBER\0"
+    "MSSIPOTF_E_BAD_OFFSET_TABLE\0"
+    "MSSIPOTF_E_TABLE_TAGORDER\0"
+    "MSSIPOTF_E_TABLE_LONGWORD\0"
+    "MSSIPOTF_E_BAD_FIRST_TABLE_PLACEMENT\0"
+    "MSSIPOTF_E_TABLES_OVERLAP\0"
+    "MSSIPOTF_E_TABLE_PADBYTES\0"
+    "MSSIPOTF_E_FILETOOSMALL\0"
+    "MSSIPOTF_E_TABLE_CHECKSUM\0"
+    "MSSIPOTF_E_FILE_CHECKSUM\0"
+    "MSSIPOTF_E_FAILED_POLICY\0"
+    "MSSIPOTF_E_FAILED_HINTS_CHECK\0"
+    "MSSIPOTF_E_NOT_OPENTYPE\0"
+    "MSSIPOTF_E_FILE\0"
+    "MSSIPOTF_E_CRYPT\0"
+    "MSSIPOTF_E_BADVERSION\0"
+    "MSSIPOTF_E_DSIG_STRUCTURE\0"
+    "MSSIPOTF_E_PCONST_CHECK\0"
+    "MSSIPOTF_E_STRUCTURE\0"
+    "TRUST_E_PROVIDER_UNKNOWN\0"
+    "TRUST_E_ACTION_UNKNOWN\0"
+    "TRUST_E_SUBJECT_FORM_UNKNOWN\0"
+    "TRUST_E_SUBJECT_NOT_TRUSTED\0"
+    "DIGSIG_E_ENCODE\0"
+    "DIGSIG_E_DECODE\0"
+    "DIGSIG_E_EXTENSIBILITY\0"
+    "DIGSIG_E_CRYPTO\0"
+    "PERSIST_E_SIZEDEFINITE\0"
+    "PERSIST_E_SIZEINDEFINITE\0"
+    "PERSIST_E_NOTSELFSIZING\0"
+    "TRUST_E_NOSIGNATURE\0"
+    "CERT_E_EXPIRED\0"
+    "CERT_E_VALIDITYPERIODNESTING\0"
+    "CERT_E_ROLE\0"
+    "CERT_E_PATHLENCONST\0"
+    "CERT_E_CRITICAL\0"
+    "CERT_E_PURPOSE\0"
+    "CERT_E_ISSUERCHAINING\0"
+    "CERT_E_MALFORMED\0"
+    "CERT_E_UNTRUSTEDROOT\0"
+    "CERT_E_CHAINING\0"
+    "TRUST_E_FAIL\0"
+    "CERT_E_REVOKED\0"
+    "CERT_E_UNTRUSTEDTESTROOT\0"
+    "CERT_E_REVOCATION_FAILURE\0"
+    "CERT_E_CN_NO_MATCH\0"
+    "CERT_E_WRONG_USAGE\0"
+    "TRUST_E_EXPLICIT_DISTRUST\0"
+    "CERT_E_UNTRUSTEDCA\0"
+    "CERT_E_INVALID_POLICY\0"
+    "CERT_E_INVALID_NAME\0"
+    "SPAPI_E_EXPECTED_SECTION_NAME\0"
+    "SPAPI_E_BAD_SECTION_NAME_LINE\0"
+    "SPAPI_E_SECTION_NAME_TOO_LONG\0"
+    "SPAPI_E_GENERAL_SYNTAX\0"
+    "SPAPI_E_WRONG_INF_STYLE\0"
+    "SPAPI_E_SECTION_NOT_FOUND\0"
+    "SPAPI_E_LINE_NOT_FOUND\0"
+    "SPAPI_E_NO_BACKUP\0"
+    "SPAPI_E_NO_ASSOCIATED_CLASS\0"
+    "SPAPI_E_CLASS_MISMATCH\0"
+    "SPAPI_E_DUPLICATE_FOUND\0"
+    "SPAPI_E_NO_DRIVER_SELECTED\0"
+    "SPAPI_E_KEY_DOES_NOT_EXIST\0"
+    "SPAPI_E_INVALID_DEVINST_NAME\0"
+    "SPAPI_E_INVALID_CLASS\0"
+    "SPAPI_E_DEVINST_ALREADY_EXISTS\0"
+    "SPAPI_E_DEVINFO_NOT_REGISTERED\0"
+    "SPAPI_E_INVALID_REG_PROPERTY\0"
+    "SPAPI_E_NO_INF\0"
+    "SPAPI_E_NO_SUCH_DEVINST\0"
+    "SPAPI_E_CANT_LOAD_CLASS_ICON\0"
+    "SPAPI_E_INVALID_CLASS_INSTALLER\0"
+    "SPAPI_E_DI_DO_DEFAULT\0"
+    "SPAPI_E_DI_NOFILECOPY\0"
+    "SPAPI_E_INVALID_HWPROFILE\0"
+    "SPAPI_E_NO_DEVICE_SELECTED\0"
+    "SPAPI_E_DEVINFO_LIST_LOCKED\0"
+    "SPAPI_E_DEVINFO_DATA_LOCKED\0"
+    "SPAPI_E_DI_BAD_PATH\0"
+    "SPAPI_E_NO_CLASSINSTALL_PARAMS\0"
+    "SPAPI_E_FILEQUEUE_LOCKED\0"
+    "SPAPI_E_BAD_SERVICE_INSTALLSECT\0"
+    "SPAPI_E_NO_CLASS_DRIVER_LIST\0"
+    "SPAPI_E_NO_ASSOCIATED_SERVICE\0"
+    "SPAPI_E_NO_DEFAULT_DEVICE_INTERFACE\0"
+    "SPAPI_E_DEVICE_INTERFACE_ACTIVE\0"
+    "SPAPI_E_DEVICE_INTERFACE_REMOVED\0"
+    "SPAPI_E_BAD_INTERFACE_INSTALLSECT\0"
+    "SPAPI_E_NO_SUCH_INTERFACE_CLASS\0"
+    "SPAPI_E_INVALID_REFERENCE_STRING\0"
+    "SPAPI_E_INVALID_MACHINENAME\0"
+    "SPAPI_E_REMOTE_COMM_FAILURE\0"
+    "SPAPI_E_MACHINE_UNAVAILABLE\0"
+    "SPAPI_E_NO_CONFIGMGR_SERVICES\0"
+    "SPAPI_E_INVALID_PROPPAGE_PROVIDER\0"
+    "SPAPI_E_NO_SUCH_DEVICE_INTERFACE\0"
+    "SPAPI_E_DI_POSTPROCESSING_REQUIRED\0"
+    "SPAPI_E_INVALID_COINSTALLER\0"
+    "SPAPI_E_NO_COMPAT_DRIVERS\0"
+    "SPAPI_E_NO_DEVICE_ICON\0"
+    "SPAPI_E_INVALID_INF_LOGCONFIG\0"
+    "SPAPI_E_DI_DONT_INSTALL\0"
+    "SPAPI_E_INVALID_FILTER_DRIVER\0"
+    "SPAPI_E_NON_WINDOWS_NT_DRIVER\0"
+    "SPAPI_E_NON_WINDOWS_DRIVER\0"
+    "SPAPI_E_NO_CATALOG_FOR_OEM_INF\0"
+    "SPAPI_E_DEVINSTALL_QUEUE_NONNATIVE\0"
+    "SPAPI_E_NOT_DISABLEABLE\0"
+    "SPAPI_E_CANT_REMOVE_DEVINST\0"
+    "SPAPI_E_INVALID_TARGET\0"
+    "SPAPI_E_DRIVER_NONNATIVE\0"
+    "SPAPI_E_IN_WOW64\0"
+    "SPAPI_E_SET_SYSTEM_RESTORE_POINT\0"
+    "SPAPI_E_INCORRECTLY_COPIED_INF\0"
+    "SPAPI_E_SCE_DISABLED\0"
+    "SPAPI_E_UNKNOWN_EXCEPTION\0"
+    "SPAPI_E_PNP_REGISTRY_ERROR\0"
+    "SPAPI_E_REMOTE_REQUEST_UNSUPPORTED\0"
+    "SPAPI_E_NOT_AN_INSTALLED_OEM_INF\0"
+    "SPAPI_E_INF_IN_USE_BY_DEVICES\0"
+    "SPAPI_E_DI_FUNCTION_OBSOLETE\0"
+    "SPAPI_E_NO_AUTHENTICODE_CATALOG\0"
+    "SPAPI_E_AUTHENTICODE_DISALLOWED\0"
+    "SPAPI_E_AUTHENTICODE_TRUSTED_PUBLISHER\0"
+    "SPAPI_E_AUTHENTICODE_TRUST_NOT_ESTABLISHED\0"
+    "SPAPI_E_AUTHENTICODE_PUBLISHER_NOT_TRUSTED\0"
+    "SPAPI_E_SIGNATURE_OSATTRIBUTE_MISMATCH\0"
+    "SPAPI_E_ONLY_VALIDATE_VIA_AUTHENTICODE\0"
+    "SPAPI_E_UNRECOVERABLE_STACK_OVERFLOW\0"
+    "SPAPI_E_ERROR_NOT_INSTALLED\0"
+    "SCARD_F_INTERNAL_ERROR\0"
+    "SCARD_E_CANCELLED\0"
+    "SCARD_E_INVALID_HANDLE\0"
+    "SCARD_E_INVALID_PARAMETER\0"
+    "SCARD_E_INVALID_TARGET\0"
+    "SCARD_E_NO_MEMORY\0"
+    "SCARD_F_WAITED_TOO_LONG\0"
+    "SCARD_E_INSUFFICIENT_BUFFER\0"
+    "SCARD_E_UNKNOWN_READER\0"
+    "SCARD_E_TIMEOUT\0"
+    "SCARD_E_SHARING_VIOLATION\0"
+    "SCARD_E_NO_SMARTCARD\0"
+    "SCARD_E_UNKNOWN_CARD\0"
+    "SCARD_E_CANT_DISPOSE\0"
+    "SCARD_E_PROTO_MISMATCH\0"
+    "SCARD_E_NOT_READY\0"
+    "SCARD_E_INVALID_VALUE\0"
+    "SCARD_E_SYSTEM_CANCELLED\0"
+    "SCARD_F_COMM_ERROR\0"
+    "SCARD_F_UNKNOWN_ERROR\0"
+    "SCARD_E_INVALID_ATR\0"
+    "SCARD_E_NOT_TRANSACTED\0"
+    "SCARD_E_READER_UNAVAILABLE\0"
+    "SCARD_P_SHUTDOWN\0"
+    "SCARD_E_PCI_TOO_SMALL\0"
+    "SCARD_E_READER_UNSUPPORTED\0"
+    "SCARD_E_DUPLICATE_READER\0"
+    "SCARD_E_CARD_UNSUPPORTED\0"
+    "SCARD_E_NO_SERVICE\0"
+    "SCARD_E_SERVICE_STOPPED\0"
+    "SCARD_E_UNEXPECTED\0"
+    "SCARD_E_ICC_INSTALLATION\0"
+    "SCARD_E_ICC_CREATEORDER\0"
+    "SCARD_E_UNSUPPORTED_FEATURE\0"
+    "SCARD_E_DIR_NOT_FOUND\0"
+    "SCARD_E_FILE_NOT_FOUND\0"
+    "SCARD_E_NO_DIR\0"
+    "SCARD_E_NO_FILE\0"
+    "SCARD_E_NO_ACCESS\0"
+    "SCARD_E_WRITE_TOO_MANY\0"
+    "SCARD_E_BAD_SEEK\0"
+    "SCARD_E_INVALID_CHV\0"
+    "SCARD_E_UNKNOWN_RES_MNG\0"
+    "SCARD_E_NO_SUCH_CERTIFICATE\0"
+    "SCARD_E_CERTIFICATE_UNAVAILABLE\0"
+    "SCARD_E_NO_READERS_AVAILABLE\0"
+    "SCARD_E_COMM_DATA_LOST\0"
+    "SCARD_E_NO_KEY_CONTAINER\0"
+    "SCARD_E_SERVER_TOO_BUSY\0"
+    "SCARD_W_UNSUPPORTED_CARD\0"
+    "SCARD_W_UNRESPONSIVE_CARD\0"
+    "SCARD_W_UNPOWERED_CARD\0"
+    "SCARD_W_RESET_CARD\0"
+    "SCARD_W_REMOVED_CARD\0"
+    "SCARD_W_SECURITY_VIOLATION\0"
+    "SCARD_W_WRONG_CHV\0"
+    "SCARD_W_CHV_BLOCKED\0"
+    "SCARD_W_EOF\0"
+    "SCARD_W_CANCELLED_BY_USER\0"
+    "SCARD_W_CARD_NOT_AUTHENTICATED\0"
+    "SCARD_W_CACHE_ITEM_NOT_FOUND\0"
+    "SCARD_W_CACHE_ITEM_STALE\0"
+    "COMADMIN_E_OBJECTERRORS\0"
+    "COMADMIN_E_OBJECTINVALID\0"
+    "COMADMIN_E_KEYMISSING\0"
+    "COMADMIN_E_ALREADYINSTALLED\0"
+    "COMADMIN_E_APP_FILE_WRITEFAIL\0"
+    "COMADMIN_E_APP_FILE_READFAIL\0"
+    "COMADMIN_E_APP_FILE_VERSION\0"
+    "COMADMIN_E_BADPATH\0"
+    "COMADMIN_E_APPLICATIONEXISTS\0"
+    "COMADMIN_E_ROLEEXISTS\0"
+    "COMADMIN_E_CANTCOPYFILE\0"
+    "COMADMIN_E_NOUSER\0"
+    "COMADMIN_E_INVALIDUSERIDS\0"
+    "COMADMIN_E_NOREGISTRYCLSID\0"
+    "COMADMIN_E_BADREGISTRYPROGID\0"
+    "COMADMIN_E_AUTHENTICATIONLEVEL\0"
+    "COMADMIN_E_USERPASSWDNOTVALID\0"
+    "COMADMIN_E_CLSIDORIIDMISMATCH\0"
+    "COMADMIN_E_REMOTEINTERFACE\0"
+    "COMADMIN_E_DLLREGISTERSERVER\0"
+    "COMADMIN_E_NOSERVERSHARE\0"
+    "COMADMIN_E_DLLLOADFAILED\0"
+    "COMADMIN_E_BADREGISTRYLIBID\0"
+    "COMADMIN_E_APPDIRNOTFOUND\0"
+    "COMADMIN_E_REGISTRARFAILED\0"
+    "COMADMIN_E_COMPFILE_DOESNOTEXIST\0"
+    "COMADMIN_E_COMPFILE_LOADDLLFAIL\0"
+    "COMADMIN_E_COMPFILE_GETCLASSOBJ\0"
+    "COMADMIN_E_COMPFILE_CLASSNOTAVAIL\0"
+    "COMADMIN_E_COMPFILE_BADTLB\0"
+    "COMADMIN_E_COMPFILE_NOTINSTALLABLE\0"
+    "COMADMIN_E_NOTCHANGEABLE\0"
+    "COMADMIN_E_NOTDELETEABLE\0"
+    "COMADMIN_E_SESSION\0"
+    "COMADMIN_E_COMP_MOVE_LOCKED\0"
+    "COMADMIN_E_COMP_MOVE_BAD_DEST\0"
+    "COMADMIN_E_REGISTERTLB\0"
+    "COMADMIN_E_SYSTEMAPP\0"
+    "COMADMIN_E_COMPFILE_NOREGISTRAR\0"
+    "COMADMIN_E_COREQCOMPINSTALLED\0"
+    "COMADMIN_E_SERVICENOTINSTALLED\0"
+    "COMADMIN_E_PROPERTYSAVEFAILED\0"
+    "COMADMIN_E_OBJECTEXISTS\0"
+    "COMADMIN_E_COMPONENTEXISTS\0"
+    "COMADMIN_E_REGFILE_CORRUPT\0"
+    "COMADMIN_E_PROPERTY_OVERFLOW\0"
+    "COMADMIN_E_NOTINREGISTRY\0"
+    "COMADMIN_E_OBJECTNOTPOOLABLE\0"
+    "COMADMIN_E_APPLID_MATCHES_CLSID\0"
+    "COMADMIN_E_ROLE_DOES_NOT_EXIST\0"
+    "COMADMIN_E_START_APP_NEEDS_COMPONENTS\0"
+    "COMADMIN_E_REQUIRES_DIFFERENT_PLATFORM\0"
+    "COMADMIN_E_CAN_NOT_EXPORT_APP_PROXY\0"
+    "COMADMIN_E_CAN_NOT_START_APP\0"
+    "COMADMIN_E_CAN_NOT_EXPORT_SYS_APP\0"
+    "COMADMIN_E_CANT_SUBSCRIBE_TO_COMPONENT\0"
+    "COMADMIN_E_EVENTCLASS_CANT_BE_SUBSCRIBER\0"
+    "COMADMIN_E_LIB_APP_PROXY_INCOMPATIBLE\0"
+    "COMADMIN_E_BASE_PARTITION_ONLY\0"
+    "COMADMIN_E_START_APP_DISABLED\0"
+    "COMADMIN_E_CAT_DUPLICATE_PARTITION_NAME\0"
+    "COMADMIN_E_CAT_INVALID_PARTITION_NAME\0"
+    "COMADMIN_E_CAT_PARTITION_IN_USE\0"
+    "COMADMIN_E_FILE_PARTITION_DUPLICATE_FILES\0"
+    "COMADMIN_E_CAT_IMPORTED_COMPONENTS_NOT_ALLOWED\0"
+    "COMADMIN_E_AMBIGUOUS_APPLICATION_NAME\0"
+    "COMADMIN_E_AMBIGUOUS_PARTITION_NAME\0"
+    "COMADMIN_E_REGDB_NOTINITIALIZED\0"
+    "COMADMIN_E_REGDB_NOTOPEN\0"
+    "COMADMIN_E_REGDB_SYSTEMERR\0"
+    "COMADMIN_E_REGDB_ALREADYRUNNING\0"
+    "COMADMIN_E_MIG_VERSIONNOTSUPPORTED\0"
+    "COMADMIN_E_MIG_SCHEMANOTFOUND\0"
+    "COMADMIN_E_CAT_BITNESSMISMATCH\0"
+    "COMADMIN_E_CAT_UNACCEPTABLEBITNESS\0"
+    "COMADMIN_E_CAT_WRONGAPPBITNESS\0"
+    "COMADMIN_E_CAT_PAUSE_RESUME_NOT_SUPPORTED\0"
+    "COMADMIN_E_CAT_SERVERFAULT\0"
+    "COMQC_E_APPLICATION_NOT_QUEUED\0"
+    "COMQC_E_NO_QUEUEABLE_INTERFACES\0"
+    "COMQC_E_QUEUING_SERVICE_NOT_AVAILABLE\0"
+    "COMQC_E_NO_IPERSISTSTREAM\0"
+    "COMQC_E_BAD_MESSAGE\0"
+    "COMQC_E_UNAUTHENTICATED\0"
+    "COMQC_E_UNTRUSTED_ENQUEUER\0"
+    "MSDTC_E_DUPLICATE_RESOURCE\0"
+    "COMADMIN_E_OBJECT_PARENT_MISSING\0"
+    "COMADMIN_E_OBJECT_DOES_NOT_EXIST\0"
+    "COMADMIN_E_APP_NOT_RUNNING\0"
+    "COMADMIN_E_INVALID_PARTITION\0"
+    "COMADMIN_E_SVCAPP_NOT_POOLABLE_OR_RECYCLABLE\0"
+    "COMADMIN_E_USER_IN_SET\0"
+    "COMADMIN_E_CANTRECYCLELIBRARYAPPS\0"
+    "COMADMIN_E_CANTRECYCLESERVICEAPPS\0"
+    "COMADMIN_E_PROCESSALREADYRECYCLED\0"
+    "COMADMIN_E_PAUSEDPROCESSMAYNOTBERECYCLED\0"
+    "COMADMIN_E_CANTMAKEINPROCSERVICE\0"
+    "COMADMIN_E_PROGIDINUSEBYCLSID\0"
+    "COMADMIN_E_DEFAULT_PARTITION_NOT_IN_SET\0"
+    "COMADMIN_E_RECYCLEDPROCESSMAYNOTBEPAUSED\0"
+    "COMADMIN_E_PARTITION_ACCESSDENIED\0"
+    "COMADMIN_E_PARTITION_MSI_ONLY\0"
+    "COMADMIN_E_LEGACYCOMPS_NOT_ALLOWED_IN_1_0_FORMAT\0"
+    "COMADMIN_E_LEGACYCOMPS_NOT_ALLOWED_IN_NONBASE_PARTITIONS\0"
+    "COMADMIN_E_COMP_MOVE_SOURCE\0"
+    "COMADMIN_E_COMP_MOVE_DEST\0"
+    "COMADMIN_E_COMP_MOVE_PRIVATE\0"
+    "COMADMIN_E_BASEPARTITION_REQUIRED_IN_SET\0"
+    "COMADMIN_E_CANNOT_ALIAS_EVENTCLASS\0"
+    "COMADMIN_E_PRIVATE_ACCESSDENIED\0"
+    "COMADMIN_E_SAFERINVALID\0"
+    "COMADMIN_E_REGISTRY_ACCESSDENIED\0"
+    "COMADMIN_E_PARTITIONS_DISABLED\0"
+    "TBS_E_INTERNAL_ERROR\0"
+    "TBS_E_BAD_PARAMETER\0"
+    "TBS_E_INVALID_OUTPUT_POINTER\0"
+    "TBS_E_INSUFFICIENT_BUFFER\0"
+    "TBS_E_IOERROR\0"
+    "TBS_E_INVALID_CONTEXT_PARAM\0"
+    "TBS_E_SERVICE_NOT_RUNNING\0"
+    "TBS_E_TOO_MANY_TBS_CONTEXTS\0"
+    "TBS_E_SERVICE_START_PENDING\0"
+    "TBS_E_BUFFER_TOO_LARGE\0"
+    "TBS_E_TPM_NOT_FOUND\0"
+    "TBS_E_SERVICE_DISABLED\0"
+    "TBS_E_DEACTIVATED\0"
+    "FWP_E_CALLOUT_NOT_FOUND\0"
+    "FWP_E_CONDITION_NOT_FOUND\0"
+    "FWP_E_FILTER_NOT_FOUND\0"
+    "FWP_E_LAYER_NOT_FOUND\0"
+    "FWP_E_PROVIDER_NOT_FOUND\0"
+    "FWP_E_PROVIDER_CONTEXT_NOT_FOUND\0"
+    "FWP_E_SUBLAYER_NOT_FOUND\0"
+    "FWP_E_NOT_FOUND\0"
+    "FWP_E_ALREADY_EXISTS\0"
+    "FWP_E_IN_USE\0"
+    "FWP_E_DYNAMIC_SESSION_IN_PROGRESS\0"
+    "FWP_E_WRONG_SESSION\0"
+    "FWP_E_NO_TXN_IN_PROGRESS\0"
+    "FWP_E_TXN_IN_PROGRESS\0"
+    "FWP_E_TXN_ABORTED\0"
+    "FWP_E_SESSION_ABORTED\0"
+    "FWP_E_INCOMPATIBLE_TXN\0"
+    "FWP_E_TIMEOUT\0"
+    "FWP_E_NET_EVENTS_DISABLED\0"
+    "FWP_E_INCOMPATIBLE_LAYER\0"
+    "FWP_E_KM_CLIENTS_ONLY\0"
+    "FWP_E_LIFETIME_MISMATCH\0"
+    "FWP_E_BUILTIN_OBJECT\0"
+    "FWP_E_TOO_MANY_CALLOUTS\0"
+    "FWP_E_NOTIFICATION_DROPPED\0"
+    "FWP_E_TRAFFIC_MISMATCH\0"
+    "FWP_E_INCOMPATIBLE_SA_STATE\0"
+    "FWP_E_NULL_POINTER\0"
+    "FWP_E_INVALID_ENUMERATOR\0"
+    "FWP_E_INVALID_FLAGS\0"
+    "FWP_E_INVALID_NET_MASK\0"
+    "FWP_E_INVALID_RANGE\0"
+    "FWP_E_INVALID_INTERVAL\0"
+    "FWP_E_ZERO_LENGTH_ARRAY\0"
+    "FWP_E_NULL_DISPLAY_NAME\0"
+    "FWP_E_INVALID_ACTION_TYPE\0"
+    "FWP_E_INVALID_WEIGHT\0"
+    "FWP_E_MATCH_TYPE_MISMATCH\0"
+    "FWP_E_TYPE_MISMATCH\0"
+    "FWP_E_OUT_OF_BOUNDS\0"
+    "FWP_E_RESERVED\0"
+    "FWP_E_DUPLICATE_CONDITION\0"
+    "FWP_E_DUPLICATE_KEYMOD\0"
+    "FWP_E_ACTION_INCOMPATIBLE_WITH_LAYER\0"
+    "FWP_E_ACTION_INCOMPATIBLE_WITH_SUBLAYER\0"
+    "FWP_E_CONTEXT_INCOMPATIBLE_WITH_LAYER\0"
+    "FWP_E_CONTEXT_INCOMPATIBLE_WITH_CALLOUT\0"
+    "FWP_E_INCOMPATIBLE_AUTH_METHOD\0"
+    "FWP_E_INCOMPATIBLE_DH_GROUP\0"
+    "FWP_E_EM_NOT_SUPPORTED\0"
+    "FWP_E_NEVER_MATCH\0"
+    "FWP_E_PROVIDER_CONTEXT_MISMATCH\0"
+    "FWP_E_INVALID_PARAMETER\0"
+    "FWP_E_TOO_MANY_SUBLAYERS\0"
+    "FWP_E_CALLOUT_NOTIFICATION_FAILED\0"
+    "FWP_E_INVALID_AUTH_TRANSFORM\0"
+    "FWP_E_INVALID_CIPHER_TRANSFORM\0"
+    "ERROR_AUDITING_DISABLED\0"
+    "ERROR_ALL_SIDS_FILTERED\0"
+    ;
+
+QT_END_NAMESPACE
+
+#endif // QWINHRESULTNAMES_DATA_P_H
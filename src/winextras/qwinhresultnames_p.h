@@ -0,0 +1,85 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINHRESULTNAMES_P_H
+#define QWINHRESULTNAMES_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+// Maps HRESULT values to the names of their Windows SDK macros and back.
+// The built-in names come from the tables generated by
+// util/hresultnames/generate.py and are looked up by binary search without
+// allocating. Applications can register names for their own codes; these
+// are consulted when a value or name is not built in.
+namespace QWinHResultNames
+{
+    // Returns the name of hresult, or a null string if it is unknown. The
+    // string stays valid for the lifetime of the process.
+    QLatin1String name(quint32 hresult);
+
+    // Sets *hresult to the value called name and returns true, or returns
+    // false if name is unknown.
+    bool value(QLatin1String name, quint32 *hresult);
+
+    // Registers name for hresult, replacing a previously registered name.
+    // Returns false if hresult or name is built in, if name is registered
+    // for another value, or if name is empty.
+    bool registerName(quint32 hresult, QLatin1String name);
+
+    int builtInCount();
+    quint32 builtInValue(int index);
+    QLatin1String builtInName(int index);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINHRESULTNAMES_P_H
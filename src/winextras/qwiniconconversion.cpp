@@ -0,0 +1,149 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwiniconconversion_p.h"
+#include "qwinpixelconversion_p.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthreadpool.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+void QWinIconConversion::prepareIconPixels(const QImage &image, uchar *colorBits,
+                                           uchar *maskBits, int maskBytesPerLine)
+{
+    const int width = image.width();
+    const int height = image.height();
+    const int bytesPerLine = width * 4;
+    const bool premultiplied = image.format() == QImage::Format_ARGB32_Premultiplied;
+    const QImage source = premultiplied || image.format() == QImage::Format_ARGB32
+        ? image : image.convertToFormat(QImage::Format_ARGB32);
+    for (int y = 0; y < height; ++y)
+        memcpy(colorBits + y * bytesPerLine, source.constScanLine(y), size_t(bytesPerLine));
+    if (premultiplied)
+        QWinPixelConversion::unpremultiplyRows(colorBits, width, height, bytesPerLine);
+    QWinPixelConversion::alphaToMask(colorBits, width, height, bytesPerLine,
+                                     maskBits, maskBytesPerLine);
+}
+
+void QWinIconConversion::applyIconMask(QImage *image, const QImage &mask)
+{
+    Q_ASSERT(mask.size() == image->size() && mask.depth() == 32);
+    const int width = image->width();
+    const int height = image->height();
+    for (int y = 0; y < height; ++y) {
+        const quint32 *pixels = reinterpret_cast<const quint32 *>(image->constScanLine(y));
+        for (int x = 0; x < width; ++x) {
+            if (pixels[x] & 0xff000000)
+                return;
+        }
+    }
+    for (int y = 0; y < height; ++y) {
+        quint32 *pixels = reinterpret_cast<quint32 *>(image->scanLine(y));
+        const quint32 *maskPixels = reinterpret_cast<const quint32 *>(mask.constScanLine(y));
+        for (int x = 0; x < width; ++x) {
+            if (maskPixels[x] & 0x00ff0000)
+                pixels[x] = 0;
+            else
+                pixels[x] |= 0xff000000;
+        }
+    }
+}
+
+namespace {
+// Takes indexes off a shared counter until all jobs have been claimed, so
+// that uneven icon sizes do not leave threads idle.
+struct ForEachState
+{
+    const std::function<void(int)> *job;
+    int count;
+    QAtomicInt next;
+    QSemaphore done;
+
+    void run()
+    {
+        for (int i = next.fetchAndAddRelaxed(1); i < count; i = next.fetchAndAddRelaxed(1))
+            (*job)(i);
+    }
+};
+
+class ForEachRunnable : public QRunnable
+{
+public:
+    explicit ForEachRunnable(ForEachState *state) : m_state(state) {}
+
+    void run() override
+    {
+        m_state->run();
+        m_state->done.release();
+    }
+
+private:
+    ForEachState *m_state;
+};
+} // namespace
+
+void QWinIconConversion::forEach(int count, const std::function<void(int)> &job, QThreadPool *pool)
+{
+    if (count <= 0)
+        return;
+    if (!pool)
+        pool = QThreadPool::globalInstance();
+
+    ForEachState state;
+    state.job = &job;
+    state.count = count;
+    const int helpers = qMin(count, pool->maxThreadCount()) - 1;
+    int started = 0;
+    for (; started < helpers; ++started) {
+        ForEachRunnable *runnable = new ForEachRunnable(&state);
+        if (!pool->tryStart(runnable)) {
+            delete runnable; // The calling thread picks up the remaining work.
+            break;
+        }
+    }
+    state.run();
+    state.done.acquire(started);
+}
+
+QT_END_NAMESPACE
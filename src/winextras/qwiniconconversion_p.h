@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINICONCONVERSION_P_H
+#define QWINICONCONVERSION_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinpixelconversion_p.h"
+
+#include <QtGui/qimage.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class QThreadPool;
+
+// The pixel work of converting icons, separated from the GDI calls that have
+// to stay on the calling thread so that it can be spread over a thread pool.
+namespace QWinIconConversion
+{
+    using QWinPixelConversion::maskBytesPerLine;
+
+    // toHICON: converts image to the straight alpha BGRA data of an icon color
+    // bitmap, written to colorBits (width * 4 bytes per line), and derives the
+    // AND mask from its alpha channel.
+    void prepareIconPixels(const QImage &image, uchar *colorBits,
+                           uchar *maskBits, int maskBytesPerLine);
+
+    // fromHICON: image holds the premultiplied pixels DrawIconEx() rendered
+    // with DI_NORMAL, mask those it rendered with DI_MASK at the same size.
+    // Icons without alpha channel leave alpha at 0; their transparency is
+    // then taken from the mask as QPixmap's HICON conversion does: pixels
+    // with a red component in the mask are transparent.
+    void applyIconMask(QImage *image, const QImage &mask);
+
+    // Calls job(i) for i in [0, count), spread over pool (the global instance
+    // if null) with the calling thread taking its share. Returns when all
+    // calls have finished.
+    void forEach(int count, const std::function<void(int)> &job, QThreadPool *pool = nullptr);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINICONCONVERSION_P_H
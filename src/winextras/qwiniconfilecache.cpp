@@ -0,0 +1,151 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwiniconfilecache_p.h"
+#include "qwinicowriter_p.h"
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qsavefile.h>
+
+QT_BEGIN_NAMESPACE
+
+QWinIconFileCache::QWinIconFileCache(const QString &directory)
+    : m_directory(QDir::cleanPath(directory))
+{
+}
+
+QByteArray QWinIconFileCache::key(const QVector<QImage> &frames)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    // Bump when the file contents written for the same frames change.
+    hash.addData("ico1", 4);
+    for (const QImage &frame : frames) {
+        uchar header[12];
+        qToLittleEndian(quint32(frame.width()), header);
+        qToLittleEndian(quint32(frame.height()), header + 4);
+        qToLittleEndian(quint32(frame.format()), header + 8);
+        hash.addData(reinterpret_cast<const char *>(header), int(sizeof(header)));
+        const int lineBytes = (frame.width() * frame.depth() + 7) / 8;
+        for (int y = 0; y < frame.height(); ++y)
+            hash.addData(reinterpret_cast<const char *>(frame.constScanLine(y)), lineBytes);
+    }
+    return hash.result().toHex();
+}
+
+QString QWinIconFileCache::iconPath(const QVector<QImage> &frames)
+{
+    if (frames.isEmpty())
+        return QString();
+    const QByteArray fileKey = key(frames);
+    const QString fileName = QString::fromLatin1(fileKey) + QLatin1String(".ico");
+    const QString path = m_directory + QLatin1Char('/') + fileName;
+
+    if (markInUse(fileKey)) {
+        ++m_statistics.hits;
+        return path;
+    }
+
+    ++m_statistics.misses;
+    QSaveFile file(path);
+    if (!QDir().mkpath(m_directory) || !file.open(QIODevice::WriteOnly)
+        || !QWinIcoWriter::write(&file, frames) || !file.commit()) {
+        ++m_statistics.writeFailures;
+        return QString();
+    }
+    m_inUse.insert(fileName);
+    m_writtenSinceSweep += QFileInfo(path).size();
+    if (!m_swept || (m_maximumSize >= 0 && m_writtenSinceSweep > m_maximumSize / 4))
+        sweep();
+    return path;
+}
+
+bool QWinIconFileCache::markInUse(const QByteArray &key)
+{
+    const QString fileName = QString::fromLatin1(key) + QLatin1String(".ico");
+    const QString path = m_directory + QLatin1Char('/') + fileName;
+    const QFileInfo info(path);
+    if (!info.isFile() || info.size() <= 0)
+        return false;
+    if (!m_inUse.contains(fileName)) {
+        // The modification time tells the sweep when a file was last used.
+        QFile file(path);
+        if (file.open(QIODevice::ReadWrite))
+            file.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+        m_inUse.insert(fileName);
+    }
+    return true;
+}
+
+int QWinIconFileCache::sweep()
+{
+    m_swept = true;
+    m_writtenSinceSweep = 0;
+    if (m_maximumSize < 0 && m_maximumAge < 0)
+        return 0;
+
+    // Least recently used first.
+    const QFileInfoList files = QDir(m_directory).entryInfoList(QStringList(QStringLiteral("*.ico")),
+                                                                QDir::Files, QDir::Time | QDir::Reversed);
+    qint64 totalSize = 0;
+    for (const QFileInfo &info : files)
+        totalSize += info.size();
+
+    const QDateTime expiry = QDateTime::currentDateTimeUtc().addSecs(-m_maximumAge);
+    int removed = 0;
+    for (const QFileInfo &info : files) {
+        if (m_inUse.contains(info.fileName()))
+            continue;
+        const bool tooLarge = m_maximumSize >= 0 && totalSize > m_maximumSize;
+        const bool tooOld = m_maximumAge >= 0 && info.lastModified().toUTC() < expiry;
+        if (!tooLarge && !tooOld)
+            continue;
+        if (QFile::remove(info.absoluteFilePath())) {
+            totalSize -= info.size();
+            ++removed;
+        }
+    }
+    m_statistics.evictions += quint64(removed);
+    return removed;
+}
+
+QT_END_NAMESPACE
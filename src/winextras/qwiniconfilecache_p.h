@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINICONFILECACHE_P_H
+#define QWINICONFILECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qset.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
+
+QT_BEGIN_NAMESPACE
+
+// A directory of .ico files named after a hash of their frames, so that an
+// icon is written once and then shared by every link and every rebuild that
+// uses it. Files are written atomically and only when missing. A sweep
+// removes files that have not been used for a while and, least recently used
+// first, files exceeding the size limit; files handed out or marked in use
+// by this instance are never removed since the shell may still read them.
+// A negative limit disables it; without limits nothing is removed.
+// Not thread-safe.
+class QWinIconFileCache
+{
+public:
+    struct Statistics
+    {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        quint64 writeFailures = 0;
+        quint64 evictions = 0;
+    };
+
+    enum {
+        DefaultMaximumSize = 8 * 1024 * 1024,
+        DefaultMaximumAge = 30 * 24 * 60 * 60 // seconds
+    };
+
+    explicit QWinIconFileCache(const QString &directory);
+
+    QString directory() const { return m_directory; }
+
+    qint64 maximumSize() const { return m_maximumSize; }
+    void setMaximumSize(qint64 bytes) { m_maximumSize = bytes; }
+    int maximumAge() const { return m_maximumAge; }
+    void setMaximumAge(int seconds) { m_maximumAge = seconds; }
+
+    // Hex encoded hash of the sizes and pixels of frames.
+    static QByteArray key(const QVector<QImage> &frames);
+
+    // Returns the absolute path of the icon file for frames, writing it if
+    // it does not exist yet, or an empty string on failure.
+    QString iconPath(const QVector<QImage> &frames);
+
+    // Protects the file of key from sweeps, as if iconPath() had returned
+    // it; for files the shell got from an earlier run. Returns false if
+    // there is no such file.
+    bool markInUse(const QByteArray &key);
+
+    // Applies the age and size limits; returns the number of removed files.
+    // Runs automatically after a sizeable amount of new files was written.
+    int sweep();
+
+    Statistics statistics() const { return m_statistics; }
+    void resetStatistics() { m_statistics = Statistics(); }
+
+private:
+    QString m_directory;
+    qint64 m_maximumSize = DefaultMaximumSize;
+    int m_maximumAge = DefaultMaximumAge;
+    qint64 m_writtenSinceSweep = 0;
+    bool m_swept = false;
+    QSet<QString> m_inUse;
+    Statistics m_statistics;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINICONFILECACHE_P_H
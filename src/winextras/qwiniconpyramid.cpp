@@ -0,0 +1,218 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwiniconpyramid_p.h"
+
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
+#include <QtGui/qicon.h>
+
+QT_BEGIN_NAMESPACE
+
+enum {
+    SmallestLevelSize = 16,
+    CacheCostKiB = 8 * 1024
+};
+
+QWinIconPyramid::QWinIconPyramid(const QImage &source)
+{
+    buildChain(source);
+}
+
+QWinIconPyramid::QWinIconPyramid(const QIcon &icon, int largestSize)
+{
+    if (icon.isNull() || largestSize <= 0)
+        return;
+    buildChain(icon.pixmap(largestSize).toImage());
+    if (isNull())
+        return;
+
+    const QList<QSize> availableSizes = icon.availableSizes();
+    const QVector<int> sizes = standardSizes();
+    for (int size : sizes) {
+        if (size > largestSize)
+            break;
+        const QSize bounds(size, size);
+        QImage level;
+        if (bounds != sourceSize() && availableSizes.contains(bounds)) {
+            level = icon.pixmap(bounds).toImage();
+            if (level.size() == bounds)
+                level = level.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            else
+                level = QImage(); // high DPI pixmap
+        }
+        m_levels.insert(size, level.isNull() ? derive(bounds) : level);
+    }
+}
+
+QVector<int> QWinIconPyramid::standardSizes()
+{
+    return QVector<int>() << 16 << 20 << 24 << 32 << 48 << 64 << 256;
+}
+
+qsizetype QWinIconPyramid::byteCount() const
+{
+    qsizetype result = 0;
+    for (const QImage &image : m_chain)
+        result += image.sizeInBytes();
+    for (const QImage &image : m_levels)
+        result += image.sizeInBytes();
+    return result;
+}
+
+void QWinIconPyramid::buildChain(const QImage &source)
+{
+    if (source.isNull())
+        return;
+    m_chain.append(source.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    for (QImage level = m_chain.constLast();
+         qMax(level.width(), level.height()) > SmallestLevelSize && qMin(level.width(), level.height()) > 1; ) {
+        level = halved(level);
+        m_chain.append(level);
+    }
+}
+
+QImage QWinIconPyramid::image(const QSize &bounds) const
+{
+    if (bounds.width() == bounds.height()) {
+        const auto it = m_levels.constFind(bounds.width());
+        if (it != m_levels.constEnd())
+            return it.value();
+    }
+    return derive(bounds);
+}
+
+QImage QWinIconPyramid::derive(const QSize &bounds) const
+{
+    if (isNull() || bounds.isEmpty())
+        return QImage();
+    const QSize source = sourceSize();
+    if (source.width() <= bounds.width() && source.height() <= bounds.height())
+        return m_chain.constFirst();
+    const QSize target = source.scaled(bounds, Qt::KeepAspectRatio).expandedTo(QSize(1, 1));
+
+    // The smallest level still covering the target.
+    QImage level = m_chain.constFirst();
+    for (const QImage &candidate : m_chain) {
+        if (candidate.width() < target.width() || candidate.height() < target.height())
+            break;
+        level = candidate;
+    }
+    if (level.size() == target)
+        return level;
+    return level.scaled(target, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+}
+
+// Averages four premultiplied pixels, two channels at a time.
+static inline quint32 average4(quint32 a, quint32 b, quint32 c, quint32 d)
+{
+    const quint32 rb = (a & 0x00ff00ff) + (b & 0x00ff00ff) + (c & 0x00ff00ff) + (d & 0x00ff00ff)
+        + 0x00020002;
+    const quint32 ag = ((a >> 8) & 0x00ff00ff) + ((b >> 8) & 0x00ff00ff) + ((c >> 8) & 0x00ff00ff)
+        + ((d >> 8) & 0x00ff00ff) + 0x00020002;
+    return ((rb >> 2) & 0x00ff00ff) | ((ag << 6) & 0xff00ff00);
+}
+
+QImage QWinIconPyramid::halved(const QImage &image)
+{
+    Q_ASSERT(image.format() == QImage::Format_ARGB32_Premultiplied);
+    if (image.isNull())
+        return QImage();
+    const int width = qMax(1, image.width() / 2);
+    const int height = qMax(1, image.height() / 2);
+    QImage result(width, height, QImage::Format_ARGB32_Premultiplied);
+    if (result.isNull())
+        return result;
+
+    // Odd trailing rows and columns are dropped, except for a size of 1,
+    // which is kept.
+    const int lastX = image.width() - 1;
+    const int lastY = image.height() - 1;
+    for (int y = 0; y < height; ++y) {
+        const quint32 *line0 = reinterpret_cast<const quint32 *>(image.constScanLine(qMin(2 * y, lastY)));
+        const quint32 *line1 = reinterpret_cast<const quint32 *>(image.constScanLine(qMin(2 * y + 1, lastY)));
+        quint32 *dest = reinterpret_cast<quint32 *>(result.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            const int x0 = qMin(2 * x, lastX);
+            const int x1 = qMin(2 * x + 1, lastX);
+            dest[x] = average4(line0[x0], line0[x1], line1[x0], line1[x1]);
+        }
+    }
+    return result;
+}
+
+namespace {
+struct IconPyramidCache
+{
+    IconPyramidCache() : pyramids(CacheCostKiB) {}
+
+    QMutex mutex;
+    QCache<qint64, QWinIconPyramid> pyramids;
+};
+} // namespace
+
+Q_GLOBAL_STATIC(IconPyramidCache, iconPyramidCache)
+
+QImage QWinIconPyramid::cachedImage(const QIcon &icon, int size)
+{
+    if (icon.isNull() || size <= 0)
+        return QImage();
+    if (size > DefaultLargestSize)
+        return icon.pixmap(size).toImage();
+
+    IconPyramidCache *cache = iconPyramidCache();
+    QMutexLocker locker(&cache->mutex);
+    const qint64 key = icon.cacheKey();
+    if (const QWinIconPyramid *pyramid = cache->pyramids.object(key))
+        return pyramid->image(size);
+    QWinIconPyramid *pyramid = new QWinIconPyramid(icon);
+    const QImage result = pyramid->image(size);
+    // Takes ownership and deletes pyramid right away if it is too large.
+    cache->pyramids.insert(key, pyramid, int(qMax(qsizetype(1), pyramid->byteCount() / 1024)));
+    return result;
+}
+
+void QWinIconPyramid::clearCache()
+{
+    IconPyramidCache *cache = iconPyramidCache();
+    QMutexLocker locker(&cache->mutex);
+    cache->pyramids.clear();
+}
+
+QT_END_NAMESPACE
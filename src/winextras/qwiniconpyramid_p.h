@@ -0,0 +1,111 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINICONPYRAMID_P_H
+#define QWINICONPYRAMID_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qmap.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qpixmap.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIcon;
+
+// Produces all icon sizes the shell asks for from a single rendering: the
+// source is halved repeatedly with a box filter on premultiplied pixels, and
+// sizes in between are taken from the next larger level by one bilinear step,
+// which never shrinks by 2 or more and therefore does not alias.
+class QWinIconPyramid
+{
+public:
+    enum { DefaultLargestSize = 256 };
+
+    QWinIconPyramid() {}
+    explicit QWinIconPyramid(const QImage &source);
+    // Renders icon once at largestSize and derives standardSizes() from it.
+    // Sizes the icon provides as pixmaps (QIcon::availableSizes()) are taken
+    // from the icon as they are.
+    explicit QWinIconPyramid(const QIcon &icon, int largestSize = DefaultLargestSize);
+
+    static QVector<int> standardSizes();
+
+    bool isNull() const { return m_chain.isEmpty(); }
+    QSize sourceSize() const { return isNull() ? QSize() : m_chain.constFirst().size(); }
+    qsizetype byteCount() const;
+
+    // Returns the source scaled to fit into bounds keeping the aspect ratio.
+    // Like QIcon::pixmap(), the source is never scaled up.
+    QImage image(const QSize &bounds) const;
+    QImage image(int size) const { return image(QSize(size, size)); }
+    QPixmap pixmap(int size) const { return QPixmap::fromImage(image(size)); }
+
+    // 2x2 box filter; image must be in Format_ARGB32_Premultiplied.
+    static QImage halved(const QImage &image);
+
+    // Returns an image or pixmap of size of icon, from a pyramid shared per
+    // QIcon::cacheKey().
+    static QImage cachedImage(const QIcon &icon, int size);
+    static QPixmap cachedPixmap(const QIcon &icon, int size)
+        { return QPixmap::fromImage(cachedImage(icon, size)); }
+    static void clearCache();
+
+private:
+    QImage derive(const QSize &bounds) const;
+    void buildChain(const QImage &source);
+
+    QVector<QImage> m_chain; // source followed by its successive halvings
+    QMap<int, QImage> m_levels;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINICONPYRAMID_P_H
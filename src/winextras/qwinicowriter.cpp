@@ -0,0 +1,281 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinicowriter_p.h"
+#include "qwinpixelconversion_p.h"
+
+#include <QtCore/qendian.h>
+#include <QtCore/qiodevice.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// Hands out the scan lines of an image as straight alpha ARGB32 values.
+class StraightScanLines
+{
+public:
+    explicit StraightScanLines(const QImage &image)
+        : m_image(image)
+    {
+        switch (m_image.format()) {
+        case QImage::Format_ARGB32:
+        case QImage::Format_ARGB32_Premultiplied:
+        case QImage::Format_RGB32:
+            break;
+        default:
+            m_image = m_image.convertToFormat(QImage::Format_ARGB32);
+            break;
+        }
+        if (m_image.format() != QImage::Format_ARGB32)
+            m_line.resize(m_image.width());
+    }
+
+    const quint32 *line(int y)
+    {
+        const quint32 *source = reinterpret_cast<const quint32 *>(m_image.constScanLine(y));
+        const int width = m_image.width();
+        switch (m_image.format()) {
+        case QImage::Format_ARGB32_Premultiplied:
+            memcpy(m_line.data(), source, size_t(width) * 4);
+            QWinPixelConversion::unpremultiply(m_line.data(), width);
+            return m_line.constData();
+        case QImage::Format_RGB32:
+            for (int x = 0; x < width; ++x)
+                m_line[x] = source[x] | 0xff000000;
+            return m_line.constData();
+        default:
+            break;
+        }
+        return source;
+    }
+
+private:
+    QImage m_image;
+    QVector<quint32> m_line;
+};
+
+struct Crc32Table
+{
+    Crc32Table()
+    {
+        for (quint32 n = 0; n < 256; ++n) {
+            quint32 c = n;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            values[n] = c;
+        }
+    }
+
+    quint32 values[256];
+};
+} // namespace
+
+static quint32 crc32(const char *data, int length)
+{
+    static const Crc32Table table;
+    quint32 crc = 0xffffffff;
+    for (int i = 0; i < length; ++i)
+        crc = table.values[(crc ^ uchar(data[i])) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffff;
+}
+
+static void appendBigEndian(QByteArray *out, quint32 value)
+{
+    uchar bytes[4];
+    qToBigEndian(value, bytes);
+    out->append(reinterpret_cast<const char *>(bytes), 4);
+}
+
+static void appendPngChunk(QByteArray *out, const char *type, const char *data, int length)
+{
+    appendBigEndian(out, quint32(length));
+    const int start = out->size();
+    out->append(type, 4);
+    out->append(data, length);
+    appendBigEndian(out, crc32(out->constData() + start, 4 + length));
+}
+
+static inline bool isValidFrame(const QImage &image)
+{
+    return !image.isNull() && image.width() <= QWinIcoWriter::MaximumFrameSize
+        && image.height() <= QWinIcoWriter::MaximumFrameSize;
+}
+
+QByteArray QWinIcoWriter::encodePng(const QImage &image)
+{
+    if (image.isNull())
+        return QByteArray();
+    const int width = image.width();
+    const int height = image.height();
+    StraightScanLines lines(image);
+
+    // Every scan line uses the "Sub" filter, which makes gradients compress well.
+    const int rowSize = 1 + 4 * width;
+    QByteArray raw(rowSize * height, Qt::Uninitialized);
+    for (int y = 0; y < height; ++y) {
+        const quint32 *line = lines.line(y);
+        uchar *dest = reinterpret_cast<uchar *>(raw.data()) + y * rowSize;
+        *dest++ = 1;
+        quint32 previous = 0;
+        for (int x = 0; x < width; ++x) {
+            const quint32 pixel = line[x];
+            *dest++ = uchar((pixel >> 16) - (previous >> 16));
+            *dest++ = uchar((pixel >> 8) - (previous >> 8));
+            *dest++ = uchar(pixel - previous);
+            *dest++ = uchar((pixel >> 24) - (previous >> 24));
+            previous = pixel;
+        }
+    }
+    // qCompress() prepends the uncompressed size to the zlib stream.
+    const QByteArray compressed = qCompress(raw);
+    if (compressed.size() <= 4)
+        return QByteArray();
+
+    static const char signature[] = { '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n' };
+    uchar header[13];
+    qToBigEndian(quint32(width), header);
+    qToBigEndian(quint32(height), header + 4);
+    header[8] = 8;  // bit depth
+    header[9] = 6;  // RGBA
+    header[10] = 0; // deflate
+    header[11] = 0; // adaptive filtering
+    header[12] = 0; // no interlace
+
+    QByteArray png;
+    png.reserve(int(sizeof(signature)) + 3 * 12 + int(sizeof(header)) + compressed.size() - 4);
+    png.append(signature, int(sizeof(signature)));
+    appendPngChunk(&png, "IHDR", reinterpret_cast<const char *>(header), int(sizeof(header)));
+    appendPngChunk(&png, "IDAT", compressed.constData() + 4, compressed.size() - 4);
+    appendPngChunk(&png, "IEND", nullptr, 0);
+    return png;
+}
+
+QByteArray QWinIcoWriter::encodeBitmap(const QImage &image)
+{
+    if (image.isNull())
+        return QByteArray();
+    const int width = image.width();
+    const int height = image.height();
+    const int colorBytesPerLine = width * 4;
+    const int maskBytesPerLine = QWinPixelConversion::maskBytesPerLine(width);
+    const int headerSize = 40;
+    const int colorSize = colorBytesPerLine * height;
+    const int maskSize = maskBytesPerLine * height;
+    StraightScanLines lines(image);
+
+    QByteArray result(headerSize + colorSize + maskSize, Qt::Uninitialized);
+    uchar *header = reinterpret_cast<uchar *>(result.data());
+    memset(header, 0, size_t(headerSize));
+    qToLittleEndian(quint32(headerSize), header);      // biSize
+    qToLittleEndian(qint32(width), header + 4);        // biWidth
+    qToLittleEndian(qint32(2 * height), header + 8);   // biHeight, color and mask
+    qToLittleEndian(quint16(1), header + 12);          // biPlanes
+    qToLittleEndian(quint16(32), header + 14);         // biBitCount
+    qToLittleEndian(quint32(colorSize + maskSize), header + 20); // biSizeImage
+
+    // Bitmap scan lines are stored bottom-up.
+    uchar *color = header + headerSize;
+    uchar *mask = color + colorSize;
+    for (int y = 0; y < height; ++y) {
+        const int row = height - 1 - y;
+        const quint32 *line = lines.line(y);
+        uchar *colorLine = color + row * colorBytesPerLine;
+        for (int x = 0; x < width; ++x)
+            qToLittleEndian(line[x], colorLine + 4 * x);
+        QWinPixelConversion::alphaToMask(reinterpret_cast<const uchar *>(line), width, 1, colorBytesPerLine,
+                                         mask + row * maskBytesPerLine, maskBytesPerLine);
+    }
+    return result;
+}
+
+QByteArray QWinIcoWriter::encode(const QVector<QImage> &frames, FrameEncoding encoding)
+{
+    const int count = frames.size();
+    if (count == 0 || count > 0xffff)
+        return QByteArray();
+    QVector<QByteArray> data;
+    data.reserve(count);
+    for (const QImage &frame : frames) {
+        if (!isValidFrame(frame))
+            return QByteArray();
+        const bool png = encoding == Png
+            || (encoding == Automatic && qMax(frame.width(), frame.height()) >= MaximumFrameSize);
+        data.append(png ? encodePng(frame) : encodeBitmap(frame));
+        if (data.constLast().isEmpty())
+            return QByteArray();
+    }
+
+    // ICONDIR followed by one ICONDIRENTRY per frame.
+    const int directorySize = 6 + 16 * count;
+    int size = directorySize;
+    for (const QByteArray &frame : qAsConst(data))
+        size += frame.size();
+    QByteArray result(size, Qt::Uninitialized);
+    uchar *out = reinterpret_cast<uchar *>(result.data());
+    qToLittleEndian(quint16(0), out);
+    qToLittleEndian(quint16(1), out + 2); // icon
+    qToLittleEndian(quint16(count), out + 4);
+
+    int offset = directorySize;
+    for (int i = 0; i < count; ++i) {
+        const QImage &frame = frames.at(i);
+        uchar *entry = out + 6 + 16 * i;
+        entry[0] = uchar(frame.width() & 0xff);  // 0 means 256
+        entry[1] = uchar(frame.height() & 0xff);
+        entry[2] = 0; // colors in palette
+        entry[3] = 0;
+        qToLittleEndian(quint16(1), entry + 4);  // planes
+        qToLittleEndian(quint16(32), entry + 6); // bits per pixel
+        qToLittleEndian(quint32(data.at(i).size()), entry + 8);
+        qToLittleEndian(quint32(offset), entry + 12);
+        memcpy(out + offset, data.at(i).constData(), size_t(data.at(i).size()));
+        offset += data.at(i).size();
+    }
+    return result;
+}
+
+bool QWinIcoWriter::write(QIODevice *device, const QVector<QImage> &frames, FrameEncoding encoding)
+{
+    const QByteArray data = encode(frames, encoding);
+    return !data.isEmpty() && device->write(data) == data.size();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,90 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINICOWRITER_P_H
+#define QWINICOWRITER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+// Writes .ico files without going through the image format plugins. Frames
+// are stored either as PNG, which Windows expects for 256 pixel icons, or as
+// 32bpp BGRA bitmaps followed by the 1bpp AND mask. The scan lines of 32bpp
+// QImages are read directly; other formats are converted first.
+namespace QWinIcoWriter
+{
+    enum FrameEncoding {
+        Automatic, // PNG for frames of 256 pixels, bitmaps for smaller ones
+        Bitmap,
+        Png
+    };
+
+    enum { MaximumFrameSize = 256 };
+
+    // Returns false if frames is empty, a frame is null or larger than
+    // MaximumFrameSize, or writing fails.
+    bool write(QIODevice *device, const QVector<QImage> &frames,
+               FrameEncoding encoding = Automatic);
+    QByteArray encode(const QVector<QImage> &frames, FrameEncoding encoding = Automatic);
+
+    // Non-interlaced 8 bit RGBA PNG with straight alpha.
+    QByteArray encodePng(const QImage &image);
+    // BITMAPINFOHEADER, bottom-up BGRA scan lines and the AND mask.
+    QByteArray encodeBitmap(const QImage &image);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINICOWRITER_P_H
@@ -58,14 +58,24 @@
 #include "winpropkey_p.h"
 
 #include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QCryptographicHash>
 #include <QtCore/QDebug>
 #include <QCoreApplication>
-#include <QRegularExpression>
+#include <QTimer>
+#include <QMutex>
 #include <qt_windows.h>
 #include <propvarutil.h>
 
 #include "qwinfunctions.h"
 #include "qwinfunctions_p.h"
+#include "qwincomfailurereporter_p.h"
+#include "qwincommandline_p.h"
+#include "qwiniconpyramid_p.h"
+#include "qwiniconfilecache_p.h"
+#include "qwinjumpliststate_p.h"
 #include "winpropkey_p.h"
 
 #include <shobjidl.h>
@@ -82,6 +92,12 @@ QT_BEGIN_NAMESPACE
 
     An application can use Jump Lists to provide users with faster access to
     files or to display shortcuts to tasks or commands.
+
+    The state of the last commit is kept in a file in the temporary
+    directory. When an application sets up the same jump list at every start,
+    only the first start commits it; later ones compare the jump list with
+    that file and leave the list of the shell as it is. saveState() and
+    restoreState() give access to the same format.
  */
 
 /*!
@@ -89,70 +105,391 @@ QT_BEGIN_NAMESPACE
     \externalpage http://msdn.microsoft.com/en-us/library/windows/desktop/dd378459%28v=vs.85%29.aspx
  */
 
-// partial copy of qprocess_win.cpp:qt_create_commandline()
-static QString createArguments(const QStringList &arguments)
-{
-    QString args;
-    for (int i=0; i<arguments.size(); ++i) {
-        QString tmp = arguments.at(i);
-        // Quotes are escaped and their preceding backslashes are doubled.
-        tmp.replace(QRegularExpression(QLatin1String("(\\\\*)\"")), QLatin1String("\\1\\1\\\""));
-        if (tmp.isEmpty() || tmp.contains(QLatin1Char(' ')) || tmp.contains(QLatin1Char('\t'))) {
-            // The argument must not end with a \ since this would be interpreted
-            // as escaping the quote -- rather put the \ behind the quote: e.g.
-            // rather use "foo"\ than "foo\"
-            int i = tmp.length();
-            while (i > 0 && tmp.at(i - 1) == QLatin1Char('\\'))
-                --i;
-            tmp.insert(i, QLatin1Char('"'));
-            tmp.prepend(QLatin1Char('"'));
+void QWinJumpListPrivate::warning(const char *function, HRESULT hresult)
+{
+    QWinComFailureReporter::instance()->report("QWinJumpList", function, quint32(hresult));
+}
+
+QString QWinJumpListPrivate::iconsDirPath()
+{
+    // The cache creates the directory when it writes the first file.
+    return QDir::tempPath() + QLatin1Char('/') + QCoreApplication::instance()->applicationName() + QLatin1String("/qt-jl-icons/");
+}
+
+// Guards iconCache(), which is shared by commits on the GUI thread and on
+// the committer threads of all jump lists.
+static QBasicMutex iconCacheMutex;
+
+QWinIconFileCache *QWinJumpListPrivate::iconCache()
+{
+    static QWinIconFileCache cache(iconsDirPath());
+    return &cache;
+}
+
+// Identical icons share one file, which is only written if missing.
+QString QWinJumpListPrivate::iconPath(const QVector<QImage> &frames)
+{
+    QMutexLocker locker(&iconCacheMutex);
+    return iconCache()->iconPath(frames);
+}
+
+// Recent documents stay in the shell for as long as it likes, so nothing
+// tells when their icon files are no longer used; they are never removed.
+static QWinIconFileCache *createRecentIconCache()
+{
+    QWinIconFileCache *cache = new QWinIconFileCache(QWinJumpListPrivate::iconsDirPath() + QLatin1String("recent"));
+    cache->setMaximumSize(-1);
+    cache->setMaximumAge(-1);
+    return cache;
+}
+
+QString QWinJumpListPrivate::recentIconPath(const QVector<QImage> &frames)
+{
+    static const QScopedPointer<QWinIconFileCache> cache(createRecentIconCache());
+    QMutexLocker locker(&iconCacheMutex);
+    return cache->iconPath(frames);
+}
+
+// For the icon files of a list the shell got from an earlier run.
+void QWinJumpListPrivate::markIconsInUse(const QWinJumpListSnapshot &snapshot)
+{
+    QMutexLocker locker(&iconCacheMutex);
+    for (const QWinJumpListSnapshot::Category &category : snapshot.categories()) {
+        for (const QWinJumpListSnapshot::Item &item : category.items) {
+            if (!item.iconFileKey.isEmpty())
+                iconCache()->markInUse(item.iconFileKey);
         }
-        args += QLatin1Char(' ') + tmp;
     }
-    return args;
 }
 
-void QWinJumpListPrivate::warning(const char *function, HRESULT hresult)
+// One file per application and identifier; identifiers are hashed since
+// they may contain characters that are not valid in file names.
+QString QWinJumpListPrivate::statePath(const QString &identifier)
 {
-    const QString err = QtWin::errorStringFromHresult(hresult);
-    qWarning("QWinJumpList: %s() failed: %#010x, %s.", function, unsigned(hresult), qPrintable(err));
+    const QString name = identifier.isEmpty()
+        ? QStringLiteral("default")
+        : QString::fromLatin1(QCryptographicHash::hash(identifier.toUtf8(), QCryptographicHash::Sha1).toHex().left(16));
+    return QDir::tempPath() + QLatin1Char('/') + QCoreApplication::instance()->applicationName()
+        + QLatin1String("/qt-jl-") + name + QLatin1String(".state");
 }
 
-QString QWinJumpListPrivate::iconsDirPath()
+// An empty state removes the file, so that the next start commits again.
+void QWinJumpListPrivate::persistState(const QString &path, const QByteArray &state)
 {
-    QString iconDirPath = QDir::tempPath() + QLatin1Char('/') + QCoreApplication::instance()->applicationName() + QLatin1String("/qt-jl-icons/");
-    QDir().mkpath(iconDirPath);
-    return iconDirPath;
+    if (state.isEmpty()) {
+        QFile::remove(path);
+        return;
+    }
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly) || file.write(state) != state.size() || !file.commit())
+        QFile::remove(path);
+}
+
+// Called on the thread of the commit, right after it, so that the state
+// always describes what the shell shows, also when the jump list is
+// destroyed before an asynchronous result reaches it. The icon files the
+// serializer resolved give the keys of their icons without hashing them
+// again.
+void QWinJumpListPrivate::persistCommit(const QWinJumpListSnapshot &snapshot,
+                                        const QWinJumpListSerializer &serializer,
+                                        QWinJumpListCommitter::Result result)
+{
+    if (result == QWinJumpListCommitter::Aborted)
+        return;
+    const QString path = statePath(snapshot.identifier());
+    if (result != QWinJumpListCommitter::Committed) {
+        persistState(path, QByteArray());
+        return;
+    }
+    QHash<qint64, QByteArray> iconFileKeys;
+    const QHash<qint64, QString> iconPaths = serializer.iconPaths();
+    for (auto it = iconPaths.cbegin(), end = iconPaths.cend(); it != end; ++it)
+        iconFileKeys.insert(it.key(), QFileInfo(it.value()).completeBaseName().toLatin1());
+    persistState(path, QWinJumpListState::save(snapshot, iconFileKeys));
+}
+
+// The shell takes UTF-16, so strings are handed over without conversion.
+Q_STATIC_ASSERT(sizeof(wchar_t) == sizeof(QChar));
+
+static inline const wchar_t *wideString(const QChar *string)
+{
+    return reinterpret_cast<const wchar_t *>(string);
 }
 
 void QWinJumpListPrivate::invalidate()
+{
+    if (pDestList)
+        scheduler.request();
+}
+
+// The small and large shell icon sizes, taken from one icon pyramid.
+static QVector<QImage> iconFrames(const QIcon &icon)
+{
+    QVector<QImage> frames;
+    const int sizes[] = { GetSystemMetrics(SM_CXSMICON), GetSystemMetrics(SM_CXICON) };
+    for (int size : sizes) {
+        const QImage frame = QWinIconPyramid::cachedImage(icon, size);
+        if (!frame.isNull() && (frames.isEmpty() || frames.constLast().size() != frame.size()))
+            frames.append(frame);
+    }
+    return frames;
+}
+
+// Rebuilding replaces the whole list, so it is skipped when the model
+// compares equal to what was committed last, such as after a setter wrote
+// an equal value or a change was reverted before the rebuild ran. The first
+// rebuild compares with the state persisted by the last commit instead,
+// which usually is the one of the previous run of the application. Only
+// that comparison builds the state on this thread; the commits persist it.
+// The shell keeps showing the icon files of the persisted state then, so
+// they are protected from sweeps as if this run had written them.
+void QWinJumpListPrivate::rebuild()
+{
+    Q_Q(QWinJumpList);
+    const QWinJumpListSnapshot snapshot = takeSnapshot();
+    if (QWinJumpListDiff::compute(committed, snapshot).isEmpty())
+        return;
+
+    if (committed.isNull()) {
+        QFile file(statePath(snapshot.identifier()));
+        const QByteArray state = file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+        QWinJumpListSnapshot persisted;
+        if (QWinJumpListState::fingerprint(state) == QWinJumpListState::fingerprint(QWinJumpListState::save(snapshot))
+            && QWinJumpListState::restore(state, &persisted)) {
+            markIconsInUse(persisted);
+            committed = snapshot;
+            return;
+        }
+    }
+
+    if (committer) {
+        // Taken as committed until the committer reports a failure.
+        committed = snapshot;
+        lastCommit = committer->submit(snapshot);
+        return;
+    }
+
+    const QWinJumpListCommitter::Result result = commitSnapshot(pDestList, &serializer, &pruner, snapshot);
+    persistCommit(snapshot, serializer, result);
+    const bool success = result == QWinJumpListCommitter::Committed;
+    if (success)
+        committed = snapshot;
+    reportRemovals();
+    QFutureInterface<bool> future;
+    future.reportStarted();
+    future.reportResult(success);
+    future.reportFinished();
+    lastCommit = future.future();
+    emit q->committed(success);
+}
+
+void QWinJumpListPrivate::commitFinished(bool success)
+{
+    Q_Q(QWinJumpList);
+    if (!success)
+        committed = QWinJumpListSnapshot(); // retry with the next change
+    reportRemovals();
+    emit q->committed(success);
+}
+
+// Removed items stay in the model, which belongs to the application; they
+// are left out of every commit.
+void QWinJumpListPrivate::reportRemovals()
 {
     Q_Q(QWinJumpList);
-    if (!pDestList)
+    const QStringList keys = pruner.takeRemoved();
+    if (keys.isEmpty())
         return;
+    const QSet<QString> removed = keys.toSet();
+    QList<QWinJumpListItem *> items;
+    for (const QWinJumpListCategory *category : qAsConst(categories)) {
+        const QList<QWinJumpListItem *> categoryItems = category->items();
+        for (QWinJumpListItem *item : categoryItems) {
+            if (removed.contains(QWinJumpListPruner::key(item->filePath(), item->arguments())))
+                items.append(item);
+        }
+    }
+    if (!items.isEmpty())
+        emit q->itemsRemoved(items);
+}
+
+// Commits on the committer's thread, which is a single-threaded apartment
+// with a destination list of its own.
+class QWinJumpListShellBackend : public QWinJumpListCommitter::Backend
+{
+public:
+    explicit QWinJumpListShellBackend(QWinJumpListPruner *pruner) : m_pruner(pruner) {}
+
+    void threadStarted() override
+    {
+        m_initialized = SUCCEEDED(CoInitializeEx(0, COINIT_APARTMENTTHREADED));
+        HRESULT hresult = CoCreateInstance(qCLSID_DestinationList, 0, CLSCTX_INPROC_SERVER, qIID_ICustomDestinationList, reinterpret_cast<void **>(&m_destList));
+        if (FAILED(hresult)) {
+            m_destList = 0;
+            QWinJumpListPrivate::warning("CoCreateInstance(ICustomDestinationList)", hresult);
+        }
+    }
+
+    void threadFinished() override
+    {
+        if (m_destList)
+            m_destList->Release();
+        if (m_initialized)
+            CoUninitialize();
+    }
+
+    QWinJumpListCommitter::Result commit(const QWinJumpListSnapshot &snapshot,
+                                         const std::function<bool()> &isSuperseded) override
+    {
+        const QWinJumpListCommitter::Result result = m_destList
+            ? QWinJumpListPrivate::commitSnapshot(m_destList, &m_serializer, m_pruner, snapshot, isSuperseded)
+            : QWinJumpListCommitter::Failed;
+        QWinJumpListPrivate::persistCommit(snapshot, m_serializer, result);
+        return result;
+    }
+
+private:
+    ICustomDestinationList *m_destList = nullptr;
+    QWinJumpListSerializer m_serializer{&QWinJumpListPrivate::iconPath};
+    QWinJumpListPruner *m_pruner;
+    bool m_initialized = false;
+};
 
-    if (!dirty) {
-        dirty = true;
-        QMetaObject::invokeMethod(q, "_q_rebuild", Qt::QueuedConnection);
+void QWinJumpListPrivate::setAsynchronous(bool asynchronous)
+{
+    Q_Q(QWinJumpList);
+    if (asynchronous == (committer != nullptr))
+        return;
+    if (asynchronous) {
+        committer = new QWinJumpListCommitter(new QWinJumpListShellBackend(&pruner), q);
+        QObject::connect(committer, &QWinJumpListCommitter::committed, q,
+                         [this](bool success) { commitFinished(success); });
+    } else {
+        // Results still queued are delivered before the committer goes away.
+        committer->waitForIdle();
+        committer->deleteLater();
+        committer = nullptr;
     }
 }
 
-void QWinJumpListPrivate::_q_rebuild()
+// The strings of a commit come from the arena of the serializer, which is
+// reused by every commit. Items the shell would not show are pruned before
+// any shell link or icon file is made for them.
+QWinJumpListCommitter::Result QWinJumpListPrivate::commitSnapshot(ICustomDestinationList *list,
+                                                                  QWinJumpListSerializer *serializer,
+                                                                  QWinJumpListPruner *pruner,
+                                                                  const QWinJumpListSnapshot &snapshot,
+                                                                  const std::function<bool()> &isSuperseded)
 {
-    if (beginList()) {
-        if (recent && recent->isVisible())
-            appendKnownCategory(KDC_RECENT);
-        if (frequent && frequent->isVisible())
-            appendKnownCategory(KDC_FREQUENT);
-        for (QWinJumpListCategory *category : qAsConst(categories)) {
-            if (category->isVisible())
-                appendCustomCategory(category);
+    serializer->begin();
+    const QString identifier = snapshot.identifier();
+    int maxSlots = 0;
+    QStringList removed;
+    if (!beginList(list, identifier.isEmpty() ? nullptr : wideString(serializer->string(identifier)),
+                   &maxSlots, &removed)) {
+        return QWinJumpListCommitter::Failed;
+    }
+    const QWinJumpListSnapshot pruned = pruner->prune(snapshot, maxSlots, removed);
+    for (const QWinJumpListSnapshot::Category &category : pruned.categories()) {
+        if (isSuperseded && isSuperseded()) {
+            list->AbortList();
+            return QWinJumpListCommitter::Aborted;
+        }
+        if (!category.visible)
+            continue;
+        switch (category.type) {
+        case QWinJumpListSnapshot::Recent:
+            appendKnownCategory(list, KDC_RECENT);
+            break;
+        case QWinJumpListSnapshot::Frequent:
+            appendKnownCategory(list, KDC_FREQUENT);
+            break;
+        case QWinJumpListSnapshot::Custom:
+            appendCustomCategory(list, serializer, category);
+            break;
+        case QWinJumpListSnapshot::Tasks:
+            appendTasks(list, serializer, category.items);
+            break;
         }
-        if (tasks && tasks->isVisible())
-            appendTasks(tasks->items());
-        commitList();
     }
-    dirty = false;
+    return commitList(list) ? QWinJumpListCommitter::Committed : QWinJumpListCommitter::Failed;
+}
+
+Q_STATIC_ASSERT(int(QWinJumpListSnapshot::Separator) == int(QWinJumpListItem::Separator));
+Q_STATIC_ASSERT(int(QWinJumpListSnapshot::Tasks) == int(QWinJumpListCategory::Tasks));
+Q_STATIC_ASSERT(int(QWinRebuildScheduler::Debounced) == int(QWinJumpList::DebouncedRebuild));
+
+QWinJumpListSnapshot QWinJumpListPrivate::takeSnapshot() const
+{
+    QWinJumpListSnapshot snapshot(identifier);
+    if (recent)
+        snapshot.appendCategory(snapshotOf(recent));
+    if (frequent)
+        snapshot.appendCategory(snapshotOf(frequent));
+    for (const QWinJumpListCategory *category : categories)
+        snapshot.appendCategory(snapshotOf(category));
+    if (tasks)
+        snapshot.appendCategory(snapshotOf(tasks));
+    return snapshot;
+}
+
+QWinJumpListSnapshot::Category QWinJumpListPrivate::snapshotOf(const QWinJumpListCategory *category)
+{
+    QWinJumpListSnapshot::Category result;
+    result.type = QWinJumpListSnapshot::CategoryType(category->type());
+    result.title = category->title();
+    result.visible = category->isVisible();
+    // The shell fills the known categories itself.
+    if (result.type == QWinJumpListSnapshot::Recent || result.type == QWinJumpListSnapshot::Frequent)
+        return result;
+    const QList<QWinJumpListItem *> items = category->items();
+    result.items.reserve(items.size());
+    for (const QWinJumpListItem *item : items)
+        result.items.append(snapshotOf(item));
+    return result;
+}
+
+// Icons are rendered here since QIcon may only be used on the GUI thread.
+QWinJumpListSnapshot::Item QWinJumpListPrivate::snapshotOf(const QWinJumpListItem *item)
+{
+    QWinJumpListSnapshot::Item result;
+    result.type = QWinJumpListSnapshot::ItemType(item->type());
+    result.filePath = item->filePath();
+    result.workingDirectory = item->workingDirectory();
+    result.title = item->title();
+    result.description = item->description();
+    result.arguments = item->arguments();
+    const QIcon icon = item->icon();
+    if (!icon.isNull() && result.type == QWinJumpListSnapshot::Link) {
+        result.iconKey = icon.cacheKey();
+        result.iconFrames = iconFrames(icon);
+    }
+    return result;
+}
+
+QWinJumpListItem *QWinJumpListPrivate::itemOf(const QWinJumpListSnapshot::Item &item)
+{
+    QWinJumpListItem *result = new QWinJumpListItem(QWinJumpListItem::Type(item.type));
+    result->setFilePath(item.filePath);
+    result->setWorkingDirectory(item.workingDirectory);
+    result->setTitle(item.title);
+    result->setDescription(item.description);
+    result->setArguments(item.arguments);
+    // Icon files older than the state may have been swept from the cache.
+    if (!item.iconFileKey.isEmpty()) {
+        const QString path = iconsDirPath() + QString::fromLatin1(item.iconFileKey) + QLatin1String(".ico");
+        if (QFileInfo::exists(path))
+            result->setIcon(QIcon(path));
+    }
+    return result;
+}
+
+void QWinJumpListPrivate::restoreItems(QWinJumpListCategory *category, const QWinJumpListSnapshot::Category &snapshot)
+{
+    category->setVisible(snapshot.visible);
+    for (const QWinJumpListSnapshot::Item &item : snapshot.items)
+        category->addItem(itemOf(item));
 }
 
 void QWinJumpListPrivate::destroy()
@@ -168,108 +505,110 @@ void QWinJumpListPrivate::destroy()
     invalidate();
 }
 
-bool QWinJumpListPrivate::beginList()
+bool QWinJumpListPrivate::beginList(ICustomDestinationList *list, const wchar_t *identifier,
+                                    int *maxSlots, QStringList *removed)
 {
     HRESULT hresult = S_OK;
-    if (!identifier.isEmpty()) {
-        wchar_t *id = qt_qstringToNullTerminated(identifier);
-        hresult = pDestList->SetAppID(id);
-        delete[] id;
-    }
+    if (identifier)
+        hresult = list->SetAppID(identifier);
     if (SUCCEEDED(hresult)) {
-        UINT maxSlots = 0;
-        IUnknown *array = 0;
-        hresult = pDestList->BeginList(&maxSlots, qIID_IUnknown, reinterpret_cast<void **>(&array));
-        if (array)
+        UINT slots = 0;
+        IObjectArray *array = 0;
+        hresult = list->BeginList(&slots, qIID_IObjectArray, reinterpret_cast<void **>(&array));
+        *maxSlots = int(slots);
+        if (array) {
+            const QVector<QWinDocumentList::Entry> entries = fromComCollection(array);
+            for (const QWinDocumentList::Entry &entry : entries)
+                removed->append(QWinJumpListPruner::key(entry.filePath, entry.arguments));
             array->Release();
+        }
     }
     if (FAILED(hresult))
-        QWinJumpListPrivate::warning("BeginList", hresult);
+        QWinJumpListPrivate::warning("BeginList()", hresult);
     return SUCCEEDED(hresult);
 }
 
-bool QWinJumpListPrivate::commitList()
+bool QWinJumpListPrivate::commitList(ICustomDestinationList *list)
 {
-    HRESULT hresult = pDestList->CommitList();
+    HRESULT hresult = list->CommitList();
     if (FAILED(hresult))
-        QWinJumpListPrivate::warning("CommitList", hresult);
+        QWinJumpListPrivate::warning("CommitList()", hresult);
     return SUCCEEDED(hresult);
 }
 
-void QWinJumpListPrivate::appendKnownCategory(KNOWNDESTCATEGORY category)
+void QWinJumpListPrivate::appendKnownCategory(ICustomDestinationList *list, KNOWNDESTCATEGORY category)
 {
-    HRESULT hresult = pDestList->AppendKnownCategory(category);
+    HRESULT hresult = list->AppendKnownCategory(category);
     if (FAILED(hresult))
-        QWinJumpListPrivate::warning("AppendKnownCategory", hresult);
+        QWinJumpListPrivate::warning("AppendKnownCategory()", hresult);
 }
 
-void QWinJumpListPrivate::appendCustomCategory(QWinJumpListCategory *category)
+void QWinJumpListPrivate::appendCustomCategory(ICustomDestinationList *list, QWinJumpListSerializer *serializer,
+                                               const QWinJumpListSnapshot::Category &category)
 {
-    IObjectCollection *collection = toComCollection(category->items());
+    IObjectCollection *collection = toComCollection(serializer, category.items);
     if (collection) {
-        wchar_t *title = qt_qstringToNullTerminated(category->title());
-        HRESULT hresult = pDestList->AppendCategory(title, collection);
+        HRESULT hresult = list->AppendCategory(wideString(serializer->string(category.title)), collection);
         if (FAILED(hresult))
-            QWinJumpListPrivate::warning("AppendCategory", hresult);
-        delete[] title;
+            QWinJumpListPrivate::warning("AppendCategory()", hresult);
         collection->Release();
     }
 }
 
-void QWinJumpListPrivate::appendTasks(const QList<QWinJumpListItem *> &items)
+void QWinJumpListPrivate::appendTasks(ICustomDestinationList *list, QWinJumpListSerializer *serializer,
+                                      const QVector<QWinJumpListSnapshot::Item> &items)
 {
-    IObjectCollection *collection = toComCollection(items);
+    IObjectCollection *collection = toComCollection(serializer, items);
     if (collection) {
-        HRESULT hresult = pDestList->AddUserTasks(collection);
+        HRESULT hresult = list->AddUserTasks(collection);
         if (FAILED(hresult))
-            QWinJumpListPrivate::warning("AddUserTasks", hresult);
+            QWinJumpListPrivate::warning("AddUserTasks()", hresult);
         collection->Release();
     }
 }
 
-QList<QWinJumpListItem *> QWinJumpListPrivate::fromComCollection(IObjectArray *array)
+QVector<QWinDocumentList::Entry> QWinJumpListPrivate::fromComCollection(IObjectArray *array)
 {
-    QList<QWinJumpListItem *> list;
+    QVector<QWinDocumentList::Entry> list;
     UINT count = 0;
     array->GetCount(&count);
+    list.reserve(int(count));
     for (UINT i = 0; i < count; ++i) {
         IUnknown *collectionItem = 0;
         HRESULT hresult = array->GetAt(i, qIID_IUnknown, reinterpret_cast<void **>(&collectionItem));
         if (FAILED(hresult)) {
-            QWinJumpListPrivate::warning("GetAt", hresult);
+            QWinJumpListPrivate::warning("GetAt()", hresult);
             continue;
         }
         IShellItem2 *shellItem = 0;
         IShellLinkW *shellLink = 0;
-        QWinJumpListItem *jumplistItem = 0;
         if (SUCCEEDED(collectionItem->QueryInterface(qIID_IShellItem2, reinterpret_cast<void **>(&shellItem)))) {
-            jumplistItem = fromIShellItem(shellItem);
+            list.append(fromIShellItem(shellItem));
             shellItem->Release();
         } else if (SUCCEEDED(collectionItem->QueryInterface(qIID_IShellLinkW, reinterpret_cast<void **>(&shellLink)))) {
-            jumplistItem = fromIShellLink(shellLink);
+            list.append(fromIShellLink(shellLink));
             shellLink->Release();
         } else {
             qWarning("QWinJumpList: object of unexpected class found");
         }
         collectionItem->Release();
-        if (jumplistItem)
-            list.append(jumplistItem);
     }
     return list;
 }
 
-IObjectCollection *QWinJumpListPrivate::toComCollection(const QList<QWinJumpListItem *> &list)
+IObjectCollection *QWinJumpListPrivate::toComCollection(QWinJumpListSerializer *serializer,
+                                                        const QVector<QWinJumpListSnapshot::Item> &list)
 {
     if (list.isEmpty())
         return 0;
     IObjectCollection *collection = 0;
     HRESULT hresult = CoCreateInstance(qCLSID_EnumerableObjectCollection, 0, CLSCTX_INPROC_SERVER, qIID_IObjectCollection, reinterpret_cast<void **>(&collection));
     if (FAILED(hresult)) {
-        QWinJumpListPrivate::warning("QWinJumpList: failed to instantiate IObjectCollection", hresult);
+        QWinJumpListPrivate::warning("CoCreateInstance(IObjectCollection)", hresult);
         return 0;
     }
-    for (QWinJumpListItem *item : list) {
-        IUnknown *iitem = toICustomDestinationListItem(item);
+    for (const QWinJumpListSnapshot::Item &item : list) {
+        IUnknown *iitem = toICustomDestinationListItem(serializer, item);
         if (iitem) {
             collection->AddObject(iitem);
             iitem->Release();
@@ -278,15 +617,16 @@ IObjectCollection *QWinJumpListPrivate::toComCollection(const QList<QWinJumpList
     return collection;
 }
 
-QWinJumpListItem *QWinJumpListPrivate::fromIShellLink(IShellLinkW *link)
+QWinDocumentList::Entry QWinJumpListPrivate::fromIShellLink(IShellLinkW *link)
 {
-    QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Link);
+    QWinDocumentList::Entry item;
+    item.isLink = true;
 
     IPropertyStore *linkProps;
     link->QueryInterface(qIID_IPropertyStore, reinterpret_cast<void **>(&linkProps));
     PROPVARIANT var;
     linkProps->GetValue(qPKEY_Link_Arguments, &var);
-    item->setArguments(QStringList(QString::fromWCharArray(var.pwszVal)));
+    item.arguments = QWinCommandLine::split(QString::fromWCharArray(var.pwszVal));
     PropVariantClear(&var);
     linkProps->Release();
 
@@ -294,110 +634,84 @@ QWinJumpListItem *QWinJumpListPrivate::fromIShellLink(IShellLinkW *link)
     wchar_t buffer[buffersize];
 
     link->GetDescription(buffer, INFOTIPSIZE);
-    item->setDescription(QString::fromWCharArray(buffer));
+    item.description = QString::fromWCharArray(buffer);
 
     int dummyindex;
     link->GetIconLocation(buffer, buffersize-1, &dummyindex);
-    item->setIcon(QIcon(QString::fromWCharArray(buffer)));
+    item.iconLocation = QString::fromWCharArray(buffer);
 
     link->GetPath(buffer, buffersize-1, 0, 0);
-    item->setFilePath(QDir::fromNativeSeparators(QString::fromWCharArray(buffer)));
+    item.filePath = QDir::fromNativeSeparators(QString::fromWCharArray(buffer));
 
     return item;
 }
 
-QWinJumpListItem *QWinJumpListPrivate::fromIShellItem(IShellItem2 *shellitem)
+QWinDocumentList::Entry QWinJumpListPrivate::fromIShellItem(IShellItem2 *shellitem)
 {
-    QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Destination);
+    QWinDocumentList::Entry item;
     wchar_t *strPtr;
     shellitem->GetDisplayName(SIGDN_FILESYSPATH, &strPtr);
-    item->setFilePath(QDir::fromNativeSeparators(QString::fromWCharArray(strPtr)));
+    item.filePath = QDir::fromNativeSeparators(QString::fromWCharArray(strPtr));
     CoTaskMemFree(strPtr);
     return item;
 }
 
-IUnknown *QWinJumpListPrivate::toICustomDestinationListItem(const QWinJumpListItem *item)
+IUnknown *QWinJumpListPrivate::toICustomDestinationListItem(QWinJumpListSerializer *serializer,
+                                                            const QWinJumpListSnapshot::Item &item)
 {
-    switch (item->type()) {
-    case QWinJumpListItem::Destination :
-        return toIShellItem(item);
-    case QWinJumpListItem::Link :
-        return toIShellLink(item);
-    case QWinJumpListItem::Separator :
+    switch (item.type) {
+    case QWinJumpListSnapshot::Destination :
+        return toIShellItem(wideString(serializer->string(item.filePath)));
+    case QWinJumpListSnapshot::Link :
+        return toIShellLink(serializer->link(item));
+    case QWinJumpListSnapshot::Separator :
         return makeSeparatorShellItem();
     default:
         return 0;
     }
 }
 
-IShellLinkW *QWinJumpListPrivate::toIShellLink(const QWinJumpListItem *item)
+IShellLinkW *QWinJumpListPrivate::toIShellLink(const QWinJumpListSerializer::Link &link)
 {
-    IShellLinkW *link = 0;
-    HRESULT hresult = CoCreateInstance(CLSID_ShellLink, 0, CLSCTX_INPROC_SERVER, qIID_IShellLinkW, reinterpret_cast<void **>(&link));
+    IShellLinkW *shellLink = 0;
+    HRESULT hresult = CoCreateInstance(CLSID_ShellLink, 0, CLSCTX_INPROC_SERVER, qIID_IShellLinkW, reinterpret_cast<void **>(&shellLink));
     if (FAILED(hresult)) {
-        QWinJumpListPrivate::warning("QWinJumpList: failed to instantiate IShellLinkW", hresult);
+        QWinJumpListPrivate::warning("CoCreateInstance(IShellLinkW)", hresult);
         return 0;
     }
 
-    const QString args = createArguments(item->arguments());
-    const int iconPathSize = QWinJumpListPrivate::iconsDirPath().size()
-        + int(sizeof(void *)) * 2 + 4; // path + ptr-name-in-hex + .ico
-    const int bufferSize = qMax(args.size(),
-                                qMax(item->workingDirectory().size(),
-                                     qMax(item->description().size(),
-                                          qMax(item->title().size(),
-                                               qMax(item->filePath().size(), iconPathSize))))) + 1;
-    wchar_t *buffer = new wchar_t[bufferSize];
-
-    if (!item->description().isEmpty()) {
-        qt_qstringToNullTerminated(item->description(), buffer);
-        link->SetDescription(buffer);
-    }
-
-    qt_qstringToNullTerminated(item->filePath(), buffer);
-    link->SetPath(buffer);
-
-    if (!item->workingDirectory().isEmpty()) {
-        qt_qstringToNullTerminated(item->workingDirectory(), buffer);
-        link->SetWorkingDirectory(buffer);
-    }
-
-    qt_qstringToNullTerminated(args, buffer);
-    link->SetArguments(buffer);
-
-    if (!item->icon().isNull()) {
-        QString iconPath = QWinJumpListPrivate::iconsDirPath() + QString::number(reinterpret_cast<quintptr>(item), 16) + QLatin1String(".ico");
-        bool iconSaved = item->icon().pixmap(GetSystemMetrics(SM_CXICON)).save(iconPath, "ico");
-        if (iconSaved) {
-            qt_qstringToNullTerminated(iconPath, buffer);
-            link->SetIconLocation(buffer, 0);
-        }
-    }
+    if (link.description)
+        shellLink->SetDescription(wideString(link.description));
+    shellLink->SetPath(wideString(link.path));
+    if (link.workingDirectory)
+        shellLink->SetWorkingDirectory(wideString(link.workingDirectory));
+    shellLink->SetArguments(wideString(link.arguments));
+    if (link.iconLocation)
+        shellLink->SetIconLocation(wideString(link.iconLocation), 0);
 
     IPropertyStore *properties;
-    PROPVARIANT titlepv;
-    hresult = link->QueryInterface(qIID_IPropertyStore, reinterpret_cast<void **>(&properties));
+    hresult = shellLink->QueryInterface(qIID_IPropertyStore, reinterpret_cast<void **>(&properties));
     if (FAILED(hresult)) {
-        link->Release();
+        shellLink->Release();
         return 0;
     }
 
-    qt_qstringToNullTerminated(item->title(), buffer);
-    InitPropVariantFromString(buffer, &titlepv);
+    // SetValue() copies the value, so the title is not copied beforehand.
+    PROPVARIANT titlepv;
+    PropVariantInit(&titlepv);
+    titlepv.vt = VT_LPWSTR;
+    titlepv.pwszVal = const_cast<wchar_t *>(wideString(link.title));
     properties->SetValue(qPKEY_Title, titlepv);
     properties->Commit();
     properties->Release();
-    PropVariantClear(&titlepv);
 
-    delete[] buffer;
-    return link;
+    return shellLink;
 }
 
-IShellItem2 *QWinJumpListPrivate::toIShellItem(const QWinJumpListItem *item)
+IShellItem2 *QWinJumpListPrivate::toIShellItem(const wchar_t *path)
 {
     IShellItem2 *shellitem = 0;
-    QScopedArrayPointer<wchar_t> buffer(qt_qstringToNullTerminated(item->filePath()));
-    SHCreateItemFromParsingName(buffer.data(), 0, qIID_IShellItem2, reinterpret_cast<void **>(&shellitem));
+    SHCreateItemFromParsingName(path, 0, qIID_IShellItem2, reinterpret_cast<void **>(&shellitem));
     return shellitem;
 }
 
@@ -433,9 +747,18 @@ QWinJumpList::QWinJumpList(QObject *parent) :
 {
     Q_D(QWinJumpList);
     d->q_ptr = this;
+    QTimer *rebuildTimer = new QTimer(this);
+    rebuildTimer->setSingleShot(true);
+    connect(rebuildTimer, &QTimer::timeout, this, [d]() { d->scheduler.timeout(); });
+    d->scheduler.setTimer([rebuildTimer](int msec) {
+        if (msec < 0)
+            rebuildTimer->stop();
+        else
+            rebuildTimer->start(msec);
+    });
     HRESULT hresult = CoCreateInstance(qCLSID_DestinationList, 0, CLSCTX_INPROC_SERVER, qIID_ICustomDestinationList, reinterpret_cast<void **>(&d_ptr->pDestList));
     if (FAILED(hresult))
-        QWinJumpListPrivate::warning("CoCreateInstance", hresult);
+        QWinJumpListPrivate::warning("CoCreateInstance(ICustomDestinationList)", hresult);
     d->invalidate();
 }
 
@@ -445,8 +768,12 @@ QWinJumpList::QWinJumpList(QObject *parent) :
 QWinJumpList::~QWinJumpList()
 {
     Q_D(QWinJumpList);
-    if (d->dirty)
-        d->_q_rebuild();
+    d->scheduler.flush();
+    if (d->committer) {
+        d->committer->waitForIdle();
+        delete d->committer;
+        d->committer = nullptr;
+    }
     if (d->pDestList) {
         d->pDestList->Release();
         d->pDestList = 0;
@@ -484,10 +811,275 @@ void QWinJumpList::setIdentifier(const QString &identifier)
         id.truncate(128);
     if (d->identifier != id) {
         d->identifier = id;
+        if (d->recent)
+            QWinJumpListCategoryPrivate::get(d->recent)->documents->setAppId(id);
+        if (d->frequent)
+            QWinJumpListCategoryPrivate::get(d->frequent)->documents->setAppId(id);
         d->invalidate();
     }
 }
 
+/*!
+    \enum QWinJumpList::RebuildPolicy
+    \since 5.11.4
+
+    This enum type specifies when the jump list is rebuilt after a change.
+    Rebuilding replaces the whole list, so changes are usually batched.
+
+    \value QueuedRebuild
+           The jump list is rebuilt once control returns to the event loop,
+           so all changes made until then are applied together. This is the
+           default.
+    \value ImmediateRebuild
+           The jump list is rebuilt within the call that changed it.
+    \value DebouncedRebuild
+           The jump list is rebuilt once it has not been changed for
+           debounceInterval milliseconds.
+
+    With every policy, rebuilds are at least minimumRebuildInterval
+    milliseconds apart. Rebuilds that would happen earlier are postponed.
+
+    \sa flush()
+ */
+
+/*!
+    \property QWinJumpList::rebuildPolicy
+    \brief when the jump list is rebuilt after a change
+    \since 5.11.4
+
+    The default value is QWinJumpList::QueuedRebuild.
+ */
+QWinJumpList::RebuildPolicy QWinJumpList::rebuildPolicy() const
+{
+    Q_D(const QWinJumpList);
+    return RebuildPolicy(d->scheduler.policy());
+}
+
+void QWinJumpList::setRebuildPolicy(QWinJumpList::RebuildPolicy policy)
+{
+    Q_D(QWinJumpList);
+    d->scheduler.setPolicy(QWinRebuildScheduler::Policy(policy));
+}
+
+/*!
+    \property QWinJumpList::debounceInterval
+    \brief the time in milliseconds without changes after which the jump list
+    is rebuilt
+    \since 5.11.4
+
+    Only used with the QWinJumpList::DebouncedRebuild policy. The default
+    value is \c 100.
+ */
+int QWinJumpList::debounceInterval() const
+{
+    Q_D(const QWinJumpList);
+    return d->scheduler.debounceInterval();
+}
+
+void QWinJumpList::setDebounceInterval(int msec)
+{
+    Q_D(QWinJumpList);
+    d->scheduler.setDebounceInterval(msec);
+}
+
+/*!
+    \property QWinJumpList::minimumRebuildInterval
+    \brief the minimum time in milliseconds between two rebuilds of the jump
+    list
+    \since 5.11.4
+
+    The default value is \c 0.
+
+    \sa flush()
+ */
+int QWinJumpList::minimumRebuildInterval() const
+{
+    Q_D(const QWinJumpList);
+    return d->scheduler.minimumInterval();
+}
+
+void QWinJumpList::setMinimumRebuildInterval(int msec)
+{
+    Q_D(QWinJumpList);
+    d->scheduler.setMinimumInterval(msec);
+}
+
+/*!
+    \since 5.11.4
+
+    Returns how many times a change asked the jump list to be rebuilt
+    since it was created.
+
+    Together with executedRebuildCount(), this tells how well the
+    rebuildPolicy coalesces changes.
+
+    \sa executedRebuildCount()
+ */
+quint64 QWinJumpList::requestedRebuildCount() const
+{
+    Q_D(const QWinJumpList);
+    return d->scheduler.requestedCount();
+}
+
+/*!
+    \since 5.11.4
+
+    Returns how many rebuilds of the jump list ran since it was created,
+    including those that found nothing to commit.
+
+    \sa requestedRebuildCount()
+ */
+quint64 QWinJumpList::executedRebuildCount() const
+{
+    Q_D(const QWinJumpList);
+    return d->scheduler.executedCount();
+}
+
+/*!
+    \property QWinJumpList::asynchronous
+    \brief whether the jump list is committed on a worker thread
+    \since 5.11.4
+
+    Committing creates a shell link for every item and writes the item icons
+    to files, which can stall the GUI thread for large jump lists. When this
+    property is \c true, the GUI thread only takes a copy of the jump list,
+    and a worker thread of its own commits it. If the jump list changes again
+    before a commit has finished, that commit is abandoned in favor of the
+    newer one.
+
+    The default value is \c false.
+
+    \sa committed(), lastCommit(), flush()
+ */
+bool QWinJumpList::isAsynchronous() const
+{
+    Q_D(const QWinJumpList);
+    return d->committer != nullptr;
+}
+
+void QWinJumpList::setAsynchronous(bool asynchronous)
+{
+    Q_D(QWinJumpList);
+    d->setAsynchronous(asynchronous);
+}
+
+/*!
+    \since 5.11.4
+
+    Returns a future for the most recent commit of the jump list. Its result
+    is \c true if the commit succeeded. The future of an asynchronous commit
+    that was abandoned in favor of a newer one is canceled, and its result is
+    \c false.
+
+    \sa asynchronous, committed()
+ */
+QFuture<bool> QWinJumpList::lastCommit() const
+{
+    Q_D(const QWinJumpList);
+    return d->lastCommit;
+}
+
+/*!
+    \since 5.11.4
+
+    Returns the identifier, the categories and the items of the jump list in
+    a compact binary form, to be passed to restoreState(). The recent and
+    frequent categories are saved without their items, which the system
+    keeps. Icons are saved as references to the icon files written when
+    committing the jump list.
+
+    \sa restoreState()
+ */
+QByteArray QWinJumpList::saveState() const
+{
+    Q_D(const QWinJumpList);
+    return QWinJumpListState::save(d->takeSnapshot());
+}
+
+/*!
+    \since 5.11.4
+
+    Replaces the identifier, the categories and the items of the jump list
+    with the ones saved in \a state by saveState(). Existing categories and
+    items are deleted. Icons whose files no longer exist are not restored.
+
+    Returns \c false, leaving the jump list as it is, if \a state is
+    corrupt or was saved by an incompatible version of Qt.
+
+    \sa saveState()
+ */
+bool QWinJumpList::restoreState(const QByteArray &state)
+{
+    Q_D(QWinJumpList);
+    QWinJumpListSnapshot snapshot;
+    if (!QWinJumpListState::restore(state, &snapshot))
+        return false;
+    d->destroy();
+    setIdentifier(snapshot.identifier());
+    for (const QWinJumpListSnapshot::Category &category : snapshot.categories()) {
+        switch (category.type) {
+        case QWinJumpListSnapshot::Recent:
+            recent()->setVisible(category.visible);
+            break;
+        case QWinJumpListSnapshot::Frequent:
+            frequent()->setVisible(category.visible);
+            break;
+        case QWinJumpListSnapshot::Tasks:
+            QWinJumpListPrivate::restoreItems(tasks(), category);
+            break;
+        case QWinJumpListSnapshot::Custom: {
+            QWinJumpListCategory *custom = new QWinJumpListCategory(category.title);
+            QWinJumpListPrivate::restoreItems(custom, category);
+            addCategory(custom);
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+/*!
+    \since 5.11.4
+
+    Returns the number of destinations the shell shows in the custom
+    categories, as reported by the last commit, or \c 0 before the first
+    one. It follows a setting of the user.
+
+    Commits leave out the items beyond this number. The first item of every
+    visible custom category is kept, then the second one of every category,
+    and so on.
+
+    \sa itemsRemoved()
+ */
+int QWinJumpList::maximumSlots() const
+{
+    Q_D(const QWinJumpList);
+    return d->pruner.maximumSlots();
+}
+
+/*!
+    \fn void QWinJumpList::itemsRemoved(const QList<QWinJumpListItem *> &items)
+    \since 5.11.4
+
+    This signal is emitted after a commit when the user has removed \a items
+    of the custom categories from the jump list. The items stay in their
+    categories but are no longer committed, as the shell expects; the
+    application may delete them.
+
+    \sa maximumSlots()
+ */
+
+/*!
+    \fn void QWinJumpList::committed(bool success)
+    \since 5.11.4
+
+    This signal is emitted when a commit of the jump list has finished.
+    \a success is \c false if the shell refused the jump list. Commits that
+    were abandoned in favor of newer ones are not reported.
+
+    \sa lastCommit()
+ */
+
 /*!
     Returns the recent items category in the jump list.
  */
@@ -581,6 +1173,27 @@ void QWinJumpList::clear()
     d->destroy();
 }
 
+/*!
+    \since 5.11.4
+
+    Rebuilds the jump list right away if there are changes that were not
+    applied yet, regardless of the rebuild policy and the minimum rebuild
+    interval. With asynchronous commits, waits for the commit to finish.
+    Also waits for items added with QWinJumpListCategory::addItems() to be
+    registered with the system.
+
+    \sa rebuildPolicy
+ */
+void QWinJumpList::flush()
+{
+    Q_D(QWinJumpList);
+    d->scheduler.flush();
+    if (d->committer)
+        d->committer->waitForIdle();
+    if (d->recentDocuments)
+        d->recentDocuments->waitForIdle();
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 
 QDebug operator<<(QDebug debug, const QWinJumpList *jumplist)
@@ -41,6 +41,7 @@
 #ifndef QWINJUMPLIST_H
 #define QWINJUMPLIST_H
 
+#include <QtCore/qfuture.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qstringlist.h>
 #include <QtCore/qscopedpointer.h>
@@ -56,14 +57,43 @@ class Q_WINEXTRAS_EXPORT QWinJumpList : public QObject
 {
     Q_OBJECT
     Q_PROPERTY(QString identifier READ identifier WRITE setIdentifier)
+    Q_PROPERTY(RebuildPolicy rebuildPolicy READ rebuildPolicy WRITE setRebuildPolicy)
+    Q_PROPERTY(int debounceInterval READ debounceInterval WRITE setDebounceInterval)
+    Q_PROPERTY(int minimumRebuildInterval READ minimumRebuildInterval WRITE setMinimumRebuildInterval)
+    Q_PROPERTY(bool asynchronous READ isAsynchronous WRITE setAsynchronous)
 
 public:
+    enum RebuildPolicy {
+        QueuedRebuild,
+        ImmediateRebuild,
+        DebouncedRebuild
+    };
+    Q_ENUM(RebuildPolicy)
+
     explicit QWinJumpList(QObject *parent = nullptr);
     ~QWinJumpList();
 
     QString identifier() const;
     void setIdentifier(const QString &identifier);
 
+    RebuildPolicy rebuildPolicy() const;
+    void setRebuildPolicy(RebuildPolicy policy);
+    int debounceInterval() const;
+    void setDebounceInterval(int msec);
+    int minimumRebuildInterval() const;
+    void setMinimumRebuildInterval(int msec);
+    quint64 requestedRebuildCount() const;
+    quint64 executedRebuildCount() const;
+    bool isAsynchronous() const;
+    void setAsynchronous(bool asynchronous);
+
+    QFuture<bool> lastCommit() const;
+
+    QByteArray saveState() const;
+    bool restoreState(const QByteArray &state);
+
+    int maximumSlots() const;
+
     QWinJumpListCategory *recent() const;
     QWinJumpListCategory *frequent() const;
     QWinJumpListCategory *tasks() const;
@@ -74,13 +104,16 @@ public:
 
 public Q_SLOTS:
     void clear();
+    void flush();
+
+Q_SIGNALS:
+    void committed(bool success);
+    void itemsRemoved(const QList<QWinJumpListItem *> &items);
 
 private:
     Q_DISABLE_COPY(QWinJumpList)
     Q_DECLARE_PRIVATE(QWinJumpList)
     QScopedPointer<QWinJumpListPrivate> d_ptr;
-
-    Q_PRIVATE_SLOT(d_func(), void _q_rebuild())
 };
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -54,9 +54,23 @@
 
 #include "qwinjumplist.h"
 #include "winshobjidl_p.h"
+#include "qwinjumplistsnapshot_p.h"
+#include "qwinrebuildscheduler_p.h"
+#include "qwinjumplistcommitter_p.h"
+#include "qwinjumplistserializer_p.h"
+#include "qwindocumentlist_p.h"
+#include "qwinrecentdocumentsubmitter_p.h"
+#include "qwinjumplistpruner_p.h"
+
+#include <QtCore/qfuture.h>
+#include <QtCore/qscopedpointer.h>
+
+#include <functional>
 
 QT_BEGIN_NAMESPACE
 
+class QWinIconFileCache;
+
 class QWinJumpListPrivate
 {
     Q_DECLARE_PUBLIC(QWinJumpList)
@@ -69,25 +83,53 @@ public:
 
     static void warning(const char *function, HRESULT hresult);
     static QString iconsDirPath();
+    static QWinIconFileCache *iconCache();
+    static QString iconPath(const QVector<QImage> &frames);
+    static QString recentIconPath(const QVector<QImage> &frames);
+    static void markIconsInUse(const QWinJumpListSnapshot &snapshot);
+    static QString statePath(const QString &identifier);
+    static void persistState(const QString &path, const QByteArray &state);
+    static void persistCommit(const QWinJumpListSnapshot &snapshot, const QWinJumpListSerializer &serializer,
+                              QWinJumpListCommitter::Result result);
 
     void invalidate();
-    void _q_rebuild();
+    void rebuild();
+    void commitFinished(bool success);
+    void reportRemovals();
+    void setAsynchronous(bool asynchronous);
     void destroy();
+    QWinRecentDocumentSubmitter *recentDocumentSubmitter();
+
+    QWinJumpListSnapshot takeSnapshot() const;
+    static QWinJumpListSnapshot::Category snapshotOf(const QWinJumpListCategory *category);
+    static QWinJumpListSnapshot::Item snapshotOf(const QWinJumpListItem *item);
+    static QWinJumpListItem *itemOf(const QWinJumpListSnapshot::Item &item);
+    static void restoreItems(QWinJumpListCategory *category, const QWinJumpListSnapshot::Category &snapshot);
 
-    bool beginList();
-    bool commitList();
+    static QWinJumpListCommitter::Result commitSnapshot(ICustomDestinationList *list,
+                                                        QWinJumpListSerializer *serializer,
+                                                        QWinJumpListPruner *pruner,
+                                                        const QWinJumpListSnapshot &snapshot,
+                                                        const std::function<bool()> &isSuperseded = std::function<bool()>());
+    static bool beginList(ICustomDestinationList *list, const wchar_t *identifier,
+                          int *maxSlots, QStringList *removed);
+    static bool commitList(ICustomDestinationList *list);
 
-    void appendKnownCategory(KNOWNDESTCATEGORY category);
-    void appendCustomCategory(QWinJumpListCategory *category);
-    void appendTasks(const QList<QWinJumpListItem *> &items);
+    static void appendKnownCategory(ICustomDestinationList *list, KNOWNDESTCATEGORY category);
+    static void appendCustomCategory(ICustomDestinationList *list, QWinJumpListSerializer *serializer,
+                                     const QWinJumpListSnapshot::Category &category);
+    static void appendTasks(ICustomDestinationList *list, QWinJumpListSerializer *serializer,
+                            const QVector<QWinJumpListSnapshot::Item> &items);
 
-    static QList<QWinJumpListItem *> fromComCollection(IObjectArray *array);
-    static IObjectCollection *toComCollection(const QList<QWinJumpListItem *> &list);
-    static QWinJumpListItem *fromIShellLink(IShellLinkW *link);
-    static QWinJumpListItem *fromIShellItem(IShellItem2 *shellitem);
-    static IUnknown *toICustomDestinationListItem(const QWinJumpListItem *item);
-    static IShellLinkW *toIShellLink(const QWinJumpListItem *item);
-    static IShellItem2 *toIShellItem(const QWinJumpListItem *item);
+    static QVector<QWinDocumentList::Entry> fromComCollection(IObjectArray *array);
+    static IObjectCollection *toComCollection(QWinJumpListSerializer *serializer,
+                                              const QVector<QWinJumpListSnapshot::Item> &list);
+    static QWinDocumentList::Entry fromIShellLink(IShellLinkW *link);
+    static QWinDocumentList::Entry fromIShellItem(IShellItem2 *shellitem);
+    static IUnknown *toICustomDestinationListItem(QWinJumpListSerializer *serializer,
+                                                  const QWinJumpListSnapshot::Item &item);
+    static IShellLinkW *toIShellLink(const QWinJumpListSerializer::Link &link);
+    static IShellItem2 *toIShellItem(const wchar_t *path);
     static IShellLinkW *makeSeparatorShellItem();
 
     QWinJumpList *q_ptr = nullptr;
@@ -97,7 +139,13 @@ public:
     QWinJumpListCategory *tasks = nullptr;
     QList<QWinJumpListCategory *> categories;
     QString identifier;
-    bool dirty = false;
+    QWinJumpListSnapshot committed;
+    QWinJumpListSerializer serializer{&QWinJumpListPrivate::iconPath};
+    QWinJumpListPruner pruner;
+    QWinRebuildScheduler scheduler{[this]() { rebuild(); }};
+    QWinJumpListCommitter *committer = nullptr;
+    QFuture<bool> lastCommit;
+    QScopedPointer<QWinRecentDocumentSubmitter> recentDocuments;
 };
 
 QT_END_NAMESPACE
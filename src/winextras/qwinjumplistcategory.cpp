@@ -57,10 +57,15 @@
 #include "winshobjidl_p.h"
 #include "windowsguidsdefs_p.h"
 
+#include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QSet>
 
 #include <shlobj.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -88,43 +93,216 @@ QT_BEGIN_NAMESPACE
 QWinJumpListCategory *QWinJumpListCategoryPrivate::create(QWinJumpListCategory::Type type, QWinJumpList *jumpList)
 {
     QWinJumpListCategory *category = new QWinJumpListCategory;
-    category->d_func()->type = type;
-    category->d_func()->jumpList = jumpList;
-    if (type == QWinJumpListCategory::Recent || type == QWinJumpListCategory::Frequent)
-        category->d_func()->loadRecents();
+    QWinJumpListCategoryPrivate *d = category->d_func();
+    d->type = type;
+    d->jumpList = jumpList;
+    if (type == QWinJumpListCategory::Recent || type == QWinJumpListCategory::Frequent) {
+        d->documents.reset(new QWinDocumentList(type == QWinJumpListCategory::Recent ? QWinDocumentList::Recent
+                                                                                     : QWinDocumentList::Frequent,
+                                                documentListProvider()));
+        d->documents->setAppId(jumpList->identifier());
+    }
     return category;
 }
 
+// Reads the lists of IApplicationDocumentLists.
+class QWinShellDocumentListProvider : public QWinDocumentList::Provider
+{
+public:
+    bool read(QWinDocumentList::Type type, const QString &appId, int limit,
+              QVector<QWinDocumentList::Entry> *entries) override
+    {
+        IApplicationDocumentLists *pDocList = 0;
+        HRESULT hresult = CoCreateInstance(qCLSID_ApplicationDocumentLists, 0, CLSCTX_INPROC_SERVER, qIID_IApplicationDocumentLists, reinterpret_cast<void **>(&pDocList));
+        if (SUCCEEDED(hresult)) {
+            if (!appId.isEmpty()) {
+                wchar_t *id = qt_qstringToNullTerminated(appId);
+                hresult = pDocList->SetAppID(id);
+                delete[] id;
+            }
+            if (SUCCEEDED(hresult)) {
+                IObjectArray *array = 0;
+                hresult = pDocList->GetList(type == QWinDocumentList::Recent ? ADLT_RECENT : ADLT_FREQUENT,
+                                            UINT(limit), qIID_IObjectArray, reinterpret_cast<void **>(&array));
+                if (SUCCEEDED(hresult)) {
+                    *entries = QWinJumpListPrivate::fromComCollection(array);
+                    array->Release();
+                }
+            }
+            pDocList->Release();
+        }
+        if (FAILED(hresult))
+            QWinJumpListPrivate::warning("loadRecents()", hresult);
+        return SUCCEEDED(hresult);
+    }
+};
+
+Q_GLOBAL_STATIC(QWinShellDocumentListProvider, shellDocumentListProvider)
+
+// Adds recent documents on the thread of the submitter.
+class QWinShellRecentDocumentSink : public QWinRecentDocumentSubmitter::Sink
+{
+public:
+    void batchStarted() override
+    {
+        m_initialized = SUCCEEDED(CoInitializeEx(0, COINIT_APARTMENTTHREADED));
+    }
+
+    void batchFinished() override
+    {
+        if (m_initialized)
+            CoUninitialize();
+    }
+
+    bool add(const QChar *appId, const QWinJumpListSerializer::Link &link) override
+    {
+        SHARDAPPIDINFOLINK info;
+        info.pszAppID = reinterpret_cast<const wchar_t *>(appId);
+        info.psl = QWinJumpListPrivate::toIShellLink(link);
+        if (!info.psl)
+            return false;
+        SHAddToRecentDocs(SHARD_APPIDINFOLINK, &info);
+        info.psl->Release();
+        return true;
+    }
+
+private:
+    bool m_initialized = false;
+};
+
+QWinRecentDocumentSubmitter *QWinJumpListPrivate::recentDocumentSubmitter()
+{
+    if (!recentDocuments)
+        recentDocuments.reset(new QWinRecentDocumentSubmitter(new QWinShellRecentDocumentSink, &QWinJumpListPrivate::recentIconPath));
+    return recentDocuments.data();
+}
+
+QWinDocumentList::Provider *QWinJumpListCategoryPrivate::documentListProvider()
+{
+    return shellDocumentListProvider();
+}
+
 void QWinJumpListCategoryPrivate::invalidate()
 {
     if (jumpList)
         QWinJumpListPrivate::get(jumpList)->invalidate();
 }
 
+// Keeps one link per row of the model at the front of the items.
+class QWinJumpListCategoryModelSink : public QWinJumpListModelMapper::Sink
+{
+public:
+    explicit QWinJumpListCategoryModelSink(QWinJumpListCategory *category) : m_category(category) {}
+
+    void insertItems(int first, int count) override
+    {
+        QWinJumpListCategoryPrivate *d = QWinJumpListCategoryPrivate::get(m_category);
+        for (int i = 0; i < count; ++i) {
+            QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Link);
+            QWinJumpListItemPrivate *p = QWinJumpListItemPrivate::get(item);
+            p->filePath = QCoreApplication::applicationFilePath();
+            p->category = m_category;
+            d->items.insert(first + i, item);
+        }
+        d->invalidate();
+    }
+
+    void removeItems(int first, int count) override
+    {
+        QWinJumpListCategoryPrivate *d = QWinJumpListCategoryPrivate::get(m_category);
+        for (int i = 0; i < count; ++i)
+            delete d->items.takeAt(first);
+        d->invalidate();
+    }
+
+    void setField(int row, QWinJumpListModelMapper::Field field, const QVariant &value) override
+    {
+        QWinJumpListItem *item = QWinJumpListCategoryPrivate::get(m_category)->items.at(row);
+        switch (field) {
+        case QWinJumpListModelMapper::FilePath: {
+            const QString filePath = value.toString();
+            item->setFilePath(filePath.isEmpty() ? QCoreApplication::applicationFilePath() : filePath);
+            break;
+        }
+        case QWinJumpListModelMapper::Title:
+            item->setTitle(value.toString());
+            break;
+        case QWinJumpListModelMapper::Arguments:
+            item->setArguments(value.toStringList());
+            break;
+        case QWinJumpListModelMapper::Icon:
+            item->setIcon(qvariant_cast<QIcon>(value));
+            break;
+        case QWinJumpListModelMapper::FieldCount:
+            break;
+        }
+    }
+
+private:
+    QWinJumpListCategory *m_category;
+};
+
+static bool isSameDocument(const QWinDocumentList::Entry &entry, const QWinJumpListItem *item)
+{
+    return entry.isLink == (item->type() == QWinJumpListItem::Link)
+        && QDir::fromNativeSeparators(item->filePath()).compare(entry.filePath, Qt::CaseInsensitive) == 0
+        && entry.arguments == item->arguments();
+}
+
+// Makes the items of a recent or frequent category when they are first
+// needed, and again after the document list was invalidated. Items added
+// with addItem() are also known to the shell, they are not listed twice.
 void QWinJumpListCategoryPrivate::loadRecents()
 {
-    Q_ASSERT(jumpList);
-    IApplicationDocumentLists *pDocList = 0;
-    HRESULT hresult = CoCreateInstance(qCLSID_ApplicationDocumentLists, 0, CLSCTX_INPROC_SERVER, qIID_IApplicationDocumentLists, reinterpret_cast<void **>(&pDocList));
-    if (SUCCEEDED(hresult)) {
-        if (!jumpList->identifier().isEmpty()) {
-            wchar_t *id = qt_qstringToNullTerminated(jumpList->identifier());
-            hresult = pDocList->SetAppID(id);
-            delete[] id;
+    if (!documents)
+        return;
+    const QVector<QWinDocumentList::Entry> &entries = documents->entries();
+    if (documents->generation() == recentsGeneration)
+        return;
+    recentsGeneration = documents->generation();
+
+    qDeleteAll(recents);
+    recents.clear();
+    recents.reserve(entries.size());
+    for (const QWinDocumentList::Entry &entry : entries) {
+        const auto added = std::find_if(items.cbegin(), items.cend(), [&entry](const QWinJumpListItem *item) {
+            return isSameDocument(entry, item);
+        });
+        if (added != items.cend())
+            continue;
+        QWinJumpListItem *item = new QWinJumpListItem(entry.isLink ? QWinJumpListItem::Link
+                                                                   : QWinJumpListItem::Destination);
+        QWinJumpListItemPrivate *p = QWinJumpListItemPrivate::get(item);
+        p->filePath = entry.filePath;
+        p->description = entry.description;
+        p->arguments = entry.arguments;
+        p->iconLocation = entry.iconLocation;
+        recents.append(item);
+    }
+}
+
+bool QWinJumpListCategoryPrivate::accepts(const QWinJumpListItem *item, const char *function) const
+{
+    if (type == QWinJumpListCategory::Recent || type == QWinJumpListCategory::Frequent) {
+        if (item->type() == QWinJumpListItem::Separator) {
+            qWarning("QWinJumpListCategory::%s(): only tasks/custom categories support separators.", function);
+            return false;
         }
-        if (SUCCEEDED(hresult)) {
-            IObjectArray *array = 0;
-            hresult = pDocList->GetList(type == QWinJumpListCategory::Recent ? ADLT_RECENT : ADLT_FREQUENT,
-                                        0, qIID_IObjectArray, reinterpret_cast<void **>(&array));
-            if (SUCCEEDED(hresult)) {
-                items = QWinJumpListPrivate::fromComCollection(array);
-                array->Release();
-            }
+        if (item->type() == QWinJumpListItem::Destination) {
+            qWarning("QWinJumpListCategory::%s(): only tasks/custom categories support destinations.", function);
+            return false;
         }
-        pDocList->Release();
     }
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("loadRecents", hresult);
+    return true;
+}
+
+bool QWinJumpListCategoryPrivate::acceptsModel(const char *function) const
+{
+    if (type == QWinJumpListCategory::Recent || type == QWinJumpListCategory::Frequent) {
+        qWarning("QWinJumpListCategory::%s(): only tasks/custom categories support models.", function);
+        return false;
+    }
+    return true;
 }
 
 void QWinJumpListCategoryPrivate::addRecent(QWinJumpListItem *item)
@@ -136,7 +314,9 @@ void QWinJumpListCategoryPrivate::addRecent(QWinJumpListItem *item)
 
     SHARDAPPIDINFOLINK info;
     info.pszAppID = id;
-    info.psl =  QWinJumpListPrivate::toIShellLink(item);
+    QWinJumpListSerializer serializer(&QWinJumpListPrivate::recentIconPath);
+    const QWinJumpListSnapshot::Item snapshot = QWinJumpListPrivate::snapshotOf(item);
+    info.psl = QWinJumpListPrivate::toIShellLink(serializer.link(snapshot));
     if (info.psl) {
         SHAddToRecentDocs(SHARD_APPIDINFOLINK, &info);
         info.psl->Release();
@@ -158,8 +338,13 @@ void QWinJumpListCategoryPrivate::clearRecents()
         hresult = pDest->RemoveAllDestinations();
         pDest->Release();
     }
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("clearRecents", hresult);
+    if (FAILED(hresult)) {
+        QWinJumpListPrivate::warning("clearRecents()", hresult);
+        documents->invalidate();
+    } else {
+        documents->setCleared();
+    }
+    recentsGeneration = documents->generation();
 }
 
 /*!
@@ -169,6 +354,8 @@ QWinJumpListCategory::QWinJumpListCategory(const QString &title) :
     d_ptr(new QWinJumpListCategoryPrivate)
 {
     d_ptr->title = title;
+    d_ptr->modelSink.reset(new QWinJumpListCategoryModelSink(this));
+    d_ptr->modelMapper.reset(new QWinJumpListModelMapper(d_ptr->modelSink.data()));
 }
 
 /*!
@@ -177,6 +364,9 @@ QWinJumpListCategory::QWinJumpListCategory(const QString &title) :
 QWinJumpListCategory::~QWinJumpListCategory()
 {
     Q_D(QWinJumpListCategory);
+    d->modelMapper.reset();
+    qDeleteAll(d->recents);
+    d->recents.clear();
     qDeleteAll(d->items);
     d->items.clear();
 }
@@ -232,13 +422,47 @@ void QWinJumpListCategory::setTitle(const QString &title)
     }
 }
 
+/*!
+    \since 5.11.4
+
+    Returns the maximum number of items a recent or frequent category reads
+    from the system, or 0 if it reads all of them. The default is 0.
+ */
+int QWinJumpListCategory::itemLimit() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->documents ? d->documents->limit() : 0;
+}
+
+/*!
+    \since 5.11.4
+
+    Sets the maximum number of items a recent or frequent category reads
+    from the system to \a limit; 0 reads all of them.
+
+    The items of these categories are read when they are first asked for,
+    and kept until the limit or the identifier of the jump list changes.
+    Items read before are deleted when they are read again. The limit
+    does not apply to items added with addItem(). Other categories ignore
+    it.
+
+    \sa QWinJumpList::identifier()
+ */
+void QWinJumpListCategory::setItemLimit(int limit)
+{
+    Q_D(QWinJumpListCategory);
+    if (d->documents)
+        d->documents->setLimit(limit);
+}
+
 /*!
     Returns the amount of items in the category.
  */
 int QWinJumpListCategory::count() const
 {
     Q_D(const QWinJumpListCategory);
-    return d->items.count();
+    const_cast<QWinJumpListCategoryPrivate *>(d)->loadRecents();
+    return d->recents.count() + d->items.count();
 }
 
 /*!
@@ -247,7 +471,8 @@ int QWinJumpListCategory::count() const
 bool QWinJumpListCategory::isEmpty() const
 {
     Q_D(const QWinJumpListCategory);
-    return d->items.isEmpty();
+    const_cast<QWinJumpListCategoryPrivate *>(d)->loadRecents();
+    return d->recents.isEmpty() && d->items.isEmpty();
 }
 
 /*!
@@ -256,7 +481,8 @@ bool QWinJumpListCategory::isEmpty() const
 QList<QWinJumpListItem *> QWinJumpListCategory::items() const
 {
     Q_D(const QWinJumpListCategory);
-    return d->items;
+    const_cast<QWinJumpListCategoryPrivate *>(d)->loadRecents();
+    return d->recents.isEmpty() ? d->items : d->recents + d->items;
 }
 
 /*!
@@ -265,20 +491,9 @@ QList<QWinJumpListItem *> QWinJumpListCategory::items() const
 void QWinJumpListCategory::addItem(QWinJumpListItem *item)
 {
     Q_D(QWinJumpListCategory);
-    if (!item)
+    if (!item || !d->accepts(item, "addItem"))
         return;
 
-    if (d->type == Recent || d->type == Frequent) {
-        if (item->type() == QWinJumpListItem::Separator) {
-            qWarning("QWinJumpListCategory::addItem(): only tasks/custom categories support separators.");
-            return;
-        }
-        if (item->type() == QWinJumpListItem::Destination) {
-            qWarning("QWinJumpListCategory::addItem(): only tasks/custom categories support destinations.");
-            return;
-        }
-    }
-
     QWinJumpListItemPrivate *p = QWinJumpListItemPrivate::get(item);
     if (p->category != this) {
         p->category = this;
@@ -289,6 +504,72 @@ void QWinJumpListCategory::addItem(QWinJumpListItem *item)
     }
 }
 
+/*!
+    \since 5.11.4
+
+    Adds \a items to the category, which takes ownership of them.
+
+    For recent and frequent categories, this is much faster than adding the
+    items one by one. The items are registered with the system in one batch
+    on a worker thread, and the jump list is invalidated once. An item that
+    refers to the same file with the same arguments as an earlier item, or
+    as an item added before, is deleted instead. QWinJumpList::flush()
+    waits for the registration to finish.
+
+    Items the category does not support, such as destinations and
+    separators in recent and frequent categories, are deleted as well,
+    unless they belong to another category.
+
+    \sa addItem()
+ */
+void QWinJumpListCategory::addItems(const QList<QWinJumpListItem *> &items)
+{
+    Q_D(QWinJumpListCategory);
+    const bool isRecent = d->type == Recent || d->type == Frequent;
+    QSet<QString> keys;
+    if (isRecent) {
+        keys.reserve(d->items.size() + items.size());
+        for (const QWinJumpListItem *item : qAsConst(d->items))
+            keys.insert(QWinRecentDocumentSubmitter::documentKey(item->filePath(), item->arguments()));
+    }
+
+    QVector<QWinJumpListSnapshot::Item> snapshots;
+    // Duplicates and unsupported items that belong to no category.
+    QSet<QWinJumpListItem *> rejected;
+    bool added = false;
+    for (QWinJumpListItem *item : items) {
+        if (!item)
+            continue;
+        QWinJumpListItemPrivate *p = QWinJumpListItemPrivate::get(item);
+        if (p->category == this)
+            continue;
+        if (!d->accepts(item, "addItems")) {
+            if (!p->category)
+                rejected.insert(item);
+            continue;
+        }
+        if (isRecent) {
+            const QString key = QWinRecentDocumentSubmitter::documentKey(p->filePath, p->arguments);
+            if (keys.contains(key)) {
+                if (!p->category)
+                    rejected.insert(item);
+                continue;
+            }
+            keys.insert(key);
+            snapshots.append(QWinJumpListPrivate::snapshotOf(item));
+        }
+        p->category = this;
+        d->items.append(item);
+        added = true;
+    }
+    qDeleteAll(rejected);
+
+    if (!snapshots.isEmpty() && d->jumpList)
+        QWinJumpListPrivate::get(d->jumpList)->recentDocumentSubmitter()->submit(d->jumpList->identifier(), snapshots);
+    if (added)
+        d->invalidate();
+}
+
 /*!
     Adds a destination to the category pointing to \a filePath.
  */
@@ -344,15 +625,166 @@ QWinJumpListItem *QWinJumpListCategory::addSeparator()
 void QWinJumpListCategory::clear()
 {
     Q_D(QWinJumpListCategory);
-    if (!d->items.isEmpty()) {
-        qDeleteAll(d->items);
-        d->items.clear();
-        if (d->type == QWinJumpListCategory::Recent || d->type == QWinJumpListCategory::Frequent)
+    // The shell is told to clear a recent or frequent category without
+    // reading it first. The links of the rows of a model stay with it.
+    const bool unread = d->documents && !d->documents->isLoaded();
+    const int modelRows = d->modelMapper->rowCount();
+    if (unread || !d->recents.isEmpty() || d->items.size() > modelRows) {
+        qDeleteAll(d->recents);
+        d->recents.clear();
+        qDeleteAll(d->items.cbegin() + modelRows, d->items.cend());
+        d->items.erase(d->items.begin() + modelRows, d->items.end());
+        if (d->documents)
             d->clearRecents();
         d->invalidate();
     }
 }
 
+/*!
+    \since 5.11.4
+
+    Returns the model the category lists the rows of, or \nullptr if
+    there is none.
+
+    \sa setModel()
+ */
+QAbstractItemModel *QWinJumpListCategory::model() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->modelMapper->model();
+}
+
+/*!
+    \since 5.11.4
+
+    Sets the \a model whose rows the category lists as links, before the
+    items added with addItem().
+
+    Each top-level row of the first column becomes a link, which takes its
+    file path, title, arguments, and icon from the data of the roles set
+    with setFilePathRole(), setTitleRole(), setArgumentsRole(), and
+    setIconRole(). A link without a file path starts the application. The
+    category follows the rows that are inserted, removed, and changed, and
+    only updates the affected links; changes made in one pass of the event
+    loop are committed in one update of the jump list.
+
+    The category does not take ownership of the model. Passing \nullptr
+    detaches the model and removes its links; clear() leaves them alone.
+    Only tasks and custom categories support models.
+ */
+void QWinJumpListCategory::setModel(QAbstractItemModel *model)
+{
+    Q_D(QWinJumpListCategory);
+    if (!model || d->acceptsModel("setModel"))
+        d->modelMapper->setModel(model);
+}
+
+/*!
+    \since 5.11.4
+
+    Returns the role the file paths of the links of the model are read
+    from. The default is Qt::UserRole.
+
+    \sa setModel()
+ */
+int QWinJumpListCategory::filePathRole() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->modelMapper->role(QWinJumpListModelMapper::FilePath);
+}
+
+/*!
+    \since 5.11.4
+
+    Sets the \a role the file paths of the links of the model are read
+    from; -1 reads none.
+ */
+void QWinJumpListCategory::setFilePathRole(int role)
+{
+    Q_D(QWinJumpListCategory);
+    d->modelMapper->setRole(QWinJumpListModelMapper::FilePath, role);
+}
+
+/*!
+    \since 5.11.4
+
+    Returns the role the titles of the links of the model are read from.
+    The default is Qt::DisplayRole.
+
+    \sa setModel()
+ */
+int QWinJumpListCategory::titleRole() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->modelMapper->role(QWinJumpListModelMapper::Title);
+}
+
+/*!
+    \since 5.11.4
+
+    Sets the \a role the titles of the links of the model are read from;
+    -1 reads none.
+ */
+void QWinJumpListCategory::setTitleRole(int role)
+{
+    Q_D(QWinJumpListCategory);
+    d->modelMapper->setRole(QWinJumpListModelMapper::Title, role);
+}
+
+/*!
+    \since 5.11.4
+
+    Returns the role the arguments of the links of the model are read
+    from. The default is Qt::UserRole + 1.
+
+    \sa setModel()
+ */
+int QWinJumpListCategory::argumentsRole() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->modelMapper->role(QWinJumpListModelMapper::Arguments);
+}
+
+/*!
+    \since 5.11.4
+
+    Sets the \a role the arguments of the links of the model are read
+    from; -1 reads none. The data is a QStringList, or a QString holding
+    one argument.
+ */
+void QWinJumpListCategory::setArgumentsRole(int role)
+{
+    Q_D(QWinJumpListCategory);
+    d->modelMapper->setRole(QWinJumpListModelMapper::Arguments, role);
+}
+
+/*!
+    \since 5.11.4
+
+    Returns the role the icons of the links of the model are read from.
+    The default is Qt::DecorationRole.
+
+    \sa setModel()
+ */
+int QWinJumpListCategory::iconRole() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->modelMapper->role(QWinJumpListModelMapper::Icon);
+}
+
+/*!
+    \since 5.11.4
+
+    Sets the \a role the icons of the links of the model are read from;
+    -1 reads none. The data is a QIcon, a QPixmap, a QImage, or the path
+    of an icon file.
+ */
+void QWinJumpListCategory::setIconRole(int role)
+{
+    Q_D(QWinJumpListCategory);
+    d->modelMapper->setRole(QWinJumpListModelMapper::Icon, role);
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 
 QDebug operator<<(QDebug debug, const QWinJumpListCategory *category)
@@ -49,6 +49,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QAbstractItemModel;
 class QWinJumpListItem;
 class QWinJumpListCategoryPrivate;
 
@@ -72,11 +73,15 @@ public:
     QString title() const;
     void setTitle(const QString &title);
 
+    int itemLimit() const;
+    void setItemLimit(int limit);
+
     int count() const;
     bool isEmpty() const;
     QList<QWinJumpListItem *> items() const;
 
     void addItem(QWinJumpListItem *item);
+    void addItems(const QList<QWinJumpListItem *> &items);
     QWinJumpListItem *addDestination(const QString &filePath);
     QWinJumpListItem *addLink(const QString &title, const QString &executablePath, const QStringList &arguments = QStringList());
     QWinJumpListItem *addLink(const QIcon &icon, const QString &title, const QString &executablePath, const QStringList &arguments = QStringList());
@@ -84,6 +89,18 @@ public:
 
     void clear();
 
+    QAbstractItemModel *model() const;
+    void setModel(QAbstractItemModel *model);
+
+    int filePathRole() const;
+    void setFilePathRole(int role);
+    int titleRole() const;
+    void setTitleRole(int role);
+    int argumentsRole() const;
+    void setArgumentsRole(int role);
+    int iconRole() const;
+    void setIconRole(int role);
+
 private:
     Q_DISABLE_COPY(QWinJumpListCategory)
     Q_DECLARE_PRIVATE(QWinJumpListCategory)
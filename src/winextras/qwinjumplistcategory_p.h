@@ -53,6 +53,10 @@
 //
 
 #include "qwinjumplistcategory.h"
+#include "qwindocumentlist_p.h"
+#include "qwinjumplistmodelmapper_p.h"
+
+#include <QtCore/qscopedpointer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,7 +72,11 @@ public:
 
     static QWinJumpListCategory *create(QWinJumpListCategory::Type type, QWinJumpList *jumpList);
 
+    static QWinDocumentList::Provider *documentListProvider();
+
     void invalidate();
+    bool accepts(const QWinJumpListItem *item, const char *function) const;
+    bool acceptsModel(const char *function) const;
     void loadRecents();
     void addRecent(QWinJumpListItem *item);
     void clearRecents();
@@ -78,6 +86,15 @@ public:
     QWinJumpList *jumpList = nullptr;
     QWinJumpListCategory::Type type = QWinJumpListCategory::Custom;
     QList<QWinJumpListItem *> items;
+    // Recent and frequent categories only: the items read from the shell
+    // on first use, which come before those added with addItem().
+    QScopedPointer<QWinDocumentList> documents;
+    QList<QWinJumpListItem *> recents;
+    quint64 recentsGeneration = 0;
+    // Tasks and custom categories only: the items of the rows of a model,
+    // which come before those added with addItem().
+    QScopedPointer<QWinJumpListModelMapper::Sink> modelSink;
+    QScopedPointer<QWinJumpListModelMapper> modelMapper;
 };
 
 QT_END_NAMESPACE
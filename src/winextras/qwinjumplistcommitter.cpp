@@ -0,0 +1,167 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistcommitter_p.h"
+
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qthread.h>
+
+QT_BEGIN_NAMESPACE
+
+QWinJumpListCommitter::QWinJumpListCommitter(Backend *backend, QObject *parent)
+    : QObject(parent)
+    , m_backend(backend)
+{
+    m_thread = QThread::create([this]() { run(); });
+    m_thread->setObjectName(QStringLiteral("QWinJumpListCommitter"));
+    m_thread->start();
+}
+
+QWinJumpListCommitter::~QWinJumpListCommitter()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_stopped.storeRelease(1);
+        if (m_pending) {
+            finish(m_pending.data(), Aborted);
+            ++m_statistics.superseded;
+            m_pending.reset();
+        }
+        m_wakeUp.wakeOne();
+    }
+    m_thread->wait();
+    delete m_thread;
+}
+
+QFuture<bool> QWinJumpListCommitter::submit(const QWinJumpListSnapshot &snapshot)
+{
+    QScopedPointer<Job> job(new Job{ snapshot, QFutureInterface<bool>(), 0 });
+    job->future.reportStarted();
+    const QFuture<bool> future = job->future.future();
+
+    QMutexLocker locker(&m_mutex);
+    ++m_statistics.submitted;
+    job->generation = m_generation.fetchAndAddOrdered(1) + 1;
+    if (m_pending) {
+        finish(m_pending.data(), Aborted);
+        ++m_statistics.superseded;
+    }
+    m_pending.swap(job);
+    m_wakeUp.wakeOne();
+    return future;
+}
+
+bool QWinJumpListCommitter::isIdle() const
+{
+    QMutexLocker locker(&m_mutex);
+    return !m_pending && !m_running;
+}
+
+bool QWinJumpListCommitter::waitForIdle(int msecs)
+{
+    const QDeadlineTimer deadline(msecs);
+    QMutexLocker locker(&m_mutex);
+    while (m_pending || m_running) {
+        if (!m_idle.wait(&m_mutex, deadline))
+            return false;
+    }
+    return true;
+}
+
+QWinJumpListCommitter::Statistics QWinJumpListCommitter::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_statistics;
+}
+
+void QWinJumpListCommitter::finish(Job *job, Result result)
+{
+    job->future.reportResult(result == Committed);
+    if (result == Aborted)
+        job->future.reportCanceled();
+    job->future.reportFinished();
+}
+
+void QWinJumpListCommitter::run()
+{
+    m_backend->threadStarted();
+    QMutexLocker locker(&m_mutex);
+    for (;;) {
+        while (!m_pending && !m_stopped.loadAcquire())
+            m_wakeUp.wait(&m_mutex);
+        if (m_stopped.loadAcquire())
+            break;
+        QScopedPointer<Job> job(m_pending.take());
+        m_running = true;
+        locker.unlock();
+
+        const int generation = job->generation;
+        const Result result = m_backend->commit(job->snapshot, [this, generation]() {
+            return m_stopped.loadAcquire() || m_generation.loadAcquire() != generation;
+        });
+        finish(job.data(), result);
+        if (result != Aborted) {
+            const bool success = result == Committed;
+            QMetaObject::invokeMethod(this, [this, success]() { emit committed(success); },
+                                      Qt::QueuedConnection);
+        }
+
+        locker.relock();
+        switch (result) {
+        case Committed:
+            ++m_statistics.committed;
+            break;
+        case Failed:
+            ++m_statistics.failed;
+            break;
+        case Aborted:
+            ++m_statistics.superseded;
+            break;
+        }
+        m_running = false;
+        if (!m_pending)
+            m_idle.wakeAll();
+    }
+    m_running = false;
+    m_idle.wakeAll();
+    locker.unlock();
+    m_backend->threadFinished();
+}
+
+QT_END_NAMESPACE
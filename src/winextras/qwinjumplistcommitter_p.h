@@ -0,0 +1,145 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTCOMMITTER_P_H
+#define QWINJUMPLISTCOMMITTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinjumplistsnapshot_p.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qfutureinterface.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qwaitcondition.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class QThread;
+
+// Commits jump list snapshots on a worker thread of its own. Only the most
+// recently submitted snapshot matters: a snapshot still waiting when a newer
+// one is submitted is dropped, and a commit in progress is asked to abort.
+// The futures of dropped and aborted commits are canceled with a false
+// result. committed() is emitted in the committer's thread for every commit
+// that ran to completion.
+class QWinJumpListCommitter : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Result { Committed, Failed, Aborted };
+
+    class Backend
+    {
+    public:
+        virtual ~Backend() {}
+        // Called on the worker thread, for example to enter an apartment.
+        virtual void threadStarted() {}
+        virtual void threadFinished() {}
+        // isSuperseded() turns true once the commit is no longer wanted;
+        // the backend should then stop and return Aborted.
+        virtual Result commit(const QWinJumpListSnapshot &snapshot,
+                              const std::function<bool()> &isSuperseded) = 0;
+    };
+
+    struct Statistics
+    {
+        quint64 submitted = 0;
+        quint64 committed = 0;
+        quint64 failed = 0;
+        quint64 superseded = 0; // dropped or aborted
+    };
+
+    // Takes ownership of backend.
+    explicit QWinJumpListCommitter(Backend *backend, QObject *parent = nullptr);
+    ~QWinJumpListCommitter();
+
+    QFuture<bool> submit(const QWinJumpListSnapshot &snapshot);
+
+    bool isIdle() const;
+    // Returns false if the worker is still busy after msecs milliseconds.
+    bool waitForIdle(int msecs = -1);
+
+    Statistics statistics() const;
+
+Q_SIGNALS:
+    void committed(bool success);
+
+private:
+    Q_DISABLE_COPY(QWinJumpListCommitter)
+
+    struct Job
+    {
+        QWinJumpListSnapshot snapshot;
+        QFutureInterface<bool> future;
+        int generation;
+    };
+
+    void run();
+    static void finish(Job *job, Result result);
+
+    QScopedPointer<Backend> m_backend;
+    QThread *m_thread = nullptr;
+    mutable QMutex m_mutex;
+    QWaitCondition m_wakeUp;
+    QWaitCondition m_idle;
+    QScopedPointer<Job> m_pending;
+    bool m_running = false;
+    QAtomicInt m_generation;
+    QAtomicInt m_stopped;
+    Statistics m_statistics;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTCOMMITTER_P_H
@@ -179,6 +179,7 @@ QString QWinJumpListItem::workingDirectory() const
 void QWinJumpListItem::setIcon(const QIcon &icon)
 {
     Q_D(QWinJumpListItem);
+    d->iconLocation.clear();
     if (d->icon.cacheKey() != icon.cacheKey()) {
         d->icon = icon;
         d->invalidate();
@@ -191,6 +192,10 @@ void QWinJumpListItem::setIcon(const QIcon &icon)
 QIcon QWinJumpListItem::icon() const
 {
     Q_D(const QWinJumpListItem);
+    if (!d->iconLocation.isEmpty()) {
+        d->icon = QIcon(d->iconLocation);
+        d->iconLocation.clear();
+    }
     return d->icon;
 }
 
@@ -72,7 +72,9 @@ public:
     QString workingDirectory;
     QString title;
     QString description;
-    QIcon icon;
+    mutable QIcon icon;
+    // The icon of an item read from the shell, loaded when asked for.
+    mutable QString iconLocation;
     QStringList arguments;
     QWinJumpListItem::Type type = QWinJumpListItem::Destination;
     QWinJumpListCategory *category = nullptr;
@@ -0,0 +1,195 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistmodelmapper_p.h"
+
+#include <QtCore/qabstractitemmodel.h>
+#include <QtGui/qicon.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qpixmap.h>
+
+QT_BEGIN_NAMESPACE
+
+QWinJumpListModelMapper::QWinJumpListModelMapper(Sink *sink, QObject *parent)
+    : QObject(parent), m_sink(sink)
+{
+    m_roles[FilePath] = Qt::UserRole;
+    m_roles[Title] = Qt::DisplayRole;
+    m_roles[Arguments] = Qt::UserRole + 1;
+    m_roles[Icon] = Qt::DecorationRole;
+}
+
+// Moves and layout changes are rare for the short lists of a jump list, so
+// they are mirrored as a removal and an insertion.
+void QWinJumpListModelMapper::setModel(QAbstractItemModel *model)
+{
+    if (m_model == model)
+        return;
+    if (m_model)
+        disconnect(m_model, nullptr, this, nullptr);
+    removeRows(0, m_rows.size() - 1);
+    m_model = model;
+    if (!m_model)
+        return;
+
+    connect(m_model, &QAbstractItemModel::rowsInserted, this,
+            [this](const QModelIndex &parent, int first, int last) {
+        if (!parent.isValid())
+            insertRows(first, last);
+    });
+    connect(m_model, &QAbstractItemModel::rowsRemoved, this,
+            [this](const QModelIndex &parent, int first, int last) {
+        if (!parent.isValid())
+            removeRows(first, last);
+    });
+    connect(m_model, &QAbstractItemModel::rowsMoved, this,
+            [this](const QModelIndex &source, int first, int last, const QModelIndex &destination, int row) {
+        if (source.isValid() && destination.isValid())
+            return;
+        if (!source.isValid())
+            removeRows(first, last);
+        if (!destination.isValid()) {
+            const int count = last - first + 1;
+            const int to = source.isValid() || row <= first ? row : row - count;
+            insertRows(to, to + count - 1);
+        }
+    });
+    connect(m_model, &QAbstractItemModel::dataChanged, this,
+            [this](const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles) {
+        if (!topLeft.parent().isValid() && topLeft.column() == 0)
+            updateRows(topLeft.row(), bottomRight.row(), roles);
+    });
+    connect(m_model, &QAbstractItemModel::modelReset, this, &QWinJumpListModelMapper::reset);
+    connect(m_model, &QAbstractItemModel::layoutChanged, this, &QWinJumpListModelMapper::reset);
+    connect(m_model, &QObject::destroyed, this, [this]() { removeRows(0, m_rows.size() - 1); });
+    insertRows(0, m_model->rowCount() - 1);
+}
+
+void QWinJumpListModelMapper::setRole(Field field, int role)
+{
+    if (m_roles[field] == role)
+        return;
+    m_roles[field] = role;
+    for (int row = 0; row < m_rows.size(); ++row)
+        updateField(row, field);
+}
+
+QVariant QWinJumpListModelMapper::toField(Field field, const QVariant &data)
+{
+    switch (field) {
+    case Arguments:
+        return data.toStringList();
+    case Icon:
+        switch (data.userType()) {
+        case QMetaType::QIcon:
+            return data;
+        case QMetaType::QPixmap:
+            return QIcon(qvariant_cast<QPixmap>(data));
+        case QMetaType::QImage:
+            return QIcon(QPixmap::fromImage(qvariant_cast<QImage>(data)));
+        default: {
+            const QString path = data.toString();
+            return path.isEmpty() ? QIcon() : QIcon(path);
+        }
+        }
+    default:
+        return data.toString();
+    }
+}
+
+void QWinJumpListModelMapper::insertRows(int first, int last)
+{
+    if (last < first)
+        return;
+    m_rows.insert(first, last - first + 1, Row(FieldCount));
+    m_sink->insertItems(first, last - first + 1);
+    for (int row = first; row <= last; ++row) {
+        for (int field = 0; field < FieldCount; ++field)
+            updateField(row, Field(field));
+    }
+}
+
+void QWinJumpListModelMapper::removeRows(int first, int last)
+{
+    if (last < first)
+        return;
+    m_rows.remove(first, last - first + 1);
+    m_sink->removeItems(first, last - first + 1);
+}
+
+// An empty list of roles stands for all of them.
+void QWinJumpListModelMapper::updateRows(int first, int last, const QVector<int> &roles)
+{
+    for (int field = 0; field < FieldCount; ++field) {
+        if (m_roles[field] < 0 || (!roles.isEmpty() && !roles.contains(m_roles[field])))
+            continue;
+        for (int row = first; row <= last && row < m_rows.size(); ++row)
+            updateField(row, Field(field));
+    }
+}
+
+// QVariant has no comparison for icons.
+static bool sameData(const QVariant &a, const QVariant &b)
+{
+    if (a.userType() == QMetaType::QIcon && b.userType() == QMetaType::QIcon)
+        return qvariant_cast<QIcon>(a).cacheKey() == qvariant_cast<QIcon>(b).cacheKey();
+    return a == b;
+}
+
+// Rows are compared by their model data, since converting a path to an icon
+// makes a new icon every time.
+void QWinJumpListModelMapper::updateField(int row, Field field)
+{
+    const QVariant data = m_roles[field] < 0 ? QVariant()
+                                             : m_model->index(row, 0).data(m_roles[field]);
+    QVariant &current = m_rows[row][field];
+    if (current.isValid() == data.isValid() && sameData(current, data))
+        return;
+    current = data;
+    m_sink->setField(row, field, toField(field, data));
+}
+
+void QWinJumpListModelMapper::reset()
+{
+    removeRows(0, m_rows.size() - 1);
+    if (m_model)
+        insertRows(0, m_model->rowCount() - 1);
+}
+
+QT_END_NAMESPACE
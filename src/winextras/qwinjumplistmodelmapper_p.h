@@ -0,0 +1,122 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTMODELMAPPER_P_H
+#define QWINJUMPLISTMODELMAPPER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qobject.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QAbstractItemModel;
+class QModelIndex;
+
+// Mirrors the rows of a list model as jump list items, one item per row of
+// the top level of the model. Insertions, removals and data changes reach
+// the sink as changes of the affected items only, and a field is only set
+// when its value changed.
+class QWinJumpListModelMapper : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Field { FilePath, Title, Arguments, Icon, FieldCount };
+
+    class Sink
+    {
+    public:
+        virtual ~Sink() {}
+        // The fields of new items are set right after they were inserted.
+        virtual void insertItems(int first, int count) = 0;
+        virtual void removeItems(int first, int count) = 0;
+        // value is a QString, a QStringList for Arguments, or a QIcon for
+        // Icon; see toField().
+        virtual void setField(int row, Field field, const QVariant &value) = 0;
+    };
+
+    // The sink is not owned and must outlive the mapper.
+    explicit QWinJumpListModelMapper(Sink *sink, QObject *parent = nullptr);
+
+    QAbstractItemModel *model() const { return m_model; }
+    void setModel(QAbstractItemModel *model);
+
+    // The role a field is read from, -1 for none. Defaults to Qt::UserRole
+    // for the file path, Qt::DisplayRole for the title, Qt::UserRole + 1
+    // for the arguments and Qt::DecorationRole for the icon.
+    int role(Field field) const { return m_roles[field]; }
+    void setRole(Field field, int role);
+
+    int rowCount() const { return m_rows.size(); }
+
+    // Converts model data: a string becomes a list of one argument or an
+    // icon loaded from that path; pixmaps and images become icons.
+    static QVariant toField(Field field, const QVariant &data);
+
+private:
+    typedef QVector<QVariant> Row; // the model data, by field
+
+    void insertRows(int first, int last);
+    void removeRows(int first, int last);
+    void updateRows(int first, int last, const QVector<int> &roles);
+    void updateField(int row, Field field);
+    void reset();
+
+    Sink *m_sink;
+    QPointer<QAbstractItemModel> m_model;
+    QVector<Row> m_rows;
+    int m_roles[FieldCount];
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTMODELMAPPER_P_H
@@ -0,0 +1,144 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistpruner_p.h"
+#include "qwinrecentdocumentsubmitter_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+QString QWinJumpListPruner::key(const QString &filePath, const QStringList &arguments)
+{
+    return QWinRecentDocumentSubmitter::documentKey(filePath, arguments);
+}
+
+// Tasks cannot be removed by the user and have their own place in the jump
+// list, so only custom categories are pruned.
+QWinJumpListSnapshot QWinJumpListPruner::prune(const QWinJumpListSnapshot &snapshot, int maxSlots,
+                                               const QStringList &removed)
+{
+    QSet<QString> removedKeys;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_maximumSlots = maxSlots;
+        for (const QString &key : removed) {
+            if (!m_removed.contains(key)) {
+                m_removed.insert(key);
+                m_newlyRemoved.append(key);
+            }
+        }
+        removedKeys = m_removed;
+    }
+
+    QVector<QWinJumpListSnapshot::Category> categories = snapshot.categories();
+    int prunedCount = 0;
+    if (!removedKeys.isEmpty()) {
+        for (QWinJumpListSnapshot::Category &category : categories) {
+            if (category.type != QWinJumpListSnapshot::Custom || !category.isEffective())
+                continue;
+            QVector<QWinJumpListSnapshot::Item> &items = category.items;
+            const auto isRemoved = [&removedKeys](const QWinJumpListSnapshot::Item &item) {
+                return removedKeys.contains(key(item.filePath, item.arguments));
+            };
+            const auto end = std::remove_if(items.begin(), items.end(), isRemoved);
+            prunedCount += int(items.end() - end);
+            items.erase(end, items.end());
+        }
+    }
+
+    if (maxSlots > 0) {
+        QVector<int> kept(categories.size(), 0);
+        int slots = maxSlots;
+        bool ranked = true;
+        for (int position = 0; slots > 0 && ranked; ++position) {
+            ranked = false;
+            for (int i = 0; i < categories.size() && slots > 0; ++i) {
+                const QWinJumpListSnapshot::Category &category = categories.at(i);
+                if (category.type == QWinJumpListSnapshot::Custom && category.isEffective()
+                    && position < category.items.size()) {
+                    ++kept[i];
+                    --slots;
+                    ranked = true;
+                }
+            }
+        }
+        for (int i = 0; i < categories.size(); ++i) {
+            QWinJumpListSnapshot::Category &category = categories[i];
+            if (category.type == QWinJumpListSnapshot::Custom && category.isEffective()
+                && kept.at(i) < category.items.size()) {
+                prunedCount += category.items.size() - kept.at(i);
+                category.items.resize(kept.at(i));
+            }
+        }
+    }
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_prunedCount = prunedCount;
+    }
+    if (!prunedCount)
+        return snapshot;
+    QWinJumpListSnapshot result(snapshot.identifier());
+    for (const QWinJumpListSnapshot::Category &category : qAsConst(categories))
+        result.appendCategory(category);
+    return result;
+}
+
+int QWinJumpListPruner::maximumSlots() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_maximumSlots;
+}
+
+QStringList QWinJumpListPruner::takeRemoved()
+{
+    QMutexLocker locker(&m_mutex);
+    QStringList removed;
+    removed.swap(m_newlyRemoved);
+    return removed;
+}
+
+int QWinJumpListPruner::prunedCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_prunedCount;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTPRUNER_P_H
+#define QWINJUMPLISTPRUNER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinjumplistsnapshot_p.h"
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qset.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+// Fits a snapshot into what the shell shows before anything is created for
+// it. BeginList() reports the number of slots for the destinations of the
+// custom categories and the destinations the user removed from the jump
+// list, which must not be committed again: CommitList() may fail on them.
+// Removals are remembered for the lifetime of the pruner. Thread-safe, since
+// commits prune on the committer thread while the GUI thread takes the
+// removals.
+class QWinJumpListPruner
+{
+public:
+    // Identifies a destination, as the shell reports it, by path and
+    // arguments; see QWinRecentDocumentSubmitter::documentKey().
+    static QString key(const QString &filePath, const QStringList &arguments);
+
+    // Returns snapshot without the removed destinations, and with no more
+    // than maxSlots of them in its committed custom categories. Slots go to
+    // the first item of every category, then to the second of every one and
+    // so on, so that a long category does not crowd out the next ones.
+    // maxSlots <= 0 leaves the number of items alone.
+    QWinJumpListSnapshot prune(const QWinJumpListSnapshot &snapshot, int maxSlots, const QStringList &removed);
+
+    // The slots reported to the last prune(), 0 before.
+    int maximumSlots() const;
+    // The keys of the destinations reported as removed for the first time
+    // since the last call.
+    QStringList takeRemoved();
+    // The number of items the last prune() dropped.
+    int prunedCount() const;
+
+private:
+    mutable QMutex m_mutex;
+    QSet<QString> m_removed;
+    QStringList m_newlyRemoved;
+    int m_maximumSlots = 0;
+    int m_prunedCount = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTPRUNER_P_H
@@ -0,0 +1,108 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistserializer_p.h"
+#include "qwincommandline_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QWinJumpListSerializer::QWinJumpListSerializer(const IconResolver &iconResolver) :
+    m_iconResolver(iconResolver)
+{
+    // Jump lists show few distinct icons.
+    m_icons.reserve(16);
+}
+
+void QWinJumpListSerializer::begin()
+{
+    m_arena.reset();
+    m_icons.clear();
+}
+
+QWinJumpListSerializer::Link QWinJumpListSerializer::link(const QWinJumpListSnapshot::Item &item)
+{
+    Link result;
+    result.path = m_arena.string(item.filePath);
+    result.title = m_arena.string(item.title);
+    if (!item.workingDirectory.isEmpty())
+        result.workingDirectory = m_arena.string(item.workingDirectory);
+    if (!item.description.isEmpty())
+        result.description = m_arena.string(item.description);
+
+    const int size = QWinCommandLine::joinedSize(item.arguments);
+    QChar *arguments = m_arena.allocate(size);
+    QWinCommandLine::join(item.arguments, arguments);
+    result.arguments = arguments;
+
+    result.iconLocation = iconLocation(item);
+    return result;
+}
+
+// Items showing the same icon share the file and, within a commit, the
+// lookup, which hashes all pixels.
+const QChar *QWinJumpListSerializer::iconLocation(const QWinJumpListSnapshot::Item &item)
+{
+    if (item.iconFrames.isEmpty() || !m_iconResolver)
+        return nullptr;
+    if (item.iconKey) {
+        for (const ResolvedIcon &icon : qAsConst(m_icons)) {
+            if (icon.key == item.iconKey)
+                return icon.location;
+        }
+    }
+
+    ++m_iconResolutions;
+    const QString path = m_iconResolver(item.iconFrames);
+    const QChar *location = path.isEmpty() ? nullptr : m_arena.nativePath(path);
+    if (item.iconKey)
+        m_icons.append({ item.iconKey, location, path });
+    return location;
+}
+
+QHash<qint64, QString> QWinJumpListSerializer::iconPaths() const
+{
+    QHash<qint64, QString> paths;
+    for (const ResolvedIcon &icon : m_icons) {
+        if (icon.location)
+            paths.insert(icon.key, icon.path);
+    }
+    return paths;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTSERIALIZER_P_H
+#define QWINJUMPLISTSERIALIZER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinjumplistsnapshot_p.h"
+#include "qwinwidestringarena_p.h"
+
+#include <QtCore/qhash.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+// Prepares the zero-terminated strings the shell links of a commit are made
+// of. All of them come from one arena that is reused by every commit, and
+// the icon of each distinct icon key is resolved once per commit, so that
+// once the arena fits a commit, serializing its items does not allocate.
+// Not thread-safe; every committing thread has its own.
+class QWinJumpListSerializer
+{
+public:
+    // Returns the path of the icon file for frames, or an empty string.
+    typedef std::function<QString(const QVector<QImage> &frames)> IconResolver;
+
+    struct Link
+    {
+        const QChar *path = nullptr;
+        const QChar *arguments = nullptr;
+        const QChar *title = nullptr;
+        // Null when not set.
+        const QChar *workingDirectory = nullptr;
+        const QChar *description = nullptr;
+        const QChar *iconLocation = nullptr; // with native separators
+    };
+
+    explicit QWinJumpListSerializer(const IconResolver &iconResolver = IconResolver());
+
+    // Starts a commit, invalidating the strings of the previous one.
+    void begin();
+
+    // The strings are valid until the next begin() as long as item and
+    // the strings passed to string() are not modified or destroyed.
+    Link link(const QWinJumpListSnapshot::Item &item);
+    const QChar *string(const QString &string) { return m_arena.string(string); }
+
+    // The paths of the icon files resolved since begin(), by icon key.
+    QHash<qint64, QString> iconPaths() const;
+
+    const QWinWideStringArena &arena() const { return m_arena; }
+    quint64 iconResolutions() const { return m_iconResolutions; }
+
+private:
+    struct ResolvedIcon
+    {
+        qint64 key;
+        const QChar *location;
+        QString path;
+    };
+
+    const QChar *iconLocation(const QWinJumpListSnapshot::Item &item);
+
+    IconResolver m_iconResolver;
+    QWinWideStringArena m_arena;
+    QVector<ResolvedIcon> m_icons;
+    quint64 m_iconResolutions = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTSERIALIZER_P_H
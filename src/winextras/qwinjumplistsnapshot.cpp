@@ -0,0 +1,180 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistsnapshot_p.h"
+
+#include <QtCore/qhash.h>
+
+QT_BEGIN_NAMESPACE
+
+QWinJumpListSnapshot::QWinJumpListSnapshot(const QString &identifier)
+    : m_null(false), m_identifier(identifier)
+{
+}
+
+// The hash lets the diff reject changed categories without comparing their
+// items one by one; equal hashes are confirmed by a full comparison. Only
+// custom categories show their title.
+void QWinJumpListSnapshot::appendCategory(const Category &category)
+{
+    uint hash = qHash(int(category.type), 0);
+    if (category.type == Custom)
+        hash = qHash(category.title, hash);
+    for (const Item &item : category.items)
+        hash = qHash(item, hash);
+    m_categories.append(category);
+    m_hashes.append(hash);
+    m_itemCount += category.items.size();
+}
+
+bool operator==(const QWinJumpListSnapshot::Item &a, const QWinJumpListSnapshot::Item &b)
+{
+    return a.type == b.type && a.iconKey == b.iconKey && a.filePath == b.filePath
+        && a.title == b.title && a.arguments == b.arguments
+        && a.workingDirectory == b.workingDirectory && a.description == b.description;
+}
+
+uint qHash(const QWinJumpListSnapshot::Item &item, uint seed)
+{
+    seed = qHash(int(item.type), seed);
+    seed = qHash(item.iconKey, seed);
+    seed = qHash(item.filePath, seed);
+    seed = qHash(item.title, seed);
+    for (const QString &argument : item.arguments)
+        seed = qHash(argument, seed);
+    seed = qHash(item.workingDirectory, seed);
+    return qHash(item.description, seed);
+}
+
+namespace {
+
+// Categories are matched by type and title; custom categories with equal
+// titles are told apart by their order of appearance.
+struct CategoryKey
+{
+    int type;
+    QString title;
+    int occurrence;
+};
+
+bool operator==(const CategoryKey &a, const CategoryKey &b)
+{
+    return a.type == b.type && a.occurrence == b.occurrence && a.title == b.title;
+}
+
+uint qHash(const CategoryKey &key, uint seed)
+{
+    return qHash(key.title, qHash(key.type * 0x10000 + key.occurrence, seed));
+}
+
+QVector<CategoryKey> effectiveKeys(const QWinJumpListSnapshot &snapshot, QVector<int> *indexes)
+{
+    QVector<CategoryKey> keys;
+    QHash<QPair<int, QString>, int> occurrences;
+    const QVector<QWinJumpListSnapshot::Category> &categories = snapshot.categories();
+    for (int i = 0; i < categories.size(); ++i) {
+        const QWinJumpListSnapshot::Category &category = categories.at(i);
+        if (!category.isEffective())
+            continue;
+        const QString title = category.type == QWinJumpListSnapshot::Custom ? category.title : QString();
+        const CategoryKey key = { category.type, title, occurrences[qMakePair(int(category.type), title)]++ };
+        keys.append(key);
+        indexes->append(i);
+    }
+    return keys;
+}
+
+bool sameContent(const QWinJumpListSnapshot &from, int oldIndex, const QWinJumpListSnapshot &to, int newIndex)
+{
+    const QWinJumpListSnapshot::Category &a = from.categories().at(oldIndex);
+    const QWinJumpListSnapshot::Category &b = to.categories().at(newIndex);
+    if (a.type == QWinJumpListSnapshot::Recent || a.type == QWinJumpListSnapshot::Frequent)
+        return true;
+    if (from.categoryHash(oldIndex) != to.categoryHash(newIndex))
+        return false;
+    return (a.type != QWinJumpListSnapshot::Custom || a.title == b.title) && a.items == b.items;
+}
+
+} // namespace
+
+QWinJumpListDiff QWinJumpListDiff::compute(const QWinJumpListSnapshot &from, const QWinJumpListSnapshot &to)
+{
+    QWinJumpListDiff diff;
+    diff.initial = from.isNull();
+    diff.identifierChanged = !diff.initial && from.identifier() != to.identifier();
+
+    QVector<int> oldIndexes;
+    QVector<int> newIndexes;
+    const QVector<CategoryKey> oldKeys = effectiveKeys(from, &oldIndexes);
+    const QVector<CategoryKey> newKeys = effectiveKeys(to, &newIndexes);
+
+    QHash<CategoryKey, int> oldPositions;
+    oldPositions.reserve(oldKeys.size());
+    for (int i = 0; i < oldKeys.size(); ++i)
+        oldPositions.insert(oldKeys.at(i), i);
+
+    QVector<bool> matched(oldKeys.size(), false);
+    int lastOldPosition = -1;
+    for (int i = 0; i < newKeys.size(); ++i) {
+        const int newIndex = newIndexes.at(i);
+        const QWinJumpListSnapshot::Category &category = to.categories().at(newIndex);
+        const int oldPosition = oldPositions.value(newKeys.at(i), -1);
+        if (oldPosition < 0) {
+            diff.changes.append({ Added, category.type, category.title, -1, newIndex });
+            continue;
+        }
+        matched[oldPosition] = true;
+        const int oldIndex = oldIndexes.at(oldPosition);
+        if (!sameContent(from, oldIndex, to, newIndex))
+            diff.changes.append({ Modified, category.type, category.title, oldIndex, newIndex });
+        else if (oldPosition < lastOldPosition)
+            diff.changes.append({ Moved, category.type, category.title, oldIndex, newIndex });
+        lastOldPosition = qMax(lastOldPosition, oldPosition);
+    }
+    for (int i = 0; i < oldKeys.size(); ++i) {
+        if (!matched.at(i)) {
+            const int oldIndex = oldIndexes.at(i);
+            const QWinJumpListSnapshot::Category &category = from.categories().at(oldIndex);
+            diff.changes.append({ Removed, category.type, category.title, oldIndex, -1 });
+        }
+    }
+    return diff;
+}
+
+QT_END_NAMESPACE
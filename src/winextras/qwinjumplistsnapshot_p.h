@@ -0,0 +1,162 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTSNAPSHOT_P_H
+#define QWINJUMPLISTSNAPSHOT_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
+
+QT_BEGIN_NAMESPACE
+
+// An immutable copy of the jump list model as it was (or is about to be)
+// committed. Items and categories are plain values so that snapshots can be
+// compared without touching the shell.
+class QWinJumpListSnapshot
+{
+public:
+    // Mirror QWinJumpListItem::Type and QWinJumpListCategory::Type.
+    enum ItemType { Destination, Link, Separator };
+    enum CategoryType { Custom, Recent, Frequent, Tasks };
+
+    struct Item
+    {
+        ItemType type = Destination;
+        QString filePath;
+        QString workingDirectory;
+        QString title;
+        QString description;
+        QStringList arguments;
+        qint64 iconKey = 0; // QIcon::cacheKey(), 0 for no icon
+        // The icon rendered on the GUI thread for committing elsewhere;
+        // items are compared by iconKey only.
+        QVector<QImage> iconFrames;
+        // Set by QWinJumpListState::restore() instead of the above: the
+        // QWinIconFileCache::key() of the icon, empty for no icon.
+        QByteArray iconFileKey;
+    };
+
+    struct Category
+    {
+        CategoryType type = Custom;
+        QString title;
+        bool visible = false;
+        QVector<Item> items;
+
+        // Whether the category ends up in the committed list: known
+        // categories are filled by the shell, empty ones are skipped.
+        bool isEffective() const
+        {
+            return visible && (type == Recent || type == Frequent || !items.isEmpty());
+        }
+    };
+
+    // A null snapshot stands for "nothing committed yet".
+    QWinJumpListSnapshot() = default;
+    explicit QWinJumpListSnapshot(const QString &identifier);
+
+    bool isNull() const { return m_null; }
+    QString identifier() const { return m_identifier; }
+
+    void appendCategory(const Category &category);
+    const QVector<Category> &categories() const { return m_categories; }
+    uint categoryHash(int index) const { return m_hashes.at(index); }
+    int itemCount() const { return m_itemCount; }
+
+private:
+    bool m_null = true;
+    QString m_identifier;
+    QVector<Category> m_categories;
+    QVector<uint> m_hashes;
+    int m_itemCount = 0;
+};
+
+bool operator==(const QWinJumpListSnapshot::Item &a, const QWinJumpListSnapshot::Item &b);
+inline bool operator!=(const QWinJumpListSnapshot::Item &a, const QWinJumpListSnapshot::Item &b)
+{ return !(a == b); }
+uint qHash(const QWinJumpListSnapshot::Item &item, uint seed = 0);
+
+Q_DECLARE_TYPEINFO(QWinJumpListSnapshot::Item, Q_MOVABLE_TYPE);
+Q_DECLARE_TYPEINFO(QWinJumpListSnapshot::Category, Q_MOVABLE_TYPE);
+
+// The effective difference between two snapshots. Only categories that are
+// part of the committed list are compared: hiding a category and changing
+// its items is one change, changing the items of a hidden one is none.
+class QWinJumpListDiff
+{
+public:
+    enum ChangeType { Added, Removed, Modified, Moved };
+
+    struct Change
+    {
+        ChangeType type;
+        QWinJumpListSnapshot::CategoryType categoryType;
+        QString title;
+        int oldIndex; // into from.categories(), -1 when added
+        int newIndex; // into to.categories(), -1 when removed
+    };
+
+    static QWinJumpListDiff compute(const QWinJumpListSnapshot &from, const QWinJumpListSnapshot &to);
+
+    // True when committing "to" would not change anything for the user.
+    bool isEmpty() const { return !initial && !identifierChanged && changes.isEmpty(); }
+
+    bool initial = false; // "from" is null
+    bool identifierChanged = false;
+    QVector<Change> changes;
+};
+
+Q_DECLARE_TYPEINFO(QWinJumpListDiff::Change, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTSNAPSHOT_P_H
@@ -0,0 +1,153 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumpliststate_p.h"
+#include "qwiniconfilecache_p.h"
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatastream.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qhash.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QWinJumpListState {
+
+// The stream version of the model; fixed for as long as Version is 1.
+static const QDataStream::Version streamVersion = QDataStream::Qt_5_11;
+
+// Items sharing an icon hash its pixels once.
+static QByteArray iconFileKey(const QWinJumpListSnapshot::Item &item, QHash<qint64, QByteArray> *keys)
+{
+    if (!item.iconFileKey.isEmpty() || item.iconFrames.isEmpty())
+        return item.iconFileKey;
+    if (!item.iconKey)
+        return QWinIconFileCache::key(item.iconFrames);
+    QHash<qint64, QByteArray>::iterator it = keys->find(item.iconKey);
+    if (it == keys->end())
+        it = keys->insert(item.iconKey, QWinIconFileCache::key(item.iconFrames));
+    return it.value();
+}
+
+QByteArray save(const QWinJumpListSnapshot &snapshot, const QHash<qint64, QByteArray> &iconFileKeys)
+{
+    QByteArray state(HeaderSize, Qt::Uninitialized);
+    {
+        QDataStream out(&state, QIODevice::Append);
+        out.setVersion(streamVersion);
+        QHash<qint64, QByteArray> iconKeys = iconFileKeys;
+        const QVector<QWinJumpListSnapshot::Category> &categories = snapshot.categories();
+        out << snapshot.identifier() << quint32(categories.size());
+        for (const QWinJumpListSnapshot::Category &category : categories) {
+            out << quint8(category.type) << category.title << category.visible
+                << quint32(category.items.size());
+            for (const QWinJumpListSnapshot::Item &item : category.items) {
+                out << quint8(item.type) << item.filePath << item.workingDirectory << item.title
+                    << item.description << item.arguments << iconFileKey(item, &iconKeys);
+            }
+        }
+    }
+    uchar *header = reinterpret_cast<uchar *>(state.data());
+    qToBigEndian<quint32>(Magic, header);
+    qToBigEndian<quint16>(Version, header + 4);
+    qToBigEndian<quint32>(quint32(state.size() - HeaderSize), header + 6);
+    state += QCryptographicHash::hash(QByteArray::fromRawData(state.constData() + HeaderSize,
+                                                             state.size() - HeaderSize),
+                                      QCryptographicHash::Sha1);
+    return state;
+}
+
+bool restore(const QByteArray &state, QWinJumpListSnapshot *snapshot)
+{
+    const QByteArray hash = fingerprint(state);
+    if (hash.isEmpty())
+        return false;
+    const QByteArray model = QByteArray::fromRawData(state.constData() + HeaderSize,
+                                                     state.size() - HeaderSize - FingerprintSize);
+    if (QCryptographicHash::hash(model, QCryptographicHash::Sha1) != hash)
+        return false;
+
+    QDataStream in(model);
+    in.setVersion(streamVersion);
+    QString identifier;
+    quint32 categoryCount = 0;
+    in >> identifier >> categoryCount;
+    QWinJumpListSnapshot result(identifier);
+    for (quint32 i = 0; i < categoryCount && in.status() == QDataStream::Ok; ++i) {
+        QWinJumpListSnapshot::Category category;
+        quint8 categoryType = 0;
+        quint32 itemCount = 0;
+        in >> categoryType >> category.title >> category.visible >> itemCount;
+        if (categoryType > QWinJumpListSnapshot::Tasks)
+            return false;
+        category.type = QWinJumpListSnapshot::CategoryType(categoryType);
+        for (quint32 j = 0; j < itemCount && in.status() == QDataStream::Ok; ++j) {
+            QWinJumpListSnapshot::Item item;
+            quint8 itemType = 0;
+            in >> itemType >> item.filePath >> item.workingDirectory >> item.title
+               >> item.description >> item.arguments >> item.iconFileKey;
+            if (itemType > QWinJumpListSnapshot::Separator)
+                return false;
+            item.type = QWinJumpListSnapshot::ItemType(itemType);
+            category.items.append(item);
+        }
+        result.appendCategory(category);
+    }
+    if (in.status() != QDataStream::Ok || !in.atEnd())
+        return false;
+    *snapshot = result;
+    return true;
+}
+
+QByteArray fingerprint(const QByteArray &state)
+{
+    if (state.size() < HeaderSize + FingerprintSize)
+        return QByteArray();
+    const uchar *header = reinterpret_cast<const uchar *>(state.constData());
+    if (qFromBigEndian<quint32>(header) != quint32(Magic)
+        || qFromBigEndian<quint16>(header + 4) != quint16(Version)
+        || qFromBigEndian<quint32>(header + 6) != quint32(state.size() - HeaderSize - FingerprintSize)) {
+        return QByteArray();
+    }
+    return state.right(FingerprintSize);
+}
+
+} // namespace QWinJumpListState
+
+QT_END_NAMESPACE
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTSTATE_P_H
+#define QWINJUMPLISTSTATE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinjumplistsnapshot_p.h"
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+
+QT_BEGIN_NAMESPACE
+
+// The binary form of a jump list model: a header with the format version,
+// the model and a SHA-1 hash of the model, which doubles as its fingerprint.
+// Icons are stored as the keys of their icon files, which do not depend on
+// the process, unlike QIcon::cacheKey(); equal models therefore have equal
+// fingerprints across runs of the application.
+namespace QWinJumpListState
+{
+    enum {
+        Magic = 0x514a4c53, // "QJLS"
+        Version = 1,
+        HeaderSize = 10, // magic, version, size of the model
+        FingerprintSize = 20
+    };
+
+    // iconFileKeys holds the icon file keys known already, by
+    // QIcon::cacheKey(); the pixels of other icons are hashed.
+    QByteArray save(const QWinJumpListSnapshot &snapshot,
+                    const QHash<qint64, QByteArray> &iconFileKeys = QHash<qint64, QByteArray>());
+
+    // Returns false for data that is truncated, corrupt or of another
+    // version, leaving snapshot untouched.
+    bool restore(const QByteArray &state, QWinJumpListSnapshot *snapshot);
+
+    // The fingerprint stored in state, or an empty array if the header is
+    // not valid. Does not read the model.
+    QByteArray fingerprint(const QByteArray &state);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTSTATE_P_H
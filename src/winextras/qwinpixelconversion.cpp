@@ -0,0 +1,436 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinpixelconversion_p.h"
+
+#include <QtGui/qrgb.h>
+#include <QtCore/private/qsimd_p.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+void qt_winPremultiply_avx2(quint32 *pixels, int count);
+void qt_winUnpremultiply_avx2(quint32 *pixels, int count);
+int qt_winAlphaToMaskRow_avx2(const quint32 *pixels, int width, uchar *mask,
+                              quint32 threshold, bool setBelow);
+#endif
+
+static void premultiply_scalar(quint32 *pixels, int count)
+{
+    for (int i = 0; i < count; ++i)
+        pixels[i] = qPremultiply(pixels[i]);
+}
+
+static void unpremultiply_scalar(quint32 *pixels, int count)
+{
+    for (int i = 0; i < count; ++i)
+        pixels[i] = qUnpremultiply(pixels[i]);
+}
+
+#ifdef __SSE2__
+static void premultiply_sse2(quint32 *pixels, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(int(0xff000000));
+    const __m128i half = _mm_set1_epi16(0x80);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i *p = reinterpret_cast<__m128i *>(pixels + i);
+        const __m128i src = _mm_loadu_si128(p);
+        const __m128i alpha = _mm_and_si128(src, alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff)
+            continue;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xffff) {
+            _mm_storeu_si128(p, zero);
+            continue;
+        }
+        // Multiplying the alpha lane by 255 and dividing by 255 keeps alpha as is.
+        const __m128i opaque = _mm_or_si128(src, alphaMask);
+        __m128i lo = _mm_unpacklo_epi8(opaque, zero);
+        __m128i hi = _mm_unpackhi_epi8(opaque, zero);
+        const __m128i srcLo = _mm_unpacklo_epi8(src, zero);
+        const __m128i srcHi = _mm_unpackhi_epi8(src, zero);
+        const __m128i alphaLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128i alphaHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        lo = _mm_mullo_epi16(lo, alphaLo);
+        hi = _mm_mullo_epi16(hi, alphaHi);
+        // Same rounding as qPremultiply(): (t + (t >> 8) + 0x80) >> 8
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), half), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), half), 8);
+        _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(pixels + i, count - i);
+}
+
+static void unpremultiply_sse2(quint32 *pixels, int count)
+{
+    // SSE2 has no 32 bit multiply, so only the common fully opaque and fully
+    // transparent blocks are vectorized; mixed blocks use the exact scalar path.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(int(0xff000000));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i *p = reinterpret_cast<__m128i *>(pixels + i);
+        const __m128i alpha = _mm_and_si128(_mm_loadu_si128(p), alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff)
+            continue;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xffff) {
+            _mm_storeu_si128(p, zero);
+            continue;
+        }
+        unpremultiply_scalar(pixels + i, 4);
+    }
+    unpremultiply_scalar(pixels + i, count - i);
+}
+#endif // __SSE2__
+
+#if defined(__ARM_NEON__)
+static void premultiply_neon(quint32 *pixels, int count)
+{
+    const uint16x8_t half = vdupq_n_u16(0x80);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8_t *p = reinterpret_cast<uint8_t *>(pixels + i);
+        uint8x8x4_t v = vld4_u8(p); // B, G, R, A planes
+        for (int c = 0; c < 3; ++c) {
+            uint16x8_t t = vmull_u8(v.val[c], v.val[3]);
+            t = vaddq_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), half);
+            v.val[c] = vshrn_n_u16(t, 8);
+        }
+        vst4_u8(p, v);
+    }
+    premultiply_scalar(pixels + i, count - i);
+}
+#endif // __ARM_NEON__
+
+static void fixupDibAlpha_scalar(quint32 *pixels, int count, quint32 mask)
+{
+    for (int i = 0; i < count; ++i) {
+        const quint32 pixel = pixels[i];
+        if ((pixel & 0xff000000) == 0 && (pixel & 0x00ffffff) != 0)
+            pixels[i] = pixel | 0xff000000;
+        else
+            pixels[i] = pixel | mask;
+    }
+}
+
+typedef void (*PixelFunction)(quint32 *, int);
+
+struct PixelFunctions
+{
+    PixelFunction premultiply;
+    PixelFunction unpremultiply;
+};
+
+static PixelFunctions pixelFunctions(QWinPixelConversion::Implementation implementation)
+{
+    PixelFunctions result = { premultiply_scalar, unpremultiply_scalar };
+    switch (implementation) {
+    case QWinPixelConversion::Scalar:
+        break;
+    case QWinPixelConversion::Sse2:
+#ifdef __SSE2__
+        result.premultiply = premultiply_sse2;
+        result.unpremultiply = unpremultiply_sse2;
+#endif
+        break;
+    case QWinPixelConversion::Avx2:
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+        if (qCpuHasFeature(AVX2)) {
+            result.premultiply = qt_winPremultiply_avx2;
+            result.unpremultiply = qt_winUnpremultiply_avx2;
+        }
+#endif
+        break;
+    case QWinPixelConversion::Neon:
+#if defined(__ARM_NEON__)
+        result.premultiply = premultiply_neon;
+#endif
+        break;
+    }
+    return result;
+}
+
+static const PixelFunctions &bestPixelFunctions()
+{
+    static const PixelFunctions functions = pixelFunctions(QWinPixelConversion::bestImplementation());
+    return functions;
+}
+
+/*!
+    \internal
+    Returns the fastest conversion implementation supported by the CPU the
+    application is running on.
+ */
+QWinPixelConversion::Implementation QWinPixelConversion::bestImplementation()
+{
+    if (isAvailable(Avx2))
+        return Avx2;
+    if (isAvailable(Sse2))
+        return Sse2;
+    if (isAvailable(Neon))
+        return Neon;
+    return Scalar;
+}
+
+bool QWinPixelConversion::isAvailable(Implementation implementation)
+{
+    switch (implementation) {
+    case Scalar:
+        return true;
+    case Sse2:
+#ifdef __SSE2__
+        return true;
+#else
+        return false;
+#endif
+    case Avx2:
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+        return qCpuHasFeature(AVX2);
+#else
+        return false;
+#endif
+    case Neon:
+#if defined(__ARM_NEON__)
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+void QWinPixelConversion::premultiply(quint32 *pixels, int count)
+{
+    bestPixelFunctions().premultiply(pixels, count);
+}
+
+void QWinPixelConversion::unpremultiply(quint32 *pixels, int count)
+{
+    bestPixelFunctions().unpremultiply(pixels, count);
+}
+
+void QWinPixelConversion::premultiply(quint32 *pixels, int count, Implementation implementation)
+{
+    pixelFunctions(implementation).premultiply(pixels, count);
+}
+
+void QWinPixelConversion::unpremultiply(quint32 *pixels, int count, Implementation implementation)
+{
+    pixelFunctions(implementation).unpremultiply(pixels, count);
+}
+
+void QWinPixelConversion::premultiplyRows(uchar *bits, int width, int height, int bytesPerLine)
+{
+    const PixelFunction function = bestPixelFunctions().premultiply;
+    if (bytesPerLine == width * 4) {
+        function(reinterpret_cast<quint32 *>(bits), width * height);
+        return;
+    }
+    for (int y = 0; y < height; ++y)
+        function(reinterpret_cast<quint32 *>(bits + y * bytesPerLine), width);
+}
+
+void QWinPixelConversion::unpremultiplyRows(uchar *bits, int width, int height, int bytesPerLine)
+{
+    const PixelFunction function = bestPixelFunctions().unpremultiply;
+    if (bytesPerLine == width * 4) {
+        function(reinterpret_cast<quint32 *>(bits), width * height);
+        return;
+    }
+    for (int y = 0; y < height; ++y)
+        function(reinterpret_cast<quint32 *>(bits + y * bytesPerLine), width);
+}
+
+void QWinPixelConversion::fixupDibAlpha(quint32 *pixels, int count, bool forceOpaque)
+{
+    const quint32 mask = forceOpaque ? 0xff000000 : 0;
+    int i = 0;
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(int(0xff000000));
+    const __m128i orMask = _mm_set1_epi32(int(mask));
+    for (; i + 4 <= count; i += 4) {
+        __m128i *p = reinterpret_cast<__m128i *>(pixels + i);
+        const __m128i src = _mm_loadu_si128(p);
+        // Opaque where alpha is 0 and color is not: (alpha == 0) & !(color == 0)
+        const __m128i noAlpha = _mm_cmpeq_epi32(_mm_and_si128(src, alphaMask), zero);
+        const __m128i noColor = _mm_cmpeq_epi32(_mm_andnot_si128(alphaMask, src), zero);
+        const __m128i makeOpaque = _mm_and_si128(_mm_andnot_si128(noColor, noAlpha), alphaMask);
+        _mm_storeu_si128(p, _mm_or_si128(src, _mm_or_si128(makeOpaque, orMask)));
+    }
+#endif
+    fixupDibAlpha_scalar(pixels + i, count - i, mask);
+}
+
+// Reverses the bits of a byte: movemask yields the first pixel in the least
+// significant bit, masks want it in the most significant one.
+#define QT_WIN_R2(n) n, n + 2 * 64, n + 1 * 64, n + 3 * 64
+#define QT_WIN_R4(n) QT_WIN_R2(n), QT_WIN_R2(n + 2 * 16), QT_WIN_R2(n + 1 * 16), QT_WIN_R2(n + 3 * 16)
+#define QT_WIN_R6(n) QT_WIN_R4(n), QT_WIN_R4(n + 2 * 4), QT_WIN_R4(n + 1 * 4), QT_WIN_R4(n + 3 * 4)
+extern const uchar qt_winBitReverseTable[256] = {
+    QT_WIN_R6(0), QT_WIN_R6(2), QT_WIN_R6(1), QT_WIN_R6(3)
+};
+#undef QT_WIN_R6
+#undef QT_WIN_R4
+#undef QT_WIN_R2
+
+// Mask row functions pack whole groups of pixels and return how many they
+// did; the scalar function completes the row.
+typedef int (*MaskRowFunction)(const quint32 *pixels, int width, uchar *mask,
+                               quint32 threshold, bool setBelow);
+
+static void alphaToMaskRow_scalar(const quint32 *pixels, int from, int width, uchar *mask,
+                                  quint32 threshold, bool setBelow)
+{
+    for (int x = from; x < width; x += 8) {
+        const int end = qMin(x + 8, width);
+        uchar byte = 0;
+        for (int i = x; i < end; ++i) {
+            if (((pixels[i] >> 24) < threshold) == setBelow)
+                byte |= uchar(0x80 >> (i - x));
+        }
+        mask[x >> 3] = byte;
+    }
+}
+
+#ifdef __SSE2__
+static int alphaToMaskRow_sse2(const quint32 *pixels, int width, uchar *mask,
+                               quint32 threshold, bool setBelow)
+{
+    const __m128i limit = _mm_set1_epi32(int(threshold));
+    const int invert = setBelow ? 0 : 0xffff;
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i *p = reinterpret_cast<const __m128i *>(pixels + x);
+        const __m128i below0 = _mm_cmplt_epi32(_mm_srli_epi32(_mm_loadu_si128(p), 24), limit);
+        const __m128i below1 = _mm_cmplt_epi32(_mm_srli_epi32(_mm_loadu_si128(p + 1), 24), limit);
+        const __m128i below2 = _mm_cmplt_epi32(_mm_srli_epi32(_mm_loadu_si128(p + 2), 24), limit);
+        const __m128i below3 = _mm_cmplt_epi32(_mm_srli_epi32(_mm_loadu_si128(p + 3), 24), limit);
+        const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(below0, below1),
+                                               _mm_packs_epi32(below2, below3));
+        const int bits = _mm_movemask_epi8(packed) ^ invert;
+        mask[x >> 3] = qt_winBitReverseTable[bits & 0xff];
+        mask[(x >> 3) + 1] = qt_winBitReverseTable[bits >> 8];
+    }
+    return x;
+}
+#endif // __SSE2__
+
+#if defined(__ARM_NEON__)
+static int alphaToMaskRow_neon(const quint32 *pixels, int width, uchar *mask,
+                               quint32 threshold, bool setBelow)
+{
+    if (threshold > 255)
+        return 0; // Every pixel is below; not expressible in 8 bits.
+    static const uchar weights[16] = { 128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1 };
+    const uint8x16_t weight = vld1q_u8(weights);
+    const uint8x16_t limit = vdupq_n_u8(uchar(threshold));
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        // Deinterleaving loads put the alpha bytes of 16 pixels in val[3].
+        const uint8x16x4_t channels = vld4q_u8(reinterpret_cast<const uchar *>(pixels + x));
+        uint8x16_t hits = vcltq_u8(channels.val[3], limit);
+        if (!setBelow)
+            hits = vmvnq_u8(hits);
+        const uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vandq_u8(hits, weight))));
+        mask[x >> 3] = uchar(vgetq_lane_u64(sums, 0));
+        mask[(x >> 3) + 1] = uchar(vgetq_lane_u64(sums, 1));
+    }
+    return x;
+}
+#endif // __ARM_NEON__
+
+static MaskRowFunction maskRowFunction(QWinPixelConversion::Implementation implementation)
+{
+    switch (implementation) {
+    case QWinPixelConversion::Scalar:
+        break;
+    case QWinPixelConversion::Sse2:
+#ifdef __SSE2__
+        return alphaToMaskRow_sse2;
+#else
+        break;
+#endif
+    case QWinPixelConversion::Avx2:
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+        if (qCpuHasFeature(AVX2))
+            return qt_winAlphaToMaskRow_avx2;
+#endif
+        break;
+    case QWinPixelConversion::Neon:
+#if defined(__ARM_NEON__)
+        return alphaToMaskRow_neon;
+#else
+        break;
+#endif
+    }
+    return nullptr;
+}
+
+void QWinPixelConversion::alphaToMask(const uchar *bits, int width, int height, int bytesPerLine,
+                                      uchar *mask, int maskBytesPerLine,
+                                      int threshold, MaskPolarity polarity)
+{
+    static const Implementation best = bestImplementation();
+    alphaToMask(bits, width, height, bytesPerLine, mask, maskBytesPerLine, threshold, polarity, best);
+}
+
+void QWinPixelConversion::alphaToMask(const uchar *bits, int width, int height, int bytesPerLine,
+                                      uchar *mask, int maskBytesPerLine,
+                                      int threshold, MaskPolarity polarity,
+                                      Implementation implementation)
+{
+    const MaskRowFunction rowFunction = maskRowFunction(implementation);
+    const quint32 limit = quint32(qBound(0, threshold, 256));
+    const bool setBelow = polarity == MaskTransparent;
+    const int usedBytes = (width + 7) / 8;
+    for (int y = 0; y < height; ++y) {
+        const quint32 *pixels = reinterpret_cast<const quint32 *>(bits + y * bytesPerLine);
+        uchar *maskLine = mask + y * maskBytesPerLine;
+        const int done = rowFunction ? rowFunction(pixels, width, maskLine, limit, setBelow) : 0;
+        alphaToMaskRow_scalar(pixels, done, width, maskLine, limit, setBelow);
+        if (maskBytesPerLine > usedBytes)
+            memset(maskLine + usedBytes, 0, size_t(maskBytesPerLine - usedBytes));
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinpixelconversion_p.h"
+
+#include <QtGui/qrgb.h>
+#include <QtCore/private/qsimd_p.h>
+
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+
+QT_BEGIN_NAMESPACE
+
+void qt_winPremultiply_avx2(quint32 *pixels, int count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alphaMask = _mm256_set1_epi32(int(0xff000000));
+    const __m256i half = _mm256_set1_epi16(0x80);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i *p = reinterpret_cast<__m256i *>(pixels + i);
+        const __m256i src = _mm256_loadu_si256(p);
+        const __m256i alpha = _mm256_and_si256(src, alphaMask);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, alphaMask)) == -1)
+            continue;
+        if (_mm256_testz_si256(alpha, alpha)) {
+            _mm256_storeu_si256(p, zero);
+            continue;
+        }
+        const __m256i opaque = _mm256_or_si256(src, alphaMask);
+        __m256i lo = _mm256_unpacklo_epi8(opaque, zero);
+        __m256i hi = _mm256_unpackhi_epi8(opaque, zero);
+        const __m256i srcLo = _mm256_unpacklo_epi8(src, zero);
+        const __m256i srcHi = _mm256_unpackhi_epi8(src, zero);
+        const __m256i alphaLo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(srcLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        const __m256i alphaHi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(srcHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        lo = _mm256_mullo_epi16(lo, alphaLo);
+        hi = _mm256_mullo_epi16(hi, alphaHi);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), half), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), half), 8);
+        _mm256_storeu_si256(p, _mm256_packus_epi16(lo, hi));
+    }
+    for (; i < count; ++i)
+        pixels[i] = qPremultiply(pixels[i]);
+}
+
+void qt_winUnpremultiply_avx2(quint32 *pixels, int count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i channelMask = _mm256_set1_epi32(0xff);
+    const __m256i alphaMask = _mm256_set1_epi32(int(0xff000000));
+    const __m256i round = _mm256_set1_epi32(0x8000);
+    const int *invFactors = reinterpret_cast<const int *>(qt_inv_premul_factor);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i *p = reinterpret_cast<__m256i *>(pixels + i);
+        const __m256i src = _mm256_loadu_si256(p);
+        const __m256i alpha = _mm256_srli_epi32(src, 24);
+        const __m256i opaque = _mm256_cmpeq_epi32(alpha, channelMask);
+        if (_mm256_movemask_epi8(opaque) == -1)
+            continue;
+        const __m256i transparent = _mm256_cmpeq_epi32(alpha, zero);
+        if (_mm256_movemask_epi8(transparent) == -1) {
+            _mm256_storeu_si256(p, zero);
+            continue;
+        }
+        // Same as qUnpremultiply(): (c * (0x00ff00ff / alpha) + 0x8000) >> 16
+        const __m256i inv = _mm256_i32gather_epi32(invFactors, alpha, 4);
+        __m256i b = _mm256_and_si256(src, channelMask);
+        __m256i g = _mm256_and_si256(_mm256_srli_epi32(src, 8), channelMask);
+        __m256i r = _mm256_and_si256(_mm256_srli_epi32(src, 16), channelMask);
+        b = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(b, inv), round), 16);
+        g = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(g, inv), round), 16);
+        r = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(r, inv), round), 16);
+        __m256i result = _mm256_and_si256(b, channelMask);
+        result = _mm256_or_si256(result, _mm256_slli_epi32(_mm256_and_si256(g, channelMask), 8));
+        result = _mm256_or_si256(result, _mm256_slli_epi32(_mm256_and_si256(r, channelMask), 16));
+        result = _mm256_or_si256(result, _mm256_and_si256(src, alphaMask));
+        result = _mm256_blendv_epi8(result, src, opaque);
+        result = _mm256_andnot_si256(transparent, result);
+        _mm256_storeu_si256(p, result);
+    }
+    for (; i < count; ++i)
+        pixels[i] = qUnpremultiply(pixels[i]);
+}
+
+extern const uchar qt_winBitReverseTable[256];
+
+int qt_winAlphaToMaskRow_avx2(const quint32 *pixels, int width, uchar *mask,
+                              quint32 threshold, bool setBelow)
+{
+    const __m256i limit = _mm256_set1_epi32(int(threshold));
+    // Packing works within 128 bit lanes; this restores the pixel order.
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    const quint32 invert = setBelow ? 0 : 0xffffffff;
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+        const __m256i *p = reinterpret_cast<const __m256i *>(pixels + x);
+        const __m256i below0 = _mm256_cmpgt_epi32(limit, _mm256_srli_epi32(_mm256_loadu_si256(p), 24));
+        const __m256i below1 = _mm256_cmpgt_epi32(limit, _mm256_srli_epi32(_mm256_loadu_si256(p + 1), 24));
+        const __m256i below2 = _mm256_cmpgt_epi32(limit, _mm256_srli_epi32(_mm256_loadu_si256(p + 2), 24));
+        const __m256i below3 = _mm256_cmpgt_epi32(limit, _mm256_srli_epi32(_mm256_loadu_si256(p + 3), 24));
+        const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(below0, below1),
+                                                  _mm256_packs_epi32(below2, below3));
+        const quint32 bits = quint32(_mm256_movemask_epi8(_mm256_permutevar8x32_epi32(packed, order))) ^ invert;
+        uchar *dest = mask + (x >> 3);
+        dest[0] = qt_winBitReverseTable[bits & 0xff];
+        dest[1] = qt_winBitReverseTable[(bits >> 8) & 0xff];
+        dest[2] = qt_winBitReverseTable[(bits >> 16) & 0xff];
+        dest[3] = qt_winBitReverseTable[bits >> 24];
+    }
+    return x;
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_COMPILER_SUPPORTS_HERE(AVX2)
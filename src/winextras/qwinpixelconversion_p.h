@@ -0,0 +1,110 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINPIXELCONVERSION_P_H
+#define QWINPIXELCONVERSION_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+// Conversion kernels between straight ARGB32 (QImage::Format_ARGB32, the
+// layout of icon DIBs) and premultiplied ARGB32 (QImage::Format_ARGB32_Premultiplied,
+// the layout expected by AlphaBlend() and the DWM). On little endian machines
+// both are BGRA in memory, so the conversions work in place on DIB scan lines.
+// The results are bit-identical to qPremultiply() / qUnpremultiply().
+namespace QWinPixelConversion
+{
+    enum Implementation {
+        Scalar,
+        Sse2,
+        Avx2,
+        Neon
+    };
+
+    Implementation bestImplementation();
+    bool isAvailable(Implementation implementation);
+
+    void premultiply(quint32 *pixels, int count);
+    void unpremultiply(quint32 *pixels, int count);
+    void premultiply(quint32 *pixels, int count, Implementation implementation);
+    void unpremultiply(quint32 *pixels, int count, Implementation implementation);
+
+    void premultiplyRows(uchar *bits, int width, int height, int bytesPerLine);
+    void unpremultiplyRows(uchar *bits, int width, int height, int bytesPerLine);
+
+    // Makes DIB data returned by GetDIBits() usable as QImage data: pixels
+    // without alpha but with color become opaque (GDI leaves alpha at 0),
+    // and all pixels become opaque if forceOpaque is set (Format_RGB32).
+    void fixupDibAlpha(quint32 *pixels, int count, bool forceOpaque);
+
+    enum MaskPolarity {
+        MaskTransparent, // bits set for alpha below the threshold, as in icon AND masks
+        MaskOpaque       // bits set for the other pixels, as in QImage::createAlphaMask()
+    };
+
+    // 1bpp masks have DWORD aligned scan lines like GetDIBits() and DIB sections.
+    inline int maskBytesPerLine(int width) { return ((width + 31) / 32) * 4; }
+
+    // Packs the alpha channel of ARGB32 scan lines into a 1bpp mask, most
+    // significant bit first. The default threshold of 128 is the one
+    // QImage::createAlphaMask() uses; threshold is clamped to [0, 256].
+    // Padding bits and bytes of the mask scan lines are cleared.
+    void alphaToMask(const uchar *bits, int width, int height, int bytesPerLine,
+                     uchar *mask, int maskBytesPerLine,
+                     int threshold = 128, MaskPolarity polarity = MaskTransparent);
+    void alphaToMask(const uchar *bits, int width, int height, int bytesPerLine,
+                     uchar *mask, int maskBytesPerLine, int threshold, MaskPolarity polarity,
+                     Implementation implementation);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINPIXELCONVERSION_P_H
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinrebuildscheduler_p.h"
+
+#include <QtCore/qdeadlinetimer.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+QWinRebuildScheduler::QWinRebuildScheduler(const Task &task)
+    : m_task(task)
+    , m_clock([]() { return QDeadlineTimer::current().deadline(); })
+{
+}
+
+void QWinRebuildScheduler::request()
+{
+    ++m_requested;
+    const qint64 now = m_clock();
+    const qint64 earliest = m_hasRun ? m_lastRun + m_minimumInterval : now;
+    if (m_policy == Immediate && !m_running && now >= earliest) {
+        run(now);
+        return;
+    }
+    if (m_policy == Debounced)
+        schedule(qMax(earliest, now + m_debounceInterval), now);
+    else if (!m_pending)
+        schedule(qMax(earliest, now), now);
+}
+
+void QWinRebuildScheduler::timeout()
+{
+    if (!m_pending)
+        return;
+    const qint64 now = m_clock();
+    if (now < m_due)
+        schedule(m_due, now); // fired early
+    else
+        run(now);
+}
+
+bool QWinRebuildScheduler::flush()
+{
+    if (!m_pending || m_running)
+        return false;
+    run(m_clock());
+    return true;
+}
+
+void QWinRebuildScheduler::cancel()
+{
+    if (!m_pending)
+        return;
+    m_pending = false;
+    if (m_timer)
+        m_timer(-1);
+}
+
+void QWinRebuildScheduler::schedule(qint64 due, qint64 now)
+{
+    m_pending = true;
+    m_due = due;
+    if (m_timer)
+        m_timer(int(qBound(qint64(0), due - now, qint64(std::numeric_limits<int>::max()))));
+}
+
+// The task may request another rebuild; it is scheduled rather than run
+// recursively.
+void QWinRebuildScheduler::run(qint64 now)
+{
+    cancel();
+    m_hasRun = true;
+    m_lastRun = now;
+    ++m_executed;
+    m_running = true;
+    m_task();
+    m_running = false;
+}
+
+QT_END_NAMESPACE
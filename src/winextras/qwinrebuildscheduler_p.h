@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINREBUILDSCHEDULER_P_H
+#define QWINREBUILDSCHEDULER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qglobal.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+// Decides when an expensive rebuild requested by request() runs:
+//
+// Queued:     on the next timer event, coalescing all requests made until
+//             then (a zero timeout, that is, the next event loop pass).
+// Immediate:  within request().
+// Debounced:  once no request was made for the debounce interval.
+//
+// In all policies, rebuilds run at least the minimum interval apart; those
+// that would run earlier are postponed. The owner provides the timer: it is
+// started with the delay in milliseconds, or stopped with a negative delay,
+// and calls timeout() when it fires. Not thread-safe.
+class QWinRebuildScheduler
+{
+public:
+    enum Policy { Queued, Immediate, Debounced };
+    enum { DefaultDebounceInterval = 100 };
+
+    typedef std::function<void()> Task;
+    typedef std::function<qint64()> Clock;
+    typedef std::function<void(int msec)> Timer;
+
+    explicit QWinRebuildScheduler(const Task &task);
+
+    // Defaults to a monotonic clock in milliseconds.
+    void setClock(const Clock &clock) { m_clock = clock; }
+    void setTimer(const Timer &timer) { m_timer = timer; }
+
+    // Settings apply to the requests made after changing them.
+    Policy policy() const { return m_policy; }
+    void setPolicy(Policy policy) { m_policy = policy; }
+    int debounceInterval() const { return m_debounceInterval; }
+    void setDebounceInterval(int msec) { m_debounceInterval = qMax(msec, 0); }
+    int minimumInterval() const { return m_minimumInterval; }
+    void setMinimumInterval(int msec) { m_minimumInterval = qMax(msec, 0); }
+
+    bool isPending() const { return m_pending; }
+    qint64 dueTime() const { return m_due; }
+
+    void request();
+    void timeout();
+    // Runs a pending rebuild right away, regardless of the minimum interval.
+    bool flush();
+    // Drops a pending rebuild.
+    void cancel();
+
+    quint64 requestedCount() const { return m_requested; }
+    quint64 executedCount() const { return m_executed; }
+    void resetCounters() { m_requested = m_executed = 0; }
+
+private:
+    void schedule(qint64 due, qint64 now);
+    void run(qint64 now);
+
+    Task m_task;
+    Clock m_clock;
+    Timer m_timer;
+    Policy m_policy = Queued;
+    int m_debounceInterval = DefaultDebounceInterval;
+    int m_minimumInterval = 0;
+    bool m_pending = false;
+    bool m_running = false;
+    bool m_hasRun = false;
+    qint64 m_due = 0;
+    qint64 m_lastRun = 0;
+    quint64 m_requested = 0;
+    quint64 m_executed = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINREBUILDSCHEDULER_P_H
@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinrecentdocumentsubmitter_p.h"
+#include "qwincommandline_p.h"
+
+#include <QtCore/qdir.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qset.h>
+
+QT_BEGIN_NAMESPACE
+
+class QWinRecentDocumentSubmitter::Batch : public QRunnable
+{
+public:
+    Batch(QWinRecentDocumentSubmitter *submitter, const QString &appId,
+          const QVector<QWinJumpListSnapshot::Item> &items, const QFutureInterface<int> &result) :
+        m_submitter(submitter), m_appId(appId), m_items(items), m_result(result)
+    {
+    }
+
+    void run() override
+    {
+        m_submitter->run(m_appId, m_items, &m_result);
+    }
+
+private:
+    QWinRecentDocumentSubmitter *m_submitter;
+    QString m_appId;
+    QVector<QWinJumpListSnapshot::Item> m_items;
+    QFutureInterface<int> m_result;
+};
+
+QWinRecentDocumentSubmitter::QWinRecentDocumentSubmitter(Sink *sink,
+                                                         const QWinJumpListSerializer::IconResolver &iconResolver) :
+    m_sink(sink), m_serializer(iconResolver)
+{
+    // One thread keeps the batches in order and the sink single-threaded.
+    m_pool.setMaxThreadCount(1);
+}
+
+QWinRecentDocumentSubmitter::~QWinRecentDocumentSubmitter()
+{
+    m_pool.waitForDone();
+}
+
+QString QWinRecentDocumentSubmitter::documentKey(const QString &filePath, const QStringList &arguments)
+{
+    return QDir::fromNativeSeparators(filePath).toCaseFolded() + QChar() + QWinCommandLine::join(arguments);
+}
+
+QFuture<int> QWinRecentDocumentSubmitter::submit(const QString &appId,
+                                                 const QVector<QWinJumpListSnapshot::Item> &items)
+{
+    QVector<QWinJumpListSnapshot::Item> distinct;
+    distinct.reserve(items.size());
+    QSet<QString> keys;
+    keys.reserve(items.size());
+    for (const QWinJumpListSnapshot::Item &item : items) {
+        const QString key = documentKey(item.filePath, item.arguments);
+        if (!keys.contains(key)) {
+            keys.insert(key);
+            distinct.append(item);
+        }
+    }
+
+    QFutureInterface<int> result;
+    result.reportStarted();
+    {
+        QMutexLocker locker(&m_mutex);
+        ++m_statistics.batches;
+        m_statistics.duplicates += quint64(items.size() - distinct.size());
+    }
+    m_pool.start(new Batch(this, appId, distinct, result));
+    return result.future();
+}
+
+void QWinRecentDocumentSubmitter::run(const QString &appId, const QVector<QWinJumpListSnapshot::Item> &items,
+                                      QFutureInterface<int> *result)
+{
+    m_sink->batchStarted();
+    m_serializer.begin();
+    const QChar *id = appId.isEmpty() ? nullptr : m_serializer.string(appId);
+    int added = 0;
+    for (const QWinJumpListSnapshot::Item &item : items) {
+        if (m_sink->add(id, m_serializer.link(item)))
+            ++added;
+    }
+    m_sink->batchFinished();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_statistics.added += quint64(added);
+        m_statistics.failed += quint64(items.size() - added);
+    }
+    result->reportResult(added);
+    result->reportFinished();
+}
+
+bool QWinRecentDocumentSubmitter::isIdle() const
+{
+    return m_pool.activeThreadCount() == 0;
+}
+
+bool QWinRecentDocumentSubmitter::waitForIdle(int msecs)
+{
+    return m_pool.waitForDone(msecs);
+}
+
+QWinRecentDocumentSubmitter::Statistics QWinRecentDocumentSubmitter::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_statistics;
+}
+
+QT_END_NAMESPACE
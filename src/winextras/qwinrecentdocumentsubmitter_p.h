@@ -0,0 +1,124 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINRECENTDOCUMENTSUBMITTER_P_H
+#define QWINRECENTDOCUMENTSUBMITTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinjumplistsnapshot_p.h"
+#include "qwinjumplistserializer_p.h"
+
+#include <QtCore/qfutureinterface.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qthreadpool.h>
+
+QT_BEGIN_NAMESPACE
+
+// Adds documents to the recent documents of the shell in batches, on a
+// worker thread. Batches run one after the other in the order they were
+// submitted; each adds every distinct document it contains once.
+class QWinRecentDocumentSubmitter
+{
+public:
+    class Sink
+    {
+    public:
+        virtual ~Sink() {}
+        // Called on the worker thread around each batch, for example to
+        // enter an apartment.
+        virtual void batchStarted() {}
+        virtual void batchFinished() {}
+        // appId is null for the default application ID.
+        virtual bool add(const QChar *appId, const QWinJumpListSerializer::Link &link) = 0;
+    };
+
+    struct Statistics
+    {
+        quint64 batches = 0;
+        quint64 duplicates = 0;
+        quint64 added = 0;
+        quint64 failed = 0;
+    };
+
+    // Takes ownership of sink.
+    explicit QWinRecentDocumentSubmitter(Sink *sink,
+                                         const QWinJumpListSerializer::IconResolver &iconResolver = QWinJumpListSerializer::IconResolver());
+    ~QWinRecentDocumentSubmitter();
+
+    // Documents are the same if their paths only differ in separators or
+    // case and their arguments are equal.
+    static QString documentKey(const QString &filePath, const QStringList &arguments);
+
+    // The future reports the number of documents added.
+    QFuture<int> submit(const QString &appId, const QVector<QWinJumpListSnapshot::Item> &items);
+
+    bool isIdle() const;
+    // Returns false if batches are still running after msecs milliseconds.
+    bool waitForIdle(int msecs = -1);
+
+    Statistics statistics() const;
+
+private:
+    Q_DISABLE_COPY(QWinRecentDocumentSubmitter)
+
+    class Batch;
+    void run(const QString &appId, const QVector<QWinJumpListSnapshot::Item> &items,
+             QFutureInterface<int> *result);
+
+    QScopedPointer<Sink> m_sink;
+    QWinJumpListSerializer m_serializer; // used by the worker only
+    mutable QMutex m_mutex;
+    Statistics m_statistics;
+    QThreadPool m_pool;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINRECENTDOCUMENTSUBMITTER_P_H
@@ -0,0 +1,505 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinregiondata_p.h"
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+static QByteArray encodeRects(const QRect *rects, int count, const QRect &bounds)
+{
+    const int headerSize = int(sizeof(QWinRegionDataHeader));
+    QByteArray result(headerSize + count * int(sizeof(QWinRect)), Qt::Uninitialized);
+
+    QWinRegionDataHeader *header = reinterpret_cast<QWinRegionDataHeader *>(result.data());
+    header->dwSize = quint32(headerSize);
+    header->iType = QWinRegionData::RdhRectangles;
+    header->nCount = quint32(count);
+    header->nRgnSize = quint32(count) * quint32(sizeof(QWinRect));
+    header->rcBound.left = bounds.left();
+    header->rcBound.top = bounds.top();
+    header->rcBound.right = bounds.left() + bounds.width();
+    header->rcBound.bottom = bounds.top() + bounds.height();
+
+    QWinRect *out = reinterpret_cast<QWinRect *>(result.data() + headerSize);
+    for (int i = 0; i < count; ++i) {
+        const QRect &rect = rects[i];
+        out->left = rect.left();
+        out->top = rect.top();
+        out->right = rect.left() + rect.width();
+        out->bottom = rect.top() + rect.height();
+        ++out;
+    }
+    return result;
+}
+
+QByteArray QWinRegionData::encode(const QRegion &region)
+{
+    return encodeRects(region.begin(), region.rectCount(), region.boundingRect());
+}
+
+QByteArray QWinRegionData::encode(const QRect *rects, int count)
+{
+    QRect bounds;
+    for (int i = 0; i < count; ++i)
+        bounds |= rects[i];
+    return encodeRects(rects, count, bounds);
+}
+
+bool QWinRegionData::isBanded(const QRect *rects, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        const QRect &rect = rects[i];
+        if (rect.isEmpty())
+            return false;
+        if (i == 0)
+            continue;
+        const QRect &previous = rects[i - 1];
+        if (rect.top() == previous.top()) {
+            // Same band: same height, left to right, neither touching nor overlapping.
+            if (rect.bottom() != previous.bottom() || rect.left() <= previous.right() + 1)
+                return false;
+        } else if (rect.top() <= previous.bottom()) {
+            return false; // bands overlap or are out of order
+        }
+    }
+    return true;
+}
+
+QRegion QWinRegionData::decode(const void *data, qsizetype size)
+{
+    const qsizetype headerSize = qsizetype(sizeof(QWinRegionDataHeader));
+    if (!data || size < headerSize)
+        return QRegion();
+    QWinRegionDataHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (header.dwSize < quint32(headerSize) || qsizetype(header.dwSize) > size
+        || header.iType != RdhRectangles
+        || header.nCount > quint32((size - header.dwSize) / qsizetype(sizeof(QWinRect)))) {
+        return QRegion();
+    }
+
+    const int count = int(header.nCount);
+    const uchar *source = static_cast<const uchar *>(data) + header.dwSize;
+    QVarLengthArray<QRect, 64> rects(count);
+    for (int i = 0; i < count; ++i) {
+        QWinRect rect;
+        memcpy(&rect, source + i * sizeof(QWinRect), sizeof(rect));
+        rects[i] = QRect(rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top);
+    }
+
+    QRegion region;
+    if (isBanded(rects.constData(), count)) {
+        region.setRects(rects.constData(), count);
+    } else {
+        for (const QRect &rect : qAsConst(rects))
+            region += rect;
+    }
+    return region;
+}
+
+// Appends the runs of set bits of an opaque mask row (most significant bit
+// first, padded with cleared bits to whole 64 bit words) as [left, right) pairs.
+static void appendRuns(const uchar *mask, int words, int width, QVector<int> *runs)
+{
+    bool inRun = false;
+    int start = 0;
+    for (int word = 0; word < words; ++word) {
+        const quint64 bits = qFromBigEndian<quint64>(mask + word * 8);
+        if (bits == (inRun ? ~quint64(0) : quint64(0)))
+            continue; // no run starts or ends in this word
+        const int base = word * 64;
+        int position = 0;
+        while (position < 64) {
+            // Shifting in cleared bits at the bottom keeps a run open, or
+            // closed, past the end of the word.
+            const quint64 rest = (inRun ? ~bits : bits) << position;
+            if (!rest)
+                break;
+            position += int(qCountLeadingZeroBits(rest));
+            if (inRun) {
+                runs->append(start);
+                runs->append(base + position);
+            } else {
+                start = base + position;
+            }
+            inRun = !inRun;
+        }
+    }
+    if (inRun) {
+        runs->append(start);
+        runs->append(width);
+    }
+}
+
+static void appendBand(const QVector<int> &runs, int top, int bottom, QVector<QRect> *rects)
+{
+    for (int i = 0; i < runs.size(); i += 2)
+        rects->append(QRect(runs.at(i), top, runs.at(i + 1) - runs.at(i), bottom - top));
+}
+
+QVector<QRect> QWinRegionData::rectsFromAlpha(const QImage &image, int threshold)
+{
+    static const QWinPixelConversion::Implementation best = QWinPixelConversion::bestImplementation();
+    return rectsFromAlpha(image, threshold, best);
+}
+
+QVector<QRect> QWinRegionData::rectsFromAlpha(const QImage &image, int threshold,
+                                              QWinPixelConversion::Implementation implementation)
+{
+    QVector<QRect> rects;
+    if (image.isNull())
+        return rects;
+    if (!image.hasAlphaChannel()) {
+        if (threshold <= 255)
+            rects.append(image.rect());
+        return rects;
+    }
+
+    QImage argb = image;
+    if (argb.format() != QImage::Format_ARGB32 && argb.format() != QImage::Format_ARGB32_Premultiplied)
+        argb = argb.convertToFormat(QImage::Format_ARGB32);
+
+    const int width = argb.width();
+    const int words = (width + 63) / 64;
+    // Bytes past maskBytesPerLine() are never written and stay cleared.
+    QVarLengthArray<uchar, 512> mask(words * 8);
+    memset(mask.data(), 0, size_t(mask.size()));
+
+    QVector<int> runs;
+    QVector<int> previousRuns;
+    int bandTop = 0;
+    for (int y = 0; y < argb.height(); ++y) {
+        QWinPixelConversion::alphaToMask(argb.constScanLine(y), width, 1, argb.bytesPerLine(),
+                                         mask.data(), QWinPixelConversion::maskBytesPerLine(width),
+                                         threshold, QWinPixelConversion::MaskOpaque, implementation);
+        runs.clear();
+        appendRuns(mask.constData(), words, width, &runs);
+        if (runs != previousRuns) {
+            appendBand(previousRuns, bandTop, y, &rects);
+            previousRuns.swap(runs);
+            bandTop = y;
+        }
+    }
+    appendBand(previousRuns, bandTop, argb.height(), &rects);
+    return rects;
+}
+
+QRegion QWinRegionData::regionFromAlpha(const QImage &image, int threshold)
+{
+    const QVector<QRect> rects = rectsFromAlpha(image, threshold);
+    QRegion region;
+    region.setRects(rects.constData(), rects.size());
+    return region;
+}
+
+QByteArray QWinRegionData::regionDataFromAlpha(const QImage &image, int threshold)
+{
+    const QVector<QRect> rects = rectsFromAlpha(image, threshold);
+    return encode(rects.constData(), rects.size());
+}
+
+namespace {
+
+// Horizontal extent of a rectangle in a band; right is exclusive.
+struct Span
+{
+    int left;
+    int right;
+};
+
+// Rows [top, bottom) covered by the spans [first, first + count).
+struct Band
+{
+    int top;
+    int bottom;
+    int first;
+    int count;
+};
+
+struct BandList
+{
+    QVector<Band> bands;
+    QVector<Span> spans;
+
+    int rectCount() const { return spans.size(); }
+};
+
+} // namespace
+
+static BandList bandsFromRegion(const QRegion &region)
+{
+    BandList list;
+    list.spans.reserve(region.rectCount());
+    for (const QRect &rect : region) {
+        if (list.bands.isEmpty() || list.bands.constLast().top != rect.top())
+            list.bands.append({rect.top(), rect.top() + rect.height(), list.spans.size(), 0});
+        list.spans.append({rect.left(), rect.left() + rect.width()});
+        ++list.bands.last().count;
+    }
+    return list;
+}
+
+static QRegion regionFromBands(const BandList &list)
+{
+    QVector<QRect> rects;
+    rects.reserve(list.spans.size());
+    for (const Band &band : list.bands) {
+        for (int i = band.first; i < band.first + band.count; ++i) {
+            const Span &span = list.spans.at(i);
+            rects.append(QRect(span.left, band.top, span.right - span.left, band.bottom - band.top));
+        }
+    }
+    QRegion region;
+    if (QWinRegionData::isBanded(rects.constData(), rects.size())) {
+        region.setRects(rects.constData(), rects.size());
+    } else {
+        for (const QRect &rect : qAsConst(rects))
+            region += rect;
+    }
+    return region;
+}
+
+// Merges spans of each band that are at most tolerance apart, or for which
+// closeGap returns true.
+static void closeGaps(BandList *list, int tolerance, const QVector<bool> &closeGap = QVector<bool>())
+{
+    QVector<Span> spans;
+    spans.reserve(list->spans.size());
+    for (Band &band : list->bands) {
+        const int first = spans.size();
+        for (int i = band.first; i < band.first + band.count; ++i) {
+            const Span &span = list->spans.at(i);
+            if (spans.size() > first
+                && (span.left - spans.constLast().right <= tolerance
+                    || (!closeGap.isEmpty() && closeGap.at(i - 1)))) {
+                spans.last().right = qMax(spans.constLast().right, span.right);
+            } else {
+                spans.append(span);
+            }
+        }
+        band.first = first;
+        band.count = spans.size() - first;
+    }
+    list->spans = spans;
+}
+
+static bool spansMatch(const BandList &list, const Band &a, const Band &b, int tolerance)
+{
+    if (a.count != b.count)
+        return false;
+    for (int i = 0; i < a.count; ++i) {
+        const Span &sa = list.spans.at(a.first + i);
+        const Span &sb = list.spans.at(b.first + i);
+        if (qAbs(sa.left - sb.left) > tolerance || qAbs(sa.right - sb.right) > tolerance)
+            return false;
+    }
+    return true;
+}
+
+// Merges vertically neighbouring bands that are at most tolerance apart and
+// whose spans match within tolerance; the merged band covers both.
+static void mergeBands(BandList *list, int tolerance)
+{
+    QVector<Band> bands;
+    QVector<Span> spans;
+    bands.reserve(list->bands.size());
+    spans.reserve(list->spans.size());
+    for (const Band &band : qAsConst(list->bands)) {
+        if (!bands.isEmpty()) {
+            Band &last = bands.last();
+            if (band.top - last.bottom <= tolerance && spansMatch(*list, last, band, tolerance)) {
+                // last lives at the end of spans: widen it in place, then
+                // join spans that now touch.
+                int count = 0;
+                for (int i = 0; i < band.count; ++i) {
+                    const Span &span = list->spans.at(band.first + i);
+                    Span merged = spans.at(last.first + i);
+                    merged.left = qMin(merged.left, span.left);
+                    merged.right = qMax(merged.right, span.right);
+                    if (count > 0 && merged.left <= spans.at(last.first + count - 1).right) {
+                        Span &previous = spans[last.first + count - 1];
+                        previous.right = qMax(previous.right, merged.right);
+                    } else {
+                        spans[last.first + count++] = merged;
+                    }
+                }
+                spans.resize(last.first + count);
+                last.count = count;
+                last.bottom = band.bottom;
+                continue;
+            }
+        }
+        bands.append({band.top, band.bottom, spans.size(), band.count});
+        for (int i = band.first; i < band.first + band.count; ++i)
+            spans.append(list->spans.at(i));
+    }
+    list->bands = bands;
+    list->spans = spans;
+}
+
+// Closes the excess cheapest gaps, measured in added area.
+static void closeCheapestGaps(BandList *list, int excess)
+{
+    struct Gap
+    {
+        qint64 cost;
+        int span;
+    };
+    QVector<Gap> gaps;
+    for (const Band &band : qAsConst(list->bands)) {
+        const qint64 height = band.bottom - band.top;
+        for (int i = band.first; i < band.first + band.count - 1; ++i)
+            gaps.append({(list->spans.at(i + 1).left - list->spans.at(i).right) * height, i});
+    }
+    if (gaps.isEmpty())
+        return;
+    excess = qMin(excess, gaps.size());
+    std::nth_element(gaps.begin(), gaps.begin() + (excess - 1), gaps.end(),
+                     [](const Gap &a, const Gap &b) {
+                         return a.cost < b.cost || (a.cost == b.cost && a.span < b.span);
+                     });
+    QVector<bool> closeGap(list->spans.size(), false);
+    for (int i = 0; i < excess; ++i)
+        closeGap[gaps.at(i).span] = true;
+    closeGaps(list, 0, closeGap);
+}
+
+// Reduces each band to its bounding span and merges neighbouring bands
+// into their bounding rectangle until at most maxRects are left.
+static void mergeBoundingBands(BandList *list, int maxRects)
+{
+    const int count = list->bands.size();
+    QVector<QRect> rects(count);
+    for (int i = 0; i < count; ++i) {
+        const Band &band = list->bands.at(i);
+        const int left = list->spans.at(band.first).left;
+        const int right = list->spans.at(band.first + band.count - 1).right;
+        rects[i] = QRect(left, band.top, right - left, band.bottom - band.top);
+    }
+
+    QVector<int> next(count);
+    QVector<int> previous(count);
+    QVector<int> version(count, 0);
+    for (int i = 0; i < count; ++i) {
+        next[i] = i + 1 < count ? i + 1 : -1;
+        previous[i] = i - 1;
+    }
+
+    auto area = [](const QRect &rect) { return qint64(rect.width()) * rect.height(); };
+    struct Merge
+    {
+        qint64 cost;
+        int first;
+        int version;
+        bool operator>(const Merge &other) const
+        {
+            return cost > other.cost || (cost == other.cost && first > other.first);
+        }
+    };
+    std::priority_queue<Merge, std::vector<Merge>, std::greater<Merge> > queue;
+    auto push = [&](int i) {
+        if (i < 0 || next[i] < 0)
+            return;
+        const QRect &a = rects.at(i);
+        const QRect &b = rects.at(next[i]);
+        queue.push({area(a | b) - area(a) - area(b), i, ++version[i]});
+    };
+    for (int i = 0; i < count; ++i)
+        push(i);
+
+    int remaining = count;
+    while (remaining > maxRects && !queue.empty()) {
+        const Merge merge = queue.top();
+        queue.pop();
+        const int i = merge.first;
+        if (merge.version != version[i] || next[i] < 0)
+            continue; // stale
+        const int j = next[i];
+        rects[i] |= rects.at(j);
+        next[i] = next[j];
+        if (next[j] >= 0)
+            previous[next[j]] = i;
+        version[j] = -1;
+        --remaining;
+        push(i);
+        push(previous[i]);
+    }
+
+    BandList merged;
+    for (int i = 0; i >= 0 && count > 0; i = next[i]) {
+        const QRect &rect = rects.at(i);
+        merged.bands.append({rect.top(), rect.top() + rect.height(), merged.spans.size(), 1});
+        merged.spans.append({rect.left(), rect.left() + rect.width()});
+    }
+    *list = merged;
+}
+
+QRegion QWinRegionData::simplified(const QRegion &region, int maxRects, int tolerance)
+{
+    if (region.isEmpty())
+        return QRegion();
+    tolerance = qMax(tolerance, 0);
+    const bool limited = maxRects > 0;
+    if (tolerance == 0 && (!limited || region.rectCount() <= maxRects))
+        return region;
+
+    BandList list = bandsFromRegion(region);
+    if (tolerance > 0) {
+        closeGaps(&list, tolerance);
+        mergeBands(&list, tolerance);
+    }
+    if (limited && list.rectCount() > maxRects) {
+        closeCheapestGaps(&list, list.rectCount() - maxRects);
+        mergeBands(&list, 0);
+    }
+    if (limited && list.rectCount() > maxRects)
+        mergeBoundingBands(&list, maxRects);
+    return regionFromBands(list);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,129 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINREGIONDATA_P_H
+#define QWINREGIONDATA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qwinpixelconversion_p.h"
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qregion.h>
+
+QT_BEGIN_NAMESPACE
+
+// Layout of RGNDATAHEADER and RECT from wingdi.h, so that region data can be
+// produced and parsed without windows.h.
+struct QWinRect
+{
+    qint32 left;
+    qint32 top;
+    qint32 right;
+    qint32 bottom;
+};
+
+struct QWinRegionDataHeader
+{
+    quint32 dwSize;
+    quint32 iType;
+    quint32 nCount;
+    quint32 nRgnSize;
+    QWinRect rcBound;
+};
+
+Q_STATIC_ASSERT(sizeof(QWinRect) == 16);
+Q_STATIC_ASSERT(sizeof(QWinRegionDataHeader) == 32);
+
+// Converts between QRegion and RGNDATA buffers as taken by ExtCreateRegion()
+// and returned by GetRegionData(). Both keep their rectangles y-x banded, so
+// the rectangles are copied in one go in either direction.
+namespace QWinRegionData
+{
+    enum { RdhRectangles = 1 }; // RDH_RECTANGLES
+
+    // Returns a header followed by the rectangles of region.
+    QByteArray encode(const QRegion &region);
+
+    // Returns the region described by data, or an empty region if data is
+    // not valid RGNDATA. Rectangles that are not y-x banded are accepted but
+    // take the slow path of uniting them one by one.
+    QRegion decode(const void *data, qsizetype size);
+    inline QRegion decode(const QByteArray &data) { return decode(data.constData(), data.size()); }
+
+    // Returns a header followed by rects, which must be banded.
+    QByteArray encode(const QRect *rects, int count);
+
+    // Whether rects satisfy the requirements of QRegion::setRects().
+    bool isBanded(const QRect *rects, int count);
+
+    // Returns the banded rectangles covering the pixels of image whose alpha
+    // is at least threshold, as QImage::createAlphaMask() with the default
+    // threshold of 128 would select them. Rows are converted to opaque mask
+    // bits by the QWinPixelConversion kernels; runs of set bits are found a
+    // 64 bit word at a time, and identical consecutive rows form one band.
+    QVector<QRect> rectsFromAlpha(const QImage &image, int threshold = 128);
+    QVector<QRect> rectsFromAlpha(const QImage &image, int threshold,
+                                  QWinPixelConversion::Implementation implementation);
+    QRegion regionFromAlpha(const QImage &image, int threshold = 128);
+    QByteArray regionDataFromAlpha(const QImage &image, int threshold = 128);
+
+    // Returns a region that contains region and consists of at most maxRects
+    // rectangles (no limit if maxRects <= 0). Gaps of up to tolerance pixels
+    // between rectangles are filled, and bands whose edges differ by at most
+    // tolerance are merged. When that is not enough, the cheapest gaps are
+    // closed, and finally neighbouring bands are merged into their bounding
+    // rectangles, always picking the merge that adds the least area.
+    QRegion simplified(const QRegion &region, int maxRects, int tolerance = 0);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINREGIONDATA_P_H
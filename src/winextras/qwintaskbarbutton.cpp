@@ -43,7 +43,9 @@
 #include "qwintaskbarprogress.h"
 #include "qwinfunctions.h"
 #include "qwinfunctions_p.h"
+#include "qwincomfailurereporter_p.h"
 #include "qwineventfilter_p.h"
+#include "qwiniconpyramid_p.h"
 #include "qwinevent.h"
 #include "winshobjidl_p.h"
 #include "windowsguidsdefs_p.h"
@@ -105,13 +107,11 @@ QWinTaskbarButtonPrivate::QWinTaskbarButtonPrivate() : progressBar(0), pTbList(0
     HRESULT hresult = CoCreateInstance(CLSID_TaskbarList, 0, CLSCTX_INPROC_SERVER, qIID_ITaskbarList4, reinterpret_cast<void **>(&pTbList));
     if (FAILED(hresult)) {
         pTbList = 0;
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinTaskbarButton: qIID_ITaskbarList4 was not created: %#010x, %s.", unsigned(hresult), qPrintable(err));
-    } else if (FAILED(pTbList->HrInit())) {
+        warning("CoCreateInstance(ITaskbarList4)", hresult);
+    } else if (FAILED(hresult = pTbList->HrInit())) {
         pTbList->Release();
         pTbList = 0;
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinTaskbarButton: qIID_ITaskbarList4 was not initialized: %#010x, %s.", unsigned(hresult), qPrintable(err));
+        warning("ITaskbarList4::HrInit()", hresult);
     }
 }
 
@@ -121,6 +121,11 @@ QWinTaskbarButtonPrivate::~QWinTaskbarButtonPrivate()
         pTbList->Release();
 }
 
+void QWinTaskbarButtonPrivate::warning(const char *function, HRESULT hresult)
+{
+    QWinComFailureReporter::instance()->report("QWinTaskbarButton", function, quint32(hresult));
+}
+
 HWND QWinTaskbarButtonPrivate::handle()
 {
     return reinterpret_cast<HWND>(window->winId());
@@ -141,14 +146,17 @@ void QWinTaskbarButtonPrivate::updateOverlayIcon()
     if (!overlayAccessibleDescription.isEmpty())
         descrPtr = qt_qstringToNullTerminated(overlayAccessibleDescription);
     if (!overlayIcon.isNull())
-        hicon = QtWin::toHICON(overlayIcon.pixmap(iconSize()));
+        hicon = QtWin::toHICON(QWinIconPyramid::cachedPixmap(overlayIcon, iconSize()));
 
+    HRESULT hresult;
     if (hicon)
-        pTbList->SetOverlayIcon(handle(), hicon, descrPtr);
+        hresult = pTbList->SetOverlayIcon(handle(), hicon, descrPtr);
     else if (!hicon && !overlayIcon.isNull())
-        pTbList->SetOverlayIcon(handle(), static_cast<HICON>(LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED)), descrPtr);
+        hresult = pTbList->SetOverlayIcon(handle(), static_cast<HICON>(LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED)), descrPtr);
     else
-        pTbList->SetOverlayIcon(handle(), NULL, descrPtr);
+        hresult = pTbList->SetOverlayIcon(handle(), NULL, descrPtr);
+    if (FAILED(hresult))
+        warning("SetOverlayIcon()", hresult);
 
     if (hicon)
         DestroyIcon(hicon);
@@ -167,10 +175,14 @@ void QWinTaskbarButtonPrivate::_q_updateProgress()
         const int range = max - min;
         if (range > 0) {
             const int value = qRound(double(100) * (double(progressBar->value() - min)) / double(range));
-            pTbList->SetProgressValue(handle(), ULONGLONG(value), 100);
+            const HRESULT hresult = pTbList->SetProgressValue(handle(), ULONGLONG(value), 100);
+            if (FAILED(hresult))
+                warning("SetProgressValue()", hresult);
         }
     }
-    pTbList->SetProgressState(handle(), nativeProgressState(progressBar));
+    const HRESULT hresult = pTbList->SetProgressState(handle(), nativeProgressState(progressBar));
+    if (FAILED(hresult))
+        warning("SetProgressState()", hresult);
 }
 
 /*!
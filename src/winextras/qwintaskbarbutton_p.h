@@ -69,6 +69,8 @@ public:
     QWinTaskbarButtonPrivate();
     ~QWinTaskbarButtonPrivate();
 
+    static void warning(const char *function, HRESULT hresult);
+
     QPointer<QWinTaskbarProgress> progressBar;
     QIcon overlayIcon;
     QString overlayAccessibleDescription;
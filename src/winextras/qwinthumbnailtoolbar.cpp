@@ -60,7 +60,9 @@
 #include "qwinevent.h"
 #include "qwinfunctions.h"
 #include "qwinfunctions_p.h"
+#include "qwincomfailurereporter_p.h"
 #include "qwineventfilter_p.h"
+#include "qwiniconpyramid_p.h"
 
 #ifndef THBN_CLICKED
 #  define THBN_CLICKED 0x1800
@@ -245,7 +247,7 @@ void QWinThumbnailToolBarPrivate::updateIconicPixmapsEnabled(bool invalidate)
     if (enabled && invalidate) {
         const HRESULT hr = DwmInvalidateIconicBitmaps(hwnd);
         if (FAILED(hr))
-            qWarning() << QWinThumbnailToolBarPrivate::msgComFailed("DwmInvalidateIconicBitmaps", hr);
+            QWinThumbnailToolBarPrivate::warning("DwmInvalidateIconicBitmaps()", hr);
     }
 }
 
@@ -272,6 +274,7 @@ bool QWinThumbnailToolBarPrivate::IconicPixmapCache::setPixmap(const QPixmap &pi
         return false;
     deleteBitmap();
     m_pixmap = pixmap;
+    m_pyramid = QWinIconPyramid();
     return true;
 }
 
@@ -282,9 +285,11 @@ HBITMAP QWinThumbnailToolBarPrivate::IconicPixmapCache::bitmap(const QSize &maxS
     if (m_bitmap && m_size.width() <= maxSize.width() && m_size.height() <= maxSize.height())
         return m_bitmap;
     deleteBitmap();
-    QPixmap pixmap = m_pixmap;
-    if (pixmap.width() >= maxSize.width() || pixmap.height() >= maxSize.width())
-        pixmap = pixmap.scaled(maxSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    // DWM asks again whenever the thumbnail size changes; the pyramid keeps
+    // the halvings of the pixmap around for that.
+    if (m_pyramid.isNull())
+        m_pyramid = QWinIconPyramid(m_pixmap.toImage());
+    const QPixmap pixmap = QPixmap::fromImage(m_pyramid.image(maxSize));
     if (const HBITMAP bitmap = QtWin::toHBITMAP(pixmap, QtWin::HBitmapAlpha)) {
         m_size = pixmap.size();
         m_bitmap = bitmap;
@@ -395,7 +400,7 @@ inline void QWinThumbnailToolBarPrivate::updateIconicThumbnail(const MSG *messag
     if (const HBITMAP bitmap = iconicThumbnail.bitmap(maxSize)) {
         const HRESULT hr = DwmSetIconicThumbnail(message->hwnd, bitmap, dWM_SIT_DISPLAYFRAME);
         if (FAILED(hr))
-            qWarning() << QWinThumbnailToolBarPrivate::msgComFailed("DwmSetIconicThumbnail", hr);
+            QWinThumbnailToolBarPrivate::warning("DwmSetIconicThumbnail()", hr);
     }
 }
 
@@ -410,7 +415,7 @@ inline void QWinThumbnailToolBarPrivate::updateIconicLivePreview(const MSG *mess
     if (const HBITMAP bitmap = iconicLivePreview.bitmap(maxSize)) {
         const HRESULT hr = DwmSetIconicLivePreviewBitmap(message->hwnd, bitmap, &offset, dWM_SIT_DISPLAYFRAME);
         if (FAILED(hr))
-            qWarning() << QWinThumbnailToolBarPrivate::msgComFailed("DwmSetIconicLivePreviewBitmap", hr);
+            QWinThumbnailToolBarPrivate::warning("DwmSetIconicLivePreviewBitmap()", hr);
     }
 }
 
@@ -427,17 +432,13 @@ static inline ITaskbarList4 *createTaskbarList()
     ITaskbarList4 *result = 0;
     HRESULT hresult = CoCreateInstance(CLSID_TaskbarList, 0, CLSCTX_INPROC_SERVER, qIID_ITaskbarList4, reinterpret_cast<void **>(&result));
     if (FAILED(hresult)) {
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinThumbnailToolBar: qIID_ITaskbarList4 was not created: %#010x, %s.",
-                 unsigned(hresult), qPrintable(err));
+        QWinThumbnailToolBarPrivate::warning("CoCreateInstance(ITaskbarList4)", hresult);
         return 0;
     }
     hresult = result->HrInit();
     if (FAILED(hresult)) {
         result->Release();
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinThumbnailToolBar: qIID_ITaskbarList4 was not initialized: %#010x, %s.",
-                 unsigned(hresult), qPrintable(err));
+        QWinThumbnailToolBarPrivate::warning("ITaskbarList4::HrInit()", hresult);
         return 0;
     }
     return result;
@@ -476,7 +477,7 @@ void QWinThumbnailToolBarPrivate::initToolbar()
     initButtons(buttons);
     HRESULT hresult = pTbList->ThumbBarAddButtons(handle(), windowsLimitedThumbbarSize, buttons);
     if (FAILED(hresult))
-        qWarning() << msgComFailed("ThumbBarAddButtons", hresult);
+        QWinThumbnailToolBarPrivate::warning("ThumbBarAddButtons()", hresult);
 }
 
 void QWinThumbnailToolBarPrivate::clearToolbar()
@@ -487,7 +488,7 @@ void QWinThumbnailToolBarPrivate::clearToolbar()
     initButtons(buttons);
     HRESULT hresult = pTbList->ThumbBarUpdateButtons(handle(), windowsLimitedThumbbarSize, buttons);
     if (FAILED(hresult))
-        qWarning() << msgComFailed("ThumbBarUpdateButtons", hresult);
+        QWinThumbnailToolBarPrivate::warning("ThumbBarUpdateButtons()", hresult);
 }
 
 void QWinThumbnailToolBarPrivate::_q_updateToolbar()
@@ -505,7 +506,7 @@ void QWinThumbnailToolBarPrivate::_q_updateToolbar()
         buttons[i].dwFlags = static_cast<THUMBBUTTONFLAGS>(makeNativeButtonFlags(button));
         buttons[i].dwMask  = static_cast<THUMBBUTTONMASK>(makeButtonMask(button));
         if (!button->icon().isNull()) {;
-            buttons[i].hIcon = QtWin::toHICON(button->icon().pixmap(GetSystemMetrics(SM_CXSMICON)));
+            buttons[i].hIcon = QtWin::toHICON(QWinIconPyramid::cachedPixmap(button->icon(), GetSystemMetrics(SM_CXSMICON)));
             if (!buttons[i].hIcon)
                 buttons[i].hIcon = static_cast<HICON>(LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED));
             else
@@ -517,7 +518,7 @@ void QWinThumbnailToolBarPrivate::_q_updateToolbar()
     }
     HRESULT hresult = pTbList->ThumbBarUpdateButtons(handle(), windowsLimitedThumbbarSize, buttons);
     if (FAILED(hresult))
-        qWarning() << msgComFailed("ThumbBarUpdateButtons", hresult);
+        QWinThumbnailToolBarPrivate::warning("ThumbBarUpdateButtons()", hresult);
     updateIconicPixmapsEnabled(false);
     for (int i = 0; i < windowsLimitedThumbbarSize; i++) {
         if (buttons[i].hIcon) {
@@ -616,12 +617,9 @@ int QWinThumbnailToolBarPrivate::makeButtonMask(const QWinThumbnailToolButton *b
     return mask;
 }
 
-QString QWinThumbnailToolBarPrivate::msgComFailed(const char *function, HRESULT hresult)
+void QWinThumbnailToolBarPrivate::warning(const char *function, HRESULT hresult)
 {
-    return QString::fromLatin1("QWinThumbnailToolBar: %1() failed: #%2: %3")
-            .arg(QLatin1String(function))
-            .arg(unsigned(hresult), 10, 16, QLatin1Char('0'))
-            .arg(QtWin::errorStringFromHresult(hresult));
+    QWinComFailureReporter::instance()->report("QWinThumbnailToolBar", function, quint32(hresult));
 }
 
 QT_END_NAMESPACE
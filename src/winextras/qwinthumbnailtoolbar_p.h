@@ -60,6 +60,7 @@
 #include <QtCore/QAbstractNativeEventFilter>
 
 #include "winshobjidl_p.h"
+#include "qwiniconpyramid_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -83,6 +84,7 @@ public:
         void deleteBitmap();
 
         QPixmap m_pixmap;
+        QWinIconPyramid m_pyramid;
         QSize m_size;
         HBITMAP m_bitmap;
     };
@@ -100,7 +102,7 @@ public:
     static void initButtons(THUMBBUTTON *buttons);
     static int makeNativeButtonFlags(const QWinThumbnailToolButton *button);
     static int makeButtonMask(const QWinThumbnailToolButton *button);
-    static QString msgComFailed(const char *function, HRESULT hresult);
+    static void warning(const char *function, HRESULT hresult);
 
     bool updateScheduled;
     QList<QWinThumbnailToolButton *> buttonList;
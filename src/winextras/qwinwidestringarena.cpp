@@ -0,0 +1,125 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinwidestringarena_p.h"
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+static const QChar emptyString[1] = { QChar() };
+
+QWinWideStringArena::QWinWideStringArena(int chunkSize) :
+    m_chunkSize(qMax(chunkSize, 1))
+{
+}
+
+QWinWideStringArena::~QWinWideStringArena()
+{
+    for (QChar *chunk : qAsConst(m_retired))
+        delete[] chunk;
+    delete[] m_chunk;
+}
+
+QChar *QWinWideStringArena::allocate(int size)
+{
+    Q_ASSERT(size >= 0);
+    if (m_chunkCapacity - m_used < size + 1)
+        grow(size + 1);
+    QChar *result = m_chunk + m_used;
+    m_used += size + 1;
+    result[size] = QChar();
+    return result;
+}
+
+// The current chunk is kept until reset(), since strings in it are in use.
+void QWinWideStringArena::grow(int size)
+{
+    if (m_chunk) {
+        m_retired.append(m_chunk);
+        m_retiredCapacity += m_chunkCapacity;
+    }
+    m_chunkCapacity = qMax(m_chunkSize, size);
+    m_chunk = new QChar[m_chunkCapacity];
+    m_used = 0;
+}
+
+const QChar *QWinWideStringArena::string(const QString &string)
+{
+    if (string.isEmpty())
+        return emptyString;
+    // Allocated string data is always zero-terminated, unlike raw data
+    // and literals, which have no capacity.
+    if (string.capacity() >= string.size())
+        return string.constData();
+    QChar *result = allocate(string.size());
+    memcpy(result, string.constData(), size_t(string.size()) * sizeof(QChar));
+    return result;
+}
+
+const QChar *QWinWideStringArena::nativePath(const QString &path)
+{
+    QChar *result = allocate(path.size());
+    const QChar *in = path.constData();
+    for (int i = 0; i < path.size(); ++i)
+        result[i] = in[i] == QLatin1Char('/') ? QLatin1Char('\\') : in[i];
+    return result;
+}
+
+void QWinWideStringArena::reset()
+{
+    if (!m_retired.isEmpty()) {
+        const int capacity = m_retiredCapacity + m_chunkCapacity;
+        for (QChar *chunk : qAsConst(m_retired))
+            delete[] chunk;
+        m_retired.clear();
+        m_retiredCapacity = 0;
+        delete[] m_chunk;
+        m_chunkCapacity = capacity;
+        m_chunk = new QChar[m_chunkCapacity];
+    }
+    m_used = 0;
+}
+
+int QWinWideStringArena::capacity() const
+{
+    return m_retiredCapacity + m_chunkCapacity;
+}
+
+QT_END_NAMESPACE
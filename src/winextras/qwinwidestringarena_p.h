@@ -0,0 +1,103 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINWIDESTRINGARENA_P_H
+#define QWINWIDESTRINGARENA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Zero-terminated UTF-16 strings that live until the next reset(), for
+// handing many short strings to the shell during one commit. Strings are
+// bump-allocated from a chunk; when a commit needed several chunks, reset()
+// merges them into one, so that a steady sequence of commits stops
+// allocating after the first. QString data that is already zero-terminated
+// is returned as is.
+// Not thread-safe.
+class QWinWideStringArena
+{
+public:
+    enum { DefaultChunkSize = 4096 }; // characters
+
+    explicit QWinWideStringArena(int chunkSize = DefaultChunkSize);
+    ~QWinWideStringArena();
+
+    // Returns size + 1 characters, the last one set to zero.
+    QChar *allocate(int size);
+
+    // Valid until reset() or until string is modified or destroyed.
+    const QChar *string(const QString &string);
+    // Copies, replacing '/' by '\\'.
+    const QChar *nativePath(const QString &path);
+
+    void reset();
+
+    int capacity() const;
+    int used() const { return m_used; }
+    int chunkCount() const { return m_retired.size() + (m_chunk ? 1 : 0); }
+
+private:
+    Q_DISABLE_COPY(QWinWideStringArena)
+
+    void grow(int size);
+
+    int m_chunkSize;
+    QChar *m_chunk = nullptr;
+    int m_chunkCapacity = 0;
+    int m_used = 0;
+    int m_retiredCapacity = 0;
+    QVector<QChar *> m_retired;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINWIDESTRINGARENA_P_H
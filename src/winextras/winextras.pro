@@ -4,6 +4,8 @@ QT += gui-private core-private
 
 DEFINES += QT_NO_FOREACH
 
+CONFIG += simd
+
 SOURCES += \
     qwinfunctions.cpp \
     qwintaskbarbutton.cpp \
@@ -16,7 +18,32 @@ SOURCES += \
     qwinthumbnailtoolbar.cpp \
     qwinthumbnailtoolbutton.cpp \
     qwinevent.cpp \
-    qwinmime.cpp
+    qwinmime.cpp \
+    qwinpixelconversion.cpp \
+    qwindibsection.cpp \
+    qwiniconconversion.cpp \
+    qwiniconpyramid.cpp \
+    qwinicowriter.cpp \
+    qwiniconfilecache.cpp \
+    qwinregiondata.cpp \
+    qwinhresultnames.cpp \
+    qwinhresultmessagecache.cpp \
+    qwinhresultinfo.cpp \
+    qwincomfailurereporter.cpp \
+    qwinjumplistsnapshot.cpp \
+    qwinrebuildscheduler.cpp \
+    qwinjumplistcommitter.cpp \
+    qwincommandline.cpp \
+    qwinwidestringarena.cpp \
+    qwinjumplistserializer.cpp \
+    qwindocumentlist.cpp \
+    qwinrecentdocumentsubmitter.cpp \
+    qwinjumpliststate.cpp \
+    qwinjumplistpruner.cpp \
+    qwinjumplistmodelmapper.cpp
+
+AVX2_SOURCES += \
+    qwinpixelconversion_avx2.cpp
 
 HEADERS += \
     qwinfunctions.h \
@@ -40,7 +67,30 @@ HEADERS += \
     qwinthumbnailtoolbutton_p.h \
     qwinevent.h \
     windowsguidsdefs_p.h \
-    qwinmime.h
+    qwinmime.h \
+    qwinhresultinfo.h \
+    qwinpixelconversion_p.h \
+    qwindibsection_p.h \
+    qwiniconconversion_p.h \
+    qwiniconpyramid_p.h \
+    qwinicowriter_p.h \
+    qwiniconfilecache_p.h \
+    qwinregiondata_p.h \
+    qwinhresultnames_p.h \
+    qwinhresultnames_data_p.h \
+    qwinhresultmessagecache_p.h \
+    qwincomfailurereporter_p.h \
+    qwinjumplistsnapshot_p.h \
+    qwinrebuildscheduler_p.h \
+    qwinjumplistcommitter_p.h \
+    qwincommandline_p.h \
+    qwinwidestringarena_p.h \
+    qwinjumplistserializer_p.h \
+    qwindocumentlist_p.h \
+    qwinrecentdocumentsubmitter_p.h \
+    qwinjumpliststate_p.h \
+    qwinjumplistpruner_p.h \
+    qwinjumplistmodelmapper_p.h
 
 QMAKE_DOCS = $$PWD/doc/qtwinextras.qdocconf
 
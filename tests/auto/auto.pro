@@ -1,5 +1,31 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    qwinpixelconversion \
+    qwindibsection \
+    qwiniconconversion \
+    qwiniconpyramid \
+    qwinicowriter \
+    qwiniconfilecache \
+    qwinregiondata \
+    qwinhresultnames \
+    qwinhresultmessagecache \
+    qwinhresultinfo \
+    qwincomfailurereporter \
+    qwinjumplistsnapshot \
+    qwinrebuildscheduler \
+    qwinjumplistcommitter \
+    qwincommandline \
+    qwinwidestringarena \
+    qwinjumplistserializer \
+    qwindocumentlist \
+    qwinrecentdocumentsubmitter \
+    qwinjumpliststate \
+    qwinjumplistpruner \
+    qwinjumplistmodelmapper
+
+qtHaveModule(qml): SUBDIRS += qquickjumplist
+
+win32: SUBDIRS += \
     cmake \
     qwinthumbnailtoolbar \
     qpixmap \
@@ -52,6 +52,9 @@ private slots:
     void toHICON();
     void fromHICON_data();
     void fromHICON();
+    void toHICONs();
+    void fromHICONs_data();
+    void fromHICONs();
 
 private:
     const QString m_dataDirectory;
@@ -279,6 +282,128 @@ void tst_QPixmap::fromHICON()
     QVERIFY2(compareImages(imageFromHICON, imageFromFile, &errorMessage), errorMessage.constData());
 }
 
+void tst_QPixmap::toHICONs()
+{
+    QVector<QPixmap> pixmaps;
+    QVector<QImage> imagesFromFile;
+    QVector<QSize> sizes;
+    sizes << QSize(16, 16) << QSize(32, 32) << QSize(48, 48) << QSize(256, 256);
+    for (const QSize &size : qAsConst(sizes)) {
+        const QString imageFileName = pngFileName(m_dataDirectory + QStringLiteral("/icon_32bpp"),
+                                                  size.width(), size.height());
+        const QImage imageFromFile = QImage(imageFileName).convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        QVERIFY2(!imageFromFile.isNull(), qPrintable(imageFileName));
+        pixmaps << QPixmap::fromImage(imageFromFile) << QPixmap();
+        imagesFromFile << imageFromFile << QImage();
+    }
+
+    const QVector<HICON> icons = QtWin::toHICONs(pixmaps);
+    QCOMPARE(icons.size(), pixmaps.size());
+    for (int i = 0; i < icons.size(); ++i) {
+        if (pixmaps.at(i).isNull()) {
+            QVERIFY(!icons.at(i));
+            continue;
+        }
+        QVERIFY(icons.at(i));
+        const QImage imageFromHICON = QtWin::fromHICON(icons.at(i)).toImage();
+        DestroyIcon(icons.at(i));
+        QByteArray errorMessage;
+        QVERIFY2(compareImages(imageFromHICON, imagesFromFile.at(i), &errorMessage), errorMessage.constData());
+    }
+}
+
+// An icon or cursor without alpha channel: a 24 bpp color bitmap and an AND
+// mask with a transparent diagonal band.
+static HICON createMaskedIcon(int size, bool icon, int xHotspot, int yHotspot)
+{
+    BITMAPINFO bmi;
+    memset(&bmi, 0, sizeof(bmi));
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = size;
+    bmi.bmiHeader.biHeight = -size;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 24;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    uchar *bits = nullptr;
+    const HBITMAP color = CreateDIBSection(0, &bmi, DIB_RGB_COLORS, reinterpret_cast<void **>(&bits), 0, 0);
+    if (!color)
+        return 0;
+
+    const int bytesPerLine = (size * 3 + 3) & ~3;
+    const int maskBytesPerLine = (size + 15) / 16 * 2;
+    QByteArray mask(maskBytesPerLine * size, 0);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            uchar *pixel = bits + y * bytesPerLine + x * 3;
+            if (qAbs(x - y) < size / 4) {
+                mask[y * maskBytesPerLine + x / 8] = char(mask.at(y * maskBytesPerLine + x / 8) | (0x80 >> (x & 7)));
+                pixel[0] = pixel[1] = pixel[2] = 0;
+            } else {
+                pixel[0] = uchar(x * 255 / size);
+                pixel[1] = uchar(y * 255 / size);
+                pixel[2] = 0x80;
+            }
+        }
+    }
+    GdiFlush();
+    const HBITMAP maskBitmap = CreateBitmap(size, size, 1, 1, mask.constData());
+
+    ICONINFO iconInfo;
+    iconInfo.fIcon = icon;
+    iconInfo.xHotspot = DWORD(xHotspot);
+    iconInfo.yHotspot = DWORD(yHotspot);
+    iconInfo.hbmMask = maskBitmap;
+    iconInfo.hbmColor = color;
+    const HICON result = maskBitmap ? CreateIconIndirect(&iconInfo) : 0;
+    if (maskBitmap)
+        DeleteObject(maskBitmap);
+    DeleteObject(color);
+    return result;
+}
+
+void tst_QPixmap::fromHICONs_data()
+{
+    QTest::addColumn<QString>("iconFile");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<bool>("isIcon");
+    QTest::addColumn<QSize>("hotspot");
+
+    QTest::newRow("32bpp_alpha_32x32") << m_dataDirectory + QStringLiteral("/icon_32bpp.ico") << 32 << true << QSize();
+    QTest::newRow("32bpp_alpha_256x256") << m_dataDirectory + QStringLiteral("/icon_32bpp.ico") << 256 << true << QSize();
+    QTest::newRow("8bpp_48x48") << m_dataDirectory + QStringLiteral("/icon_8bpp.ico") << 48 << true << QSize();
+    QTest::newRow("24bpp_mask_32x32") << QString() << 32 << true << QSize();
+    // The size of a cursor is taken from its hotspot, as for a single one.
+    QTest::newRow("cursor_32x32") << QString() << 32 << false << QSize(5, 20);
+}
+
+void tst_QPixmap::fromHICONs()
+{
+    QFETCH(QString, iconFile);
+    QFETCH(int, size);
+    QFETCH(bool, isIcon);
+    QFETCH(QSize, hotspot);
+
+    const HICON icon = iconFile.isEmpty()
+        ? createMaskedIcon(size, isIcon, hotspot.width(), hotspot.height())
+        : static_cast<HICON>(LoadImage(0, reinterpret_cast<const wchar_t *>(iconFile.utf16()),
+                                       IMAGE_ICON, size, size, LR_LOADFROMFILE));
+    QVERIFY(icon);
+
+    // Invalid handles yield null pixmaps without affecting the others.
+    QVector<HICON> icons;
+    icons << icon << HICON(0) << icon;
+    const QVector<QPixmap> pixmaps = QtWin::fromHICONs(icons);
+    const QImage expected = QtWin::fromHICON(icon).toImage();
+    DestroyIcon(icon);
+
+    QCOMPARE(pixmaps.size(), icons.size());
+    QVERIFY(pixmaps.at(1).isNull());
+    if (!isIcon)
+        QCOMPARE(expected.size(), hotspot * 2);
+    QCOMPARE(pixmaps.at(0).toImage(), expected);
+    QCOMPARE(pixmaps.at(2).toImage(), expected);
+}
+
 QTEST_MAIN(tst_QPixmap)
 
 #include "tst_qpixmap.moc"
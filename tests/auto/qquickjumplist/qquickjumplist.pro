@@ -0,0 +1,6 @@
+CONFIG += testcase
+TARGET = tst_qquickjumplist
+QT = core gui qml testlib
+include(../../shared/winextras-imports.pri)
+SOURCES += \
+    tst_qquickjumplist.cpp
@@ -0,0 +1,271 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/QStandardItemModel>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlContext>
+#include <QtQml/QQmlEngine>
+
+#include "standinjumplistbackend.h"
+
+class tst_QQuickJumpList : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void attachedOnCompletion();
+    void oneToOne();
+    void itemProperty();
+    void categoryProperties();
+    void knownCategories();
+    void replaceTasks();
+    void categoryModel();
+
+private:
+    QObject *create(const QByteArray &qml, QQmlComponent *component = nullptr);
+
+    QQmlEngine m_engine;
+};
+
+static const char jumpListQml[] =
+    "import QtWinExtras 1.0\n"
+    "JumpList {\n"
+    "    tasks: JumpListCategory {\n"
+    "        JumpListLink { objectName: 'task'; title: 'Task'; executablePath: 'app.exe'; arguments: '--task';"
+    "                       description: 'A task'; iconPath: 'task.ico' }\n"
+    "        JumpListSeparator { }\n"
+    "    }\n"
+    "    JumpListCategory {\n"
+    "        objectName: 'documents'\n"
+    "        title: 'Documents'\n"
+    "        JumpListDestination { filePath: 'C:/a.txt' }\n"
+    "        JumpListDestination { objectName: 'b'; filePath: 'C:/b.txt' }\n"
+    "    }\n"
+    "    JumpListCategory {\n"
+    "        title: 'Hidden'\n"
+    "        visible: false\n"
+    "        JumpListLink { title: 'Link'; executablePath: 'app.exe' }\n"
+    "    }\n"
+    "}\n";
+
+void tst_QQuickJumpList::initTestCase()
+{
+    StandInJumpListBackend::registerTypes();
+}
+
+QObject *tst_QQuickJumpList::create(const QByteArray &qml, QQmlComponent *component)
+{
+    QQmlComponent local(&m_engine);
+    if (!component)
+        component = &local;
+    component->setData(qml, QUrl());
+    QObject *object = component->create();
+    if (!object)
+        qWarning() << component->errors();
+    return object;
+}
+
+void tst_QQuickJumpList::attachedOnCompletion()
+{
+    QQmlComponent component(&m_engine);
+    component.setData(jumpListQml, QUrl());
+    QObject *object = component.beginCreate(m_engine.rootContext());
+    QVERIFY(object);
+    QVERIFY(!StandInJumpListBackend::instance);
+    component.completeCreate();
+    QVERIFY(StandInJumpListBackend::instance);
+    delete object;
+    QVERIFY(!StandInJumpListBackend::instance);
+}
+
+void tst_QQuickJumpList::oneToOne()
+{
+    QScopedPointer<QObject> object(create(jumpListQml));
+    QVERIFY(object);
+    StandInJumpListBackend *backend = StandInJumpListBackend::instance;
+    QVERIFY(backend);
+
+    QVERIFY(backend->tasks()->visible);
+    const QVector<StandInJumpListBackend::Item *> &tasks = backend->tasks()->items;
+    QCOMPARE(tasks.size(), 2);
+    QCOMPARE(tasks.at(0)->type, QQuickJumpListBackend::Link);
+    QCOMPARE(tasks.at(0)->title, QStringLiteral("Task"));
+    QCOMPARE(tasks.at(0)->filePath, QStringLiteral("app.exe"));
+    QCOMPARE(tasks.at(0)->arguments, QStringList(QStringLiteral("--task")));
+    QCOMPARE(tasks.at(0)->description, QStringLiteral("A task"));
+    QCOMPARE(tasks.at(0)->iconPath, QStringLiteral("task.ico"));
+    QCOMPARE(tasks.at(1)->type, QQuickJumpListBackend::Separator);
+    QCOMPARE(tasks.at(1)->updates, 0);
+
+    QCOMPARE(backend->categories.size(), 2);
+    const StandInJumpListBackend::Category *documents = backend->categories.at(0);
+    QCOMPARE(documents->title, QStringLiteral("Documents"));
+    QVERIFY(documents->visible);
+    QCOMPARE(documents->items.size(), 2);
+    QCOMPARE(documents->items.at(0)->type, QQuickJumpListBackend::Destination);
+    QCOMPARE(documents->items.at(1)->filePath, QStringLiteral("C:/b.txt"));
+    QCOMPARE(documents->items.at(1)->updates, 1);
+    QCOMPARE(backend->categories.at(1)->title, QStringLiteral("Hidden"));
+    QVERIFY(!backend->categories.at(1)->visible);
+    QCOMPARE(backend->categories.at(1)->items.size(), 1);
+}
+
+void tst_QQuickJumpList::itemProperty()
+{
+    QScopedPointer<QObject> object(create(jumpListQml));
+    QVERIFY(object);
+    StandInJumpListBackend *backend = StandInJumpListBackend::instance;
+    const int updates = backend->updates;
+
+    QObject *task = object->findChild<QObject *>(QStringLiteral("task"));
+    QVERIFY(task);
+    StandInJumpListBackend::Item *item = backend->tasks()->items.at(0);
+    const int itemUpdates = item->updates;
+    task->setProperty("title", QStringLiteral("Renamed"));
+    QCOMPARE(item->title, QStringLiteral("Renamed"));
+    QCOMPARE(item->description, QStringLiteral("A task"));
+    QCOMPARE(item->updates, itemUpdates + 1);
+    QCOMPARE(backend->updates, updates + 1);
+
+    QObject *destination = object->findChild<QObject *>(QStringLiteral("b"));
+    QVERIFY(destination);
+    destination->setProperty("filePath", QStringLiteral("C:/c.txt"));
+    QCOMPARE(backend->categories.at(0)->items.at(1)->filePath, QStringLiteral("C:/c.txt"));
+    QCOMPARE(backend->categories.at(0)->items.at(0)->filePath, QStringLiteral("C:/a.txt"));
+    QCOMPARE(backend->updates, updates + 2);
+}
+
+void tst_QQuickJumpList::categoryProperties()
+{
+    QScopedPointer<QObject> object(create(jumpListQml));
+    QVERIFY(object);
+    StandInJumpListBackend *backend = StandInJumpListBackend::instance;
+    const int updates = backend->updates;
+
+    QObject *documents = object->findChild<QObject *>(QStringLiteral("documents"));
+    QVERIFY(documents);
+    documents->setProperty("visible", false);
+    QVERIFY(!backend->categories.at(0)->visible);
+    documents->setProperty("title", QStringLiteral("Files"));
+    QCOMPARE(backend->categories.at(0)->title, QStringLiteral("Files"));
+    QCOMPARE(backend->updates, updates + 2);
+}
+
+void tst_QQuickJumpList::knownCategories()
+{
+    QScopedPointer<QObject> object(create("import QtWinExtras 1.0\n"
+                                          "JumpList { recent.visible: true }\n"));
+    QVERIFY(object);
+    StandInJumpListBackend *backend = StandInJumpListBackend::instance;
+    QVERIFY(backend->recent()->visible);
+    QVERIFY(!backend->frequent()->visible);
+
+    QObject *frequent = object->property("frequent").value<QObject *>();
+    QVERIFY(frequent);
+    frequent->setProperty("visible", true);
+    QVERIFY(backend->frequent()->visible);
+}
+
+void tst_QQuickJumpList::replaceTasks()
+{
+    QScopedPointer<QObject> object(create(jumpListQml));
+    QVERIFY(object);
+    StandInJumpListBackend *backend = StandInJumpListBackend::instance;
+
+    QQmlComponent component(&m_engine);
+    QObject *tasks = create("import QtWinExtras 1.0\n"
+                            "JumpListCategory { JumpListDestination { filePath: 'C:/d.txt' } }\n",
+                            &component);
+    QVERIFY(tasks);
+    object->setProperty("tasks", QVariant::fromValue(tasks));
+    QCOMPARE(backend->tasks()->clears, 1);
+    QCOMPARE(backend->tasks()->items.size(), 1);
+    QCOMPARE(backend->tasks()->items.at(0)->filePath, QStringLiteral("C:/d.txt"));
+
+    object->setProperty("tasks", QVariant::fromValue<QObject *>(nullptr));
+    QCOMPARE(backend->tasks()->clears, 2);
+    QVERIFY(!backend->tasks()->visible);
+}
+
+void tst_QQuickJumpList::categoryModel()
+{
+    QStandardItemModel model;
+    QHash<int, QByteArray> roleNames = model.roleNames();
+    roleNames.insert(Qt::UserRole, "filePath");
+    roleNames.insert(Qt::UserRole + 1, "arguments");
+    model.setItemRoleNames(roleNames);
+    m_engine.rootContext()->setContextProperty(QStringLiteral("documentModel"), &model);
+
+    // The model properties are new in 1.1.
+    QQmlComponent component(&m_engine);
+    component.setData("import QtWinExtras 1.0\n"
+                      "JumpListCategory { model: documentModel }\n", QUrl());
+    QVERIFY(component.isError());
+
+    QScopedPointer<QObject> object(create("import QtWinExtras 1.1\n"
+                                          "JumpList {\n"
+                                          "    JumpListCategory {\n"
+                                          "        objectName: 'documents'\n"
+                                          "        model: documentModel\n"
+                                          "        titleRole: 'display'\n"
+                                          "        JumpListDestination { filePath: 'C:/a.txt' }\n"
+                                          "    }\n"
+                                          "}\n"));
+    QVERIFY(object);
+    StandInJumpListBackend *backend = StandInJumpListBackend::instance;
+    QCOMPARE(backend->categories.size(), 1);
+    StandInJumpListBackend::Category *category = backend->categories.at(0);
+    QCOMPARE(category->model, &model);
+    QCOMPARE(category->roles, (QVector<int>{Qt::UserRole, Qt::DisplayRole, Qt::UserRole + 1, -1}));
+    QCOMPARE(category->items.size(), 1);
+
+    // Rows do not pass the model on again, they reach the backend through it.
+    const int modelUpdates = category->modelUpdates;
+    model.appendRow(new QStandardItem(QStringLiteral("Document")));
+    QCOMPARE(category->modelUpdates, modelUpdates);
+
+    QObject *documents = object->findChild<QObject *>(QStringLiteral("documents"));
+    QVERIFY(documents);
+    documents->setProperty("iconRole", QStringLiteral("decoration"));
+    QCOMPARE(category->roles.at(3), int(Qt::DecorationRole));
+    documents->setProperty("argumentsRole", QStringLiteral("unknown"));
+    QCOMPARE(category->roles.at(2), -1);
+    QCOMPARE(category->modelUpdates, modelUpdates + 2);
+
+    documents->setProperty("model", QVariant::fromValue<QObject *>(nullptr));
+    QVERIFY(!category->model);
+    QCOMPARE(category->roles, (QVector<int>{-1, -1, -1, -1}));
+    object.reset();
+    m_engine.rootContext()->setContextProperty(QStringLiteral("documentModel"), nullptr);
+}
+
+QTEST_MAIN(tst_QQuickJumpList)
+
+#include "tst_qquickjumplist.moc"
@@ -0,0 +1,8 @@
+CONFIG += testcase
+TARGET = tst_qwincomfailurereporter
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwincomfailurereporter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincomfailurereporter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultnames.cpp
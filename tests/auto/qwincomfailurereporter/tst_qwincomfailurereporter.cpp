@@ -0,0 +1,297 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+#include "qwincomfailurereporter_p.h"
+
+class tst_QWinComFailureReporter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void message();
+    void backoff();
+    void independentSites();
+    void quietPeriod();
+    void flush();
+    void expiredBackoff();
+    void reentrantSink();
+    void history();
+    void concurrentReports();
+};
+
+// Drives a reporter with a manual clock and collects what it logs.
+class ReporterFixture
+{
+public:
+    ReporterFixture()
+    {
+        reporter.setClock([this]() { return now; });
+        reporter.setSink([this](const QByteArray &message) { messages.append(message); });
+        reporter.setTimer([this](int msecs) { timers.append(msecs); });
+    }
+
+    QWinComFailureReporter reporter;
+    qint64 now = 0;
+    QByteArrayList messages;
+    QVector<int> timers; // the delays asked for
+};
+
+static const quint32 accessDenied = 0x80070005;
+static const quint32 notInitialized = 0x800401F0;
+
+void tst_QWinComFailureReporter::message()
+{
+    ReporterFixture fixture;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QVERIFY(fixture.reporter.report("QWinJumpList", "CommitList()", 0x8badf00d));
+    QCOMPARE(fixture.messages.size(), 2);
+    QCOMPARE(fixture.messages.at(0), QByteArray("QWinJumpList: BeginList() failed: 0x80070005, E_ACCESSDENIED."));
+    QCOMPARE(fixture.messages.at(1), QByteArray("QWinJumpList: CommitList() failed: 0x8badf00d."));
+}
+
+void tst_QWinComFailureReporter::backoff()
+{
+    ReporterFixture fixture;
+    fixture.reporter.setInitialBackoff(1000);
+    fixture.reporter.setMaximumBackoff(8000);
+
+    // One failure every 100 ms: logged after 1, 2, 4, 8, 8... seconds.
+    QVector<qint64> loggedAt;
+    for (fixture.now = 0; fixture.now <= 25000; fixture.now += 100) {
+        if (fixture.reporter.report("QWinTaskbarButton", "SetProgressValue()", accessDenied))
+            loggedAt.append(fixture.now);
+    }
+    QCOMPARE(loggedAt, (QVector<qint64>{ 0, 1000, 3000, 7000, 15000, 23000 }));
+
+    QCOMPARE(fixture.messages.size(), loggedAt.size());
+    QVERIFY(!fixture.messages.at(0).contains("suppressed"));
+    QVERIFY(fixture.messages.at(1).endsWith(" (9 similar failures suppressed)."));
+    QVERIFY(fixture.messages.at(2).endsWith(" (19 similar failures suppressed)."));
+    QVERIFY(fixture.messages.at(5).endsWith(" (79 similar failures suppressed)."));
+
+    const QWinComFailureReporter::Statistics statistics = fixture.reporter.statistics();
+    QCOMPARE(statistics.logged, quint64(6));
+    QCOMPARE(statistics.suppressed, quint64(251 - 6));
+}
+
+void tst_QWinComFailureReporter::independentSites()
+{
+    ReporterFixture fixture;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", notInitialized));
+    QVERIFY(fixture.reporter.report("QWinJumpList", "CommitList()", accessDenied));
+    QVERIFY(fixture.reporter.report("QWinThumbnailToolBar", "BeginList()", accessDenied));
+
+    // Call sites are compared by content, not by address.
+    const QByteArray component("QWinJumpList");
+    const QByteArray site("BeginList()");
+    QVERIFY(!fixture.reporter.report(component.constData(), site.constData(), accessDenied));
+    QCOMPARE(fixture.messages.size(), 4);
+}
+
+void tst_QWinComFailureReporter::quietPeriod()
+{
+    ReporterFixture fixture;
+    fixture.reporter.setInitialBackoff(1000);
+    fixture.reporter.setMaximumBackoff(8000);
+
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    fixture.now = 1000;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    fixture.now = 2000;
+    QVERIFY(!fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+
+    // After the maximum backoff without failures the site starts over.
+    fixture.now = 10000;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QVERIFY(fixture.messages.constLast().endsWith(" (1 similar failures suppressed)."));
+    fixture.now = 10999;
+    QVERIFY(!fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    fixture.now = 11000;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+}
+
+void tst_QWinComFailureReporter::flush()
+{
+    ReporterFixture fixture;
+    QCOMPARE(fixture.reporter.flush(), 0);
+
+    for (int i = 0; i < 4; ++i)
+        fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied);
+    fixture.reporter.report("QWinJumpList", "CommitList()", accessDenied);
+    fixture.reporter.report("QWinJumpList", "CommitList()", accessDenied);
+    fixture.reporter.report("QWinJumpList", "GetAt()", accessDenied);
+    fixture.messages.clear();
+
+    QCOMPARE(fixture.reporter.flush(), 2);
+    fixture.messages.sort();
+    QCOMPARE(fixture.messages, (QByteArrayList{
+        "QWinJumpList: BeginList() failed 3 more times with 0x80070005, E_ACCESSDENIED.",
+        "QWinJumpList: CommitList() failed 1 more time with 0x80070005, E_ACCESSDENIED." }));
+    QCOMPARE(fixture.reporter.flush(), 0);
+
+    // Flushed failures are not counted again in the next message.
+    fixture.now = 1000;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QVERIFY(!fixture.messages.constLast().contains("suppressed"));
+}
+
+// Failures that stop during a backoff are summarized when it expires.
+void tst_QWinComFailureReporter::expiredBackoff()
+{
+    ReporterFixture fixture;
+    fixture.reporter.setInitialBackoff(1000);
+
+    QVERIFY(fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QVERIFY(fixture.timers.isEmpty());
+    fixture.now = 100;
+    QVERIFY(!fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    fixture.now = 200;
+    QVERIFY(!fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QCOMPARE(fixture.timers, QVector<int>{ 900 });
+
+    fixture.now = 500;
+    QVERIFY(fixture.reporter.report("QWinJumpList", "CommitList()", accessDenied));
+    fixture.now = 600;
+    QVERIFY(!fixture.reporter.report("QWinJumpList", "CommitList()", accessDenied));
+    QCOMPARE(fixture.timers, (QVector<int>{ 900, 900 }));
+    fixture.messages.clear();
+
+    // The site whose backoff has not expired yet asks for the timer again.
+    fixture.now = 1000;
+    QCOMPARE(fixture.reporter.flushExpired(), 1);
+    QCOMPARE(fixture.messages, QByteArrayList{
+        "QWinJumpList: BeginList() failed 2 more times with 0x80070005, E_ACCESSDENIED." });
+    QCOMPARE(fixture.timers.constLast(), 500);
+
+    fixture.now = 1500;
+    QCOMPARE(fixture.reporter.flushExpired(), 1);
+    QCOMPARE(fixture.messages.constLast(),
+             QByteArray("QWinJumpList: CommitList() failed 1 more time with 0x80070005, E_ACCESSDENIED."));
+    QCOMPARE(fixture.reporter.flushExpired(), 0);
+    QCOMPARE(fixture.timers.size(), 3);
+}
+
+// The sink runs without the lock, so it may use the reporter.
+void tst_QWinComFailureReporter::reentrantSink()
+{
+    QWinComFailureReporter reporter;
+    qint64 now = 0;
+    reporter.setClock([&now]() { return now; });
+    QVector<quint64> logged;
+    reporter.setSink([&reporter, &logged](const QByteArray &) {
+        logged.append(reporter.statistics().logged);
+    });
+    QVERIFY(reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    now = 100;
+    QVERIFY(!reporter.report("QWinJumpList", "BeginList()", accessDenied));
+    QCOMPARE(reporter.flush(), 1);
+    QCOMPARE(logged, (QVector<quint64>{ 1, 1 }));
+}
+
+void tst_QWinComFailureReporter::history()
+{
+    ReporterFixture fixture;
+    QVERIFY(fixture.reporter.recentFailures().isEmpty());
+
+    fixture.now = 5;
+    fixture.reporter.report("QWinJumpList", "BeginList()", accessDenied);
+    QVector<QWinComFailureReporter::Failure> failures = fixture.reporter.recentFailures();
+    QCOMPARE(failures.size(), 1);
+    QCOMPARE(failures.at(0).component, "QWinJumpList");
+    QCOMPARE(failures.at(0).site, "BeginList()");
+    QCOMPARE(failures.at(0).hresult, accessDenied);
+    QCOMPARE(failures.at(0).timestamp, qint64(5));
+
+    // Suppressed failures are recorded too; the oldest ones are dropped.
+    const int total = QWinComFailureReporter::HistorySize * 2 + 10;
+    for (int i = 1; i < total; ++i) {
+        fixture.now = 5 + i;
+        fixture.reporter.report("QWinJumpList", "CommitList()", quint32(i));
+    }
+    failures = fixture.reporter.recentFailures();
+    QCOMPARE(failures.size(), int(QWinComFailureReporter::HistorySize));
+    for (int i = 0; i < failures.size(); ++i) {
+        const int expected = total - QWinComFailureReporter::HistorySize + i;
+        QCOMPARE(failures.at(i).hresult, quint32(expected));
+        QCOMPARE(failures.at(i).timestamp, qint64(5 + expected));
+    }
+}
+
+void tst_QWinComFailureReporter::concurrentReports()
+{
+    QWinComFailureReporter reporter;
+    QAtomicInt logged;
+    reporter.setSink([&logged](const QByteArray &) { logged.ref(); });
+
+    static const char *const sites[] = { "BeginList()", "CommitList()", "GetAt()", "AddUserTasks()" };
+    const int threadCount = 8;
+    const int reportCount = 2000;
+    QAtomicInt running(threadCount);
+    QVector<QThread *> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.append(QThread::create([&reporter, &running, t]() {
+            for (int i = 0; i < reportCount; ++i)
+                reporter.report("QWinJumpList", sites[(i + t) % 4], quint32(t));
+            running.deref();
+        }));
+        threads.constLast()->start();
+    }
+
+    // Readers never see torn entries while the ring buffer is overwritten.
+    int snapshots = 0;
+    while (running.load() > 0 || snapshots == 0) {
+        const QVector<QWinComFailureReporter::Failure> failures = reporter.recentFailures();
+        QVERIFY(failures.size() <= QWinComFailureReporter::HistorySize);
+        for (const QWinComFailureReporter::Failure &failure : failures) {
+            QCOMPARE(failure.component, "QWinJumpList");
+            QVERIFY(failure.hresult < quint32(threadCount));
+            QVERIFY(std::find_if(std::begin(sites), std::end(sites), [&failure](const char *site) {
+                return qstrcmp(site, failure.site) == 0;
+            }) != std::end(sites));
+        }
+        ++snapshots;
+    }
+    for (QThread *thread : qAsConst(threads)) {
+        thread->wait();
+        delete thread;
+    }
+
+    const QWinComFailureReporter::Statistics statistics = reporter.statistics();
+    QCOMPARE(statistics.logged + statistics.suppressed, quint64(threadCount * reportCount));
+    QCOMPARE(statistics.logged, quint64(logged.load()));
+    QVERIFY(statistics.logged >= quint64(threadCount * 4));
+    QCOMPARE(reporter.recentFailures().size(), int(QWinComFailureReporter::HistorySize));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinComFailureReporter)
+
+#include "tst_qwincomfailurereporter.moc"
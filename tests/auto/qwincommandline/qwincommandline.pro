@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwincommandline
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwincommandline.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
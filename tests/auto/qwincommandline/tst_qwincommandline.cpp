@@ -0,0 +1,195 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QRegularExpression>
+
+#include "qwincommandline_p.h"
+
+class tst_QWinCommandLine : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void split_data();
+    void split();
+    void join_data();
+    void join();
+    void roundTrip();
+    void legacyCommandLines();
+    void unicode();
+
+private:
+    static QVector<QString> allStrings(int maximumLength);
+};
+
+// The quoting QWinJumpList used before, kept to check that command lines of
+// existing links are still understood.
+static QString legacyCreateArguments(const QStringList &arguments)
+{
+    QString args;
+    for (int i=0; i<arguments.size(); ++i) {
+        QString tmp = arguments.at(i);
+        tmp.replace(QRegularExpression(QLatin1String("(\\\\*)\"")), QLatin1String("\\1\\1\\\""));
+        if (tmp.isEmpty() || tmp.contains(QLatin1Char(' ')) || tmp.contains(QLatin1Char('\t'))) {
+            int i = tmp.length();
+            while (i > 0 && tmp.at(i - 1) == QLatin1Char('\\'))
+                --i;
+            tmp.insert(i, QLatin1Char('"'));
+            tmp.prepend(QLatin1Char('"'));
+        }
+        args += QLatin1Char(' ') + tmp;
+    }
+    return args;
+}
+
+// Every string of up to maximumLength characters made of the characters
+// that matter for quoting.
+QVector<QString> tst_QWinCommandLine::allStrings(int maximumLength)
+{
+    static const char alphabet[] = { 'a', ' ', '\t', '\\', '"' };
+    const int alphabetSize = int(sizeof(alphabet));
+    QVector<QString> result;
+    for (int length = 0; length <= maximumLength; ++length) {
+        int total = 1;
+        for (int i = 0; i < length; ++i)
+            total *= alphabetSize;
+        for (int n = 0; n < total; ++n) {
+            QString string(length, Qt::Uninitialized);
+            for (int i = 0, digits = n; i < length; ++i, digits /= alphabetSize)
+                string[i] = QLatin1Char(alphabet[digits % alphabetSize]);
+            result.append(string);
+        }
+    }
+    return result;
+}
+
+void tst_QWinCommandLine::split_data()
+{
+    QTest::addColumn<QString>("commandLine");
+    QTest::addColumn<QStringList>("arguments");
+
+    QTest::newRow("empty") << QString() << QStringList();
+    QTest::newRow("blank") << QStringLiteral(" \t ") << QStringList();
+    QTest::newRow("simple") << QStringLiteral("a b\tc") << QStringList{ "a", "b", "c" };
+    QTest::newRow("surrounding blanks") << QStringLiteral("  a  b  ") << QStringList{ "a", "b" };
+    QTest::newRow("empty argument") << QStringLiteral("a \"\" b") << QStringList{ "a", "", "b" };
+    QTest::newRow("only empty argument") << QStringLiteral("\"\"") << QStringList{ "" };
+    QTest::newRow("unterminated quote") << QStringLiteral("\"a b") << QStringList{ "a b" };
+    QTest::newRow("trailing backslash") << QStringLiteral("a\\") << QStringList{ "a\\" };
+
+    // The examples of the "Parsing C++ command-line arguments" documentation.
+    QTest::newRow("msdn 1") << QStringLiteral("\"abc\" d e") << QStringList{ "abc", "d", "e" };
+    QTest::newRow("msdn 2") << QStringLiteral("a\\\\\\b d\"e f\"g h") << QStringList{ "a\\\\\\b", "de fg", "h" };
+    QTest::newRow("msdn 3") << QStringLiteral("a\\\\\\\"b c d") << QStringList{ "a\\\"b", "c", "d" };
+    QTest::newRow("msdn 4") << QStringLiteral("a\\\\\\\\\"b c\" d e") << QStringList{ "a\\\\b c", "d", "e" };
+    QTest::newRow("msdn 5") << QStringLiteral("a\"b\"\" c d") << QStringList{ "ab\" c d" };
+}
+
+void tst_QWinCommandLine::split()
+{
+    QFETCH(QString, commandLine);
+    QFETCH(QStringList, arguments);
+
+    QCOMPARE(QWinCommandLine::split(commandLine), arguments);
+}
+
+void tst_QWinCommandLine::join_data()
+{
+    QTest::addColumn<QStringList>("arguments");
+    QTest::addColumn<QString>("commandLine");
+
+    QTest::newRow("none") << QStringList() << QString();
+    QTest::newRow("plain") << QStringList{ "-a", "b" } << QStringLiteral("-a b");
+    QTest::newRow("empty") << QStringList{ "" } << QStringLiteral("\"\"");
+    QTest::newRow("blank") << QStringList{ "a b", "c\td" } << QStringLiteral("\"a b\" \"c\td\"");
+    QTest::newRow("quote") << QStringList{ "a\"b" } << QStringLiteral("a\\\"b");
+    QTest::newRow("backslashes") << QStringList{ "C:\\dir\\" } << QStringLiteral("C:\\dir\\");
+    QTest::newRow("quoted backslashes") << QStringList{ "C:\\my dir\\" } << QStringLiteral("\"C:\\my dir\\\\\"");
+    QTest::newRow("backslashes before quote") << QStringList{ "a\\\\\"b" } << QStringLiteral("a\\\\\\\\\\\"b");
+}
+
+void tst_QWinCommandLine::join()
+{
+    QFETCH(QStringList, arguments);
+    QFETCH(QString, commandLine);
+
+    QCOMPARE(QWinCommandLine::join(arguments), commandLine);
+    QCOMPARE(QWinCommandLine::joinedSize(arguments), commandLine.size());
+    QString buffer(commandLine.size(), Qt::Uninitialized);
+    QCOMPARE(QWinCommandLine::join(arguments, buffer.data()), buffer.constData() + buffer.size());
+    QCOMPARE(buffer, commandLine);
+    if (arguments.size() == 1)
+        QCOMPARE(QWinCommandLine::quoteArgument(arguments.constFirst()), commandLine);
+}
+
+void tst_QWinCommandLine::roundTrip()
+{
+    const QVector<QString> strings = allStrings(6);
+    for (const QString &string : strings) {
+        const QStringList lists[] = {
+            QStringList{ string },
+            QStringList{ string, string },
+            QStringList{ QStringLiteral("\\"), string, QStringLiteral("\"") }
+        };
+        for (const QStringList &arguments : lists) {
+            const QString commandLine = QWinCommandLine::join(arguments);
+            const QStringList parsed = QWinCommandLine::split(commandLine);
+            if (parsed != arguments) {
+                qDebug() << arguments << "->" << commandLine << "->" << parsed;
+                QFAIL("round trip failed");
+            }
+        }
+        if (QWinCommandLine::split(QWinCommandLine::quoteArgument(string)) != QStringList{ string })
+            QFAIL(qPrintable(QStringLiteral("quoting failed for \"%1\"").arg(string)));
+    }
+}
+
+void tst_QWinCommandLine::legacyCommandLines()
+{
+    const QVector<QString> strings = allStrings(5);
+    for (const QString &string : strings) {
+        const QStringList arguments{ string, QStringLiteral("x") };
+        const QStringList parsed = QWinCommandLine::split(legacyCreateArguments(arguments));
+        if (parsed != arguments) {
+            qDebug() << arguments << "->" << legacyCreateArguments(arguments) << "->" << parsed;
+            QFAIL("legacy command line not understood");
+        }
+    }
+}
+
+void tst_QWinCommandLine::unicode()
+{
+    const QStringList arguments{ QString::fromUtf8("C:/Users/J\xc3\xbcrgen/\xe6\x96\x87\xe6\xa1\xa3 1.txt"),
+                                 QString::fromUtf8("\xf0\x9f\x98\x80\"") };
+    QCOMPARE(QWinCommandLine::split(QWinCommandLine::join(arguments)), arguments);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinCommandLine)
+
+#include "tst_qwincommandline.moc"
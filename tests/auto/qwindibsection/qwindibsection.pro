@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwindibsection
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwindibsection.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwindibsection.cpp
@@ -0,0 +1,206 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+#include <QPainter>
+
+#include "qwindibsection_p.h"
+
+class CountingAllocator : public QWinMallocDibAllocator
+{
+public:
+    void *allocate(const QWinDibLayout &layout, uchar **bits) override
+    {
+        ++allocations;
+        return QWinMallocDibAllocator::allocate(layout, bits);
+    }
+
+    void release(void *handle) override
+    {
+        ++releases;
+        lastReleased = handle;
+        QWinMallocDibAllocator::release(handle);
+    }
+
+    int allocations = 0;
+    int releases = 0;
+    void *lastReleased = nullptr;
+};
+
+class tst_QWinDibSection : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void layout_data();
+    void layout();
+    void create();
+    void lifetime();
+    void bottomUp();
+    void wrapWithoutOwner();
+    void invalid();
+    void wrapFailureKeepsHandle();
+};
+
+void tst_QWinDibSection::layout_data()
+{
+    QTest::addColumn<int>("biWidth");
+    QTest::addColumn<int>("biHeight");
+    QTest::addColumn<int>("height");
+    QTest::addColumn<bool>("bottomUp");
+    QTest::addColumn<int>("bytesPerLine");
+
+    QTest::newRow("top-down") << 16 << -16 << 16 << false << 64;
+    QTest::newRow("bottom-up") << 16 << 16 << 16 << true << 64;
+    QTest::newRow("odd") << 3 << -7 << 7 << false << 12;
+}
+
+void tst_QWinDibSection::layout()
+{
+    QFETCH(int, biWidth);
+    QFETCH(int, biHeight);
+    QFETCH(int, height);
+    QFETCH(bool, bottomUp);
+    QFETCH(int, bytesPerLine);
+
+    const QWinDibLayout layout = QWinDibLayout::fromBitmapInfo(biWidth, biHeight);
+    QCOMPARE(layout.width, biWidth);
+    QCOMPARE(layout.height, height);
+    QCOMPARE(layout.bottomUp, bottomUp);
+    QCOMPARE(layout.bytesPerLine(), bytesPerLine);
+    QCOMPARE(layout.byteCount(), qsizetype(bytesPerLine) * height);
+}
+
+void tst_QWinDibSection::create()
+{
+    CountingAllocator allocator;
+    QWinDibLayout layout;
+    layout.width = 33;
+    layout.height = 17;
+    void *handle = nullptr;
+    QImage image = QWinDibSection::create(layout, QImage::Format_ARGB32_Premultiplied, &allocator, &handle);
+    QVERIFY(!image.isNull());
+    QVERIFY(handle);
+    QCOMPARE(allocator.allocations, 1);
+    QCOMPARE(image.size(), QSize(33, 17));
+    QCOMPARE(image.bytesPerLine(), layout.bytesPerLine());
+    QCOMPARE(static_cast<void *>(image.bits()), handle); // the view aliases the buffer
+
+    image.fill(Qt::transparent);
+    {
+        QPainter painter(&image);
+        painter.fillRect(QRect(0, 0, 1, 1), Qt::red);
+    }
+    const uchar *bits = static_cast<const uchar *>(handle);
+    QCOMPARE(*reinterpret_cast<const quint32 *>(bits), quint32(0xffff0000));
+
+    image = QImage();
+    QCOMPARE(allocator.releases, 1);
+    QCOMPARE(allocator.lastReleased, handle);
+}
+
+void tst_QWinDibSection::lifetime()
+{
+    CountingAllocator allocator;
+    QWinDibLayout layout;
+    layout.width = 8;
+    layout.height = 8;
+    void *handle = nullptr;
+    QImage image = QWinDibSection::create(layout, QImage::Format_RGB32, &allocator, &handle);
+    QImage copy = image;
+    image = QImage();
+    QCOMPARE(allocator.releases, 0); // a copy still refers to the buffer
+    QCOMPARE(static_cast<const void *>(copy.constBits()), static_cast<const void *>(handle));
+
+    QImage detached = copy;
+    detached.setPixel(0, 0, 0xff00ff00); // detaching copies away from the buffer
+    QVERIFY(detached.constBits() != copy.constBits());
+    copy = QImage();
+    QCOMPARE(allocator.releases, 1);
+    QCOMPARE(detached.pixel(0, 0), 0xff00ff00u);
+}
+
+void tst_QWinDibSection::bottomUp()
+{
+    CountingAllocator allocator;
+    const QWinDibLayout layout = QWinDibLayout::fromBitmapInfo(4, 3);
+    void *handle = nullptr;
+    const QImage image = QWinDibSection::create(layout, QImage::Format_RGB32, &allocator, &handle);
+    uchar *bits = static_cast<uchar *>(handle);
+    for (int y = 0; y < layout.height; ++y)
+        reinterpret_cast<quint32 *>(layout.scanLine(bits, y))[0] = 0xff000000 | quint32(y);
+
+    // The first scan line in memory is the bottom line of the picture.
+    QCOMPARE(layout.scanLine(bits, layout.height - 1), bits);
+    for (int y = 0; y < layout.height; ++y)
+        QCOMPARE(image.pixel(0, layout.height - 1 - y), 0xff000000 | quint32(y));
+}
+
+void tst_QWinDibSection::wrapWithoutOwner()
+{
+    QWinDibLayout layout;
+    layout.width = 2;
+    layout.height = 2;
+    quint32 pixels[4] = { 0xff000001, 0xff000002, 0xff000003, 0xff000004 };
+    const QImage image = QWinDibSection::wrap(reinterpret_cast<uchar *>(pixels), layout, QImage::Format_RGB32);
+    QCOMPARE(image.pixel(1, 1), 0xff000004u);
+    QCOMPARE(static_cast<const void *>(image.constBits()), static_cast<const void *>(pixels));
+}
+
+void tst_QWinDibSection::invalid()
+{
+    CountingAllocator allocator;
+    QWinDibLayout layout;
+    void *handle = reinterpret_cast<void *>(1);
+    QVERIFY(QWinDibSection::create(layout, QImage::Format_RGB32, &allocator, &handle).isNull());
+    QVERIFY(!handle);
+    QCOMPARE(allocator.releases, 0);
+}
+
+// Ownership of the handle only passes with a valid image.
+void tst_QWinDibSection::wrapFailureKeepsHandle()
+{
+    CountingAllocator allocator;
+    QWinDibLayout layout;
+    layout.width = 2;
+    layout.height = 2;
+    quint32 pixels[4] = {};
+    void *handle = &pixels;
+    QVERIFY(QWinDibSection::wrap(reinterpret_cast<uchar *>(pixels), layout, QImage::Format_Invalid,
+                                 &allocator, handle).isNull());
+    QCOMPARE(allocator.releases, 0);
+
+    QVERIFY(QWinDibSection::create(layout, QImage::Format_Invalid, &allocator, &handle).isNull());
+    QVERIFY(!handle);
+    QCOMPARE(allocator.releases, 1);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinDibSection)
+
+#include "tst_qwindibsection.moc"
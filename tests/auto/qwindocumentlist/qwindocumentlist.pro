@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwindocumentlist
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwindocumentlist.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwindocumentlist.cpp
@@ -0,0 +1,258 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwindocumentlist_p.h"
+
+// Stands in for IApplicationDocumentLists.
+class StandInProvider : public QWinDocumentList::Provider
+{
+public:
+    bool read(QWinDocumentList::Type type, const QString &appId, int limit,
+              QVector<QWinDocumentList::Entry> *entries) override
+    {
+        ++reads;
+        lastType = type;
+        lastAppId = appId;
+        lastLimit = limit;
+        if (fails)
+            return false;
+        const int count = limit && !ignoresLimit ? qMin(limit, available) : available;
+        for (int i = 0; i < count; ++i) {
+            QWinDocumentList::Entry entry;
+            entry.filePath = QStringLiteral("C:/Documents/%1/%2.txt").arg(appId).arg(i);
+            entries->append(entry);
+        }
+        return true;
+    }
+
+    int available = 20;
+    bool fails = false;
+    bool ignoresLimit = false;
+    int reads = 0;
+    QWinDocumentList::Type lastType = QWinDocumentList::Recent;
+    QString lastAppId;
+    int lastLimit = -1;
+};
+
+class tst_QWinDocumentList : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void lazy();
+    void cached();
+    void type();
+    void limit();
+    void smallerLimit();
+    void largerLimit();
+    void largerLimitWhenComplete();
+    void providerIgnoringLimit();
+    void appId();
+    void cleared();
+    void failure();
+    void generation();
+};
+
+void tst_QWinDocumentList::lazy()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setAppId(QStringLiteral("app"));
+    list.setLimit(3);
+    QVERIFY(!list.isLoaded());
+    QCOMPARE(provider.reads, 0);
+
+    QCOMPARE(list.entries().size(), 3);
+    QVERIFY(list.isLoaded());
+    QCOMPARE(provider.reads, 1);
+    QCOMPARE(list.readCount(), quint64(1));
+}
+
+void tst_QWinDocumentList::cached()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.entries();
+    list.entries();
+    list.setAppId(QString());
+    list.setLimit(0);
+    QCOMPARE(list.entries().size(), 20);
+    QCOMPARE(provider.reads, 1);
+
+    list.invalidate();
+    QVERIFY(!list.isLoaded());
+    QCOMPARE(provider.reads, 1);
+    list.entries();
+    QCOMPARE(provider.reads, 2);
+}
+
+void tst_QWinDocumentList::type()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Frequent, &provider);
+    QCOMPARE(list.type(), QWinDocumentList::Frequent);
+    list.entries();
+    QCOMPARE(provider.lastType, QWinDocumentList::Frequent);
+}
+
+void tst_QWinDocumentList::limit()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    QCOMPARE(list.limit(), 0);
+    list.entries();
+    QCOMPARE(provider.lastLimit, 0);
+
+    list.invalidate();
+    list.setLimit(-5);
+    QCOMPARE(list.limit(), 0);
+    list.setLimit(7);
+    QCOMPARE(list.entries().size(), 7);
+    QCOMPARE(provider.lastLimit, 7);
+}
+
+void tst_QWinDocumentList::smallerLimit()
+{
+    // The first entries of a longer list are those of a shorter one.
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setLimit(10);
+    const QString first = list.entries().constFirst().filePath;
+    list.setLimit(4);
+    QCOMPARE(list.entries().size(), 4);
+    QCOMPARE(list.entries().constFirst().filePath, first);
+    QCOMPARE(provider.reads, 1);
+}
+
+void tst_QWinDocumentList::largerLimit()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setLimit(5);
+    list.entries();
+    list.setLimit(4);
+    list.setLimit(5);
+    QCOMPARE(list.entries().size(), 5);
+    QCOMPARE(provider.reads, 2);
+
+    list.setLimit(0);
+    QCOMPARE(list.entries().size(), 20);
+    QCOMPARE(provider.reads, 3);
+}
+
+void tst_QWinDocumentList::largerLimitWhenComplete()
+{
+    StandInProvider provider;
+    provider.available = 3;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setLimit(5);
+    QCOMPARE(list.entries().size(), 3);
+    list.setLimit(50);
+    list.setLimit(0);
+    QCOMPARE(list.entries().size(), 3);
+    QCOMPARE(provider.reads, 1);
+}
+
+void tst_QWinDocumentList::providerIgnoringLimit()
+{
+    StandInProvider provider;
+    provider.ignoresLimit = true;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setLimit(2);
+    QCOMPARE(list.entries().size(), 2);
+}
+
+void tst_QWinDocumentList::appId()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setAppId(QStringLiteral("first"));
+    QVERIFY(list.entries().constFirst().filePath.contains(QLatin1String("first")));
+    list.setAppId(QStringLiteral("first"));
+    QVERIFY(list.isLoaded());
+
+    list.setAppId(QStringLiteral("second"));
+    QVERIFY(!list.isLoaded());
+    QVERIFY(list.entries().constFirst().filePath.contains(QLatin1String("second")));
+    QCOMPARE(provider.lastAppId, QStringLiteral("second"));
+    QCOMPARE(provider.reads, 2);
+}
+
+void tst_QWinDocumentList::cleared()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    list.setCleared();
+    QVERIFY(list.isLoaded());
+    QVERIFY(list.entries().isEmpty());
+    list.setLimit(10);
+    QVERIFY(list.entries().isEmpty());
+    QCOMPARE(provider.reads, 0);
+}
+
+void tst_QWinDocumentList::failure()
+{
+    StandInProvider provider;
+    provider.fails = true;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    QVERIFY(list.entries().isEmpty());
+    QVERIFY(list.entries().isEmpty());
+    QCOMPARE(provider.reads, 1);
+
+    provider.fails = false;
+    list.invalidate();
+    QCOMPARE(list.entries().size(), 20);
+}
+
+void tst_QWinDocumentList::generation()
+{
+    StandInProvider provider;
+    QWinDocumentList list(QWinDocumentList::Recent, &provider);
+    quint64 generation = list.generation();
+    list.invalidate(); // nothing read yet
+    QCOMPARE(list.generation(), generation);
+
+    list.entries();
+    QVERIFY(list.generation() != generation);
+    generation = list.generation();
+    list.entries();
+    list.setLimit(20); // covers all entries read
+    QCOMPARE(list.generation(), generation);
+
+    list.setLimit(10);
+    QVERIFY(list.generation() != generation);
+    generation = list.generation();
+    list.setCleared();
+    QVERIFY(list.generation() != generation);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinDocumentList)
+
+#include "tst_qwindocumentlist.moc"
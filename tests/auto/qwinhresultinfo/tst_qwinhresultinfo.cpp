@@ -0,0 +1,174 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinhresultinfo.h"
+#include "qwinhresultnames_p.h"
+
+using QtWin::HResultInfo;
+
+// Usable in constant expressions.
+Q_STATIC_ASSERT(HResultInfo(0x80070057).isFailure());
+Q_STATIC_ASSERT(HResultInfo(0x80070057).isWin32Error());
+Q_STATIC_ASSERT(HResultInfo(0x80070057).code() == 87);
+Q_STATIC_ASSERT(HResultInfo(0x887A0005).facility() == HResultInfo::FacilityDxgi);
+Q_STATIC_ASSERT(HResultInfo::fromWin32Error(5) == HResultInfo(0x80070005));
+Q_STATIC_ASSERT(HResultInfo().isSuccess());
+
+class tst_QWinHResultInfo : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void fields_data();
+    void fields();
+    void signedValues();
+    void fromWin32Error_data();
+    void fromWin32Error();
+    void facilityNames();
+    void names();
+    void debugStream();
+};
+
+void tst_QWinHResultInfo::fields_data()
+{
+    QTest::addColumn<quint32>("hresult");
+    QTest::addColumn<bool>("failure");
+    QTest::addColumn<bool>("customer");
+    QTest::addColumn<int>("facility");
+    QTest::addColumn<int>("code");
+
+    QTest::newRow("S_OK") << 0x00000000u << false << false << 0 << 0;
+    QTest::newRow("S_FALSE") << 0x00000001u << false << false << 0 << 1;
+    QTest::newRow("E_FAIL") << 0x80004005u << true << false << 0 << 0x4005;
+    QTest::newRow("E_ACCESSDENIED") << 0x80070005u << true << false << 7 << 5;
+    QTest::newRow("DXGI_ERROR_DEVICE_REMOVED") << 0x887A0005u << true << false << 0x87a << 5;
+    QTest::newRow("customer") << 0xA0040201u << true << true << 4 << 0x201;
+    QTest::newRow("success with facility") << 0x00040200u << false << false << 4 << 0x200;
+}
+
+void tst_QWinHResultInfo::fields()
+{
+    QFETCH(quint32, hresult);
+    QFETCH(bool, failure);
+    QFETCH(bool, customer);
+    QFETCH(int, facility);
+    QFETCH(int, code);
+
+    const HResultInfo info(hresult);
+    QCOMPARE(info.value(), hresult);
+    QCOMPARE(info.isFailure(), failure);
+    QCOMPARE(info.isSuccess(), !failure);
+    QCOMPARE(info.severity(), failure ? 1 : 0);
+    QCOMPARE(info.isCustomer(), customer);
+    QVERIFY(!info.isNtStatus());
+    QCOMPARE(info.facility(), facility);
+    QCOMPARE(info.code(), code);
+    QCOMPARE(info.isWin32Error(), failure && facility == 7);
+}
+
+void tst_QWinHResultInfo::signedValues()
+{
+    // HRESULT is a signed 32 bit type.
+    const qint32 hresult = qint32(0x80004005);
+    QCOMPARE(HResultInfo(hresult).value(), 0x80004005u);
+    QCOMPARE(HResultInfo(hresult), HResultInfo(0x80004005u));
+    QVERIFY(HResultInfo(hresult) != HResultInfo(0x80004004u));
+    QVERIFY(HResultInfo(0xD0000001u).isNtStatus()); // HRESULT_FROM_NT(0xC0000001)
+}
+
+void tst_QWinHResultInfo::fromWin32Error_data()
+{
+    QTest::addColumn<quint32>("error");
+    QTest::addColumn<quint32>("hresult");
+
+    QTest::newRow("ERROR_SUCCESS") << 0u << 0u;
+    QTest::newRow("ERROR_FILE_NOT_FOUND") << 2u << 0x80070002u;
+    QTest::newRow("ERROR_INVALID_PARAMETER") << 87u << 0x80070057u;
+    QTest::newRow("high bits") << 0x12345u << 0x80072345u;
+    QTest::newRow("already an HRESULT") << 0x80004005u << 0x80004005u;
+}
+
+void tst_QWinHResultInfo::fromWin32Error()
+{
+    QFETCH(quint32, error);
+    QFETCH(quint32, hresult);
+    QCOMPARE(HResultInfo::fromWin32Error(error).value(), hresult);
+}
+
+void tst_QWinHResultInfo::facilityNames()
+{
+    QCOMPARE(HResultInfo::facilityName(HResultInfo::FacilityNull), QLatin1String("NULL"));
+    QCOMPARE(HResultInfo::facilityName(HResultInfo::FacilityWin32), QLatin1String("WIN32"));
+    QCOMPARE(HResultInfo::facilityName(HResultInfo::FacilityItf), QLatin1String("ITF"));
+    QCOMPARE(HResultInfo::facilityName(HResultInfo::FacilityShell), QLatin1String("SHELL"));
+    QCOMPARE(HResultInfo::facilityName(HResultInfo::FacilityDxgi), QLatin1String("DXGI"));
+    QCOMPARE(HResultInfo::facilityName(HResultInfo::FacilityDirect2D), QLatin1String("D2D"));
+    QCOMPARE(HResultInfo(0x80320001).facilityName(), QLatin1String("FWP"));
+    QVERIFY(HResultInfo::facilityName(5).isNull());
+    QVERIFY(HResultInfo::facilityName(0x1fff).isNull());
+    QVERIFY(HResultInfo::facilityName(-1).isNull());
+
+    // Every enumerator has a name.
+    const int facilities[] = {
+        HResultInfo::FacilityNull, HResultInfo::FacilityRpc, HResultInfo::FacilityDispatch,
+        HResultInfo::FacilityStorage, HResultInfo::FacilityItf, HResultInfo::FacilityWin32,
+        HResultInfo::FacilityWindows, HResultInfo::FacilitySecurity, HResultInfo::FacilityControl,
+        HResultInfo::FacilityInternet, HResultInfo::FacilityShell, HResultInfo::FacilityDxgi,
+        HResultInfo::FacilityDirect2D
+    };
+    for (int facility : facilities)
+        QVERIFY2(!HResultInfo::facilityName(facility).isEmpty(), QByteArray::number(facility));
+}
+
+void tst_QWinHResultInfo::names()
+{
+    QCOMPARE(HResultInfo(0x80070057).name(), QLatin1String("E_INVALIDARG"));
+    QCOMPARE(HResultInfo(0x80004005).name(), QLatin1String("E_FAIL"));
+    QVERIFY(HResultInfo(0x12345678).name().isNull());
+
+    QVERIFY(QWinHResultNames::registerName(0xA0040301, QLatin1String("TST_E_REGISTERED")));
+    QCOMPARE(HResultInfo(0xA0040301).name(), QLatin1String("TST_E_REGISTERED"));
+}
+
+void tst_QWinHResultInfo::debugStream()
+{
+    QTest::ignoreMessage(QtDebugMsg,
+                         "QtWin::HResultInfo(0x80070057 E_INVALIDARG, failure, facility=WIN32 (7), code=87)");
+    qDebug() << HResultInfo(0x80070057);
+    QTest::ignoreMessage(QtDebugMsg,
+                         "QtWin::HResultInfo(0xa0050001, failure, customer, facility=(5), code=1)");
+    qDebug() << HResultInfo(0xA0050001);
+    QTest::ignoreMessage(QtDebugMsg, "QtWin::HResultInfo(0x00000000, success, facility=NULL (0), code=0)");
+    qDebug() << HResultInfo();
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHResultInfo)
+
+#include "tst_qwinhresultinfo.moc"
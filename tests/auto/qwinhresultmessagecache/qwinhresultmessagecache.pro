@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwinhresultmessagecache
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinhresultmessagecache.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultmessagecache.cpp
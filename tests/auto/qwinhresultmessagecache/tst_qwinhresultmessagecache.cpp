@@ -0,0 +1,188 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+#include "qwinhresultmessagecache_p.h"
+
+class tst_QWinHResultMessageCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void hitsAndMisses();
+    void languages();
+    void leastRecentlyUsed();
+    void capacity();
+    void clear();
+    void concurrentLookups();
+};
+
+// Stand-in for FormatMessage() that counts its calls.
+class CountingFormatter
+{
+public:
+    QString operator()(quint32 hresult, quint32 language)
+    {
+        m_calls->ref();
+        return QString::fromLatin1("message %1 in %2").arg(hresult, 8, 16, QLatin1Char('0')).arg(language);
+    }
+
+    int calls() const { return m_calls->load(); }
+
+private:
+    QSharedPointer<QAtomicInt> m_calls = QSharedPointer<QAtomicInt>::create();
+};
+
+static QString expectedMessage(quint32 hresult, quint32 language)
+{
+    return QString::fromLatin1("message %1 in %2").arg(hresult, 8, 16, QLatin1Char('0')).arg(language);
+}
+
+void tst_QWinHResultMessageCache::hitsAndMisses()
+{
+    CountingFormatter formatter;
+    QWinHResultMessageCache cache(formatter);
+
+    QCOMPARE(cache.message(0x80004005, 1033), expectedMessage(0x80004005, 1033));
+    QCOMPARE(formatter.calls(), 1);
+    QCOMPARE(cache.statistics().misses, quint64(1));
+    QCOMPARE(cache.statistics().hits, quint64(0));
+
+    for (int i = 0; i < 10; ++i)
+        QCOMPARE(cache.message(0x80004005, 1033), expectedMessage(0x80004005, 1033));
+    QCOMPARE(formatter.calls(), 1);
+    QCOMPARE(cache.statistics().hits, quint64(10));
+    QCOMPARE(cache.size(), 1);
+
+    cache.resetStatistics();
+    QCOMPARE(cache.statistics().hits, quint64(0));
+    QCOMPARE(cache.statistics().misses, quint64(0));
+}
+
+void tst_QWinHResultMessageCache::languages()
+{
+    CountingFormatter formatter;
+    QWinHResultMessageCache cache(formatter);
+
+    QCOMPARE(cache.message(0x80070057, 1033), expectedMessage(0x80070057, 1033));
+    QCOMPARE(cache.message(0x80070057, 1031), expectedMessage(0x80070057, 1031));
+    QCOMPARE(cache.message(0x80070057, 1033), expectedMessage(0x80070057, 1033));
+    QCOMPARE(formatter.calls(), 2);
+    QCOMPARE(cache.size(), 2);
+}
+
+void tst_QWinHResultMessageCache::leastRecentlyUsed()
+{
+    CountingFormatter formatter;
+    QWinHResultMessageCache cache(formatter, 3, 1);
+
+    cache.message(1, 0);
+    cache.message(2, 0);
+    cache.message(3, 0);
+    cache.message(1, 0); // 2 is now the least recently used
+    cache.message(4, 0);
+    QCOMPARE(cache.size(), 3);
+    QCOMPARE(formatter.calls(), 4);
+
+    cache.message(1, 0);
+    cache.message(3, 0);
+    cache.message(4, 0);
+    QCOMPARE(formatter.calls(), 4);
+    cache.message(2, 0);
+    QCOMPARE(formatter.calls(), 5);
+}
+
+void tst_QWinHResultMessageCache::capacity()
+{
+    CountingFormatter formatter;
+    QWinHResultMessageCache cache(formatter, 10, 4);
+    QCOMPARE(cache.stripeCount(), 4);
+    QCOMPARE(cache.capacity(), 12);
+
+    for (quint32 hresult = 0; hresult < 1000; ++hresult)
+        cache.message(0x80070000 | hresult, 1033);
+    QVERIFY(cache.size() <= cache.capacity());
+    QVERIFY(cache.size() > 0);
+
+    QWinHResultMessageCache degenerate(formatter, 0, 0);
+    QCOMPARE(degenerate.stripeCount(), 1);
+    QCOMPARE(degenerate.capacity(), 1);
+    QCOMPARE(degenerate.message(5, 5), expectedMessage(5, 5));
+}
+
+void tst_QWinHResultMessageCache::clear()
+{
+    CountingFormatter formatter;
+    QWinHResultMessageCache cache(formatter);
+    cache.message(1, 0);
+    cache.message(2, 0);
+    cache.clear();
+    QCOMPARE(cache.size(), 0);
+    cache.message(1, 0);
+    QCOMPARE(formatter.calls(), 3);
+}
+
+void tst_QWinHResultMessageCache::concurrentLookups()
+{
+    CountingFormatter formatter;
+    QWinHResultMessageCache cache(formatter, 32, 8);
+    const int threadCount = 8;
+    const int lookups = 5000;
+
+    QAtomicInt wrong;
+    QVector<QThread *> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.append(QThread::create([t, &cache, &wrong]() {
+            for (int i = 0; i < lookups; ++i) {
+                // Mostly a small working set, sometimes a code that evicts.
+                const quint32 hresult = 0x80070000 | quint32((i * 7 + t) % (i % 10 ? 24 : 200));
+                const quint32 language = 1033 + quint32(i % 2);
+                if (cache.message(hresult, language) != expectedMessage(hresult, language))
+                    wrong.ref();
+            }
+        }));
+        threads.constLast()->start();
+    }
+    for (QThread *thread : qAsConst(threads)) {
+        QVERIFY(thread->wait(60000));
+        delete thread;
+    }
+
+    QCOMPARE(wrong.load(), 0);
+    const QWinHResultMessageCache::Statistics statistics = cache.statistics();
+    QCOMPARE(statistics.hits + statistics.misses, quint64(threadCount * lookups));
+    QCOMPARE(quint64(formatter.calls()), statistics.misses);
+    QVERIFY(statistics.hits > 0);
+    QVERIFY(cache.size() <= cache.capacity());
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHResultMessageCache)
+
+#include "tst_qwinhresultmessagecache.moc"
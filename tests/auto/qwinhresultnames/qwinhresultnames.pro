@@ -0,0 +1,8 @@
+CONFIG += testcase
+TARGET = tst_qwinhresultnames
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinhresultnames.cpp \
+    ../../benchmarks/qwinhresultnames/hresultswitch.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultnames.cpp
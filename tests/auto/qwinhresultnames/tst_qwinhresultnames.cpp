@@ -0,0 +1,179 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+#include "qwinhresultnames_p.h"
+
+QString hresultSwitchName(quint32 hresult); // generated, see util/hresultnames
+
+class tst_QWinHResultNames : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tableSorted();
+    void matchesSwitch();
+    void roundTrip();
+    void knownNames_data();
+    void knownNames();
+    void unknown();
+    void registerName();
+    void concurrentRegistration();
+};
+
+void tst_QWinHResultNames::tableSorted()
+{
+    QVERIFY(QWinHResultNames::builtInCount() > 1000);
+    for (int i = 1; i < QWinHResultNames::builtInCount(); ++i)
+        QVERIFY(QWinHResultNames::builtInValue(i - 1) < QWinHResultNames::builtInValue(i));
+}
+
+void tst_QWinHResultNames::matchesSwitch()
+{
+    for (int i = 0; i < QWinHResultNames::builtInCount(); ++i) {
+        const quint32 hresult = QWinHResultNames::builtInValue(i);
+        QCOMPARE(QString(QWinHResultNames::name(hresult)), hresultSwitchName(hresult));
+        // Neighbouring values, which are mostly unknown.
+        QCOMPARE(QString(QWinHResultNames::name(hresult + 0x10000)), hresultSwitchName(hresult + 0x10000));
+    }
+}
+
+void tst_QWinHResultNames::roundTrip()
+{
+    for (int i = 0; i < QWinHResultNames::builtInCount(); ++i) {
+        const QLatin1String name = QWinHResultNames::builtInName(i);
+        QVERIFY(!name.isEmpty());
+        quint32 hresult = 0;
+        QVERIFY(QWinHResultNames::value(name, &hresult));
+        QCOMPARE(hresult, QWinHResultNames::builtInValue(i));
+        QCOMPARE(QWinHResultNames::name(hresult), name);
+    }
+}
+
+void tst_QWinHResultNames::knownNames_data()
+{
+    QTest::addColumn<quint32>("hresult");
+    QTest::addColumn<QString>("name");
+
+    QTest::newRow("E_FAIL") << 0x80004005u << QStringLiteral("E_FAIL");
+    QTest::newRow("E_INVALIDARG") << 0x80070057u << QStringLiteral("E_INVALIDARG");
+    QTest::newRow("E_UNEXPECTED") << 0x8000FFFFu << QStringLiteral("E_UNEXPECTED");
+    QTest::newRow("FWP_E_INVALID_CIPHER_TRANSFORM") << 0x80320039u
+                                                    << QStringLiteral("FWP_E_INVALID_CIPHER_TRANSFORM");
+}
+
+void tst_QWinHResultNames::knownNames()
+{
+    QFETCH(quint32, hresult);
+    QFETCH(QString, name);
+
+    QCOMPARE(QString(QWinHResultNames::name(hresult)), name);
+    const QByteArray latin1 = name.toLatin1();
+    quint32 value = 0;
+    QVERIFY(QWinHResultNames::value(QLatin1String(latin1), &value));
+    QCOMPARE(value, hresult);
+}
+
+void tst_QWinHResultNames::unknown()
+{
+    QVERIFY(QWinHResultNames::name(0x12345678).isNull());
+    QVERIFY(QWinHResultNames::name(0).isNull());
+    QVERIFY(QWinHResultNames::name(0xffffffff).isNull());
+
+    quint32 value = 42;
+    QVERIFY(!QWinHResultNames::value(QLatin1String("NOT_AN_HRESULT"), &value));
+    QVERIFY(!QWinHResultNames::value(QLatin1String("E_FAI"), &value));
+    QVERIFY(!QWinHResultNames::value(QLatin1String("E_FAILED"), &value));
+    QVERIFY(!QWinHResultNames::value(QLatin1String("e_fail"), &value));
+    QVERIFY(!QWinHResultNames::value(QLatin1String(""), &value));
+    QVERIFY(!QWinHResultNames::value(QLatin1String(), &value));
+    QCOMPARE(value, 42u);
+}
+
+void tst_QWinHResultNames::registerName()
+{
+    const quint32 broken = 0xA0040001; // customer bit set, FACILITY_ITF
+    const quint32 missing = 0xA0040002;
+
+    QVERIFY(QWinHResultNames::name(broken).isNull());
+    QVERIFY(QWinHResultNames::registerName(broken, QLatin1String("MYAPP_E_BROKEN")));
+    QCOMPARE(QWinHResultNames::name(broken), QLatin1String("MYAPP_E_BROKEN"));
+    quint32 value = 0;
+    QVERIFY(QWinHResultNames::value(QLatin1String("MYAPP_E_BROKEN"), &value));
+    QCOMPARE(value, broken);
+
+    // Registering the same name again is fine; for another value, it is not.
+    QVERIFY(QWinHResultNames::registerName(broken, QLatin1String("MYAPP_E_BROKEN")));
+    QVERIFY(!QWinHResultNames::registerName(missing, QLatin1String("MYAPP_E_BROKEN")));
+
+    // Built-in values and names cannot be taken over.
+    QVERIFY(!QWinHResultNames::registerName(0x80004005, QLatin1String("MYAPP_E_FAIL")));
+    QVERIFY(!QWinHResultNames::registerName(missing, QLatin1String("E_FAIL")));
+    QVERIFY(!QWinHResultNames::registerName(missing, QLatin1String()));
+    QCOMPARE(QWinHResultNames::name(0x80004005), QLatin1String("E_FAIL"));
+
+    // Renaming keeps the string handed out before valid.
+    const QLatin1String oldName = QWinHResultNames::name(broken);
+    QVERIFY(QWinHResultNames::registerName(broken, QLatin1String("MYAPP_E_SHATTERED")));
+    QCOMPARE(QWinHResultNames::name(broken), QLatin1String("MYAPP_E_SHATTERED"));
+    QVERIFY(!QWinHResultNames::value(QLatin1String("MYAPP_E_BROKEN"), &value));
+    QCOMPARE(oldName, QLatin1String("MYAPP_E_BROKEN"));
+    QVERIFY(QWinHResultNames::registerName(missing, QLatin1String("MYAPP_E_BROKEN")));
+}
+
+void tst_QWinHResultNames::concurrentRegistration()
+{
+    QVector<QThread *> threads;
+    QAtomicInt failures;
+    for (int t = 0; t < 4; ++t) {
+        threads.append(QThread::create([t, &failures]() {
+            for (int i = 0; i < 200; ++i) {
+                const quint32 hresult = 0xA0050000 | quint32(t << 8) | quint32(i);
+                const QByteArray name = "THREAD" + QByteArray::number(t) + "_E_" + QByteArray::number(i);
+                if (!QWinHResultNames::registerName(hresult, QLatin1String(name)))
+                    failures.ref();
+                if (QWinHResultNames::name(hresult) != QLatin1String(name))
+                    failures.ref();
+                if (QWinHResultNames::name(0x80004005) != QLatin1String("E_FAIL"))
+                    failures.ref();
+            }
+        }));
+        threads.constLast()->start();
+    }
+    for (QThread *thread : qAsConst(threads)) {
+        QVERIFY(thread->wait(60000));
+        delete thread;
+    }
+    QCOMPARE(failures.load(), 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHResultNames)
+
+#include "tst_qwinhresultnames.moc"
@@ -0,0 +1,177 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+#include <QThreadPool>
+#include <QVector>
+
+#include "qwiniconconversion_p.h"
+
+class tst_QWinIconConversion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void maskBytesPerLine();
+    void prepareIconPixels_data();
+    void prepareIconPixels();
+    void applyIconMaskWithAlpha();
+    void applyIconMaskWithoutAlpha();
+    void forEach_data();
+    void forEach();
+};
+
+static QImage testImage(int width, int height)
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+    for (int y = 0; y < height; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x)
+            line[x] = qRgba(x * 7, y * 13, x ^ y, (x * 31 + y * 17) & 0xff);
+    }
+    return image;
+}
+
+static bool maskBit(const uchar *mask, int maskBytesPerLine, int x, int y)
+{
+    return mask[y * maskBytesPerLine + (x >> 3)] & (0x80 >> (x & 7));
+}
+
+void tst_QWinIconConversion::maskBytesPerLine()
+{
+    QCOMPARE(QWinIconConversion::maskBytesPerLine(1), 4);
+    QCOMPARE(QWinIconConversion::maskBytesPerLine(16), 4);
+    QCOMPARE(QWinIconConversion::maskBytesPerLine(32), 4);
+    QCOMPARE(QWinIconConversion::maskBytesPerLine(33), 8);
+    QCOMPARE(QWinIconConversion::maskBytesPerLine(256), 32);
+}
+
+void tst_QWinIconConversion::prepareIconPixels_data()
+{
+    QTest::addColumn<QImage>("image");
+
+    const QImage argb = testImage(37, 19);
+    QTest::newRow("ARGB32") << argb;
+    QTest::newRow("ARGB32_Premultiplied") << argb.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    QTest::newRow("RGB32") << argb.convertToFormat(QImage::Format_RGB32);
+    QTest::newRow("RGB888") << argb.convertToFormat(QImage::Format_RGB888);
+    QTest::newRow("256x256") << testImage(256, 256);
+    QTest::newRow("1x1") << testImage(1, 1);
+}
+
+void tst_QWinIconConversion::prepareIconPixels()
+{
+    QFETCH(QImage, image);
+    const int width = image.width();
+    const int height = image.height();
+    const int maskBytesPerLine = QWinIconConversion::maskBytesPerLine(width);
+    QVector<uchar> color(width * height * 4, 0xcd);
+    QVector<uchar> mask(maskBytesPerLine * height, 0xcd);
+
+    QWinIconConversion::prepareIconPixels(image, color.data(), mask.data(), maskBytesPerLine);
+
+    // Color bits hold straight alpha ARGB32, as QImage::convertToFormat() produces it.
+    const QImage expected = image.convertToFormat(QImage::Format_ARGB32);
+    for (int y = 0; y < height; ++y)
+        QVERIFY(!memcmp(color.constData() + y * width * 4, expected.constScanLine(y), size_t(width * 4)));
+
+    // The AND mask is the inverse of QImage's alpha mask, with clear padding.
+    const QImage alphaMask = image.hasAlphaChannel() ? image.createAlphaMask() : QImage();
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < maskBytesPerLine * 8; ++x) {
+            const bool transparent = x < width && !alphaMask.isNull() && alphaMask.pixelIndex(x, y) == 0;
+            QCOMPARE(maskBit(mask.constData(), maskBytesPerLine, x, y), transparent);
+        }
+    }
+}
+
+void tst_QWinIconConversion::applyIconMaskWithAlpha()
+{
+    QImage image = testImage(40, 9).convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    const QImage original = image.copy();
+    QImage mask(image.size(), QImage::Format_RGB32);
+    mask.fill(Qt::white);
+
+    QWinIconConversion::applyIconMask(&image, mask);
+    QCOMPARE(image, original);
+}
+
+void tst_QWinIconConversion::applyIconMaskWithoutAlpha()
+{
+    QImage image(40, 9, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < image.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < image.width(); ++x)
+            line[x] = qRgba(x, y, 0x40, 0);
+    }
+    // DrawIconEx() renders set bits of the AND mask white, clear ones black;
+    // only the red component counts.
+    QImage mask(image.size(), QImage::Format_RGB32);
+    for (int y = 0; y < image.height(); ++y) {
+        for (int x = 0; x < image.width(); ++x)
+            mask.setPixel(x, y, (x + y) % 3 == 0 ? qRgb(0xff, 0, 0) : qRgb(0, 0xff, 0xff));
+    }
+
+    QWinIconConversion::applyIconMask(&image, mask);
+    for (int y = 0; y < image.height(); ++y) {
+        for (int x = 0; x < image.width(); ++x) {
+            const QRgb expected = (x + y) % 3 == 0 ? 0u : qRgba(x, y, 0x40, 0xff);
+            QCOMPARE(image.pixel(x, y), expected);
+        }
+    }
+}
+
+void tst_QWinIconConversion::forEach_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("threads");
+
+    QTest::newRow("empty") << 0 << 4;
+    QTest::newRow("single") << 1 << 4;
+    QTest::newRow("one-thread") << 100 << 1;
+    QTest::newRow("fewer-jobs-than-threads") << 3 << 8;
+    QTest::newRow("many") << 10000 << 4;
+}
+
+void tst_QWinIconConversion::forEach()
+{
+    QFETCH(int, count);
+    QFETCH(int, threads);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+    QVector<QAtomicInt> calls(count);
+    QWinIconConversion::forEach(count, [&calls](int i) { calls[i].ref(); }, &pool);
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(calls.at(i).load(), 1);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinIconConversion)
+
+#include "tst_qwiniconconversion.moc"
@@ -0,0 +1,10 @@
+CONFIG += testcase
+TARGET = tst_qwiniconfilecache
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwiniconfilecache.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconfilecache.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinicowriter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
@@ -0,0 +1,260 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QTemporaryDir>
+
+#include "qwiniconfilecache_p.h"
+#include "qwinicowriter_p.h"
+
+class tst_QWinIconFileCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void key();
+    void writeOnce();
+    void hitRefreshesUseTime();
+    void sweepByAge();
+    void sweepBySize();
+    void inUseFilesAreKept();
+    void markInUse();
+    void unlimited();
+    void writeFailure();
+};
+
+static QVector<QImage> frames(QRgb color, int size = 16)
+{
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(color);
+    return QVector<QImage>() << image;
+}
+
+static bool setModificationTime(const QString &path, const QDateTime &time)
+{
+    QFile file(path);
+    return file.open(QIODevice::ReadWrite) && file.setFileTime(time, QFileDevice::FileModificationTime);
+}
+
+static QString createFile(const QString &directory, const QString &name, int size, int ageDays)
+{
+    const QString path = directory + QLatin1Char('/') + name;
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return QString();
+    file.write(QByteArray(size, 'x'));
+    file.close();
+    setModificationTime(path, QDateTime::currentDateTimeUtc().addDays(-ageDays));
+    return path;
+}
+
+void tst_QWinIconFileCache::key()
+{
+    const QByteArray red = QWinIconFileCache::key(frames(0xffff0000));
+    QCOMPARE(red.size(), 40);
+    QCOMPARE(red, QWinIconFileCache::key(frames(0xffff0000)));
+    QVERIFY(red != QWinIconFileCache::key(frames(0xff00ff00)));
+    QVERIFY(red != QWinIconFileCache::key(frames(0xffff0000, 32)));
+    QVERIFY(red != QWinIconFileCache::key(frames(0xffff0000) + frames(0xffff0000, 32)));
+
+    // Only the pixels count, not where the image data lives.
+    const QImage image = frames(0xff0000ff).constFirst();
+    QCOMPARE(QWinIconFileCache::key(QVector<QImage>() << image.copy()),
+             QWinIconFileCache::key(QVector<QImage>() << image));
+}
+
+void tst_QWinIconFileCache::writeOnce()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QWinIconFileCache cache(dir.path() + QLatin1String("/icons"));
+    const QVector<QImage> icon = frames(0xffff0000);
+
+    const QString path = cache.iconPath(icon);
+    QVERIFY(!path.isEmpty());
+    QCOMPARE(QFileInfo(path).fileName(), QString::fromLatin1(QWinIconFileCache::key(icon) + ".ico"));
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.readAll(), QWinIcoWriter::encode(icon));
+    file.close();
+    QCOMPARE(cache.statistics().misses, quint64(1));
+    QCOMPARE(cache.statistics().hits, quint64(0));
+
+    // An existing file is never rewritten.
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("marker");
+    file.close();
+    QCOMPARE(cache.iconPath(icon), path);
+    QCOMPARE(QWinIconFileCache(cache.directory()).iconPath(icon), path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.readAll(), QByteArray("marker"));
+    QCOMPARE(cache.statistics().hits, quint64(1));
+    QCOMPARE(cache.statistics().misses, quint64(1));
+
+    cache.resetStatistics();
+    QCOMPARE(cache.statistics().hits, quint64(0));
+    QVERIFY(cache.iconPath(QVector<QImage>()).isEmpty());
+}
+
+void tst_QWinIconFileCache::hitRefreshesUseTime()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QVector<QImage> icon = frames(0xff00ff00);
+    const QString path = QWinIconFileCache(dir.path()).iconPath(icon);
+    QVERIFY(!path.isEmpty());
+    const QDateTime old = QDateTime::currentDateTimeUtc().addDays(-10);
+    QVERIFY(setModificationTime(path, old));
+
+    QWinIconFileCache cache(dir.path());
+    QCOMPARE(cache.iconPath(icon), path);
+    QVERIFY(QFileInfo(path).lastModified().toUTC() > old.addDays(9));
+}
+
+void tst_QWinIconFileCache::sweepByAge()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString stale = createFile(dir.path(), QLatin1String("stale.ico"), 100, 40);
+    const QString recent = createFile(dir.path(), QLatin1String("recent.ico"), 100, 2);
+    const QString other = createFile(dir.path(), QLatin1String("other.txt"), 100, 40);
+
+    QWinIconFileCache cache(dir.path());
+    QCOMPARE(cache.sweep(), 1);
+    QVERIFY(!QFile::exists(stale));
+    QVERIFY(QFile::exists(recent));
+    QVERIFY(QFile::exists(other));
+    QCOMPARE(cache.statistics().evictions, quint64(1));
+
+    cache.setMaximumAge(24 * 60 * 60);
+    QCOMPARE(cache.sweep(), 1);
+    QVERIFY(!QFile::exists(recent));
+}
+
+void tst_QWinIconFileCache::sweepBySize()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QStringList paths;
+    for (int i = 0; i < 5; ++i)
+        paths << createFile(dir.path(), QString::number(i) + QLatin1String(".ico"), 1000, 5 - i);
+
+    QWinIconFileCache cache(dir.path());
+    cache.setMaximumSize(2500);
+    QCOMPARE(cache.sweep(), 3);
+    // The least recently used files go first.
+    QVERIFY(!QFile::exists(paths.at(0)));
+    QVERIFY(!QFile::exists(paths.at(1)));
+    QVERIFY(!QFile::exists(paths.at(2)));
+    QVERIFY(QFile::exists(paths.at(3)));
+    QVERIFY(QFile::exists(paths.at(4)));
+    QCOMPARE(cache.sweep(), 0);
+}
+
+void tst_QWinIconFileCache::inUseFilesAreKept()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QWinIconFileCache cache(dir.path());
+    const QString path = cache.iconPath(frames(0xff0000ff));
+    QVERIFY(!path.isEmpty());
+    QVERIFY(setModificationTime(path, QDateTime::currentDateTimeUtc().addDays(-100)));
+
+    cache.setMaximumSize(0);
+    QCOMPARE(cache.sweep(), 0);
+    QVERIFY(QFile::exists(path));
+    QWinIconFileCache otherProcess(dir.path());
+    otherProcess.setMaximumSize(0);
+    QCOMPARE(otherProcess.sweep(), 1);
+}
+
+void tst_QWinIconFileCache::markInUse()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QVector<QImage> icon = frames(0xffff00ff);
+    const QString path = QWinIconFileCache(dir.path()).iconPath(icon);
+    QVERIFY(!path.isEmpty());
+    const QDateTime old = QDateTime::currentDateTimeUtc().addDays(-100);
+    QVERIFY(setModificationTime(path, old));
+
+    // A later run that finds the shell still showing the file.
+    QWinIconFileCache cache(dir.path());
+    QVERIFY(!cache.markInUse(QWinIconFileCache::key(frames(0xff00ffff))));
+    QVERIFY(cache.markInUse(QWinIconFileCache::key(icon)));
+    QVERIFY(QFileInfo(path).lastModified().toUTC() > old.addDays(99));
+    QVERIFY(setModificationTime(path, old));
+    cache.setMaximumSize(0);
+    QCOMPARE(cache.sweep(), 0);
+    QVERIFY(QFile::exists(path));
+}
+
+void tst_QWinIconFileCache::unlimited()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString stale = createFile(dir.path(), QLatin1String("stale.ico"), 1000, 400);
+    const QString large = createFile(dir.path(), QLatin1String("large.ico"), 100000, 0);
+
+    QWinIconFileCache cache(dir.path());
+    cache.setMaximumSize(-1);
+    cache.setMaximumAge(-1);
+    QVERIFY(!cache.iconPath(frames(0xff808080)).isEmpty());
+    QCOMPARE(cache.sweep(), 0);
+    QVERIFY(QFile::exists(stale));
+    QVERIFY(QFile::exists(large));
+
+    // Either limit alone still applies.
+    cache.setMaximumAge(QWinIconFileCache::DefaultMaximumAge);
+    QCOMPARE(cache.sweep(), 1);
+    QVERIFY(!QFile::exists(stale));
+    cache.setMaximumSize(1000);
+    QCOMPARE(cache.sweep(), 1);
+    QVERIFY(!QFile::exists(large));
+}
+
+void tst_QWinIconFileCache::writeFailure()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    // A file where the directory should be.
+    const QString blocked = createFile(dir.path(), QLatin1String("blocked"), 1, 0);
+    QWinIconFileCache cache(blocked);
+    QVERIFY(cache.iconPath(frames(0xffffffff)).isEmpty());
+    QCOMPARE(cache.statistics().writeFailures, quint64(1));
+    QCOMPARE(cache.statistics().misses, quint64(1));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinIconFileCache)
+
+#include "tst_qwiniconfilecache.moc"
@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwiniconpyramid
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwiniconpyramid.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconpyramid.cpp
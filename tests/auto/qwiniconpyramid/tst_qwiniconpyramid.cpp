@@ -0,0 +1,206 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QIcon>
+#include <QImage>
+#include <QPixmap>
+
+#include "qwiniconpyramid_p.h"
+
+class tst_QWinIconPyramid : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void halved();
+    void halvedOddSizes_data();
+    void halvedOddSizes();
+    void halvedStaysPremultiplied();
+    void standardSizes();
+    void levels();
+    void noUpscale();
+    void aspectRatio();
+    void nativeSizes();
+    void cachedPixmap();
+};
+
+static QImage noise(int width, int height)
+{
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    quint32 seed = 1;
+    for (int y = 0; y < height; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            seed = seed * 1103515245 + 12345;
+            line[x] = qPremultiply(seed);
+        }
+    }
+    return image;
+}
+
+void tst_QWinIconPyramid::halved()
+{
+    QImage image(2, 2, QImage::Format_ARGB32_Premultiplied);
+    image.setPixel(0, 0, 0xff000000);
+    image.setPixel(1, 0, 0xffffffff);
+    image.setPixel(0, 1, 0x80402010);
+    image.setPixel(1, 1, 0x00000000);
+
+    const QImage result = QWinIconPyramid::halved(image);
+    QCOMPARE(result.size(), QSize(1, 1));
+    QCOMPARE(result.format(), QImage::Format_ARGB32_Premultiplied);
+    // (0xff + 0xff + 0x80 + 0x00 + 2) / 4 = 0xa0 and so on, rounded.
+    QCOMPARE(*reinterpret_cast<const quint32 *>(result.constScanLine(0)), quint32(0xa0504844));
+}
+
+void tst_QWinIconPyramid::halvedOddSizes_data()
+{
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<QSize>("expected");
+
+    QTest::newRow("5x3") << QSize(5, 3) << QSize(2, 1);
+    QTest::newRow("1x8") << QSize(1, 8) << QSize(1, 4);
+    QTest::newRow("9x1") << QSize(9, 1) << QSize(4, 1);
+    QTest::newRow("1x1") << QSize(1, 1) << QSize(1, 1);
+}
+
+void tst_QWinIconPyramid::halvedOddSizes()
+{
+    QFETCH(QSize, size);
+    QFETCH(QSize, expected);
+
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(0x80402010);
+    const QImage result = QWinIconPyramid::halved(image);
+    QCOMPARE(result.size(), expected);
+    for (int y = 0; y < result.height(); ++y) {
+        for (int x = 0; x < result.width(); ++x)
+            QCOMPARE(*reinterpret_cast<const quint32 *>(result.constScanLine(y) + 4 * x), quint32(0x80402010));
+    }
+}
+
+void tst_QWinIconPyramid::halvedStaysPremultiplied()
+{
+    const QImage result = QWinIconPyramid::halved(noise(128, 64));
+    for (int y = 0; y < result.height(); ++y) {
+        const QRgb *line = reinterpret_cast<const QRgb *>(result.constScanLine(y));
+        for (int x = 0; x < result.width(); ++x) {
+            const int alpha = qAlpha(line[x]);
+            QVERIFY(qRed(line[x]) <= alpha && qGreen(line[x]) <= alpha && qBlue(line[x]) <= alpha);
+        }
+    }
+}
+
+void tst_QWinIconPyramid::standardSizes()
+{
+    const QVector<int> sizes = QWinIconPyramid::standardSizes();
+    QCOMPARE(sizes, QVector<int>() << 16 << 20 << 24 << 32 << 48 << 64 << 256);
+}
+
+void tst_QWinIconPyramid::levels()
+{
+    const QImage source = noise(256, 256);
+    const QWinIconPyramid pyramid(source);
+    QCOMPARE(pyramid.sourceSize(), QSize(256, 256));
+
+    const QVector<int> sizes = QWinIconPyramid::standardSizes();
+    for (int size : sizes)
+        QCOMPARE(pyramid.image(size).size(), QSize(size, size));
+    QCOMPARE(pyramid.image(256), source);
+
+    // Powers of two are exact halvings.
+    const QImage half = QWinIconPyramid::halved(source);
+    const QImage quarter = QWinIconPyramid::halved(half);
+    QCOMPARE(pyramid.image(128), half);
+    QCOMPARE(pyramid.image(64), quarter);
+    QCOMPARE(pyramid.image(32), QWinIconPyramid::halved(quarter));
+}
+
+void tst_QWinIconPyramid::noUpscale()
+{
+    const QImage source = noise(20, 20);
+    const QWinIconPyramid pyramid(source);
+    QCOMPARE(pyramid.image(32), source);
+    QCOMPARE(pyramid.image(20), source);
+    QCOMPARE(pyramid.image(16).size(), QSize(16, 16));
+    QVERIFY(QWinIconPyramid().image(16).isNull());
+    QVERIFY(pyramid.image(0).isNull());
+}
+
+void tst_QWinIconPyramid::aspectRatio()
+{
+    const QWinIconPyramid pyramid(noise(256, 128));
+    QCOMPARE(pyramid.image(64).size(), QSize(64, 32));
+    QCOMPARE(pyramid.image(QSize(200, 150)).size(), QSize(200, 100));
+    QCOMPARE(pyramid.image(QSize(256, 20)).size(), QSize(40, 20));
+}
+
+static QPixmap filledPixmap(int size, QRgb color)
+{
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(color);
+    return QPixmap::fromImage(image);
+}
+
+void tst_QWinIconPyramid::nativeSizes()
+{
+    QIcon icon;
+    icon.addPixmap(filledPixmap(256, 0xff0000ff));
+    icon.addPixmap(filledPixmap(16, 0xffff0000));
+
+    const QWinIconPyramid pyramid(icon);
+    QCOMPARE(pyramid.sourceSize(), QSize(256, 256));
+    // The hand made 16 pixel image is preferred over a downscaled one.
+    QCOMPARE(pyramid.image(16).pixel(8, 8), QRgb(0xffff0000));
+    QCOMPARE(pyramid.image(32).pixel(8, 8), QRgb(0xff0000ff));
+    QCOMPARE(pyramid.image(20).size(), QSize(20, 20));
+}
+
+void tst_QWinIconPyramid::cachedPixmap()
+{
+    QWinIconPyramid::clearCache();
+    QIcon icon;
+    icon.addPixmap(filledPixmap(64, 0xff00ff00));
+
+    const QPixmap small = QWinIconPyramid::cachedPixmap(icon, 16);
+    QCOMPARE(small.size(), QSize(16, 16));
+    QCOMPARE(small.toImage().pixel(4, 4), QRgb(0xff00ff00));
+    QCOMPARE(QWinIconPyramid::cachedPixmap(icon, 24).size(), QSize(24, 24));
+    QCOMPARE(QWinIconPyramid::cachedPixmap(icon, 256).size(), QSize(64, 64));
+    QVERIFY(QWinIconPyramid::cachedPixmap(QIcon(), 16).isNull());
+
+    // A modified icon gets a new cache key and a new pyramid.
+    icon.addPixmap(filledPixmap(16, 0xffff0000));
+    QCOMPARE(QWinIconPyramid::cachedPixmap(icon, 16).toImage().pixel(4, 4), QRgb(0xffff0000));
+    QWinIconPyramid::clearCache();
+}
+
+QTEST_MAIN(tst_QWinIconPyramid)
+
+#include "tst_qwiniconpyramid.moc"
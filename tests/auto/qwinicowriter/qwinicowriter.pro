@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinicowriter
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinicowriter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinicowriter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
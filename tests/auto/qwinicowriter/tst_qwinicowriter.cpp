@@ -0,0 +1,234 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QBuffer>
+#include <QImage>
+#include <QImageReader>
+#include <QtEndian>
+
+#include "qwinicowriter_p.h"
+
+class tst_QWinIcoWriter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void bitmapFrame_data();
+    void bitmapFrame();
+    void pngFrame_data();
+    void pngFrame();
+    void directory();
+    void forcedEncoding();
+    void invalidFrames();
+    void writeToDevice();
+    void imageReader();
+};
+
+static QImage testImage(int width, int height, QImage::Format format = QImage::Format_ARGB32)
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+    for (int y = 0; y < height; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x)
+            line[x] = qRgba(x * 5, y * 3, (x + y) & 0xff, (x * 11 + y * 7) & 0xff);
+    }
+    return image.convertToFormat(format);
+}
+
+static quint16 readU16(const QByteArray &data, int offset)
+{
+    return qFromLittleEndian<quint16>(reinterpret_cast<const uchar *>(data.constData()) + offset);
+}
+
+static quint32 readU32(const QByteArray &data, int offset)
+{
+    return qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data.constData()) + offset);
+}
+
+static void formats()
+{
+    QTest::addColumn<QImage>("image");
+
+    QTest::newRow("ARGB32") << testImage(37, 21);
+    QTest::newRow("ARGB32_Premultiplied") << testImage(37, 21, QImage::Format_ARGB32_Premultiplied);
+    QTest::newRow("RGB32") << testImage(16, 16, QImage::Format_RGB32);
+    QTest::newRow("RGBA8888") << testImage(20, 20, QImage::Format_RGBA8888);
+    QTest::newRow("1x1") << testImage(1, 1);
+    QTest::newRow("256x256") << testImage(256, 256);
+}
+
+void tst_QWinIcoWriter::bitmapFrame_data()
+{
+    formats();
+}
+
+void tst_QWinIcoWriter::bitmapFrame()
+{
+    QFETCH(QImage, image);
+    const int width = image.width();
+    const int height = image.height();
+    const QImage expected = image.convertToFormat(QImage::Format_ARGB32);
+    const int maskBytesPerLine = ((width + 31) / 32) * 4;
+
+    const QByteArray frame = QWinIcoWriter::encodeBitmap(image);
+    QCOMPARE(frame.size(), 40 + width * height * 4 + maskBytesPerLine * height);
+    QCOMPARE(readU32(frame, 0), 40u);
+    QCOMPARE(int(readU32(frame, 4)), width);
+    QCOMPARE(int(readU32(frame, 8)), 2 * height);
+    QCOMPARE(readU16(frame, 12), quint16(1));
+    QCOMPARE(readU16(frame, 14), quint16(32));
+    QCOMPARE(readU32(frame, 16), 0u);
+    QCOMPARE(int(readU32(frame, 20)), frame.size() - 40);
+
+    const int maskOffset = 40 + width * height * 4;
+    for (int y = 0; y < height; ++y) {
+        const int row = height - 1 - y;
+        for (int x = 0; x < width; ++x) {
+            const QRgb pixel = readU32(frame, 40 + (row * width + x) * 4);
+            QCOMPARE(pixel, expected.pixel(x, y));
+            const bool masked = uchar(frame.at(maskOffset + row * maskBytesPerLine + x / 8)) & (0x80 >> (x % 8));
+            QCOMPARE(masked, qAlpha(pixel) < 128);
+        }
+        for (int x = width; x < maskBytesPerLine * 8; ++x)
+            QVERIFY(!(uchar(frame.at(maskOffset + row * maskBytesPerLine + x / 8)) & (0x80 >> (x % 8))));
+    }
+}
+
+void tst_QWinIcoWriter::pngFrame_data()
+{
+    formats();
+}
+
+void tst_QWinIcoWriter::pngFrame()
+{
+    QFETCH(QImage, image);
+
+    const QByteArray png = QWinIcoWriter::encodePng(image);
+    QVERIFY(png.startsWith("\x89PNG\r\n\x1a\n"));
+    const QImage decoded = QImage::fromData(png, "PNG");
+    QVERIFY(!decoded.isNull());
+    QCOMPARE(decoded.convertToFormat(QImage::Format_ARGB32), image.convertToFormat(QImage::Format_ARGB32));
+}
+
+void tst_QWinIcoWriter::directory()
+{
+    const QVector<QImage> frames = QVector<QImage>() << testImage(16, 16) << testImage(32, 32)
+                                                     << testImage(48, 24) << testImage(256, 256);
+    const QByteArray ico = QWinIcoWriter::encode(frames);
+    QVERIFY(!ico.isEmpty());
+    QCOMPARE(readU16(ico, 0), quint16(0));
+    QCOMPARE(readU16(ico, 2), quint16(1));
+    QCOMPARE(int(readU16(ico, 4)), frames.size());
+
+    int offset = 6 + 16 * frames.size();
+    for (int i = 0; i < frames.size(); ++i) {
+        const int entry = 6 + 16 * i;
+        QCOMPARE(int(uchar(ico.at(entry))), frames.at(i).width() % 256);
+        QCOMPARE(int(uchar(ico.at(entry + 1))), frames.at(i).height() % 256);
+        QCOMPARE(readU16(ico, entry + 4), quint16(1));
+        QCOMPARE(readU16(ico, entry + 6), quint16(32));
+        const int size = int(readU32(ico, entry + 8));
+        QCOMPARE(int(readU32(ico, entry + 12)), offset);
+
+        const QByteArray data = ico.mid(offset, size);
+        if (i == frames.size() - 1)
+            QCOMPARE(data, QWinIcoWriter::encodePng(frames.at(i)));
+        else
+            QCOMPARE(data, QWinIcoWriter::encodeBitmap(frames.at(i)));
+        offset += size;
+    }
+    QCOMPARE(offset, ico.size());
+}
+
+void tst_QWinIcoWriter::forcedEncoding()
+{
+    const QVector<QImage> frames = QVector<QImage>() << testImage(16, 16) << testImage(256, 256);
+    const int firstFrame = 6 + 2 * 16;
+
+    const QByteArray png = QWinIcoWriter::encode(frames, QWinIcoWriter::Png);
+    QCOMPARE(png.mid(firstFrame, 4), QByteArray("\x89PNG"));
+
+    const QByteArray bitmap = QWinIcoWriter::encode(frames, QWinIcoWriter::Bitmap);
+    const int secondFrame = int(readU32(bitmap, 6 + 16 + 12));
+    QCOMPARE(readU32(bitmap, secondFrame), 40u);
+    QCOMPARE(int(readU32(bitmap, 6 + 16 + 8)), 40 + 256 * 256 * 4 + 32 * 256);
+}
+
+void tst_QWinIcoWriter::invalidFrames()
+{
+    QVERIFY(QWinIcoWriter::encode(QVector<QImage>()).isEmpty());
+    QVERIFY(QWinIcoWriter::encode(QVector<QImage>() << testImage(16, 16) << QImage()).isEmpty());
+    QVERIFY(QWinIcoWriter::encode(QVector<QImage>() << testImage(257, 16)).isEmpty());
+    QVERIFY(QWinIcoWriter::encodePng(QImage()).isEmpty());
+    QVERIFY(QWinIcoWriter::encodeBitmap(QImage()).isEmpty());
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(!QWinIcoWriter::write(&buffer, QVector<QImage>() << QImage()));
+    QCOMPARE(buffer.size(), qint64(0));
+}
+
+void tst_QWinIcoWriter::writeToDevice()
+{
+    const QVector<QImage> frames = QVector<QImage>() << testImage(16, 16) << testImage(256, 256);
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(QWinIcoWriter::write(&buffer, frames));
+    QCOMPARE(buffer.data(), QWinIcoWriter::encode(frames));
+
+    QBuffer readOnly;
+    QVERIFY(readOnly.open(QIODevice::ReadOnly));
+    QVERIFY(!QWinIcoWriter::write(&readOnly, frames));
+}
+
+void tst_QWinIcoWriter::imageReader()
+{
+    if (!QImageReader::supportedImageFormats().contains("ico"))
+        QSKIP("The ico image format plugin is not available.");
+
+    const QVector<QImage> frames = QVector<QImage>() << testImage(16, 16) << testImage(32, 32)
+                                                     << testImage(256, 256);
+    QByteArray ico = QWinIcoWriter::encode(frames);
+    QBuffer buffer(&ico);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QImageReader reader(&buffer, "ico");
+    QCOMPARE(reader.imageCount(), frames.size());
+    for (int i = 0; i < frames.size(); ++i) {
+        QVERIFY(reader.jumpToImage(i));
+        const QImage image = reader.read();
+        QVERIFY2(!image.isNull(), qPrintable(reader.errorString()));
+        // The plugin premultiplies bitmap frames.
+        QCOMPARE(image.convertToFormat(QImage::Format_ARGB32_Premultiplied),
+                 frames.at(i).convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinIcoWriter)
+
+#include "tst_qwinicowriter.moc"
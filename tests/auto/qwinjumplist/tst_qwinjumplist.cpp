@@ -31,6 +31,7 @@
 #include <QWinJumpListItem>
 #include <QWinJumpListCategory>
 #include <QOperatingSystemVersion>
+#include <QStandardItemModel>
 
 Q_DECLARE_METATYPE(QWinJumpListItem::Type)
 
@@ -42,9 +43,14 @@ private slots:
     void testRecent();
     void testFrequent();
     void testTasks();
+    void testAddItems();
     void testCategories();
     void testItems_data();
     void testItems();
+    void testAsynchronous();
+    void testState();
+    void testModel();
+    void testRebuildCounters();
 };
 
 static inline QByteArray msgFileNameMismatch(const QString &f1, const QString &f2)
@@ -198,6 +204,31 @@ void tst_QWinJumpList::testTasks()
     QVERIFY(tasks->items().isEmpty());
 }
 
+void tst_QWinJumpList::testAddItems()
+{
+    QWinJumpList jumplist;
+    QWinJumpListCategory *tasks = jumplist.tasks();
+    QWinJumpListItem *link = new QWinJumpListItem(QWinJumpListItem::Link);
+    QWinJumpListItem *separator = new QWinJumpListItem(QWinJumpListItem::Separator);
+    tasks->addItems(QList<QWinJumpListItem *>() << link << nullptr << separator << link);
+    QCOMPARE(tasks->items(), QList<QWinJumpListItem *>() << link << separator);
+
+    // Recent documents are added once, whatever the separators and case.
+    QWinJumpListCategory *recent = jumplist.recent();
+    recent->clear();
+    const QString applicationFilePath = QCoreApplication::applicationFilePath();
+    QWinJumpListItem *document = new QWinJumpListItem(QWinJumpListItem::Link);
+    document->setFilePath(applicationFilePath);
+    QWinJumpListItem *duplicate = new QWinJumpListItem(QWinJumpListItem::Link);
+    duplicate->setFilePath(QDir::toNativeSeparators(applicationFilePath).toUpper());
+    QWinJumpListItem *destination = new QWinJumpListItem(QWinJumpListItem::Destination);
+    QTest::ignoreMessage(QtWarningMsg, "QWinJumpListCategory::addItems(): only tasks/custom categories support destinations.");
+    recent->addItems(QList<QWinJumpListItem *>() << document << duplicate << destination);
+    jumplist.flush();
+    QCOMPARE(recent->items(), QList<QWinJumpListItem *>() << document);
+    recent->clear();
+}
+
 void tst_QWinJumpList::testCategories()
 {
     QWinJumpList jumplist;
@@ -270,6 +301,157 @@ void tst_QWinJumpList::testItems()
     QCOMPARE(item.arguments(), QCoreApplication::arguments());
 }
 
+void tst_QWinJumpList::testAsynchronous()
+{
+    QWinJumpList jumplist;
+    QVERIFY(!jumplist.isAsynchronous());
+    jumplist.setAsynchronous(true);
+    QVERIFY(jumplist.isAsynchronous());
+
+    QSignalSpy spy(&jumplist, &QWinJumpList::committed);
+    QWinJumpListCategory *tasks = jumplist.tasks();
+    tasks->setVisible(true);
+    tasks->addLink(QStringLiteral("tst_QWinJumpList"), QCoreApplication::applicationFilePath());
+    jumplist.flush();
+    QVERIFY(jumplist.lastCommit().isFinished());
+    QTRY_VERIFY(!spy.isEmpty());
+
+    jumplist.setAsynchronous(false);
+    QVERIFY(!jumplist.isAsynchronous());
+    tasks->clear();
+    jumplist.flush();
+    QVERIFY(jumplist.lastCommit().isFinished());
+}
+
+void tst_QWinJumpList::testState()
+{
+    const QString identifier = QStringLiteral("org.qt-project.tst_QWinJumpList.testState");
+    auto setUp = [&identifier](QWinJumpList *jumplist) {
+        jumplist->setIdentifier(identifier);
+        jumplist->tasks()->setVisible(true);
+        jumplist->tasks()->addLink(QStringLiteral("tst_QWinJumpList"), QCoreApplication::applicationFilePath(),
+                                   QStringList(QStringLiteral("--state")));
+        QWinJumpListCategory *category = jumplist->addCategory(QStringLiteral("Documents"));
+        category->setVisible(true);
+        category->addDestination(QCoreApplication::applicationFilePath());
+    };
+
+    QByteArray state;
+    {
+        QWinJumpList jumplist;
+        setUp(&jumplist);
+        QSignalSpy spy(&jumplist, &QWinJumpList::committed);
+        QCOMPARE(jumplist.maximumSlots(), 0);
+        jumplist.flush();
+        QCOMPARE(spy.count(), 1);
+        QVERIFY(jumplist.maximumSlots() > 0);
+        state = jumplist.saveState();
+    }
+
+    // The next start finds the same jump list committed.
+    {
+        QWinJumpList jumplist;
+        setUp(&jumplist);
+        QSignalSpy spy(&jumplist, &QWinJumpList::committed);
+        jumplist.flush();
+        QVERIFY(spy.isEmpty());
+        QCOMPARE(jumplist.saveState(), state);
+    }
+
+    QWinJumpList jumplist;
+    QVERIFY(!jumplist.restoreState(state.left(state.size() - 1)));
+    QVERIFY(jumplist.restoreState(state));
+    QCOMPARE(jumplist.identifier(), identifier);
+    QCOMPARE(jumplist.tasks()->count(), 1);
+    QCOMPARE(jumplist.tasks()->items().at(0)->arguments(), QStringList(QStringLiteral("--state")));
+    QCOMPARE(jumplist.categories().size(), 1);
+    QCOMPARE(jumplist.categories().at(0)->title(), QStringLiteral("Documents"));
+    QCOMPARE(jumplist.saveState(), state);
+    jumplist.clear();
+    jumplist.flush();
+}
+
+void tst_QWinJumpList::testModel()
+{
+    QStandardItemModel model;
+    QWinJumpList jumplist;
+    jumplist.setIdentifier(QStringLiteral("org.qt-project.tst_QWinJumpList.testModel"));
+    QWinJumpListCategory *tasks = jumplist.tasks();
+    tasks->setVisible(true);
+    tasks->addSeparator();
+    tasks->setModel(&model);
+    QCOMPARE(tasks->model(), &model);
+    QCOMPARE(tasks->count(), 1);
+
+    QSignalSpy spy(&jumplist, &QWinJumpList::committed);
+    for (int i = 0; i < 3; ++i) {
+        QStandardItem *item = new QStandardItem(QStringLiteral("Task %1").arg(i));
+        item->setData(QStringList(QStringLiteral("--task=%1").arg(i)), tasks->argumentsRole());
+        model.appendRow(item);
+    }
+    QCOMPARE(tasks->count(), 4);
+    QWinJumpListItem *first = tasks->items().at(0);
+    QCOMPARE(first->type(), QWinJumpListItem::Link);
+    QCOMPARE(first->title(), QStringLiteral("Task 0"));
+    QCOMPARE(first->filePath(), QCoreApplication::applicationFilePath());
+    QCOMPARE(first->arguments(), QStringList(QStringLiteral("--task=0")));
+    QCOMPARE(tasks->items().at(3)->type(), QWinJumpListItem::Separator);
+
+    // Changing a row keeps the other items.
+    model.item(1)->setText(QStringLiteral("Renamed"));
+    QCOMPARE(tasks->items().at(0), first);
+    QCOMPARE(tasks->items().at(1)->title(), QStringLiteral("Renamed"));
+    model.removeRow(0);
+    QCOMPARE(tasks->count(), 3);
+
+    // The changes of one pass of the event loop are committed once.
+    QTRY_COMPARE(spy.count(), 1);
+
+    QTest::ignoreMessage(QtWarningMsg, "QWinJumpListCategory::setModel(): only tasks/custom categories support models.");
+    jumplist.recent()->setModel(&model);
+    QVERIFY(!jumplist.recent()->model());
+
+    // Clearing removes the other items only; unsetting the model its links.
+    tasks->clear();
+    QCOMPARE(tasks->model(), &model);
+    QCOMPARE(tasks->count(), 2);
+    QCOMPARE(tasks->items().at(1)->title(), QStringLiteral("Task 2"));
+    tasks->addSeparator();
+    model.appendRow(new QStandardItem(QStringLiteral("Task 3")));
+    QCOMPARE(tasks->count(), 4);
+    QCOMPARE(tasks->items().at(2)->title(), QStringLiteral("Task 3"));
+    tasks->setModel(nullptr);
+    QCOMPARE(tasks->count(), 1);
+    QCOMPARE(tasks->items().at(0)->type(), QWinJumpListItem::Separator);
+    model.appendRow(new QStandardItem(QStringLiteral("Ignored")));
+    QCOMPARE(tasks->count(), 1);
+    jumplist.flush();
+}
+
+void tst_QWinJumpList::testRebuildCounters()
+{
+    QWinJumpList jumplist;
+    jumplist.flush();
+    const quint64 requested = jumplist.requestedRebuildCount();
+    const quint64 executed = jumplist.executedRebuildCount();
+
+    // Queued changes made in one go are rebuilt once.
+    QWinJumpListCategory *tasks = jumplist.tasks();
+    tasks->setVisible(true);
+    tasks->addLink(QStringLiteral("One"), QCoreApplication::applicationFilePath());
+    tasks->addLink(QStringLiteral("Two"), QCoreApplication::applicationFilePath());
+    QVERIFY(jumplist.requestedRebuildCount() >= requested + 3);
+    QCOMPARE(jumplist.executedRebuildCount(), executed);
+    jumplist.flush();
+    QCOMPARE(jumplist.executedRebuildCount(), executed + 1);
+
+    jumplist.setRebuildPolicy(QWinJumpList::ImmediateRebuild);
+    const quint64 immediate = jumplist.executedRebuildCount();
+    tasks->clear();
+    QCOMPARE(jumplist.executedRebuildCount(), immediate + 1);
+    QVERIFY(jumplist.requestedRebuildCount() >= jumplist.executedRebuildCount());
+}
+
 QTEST_MAIN(tst_QWinJumpList)
 
 #include "tst_qwinjumplist.moc"
@@ -0,0 +1,10 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistcommitter
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistcommitter_p.h
+SOURCES += \
+    tst_qwinjumplistcommitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistcommitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp
@@ -0,0 +1,277 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QSemaphore>
+#include <QThread>
+
+#include "qwinjumplistcommitter_p.h"
+
+class tst_QWinJumpListCommitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void commit();
+    void failure();
+    void workerThread();
+    void supersededWhileWaiting();
+    void abortedWhileRunning();
+    void waitForIdle();
+    void destruction();
+};
+
+// Stand-in for the shell: records the identifiers of the snapshots it
+// commits, and can be held at a gate to keep the worker busy.
+struct BackendState
+{
+    QMutex mutex;
+    QStringList commits;
+    QVector<QThread *> threads;
+    QSemaphore gate;
+    QSemaphore entered;
+    bool gated = false;
+    bool abortWhileGated = false;
+    QWinJumpListCommitter::Result result = QWinJumpListCommitter::Committed;
+    int started = 0;
+    int finished = 0;
+};
+
+class StandInBackend : public QWinJumpListCommitter::Backend
+{
+public:
+    explicit StandInBackend(BackendState *state) : m_state(state) {}
+
+    void threadStarted() override
+    {
+        QMutexLocker locker(&m_state->mutex);
+        ++m_state->started;
+        m_state->threads.append(QThread::currentThread());
+    }
+
+    void threadFinished() override
+    {
+        QMutexLocker locker(&m_state->mutex);
+        ++m_state->finished;
+    }
+
+    QWinJumpListCommitter::Result commit(const QWinJumpListSnapshot &snapshot,
+                                         const std::function<bool()> &isSuperseded) override
+    {
+        m_state->entered.release();
+        if (m_state->gated) {
+            while (!m_state->gate.tryAcquire(1, 5)) {
+                if (m_state->abortWhileGated && isSuperseded())
+                    return QWinJumpListCommitter::Aborted;
+            }
+        }
+        if (isSuperseded())
+            return QWinJumpListCommitter::Aborted;
+        QMutexLocker locker(&m_state->mutex);
+        m_state->commits.append(snapshot.identifier());
+        m_state->threads.append(QThread::currentThread());
+        return m_state->result;
+    }
+
+private:
+    BackendState *m_state;
+};
+
+static QWinJumpListSnapshot snapshot(const QString &identifier)
+{
+    QWinJumpListSnapshot result(identifier);
+    QWinJumpListSnapshot::Category category;
+    category.type = QWinJumpListSnapshot::Tasks;
+    category.visible = true;
+    QWinJumpListSnapshot::Item item;
+    item.type = QWinJumpListSnapshot::Link;
+    item.title = identifier;
+    category.items.append(item);
+    result.appendCategory(category);
+    return result;
+}
+
+void tst_QWinJumpListCommitter::commit()
+{
+    BackendState state;
+    QWinJumpListCommitter committer(new StandInBackend(&state));
+    QSignalSpy spy(&committer, &QWinJumpListCommitter::committed);
+
+    QFuture<bool> future = committer.submit(snapshot(QStringLiteral("a")));
+    future.waitForFinished();
+    QVERIFY(!future.isCanceled());
+    QCOMPARE(future.result(), true);
+    QCOMPARE(state.commits, QStringList{ QStringLiteral("a") });
+
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toBool(), true);
+
+    const QWinJumpListCommitter::Statistics statistics = committer.statistics();
+    QCOMPARE(statistics.submitted, quint64(1));
+    QCOMPARE(statistics.committed, quint64(1));
+    QCOMPARE(statistics.failed, quint64(0));
+    QCOMPARE(statistics.superseded, quint64(0));
+}
+
+void tst_QWinJumpListCommitter::failure()
+{
+    BackendState state;
+    state.result = QWinJumpListCommitter::Failed;
+    QWinJumpListCommitter committer(new StandInBackend(&state));
+    QSignalSpy spy(&committer, &QWinJumpListCommitter::committed);
+
+    QFuture<bool> future = committer.submit(snapshot(QStringLiteral("a")));
+    future.waitForFinished();
+    QVERIFY(!future.isCanceled());
+    QCOMPARE(future.result(), false);
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toBool(), false);
+    QCOMPARE(committer.statistics().failed, quint64(1));
+}
+
+void tst_QWinJumpListCommitter::workerThread()
+{
+    BackendState state;
+    {
+        QWinJumpListCommitter committer(new StandInBackend(&state));
+        committer.submit(snapshot(QStringLiteral("a"))).waitForFinished();
+        committer.submit(snapshot(QStringLiteral("b"))).waitForFinished();
+    }
+    // Started and finished once, with every commit on the same thread, which
+    // is not the thread that submitted them.
+    QCOMPARE(state.started, 1);
+    QCOMPARE(state.finished, 1);
+    QCOMPARE(state.threads.size(), 3);
+    QVERIFY(state.threads.at(0) != QThread::currentThread());
+    QCOMPARE(state.threads.at(1), state.threads.at(0));
+    QCOMPARE(state.threads.at(2), state.threads.at(0));
+}
+
+void tst_QWinJumpListCommitter::supersededWhileWaiting()
+{
+    BackendState state;
+    state.gated = true;
+    QWinJumpListCommitter committer(new StandInBackend(&state));
+    QSignalSpy spy(&committer, &QWinJumpListCommitter::committed);
+
+    QFuture<bool> a = committer.submit(snapshot(QStringLiteral("a")));
+    QVERIFY(state.entered.tryAcquire(1, 5000)); // the worker is busy with a
+    QFuture<bool> b = committer.submit(snapshot(QStringLiteral("b")));
+    QFuture<bool> c = committer.submit(snapshot(QStringLiteral("c")));
+
+    // b never reached the backend.
+    QVERIFY(b.isFinished());
+    QVERIFY(b.isCanceled());
+    QCOMPARE(b.result(), false);
+
+    // a is abandoned once it notices, c is committed.
+    state.gate.release(2);
+    a.waitForFinished();
+    c.waitForFinished();
+    QVERIFY(a.isCanceled());
+    QCOMPARE(a.result(), false);
+    QVERIFY(!c.isCanceled());
+    QCOMPARE(c.result(), true);
+    QCOMPARE(state.commits, QStringList{ QStringLiteral("c") });
+
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toBool(), true);
+
+    const QWinJumpListCommitter::Statistics statistics = committer.statistics();
+    QCOMPARE(statistics.submitted, quint64(3));
+    QCOMPARE(statistics.committed, quint64(1));
+    QCOMPARE(statistics.superseded, quint64(2));
+}
+
+void tst_QWinJumpListCommitter::abortedWhileRunning()
+{
+    BackendState state;
+    state.gated = true;
+    state.abortWhileGated = true;
+    QWinJumpListCommitter committer(new StandInBackend(&state));
+
+    QFuture<bool> a = committer.submit(snapshot(QStringLiteral("a")));
+    QVERIFY(state.entered.tryAcquire(1, 5000));
+    QFuture<bool> b = committer.submit(snapshot(QStringLiteral("b")));
+
+    // a gives up without being released.
+    a.waitForFinished();
+    QVERIFY(a.isCanceled());
+    QVERIFY(state.entered.tryAcquire(1, 5000));
+    QVERIFY(!b.isFinished());
+    state.gate.release();
+    b.waitForFinished();
+    QCOMPARE(b.result(), true);
+    QCOMPARE(state.commits, QStringList{ QStringLiteral("b") });
+}
+
+void tst_QWinJumpListCommitter::waitForIdle()
+{
+    BackendState state;
+    state.gated = true;
+    QWinJumpListCommitter committer(new StandInBackend(&state));
+    QVERIFY(committer.isIdle());
+    QVERIFY(committer.waitForIdle(0));
+
+    committer.submit(snapshot(QStringLiteral("a")));
+    QVERIFY(state.entered.tryAcquire(1, 5000));
+    QVERIFY(!committer.isIdle());
+    QVERIFY(!committer.waitForIdle(20));
+
+    state.gate.release();
+    QVERIFY(committer.waitForIdle());
+    QVERIFY(committer.isIdle());
+    QCOMPARE(state.commits, QStringList{ QStringLiteral("a") });
+}
+
+void tst_QWinJumpListCommitter::destruction()
+{
+    BackendState state;
+    state.gated = true;
+    state.abortWhileGated = true;
+    QFuture<bool> a;
+    QFuture<bool> b;
+    {
+        QWinJumpListCommitter committer(new StandInBackend(&state));
+        a = committer.submit(snapshot(QStringLiteral("a")));
+        QVERIFY(state.entered.tryAcquire(1, 5000));
+        b = committer.submit(snapshot(QStringLiteral("b")));
+    }
+    // Destroying the committer abandons the running commit and drops the
+    // waiting one.
+    QVERIFY(a.isFinished());
+    QVERIFY(a.isCanceled());
+    QVERIFY(b.isFinished());
+    QVERIFY(b.isCanceled());
+    QVERIFY(state.commits.isEmpty());
+    QCOMPARE(state.finished, 1);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinJumpListCommitter)
+
+#include "tst_qwinjumplistcommitter.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistmodelmapper
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistmodelmapper_p.h
+SOURCES += \
+    tst_qwinjumplistmodelmapper.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistmodelmapper.cpp
@@ -0,0 +1,363 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/QStandardItemModel>
+
+#include "qwinjumplistmodelmapper_p.h"
+
+// Keeps the items as the category does, and records the calls.
+class StandInSink : public QWinJumpListModelMapper::Sink
+{
+public:
+    struct Item
+    {
+        QString filePath;
+        QString title;
+        QStringList arguments;
+        QIcon icon;
+    };
+
+    void insertItems(int first, int count) override
+    {
+        items.insert(first, count, Item());
+        inserted += count;
+    }
+
+    void removeItems(int first, int count) override
+    {
+        items.remove(first, count);
+        removed += count;
+    }
+
+    void setField(int row, QWinJumpListModelMapper::Field field, const QVariant &value) override
+    {
+        Item &item = items[row];
+        switch (field) {
+        case QWinJumpListModelMapper::FilePath:
+            item.filePath = value.toString();
+            break;
+        case QWinJumpListModelMapper::Title:
+            item.title = value.toString();
+            break;
+        case QWinJumpListModelMapper::Arguments:
+            item.arguments = value.toStringList();
+            break;
+        case QWinJumpListModelMapper::Icon:
+            item.icon = qvariant_cast<QIcon>(value);
+            break;
+        case QWinJumpListModelMapper::FieldCount:
+            break;
+        }
+        ++fieldsSet;
+    }
+
+    QStringList titles() const
+    {
+        QStringList result;
+        for (const Item &item : items)
+            result.append(item.title);
+        return result;
+    }
+
+    void resetCounts() { inserted = removed = fieldsSet = 0; }
+
+    QVector<Item> items;
+    int inserted = 0;
+    int removed = 0;
+    int fieldsSet = 0;
+};
+
+// QStandardItemModel does not move rows, it removes and inserts them.
+class MovableListModel : public QAbstractListModel
+{
+public:
+    explicit MovableListModel(const QStringList &titles) : m_titles(titles) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_titles.size();
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        return role == Qt::DisplayRole ? QVariant(m_titles.at(index.row())) : QVariant();
+    }
+
+    // Moves the row at from before the row at to, as beginMoveRows() does.
+    void move(int from, int to)
+    {
+        QVERIFY(beginMoveRows(QModelIndex(), from, from, QModelIndex(), to));
+        m_titles.move(from, to > from ? to - 1 : to);
+        endMoveRows();
+    }
+
+private:
+    QStringList m_titles;
+};
+
+class tst_QWinJumpListModelMapper : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initialRows();
+    void insertedRows();
+    void removedRows();
+    void movedRows();
+    void changedData();
+    void changedRoles();
+    void childRowsAndColumns();
+    void reset();
+    void replacedAndDestroyedModel();
+    void toField();
+
+private:
+    static QStandardItem *row(const QString &title, const QString &filePath = QString(),
+                              const QStringList &arguments = QStringList());
+    static QStringList titles(int count);
+};
+
+QStandardItem *tst_QWinJumpListModelMapper::row(const QString &title, const QString &filePath,
+                                                const QStringList &arguments)
+{
+    QStandardItem *item = new QStandardItem(title);
+    if (!filePath.isEmpty())
+        item->setData(filePath, Qt::UserRole);
+    if (!arguments.isEmpty())
+        item->setData(arguments, Qt::UserRole + 1);
+    return item;
+}
+
+QStringList tst_QWinJumpListModelMapper::titles(int count)
+{
+    QStringList result;
+    for (int i = 0; i < count; ++i)
+        result.append(QString::number(i));
+    return result;
+}
+
+void tst_QWinJumpListModelMapper::initialRows()
+{
+    QStandardItemModel model;
+    model.appendRow(row(QStringLiteral("Edit"), QStringLiteral("C:/app.exe"), {QStringLiteral("--edit")}));
+    model.appendRow(row(QStringLiteral("New")));
+
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    QCOMPARE(mapper.rowCount(), 2);
+    QCOMPARE(sink.inserted, 2);
+    QCOMPARE(sink.items.at(0).title, QStringLiteral("Edit"));
+    QCOMPARE(sink.items.at(0).filePath, QStringLiteral("C:/app.exe"));
+    QCOMPARE(sink.items.at(0).arguments, QStringList(QStringLiteral("--edit")));
+    QCOMPARE(sink.items.at(1).title, QStringLiteral("New"));
+    // Fields without data are left alone.
+    QCOMPARE(sink.fieldsSet, 4);
+}
+
+void tst_QWinJumpListModelMapper::insertedRows()
+{
+    QStandardItemModel model;
+    for (const QString &title : titles(3))
+        model.appendRow(row(title));
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    sink.resetCounts();
+
+    model.insertRow(1, row(QStringLiteral("a")));
+    model.appendRow(row(QStringLiteral("b")));
+    QCOMPARE(sink.titles(), (QStringList{QStringLiteral("0"), QStringLiteral("a"), QStringLiteral("1"),
+                                         QStringLiteral("2"), QStringLiteral("b")}));
+    QCOMPARE(sink.inserted, 2);
+    QCOMPARE(sink.removed, 0);
+    QCOMPARE(sink.fieldsSet, 2);
+}
+
+void tst_QWinJumpListModelMapper::removedRows()
+{
+    QStandardItemModel model;
+    for (const QString &title : titles(5))
+        model.appendRow(row(title));
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    sink.resetCounts();
+
+    model.removeRows(1, 2);
+    QCOMPARE(sink.titles(), (QStringList{QStringLiteral("0"), QStringLiteral("3"), QStringLiteral("4")}));
+    QCOMPARE(sink.removed, 2);
+    QCOMPARE(sink.inserted, 0);
+    QCOMPARE(sink.fieldsSet, 0);
+    QCOMPARE(mapper.rowCount(), 3);
+}
+
+void tst_QWinJumpListModelMapper::movedRows()
+{
+    MovableListModel model(titles(5));
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    sink.resetCounts();
+
+    model.move(0, 5);
+    QCOMPARE(sink.titles(), (QStringList{QStringLiteral("1"), QStringLiteral("2"), QStringLiteral("3"),
+                                         QStringLiteral("4"), QStringLiteral("0")}));
+    model.move(3, 1);
+    QCOMPARE(sink.titles(), (QStringList{QStringLiteral("1"), QStringLiteral("4"), QStringLiteral("2"),
+                                         QStringLiteral("3"), QStringLiteral("0")}));
+    QCOMPARE(sink.removed, 2);
+    QCOMPARE(sink.inserted, 2);
+}
+
+void tst_QWinJumpListModelMapper::changedData()
+{
+    QStandardItemModel model;
+    for (const QString &title : titles(100))
+        model.appendRow(row(title, QStringLiteral("C:/app.exe")));
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    sink.resetCounts();
+
+    model.item(42)->setText(QStringLiteral("renamed"));
+    QCOMPARE(sink.items.at(42).title, QStringLiteral("renamed"));
+    QCOMPARE(sink.fieldsSet, 1);
+
+    // Unmapped roles and unchanged values are not passed on.
+    model.item(42)->setToolTip(QStringLiteral("tip"));
+    model.item(42)->setData(QStringLiteral("C:/app.exe"), Qt::UserRole);
+    QCOMPARE(sink.fieldsSet, 1);
+
+    model.item(7)->setData(QStringLiteral("--open"), Qt::UserRole + 1);
+    QCOMPARE(sink.items.at(7).arguments, QStringList(QStringLiteral("--open")));
+    QImage image(16, 16, QImage::Format_ARGB32);
+    image.fill(Qt::red);
+    model.item(7)->setData(image, Qt::DecorationRole);
+    QVERIFY(!sink.items.at(7).icon.isNull());
+    QCOMPARE(sink.fieldsSet, 3);
+    QCOMPARE(sink.inserted, 0);
+    QCOMPARE(sink.removed, 0);
+}
+
+void tst_QWinJumpListModelMapper::changedRoles()
+{
+    QStandardItemModel model;
+    model.appendRow(row(QStringLiteral("title")));
+    model.item(0)->setToolTip(QStringLiteral("tip"));
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    QCOMPARE(mapper.role(QWinJumpListModelMapper::Title), int(Qt::DisplayRole));
+
+    mapper.setRole(QWinJumpListModelMapper::Title, Qt::ToolTipRole);
+    QCOMPARE(sink.items.at(0).title, QStringLiteral("tip"));
+    model.item(0)->setText(QStringLiteral("ignored"));
+    QCOMPARE(sink.items.at(0).title, QStringLiteral("tip"));
+
+    mapper.setRole(QWinJumpListModelMapper::Title, -1);
+    QVERIFY(sink.items.at(0).title.isEmpty());
+}
+
+void tst_QWinJumpListModelMapper::childRowsAndColumns()
+{
+    QStandardItemModel model(0, 2);
+    model.appendRow({row(QStringLiteral("0")), new QStandardItem(QStringLiteral("column"))});
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+    sink.resetCounts();
+
+    model.item(0)->appendRow(row(QStringLiteral("child")));
+    model.item(0, 1)->setText(QStringLiteral("changed"));
+    QCOMPARE(sink.titles(), QStringList(QStringLiteral("0")));
+    QCOMPARE(sink.inserted, 0);
+    QCOMPARE(sink.fieldsSet, 0);
+}
+
+void tst_QWinJumpListModelMapper::reset()
+{
+    QStandardItemModel model;
+    for (const QString &title : titles(3))
+        model.appendRow(row(title));
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&model);
+
+    model.sort(0, Qt::DescendingOrder);
+    QCOMPARE(sink.titles(), (QStringList{QStringLiteral("2"), QStringLiteral("1"), QStringLiteral("0")}));
+
+    sink.resetCounts();
+    model.clear();
+    QVERIFY(sink.items.isEmpty());
+    QCOMPARE(sink.removed, 3);
+    QCOMPARE(mapper.rowCount(), 0);
+}
+
+void tst_QWinJumpListModelMapper::replacedAndDestroyedModel()
+{
+    QStandardItemModel first;
+    first.appendRow(row(QStringLiteral("first")));
+    QScopedPointer<QStandardItemModel> second(new QStandardItemModel);
+    for (const QString &title : titles(2))
+        second->appendRow(row(title));
+
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    mapper.setModel(&first);
+    mapper.setModel(second.data());
+    QCOMPARE(sink.titles(), titles(2));
+
+    first.appendRow(row(QStringLiteral("ignored")));
+    QCOMPARE(sink.items.size(), 2);
+
+    second.reset();
+    QVERIFY(!mapper.model());
+    QVERIFY(sink.items.isEmpty());
+    QCOMPARE(mapper.rowCount(), 0);
+}
+
+void tst_QWinJumpListModelMapper::toField()
+{
+    QCOMPARE(QWinJumpListModelMapper::toField(QWinJumpListModelMapper::Arguments, QStringLiteral("-a")),
+             QVariant(QStringList(QStringLiteral("-a"))));
+    QCOMPARE(QWinJumpListModelMapper::toField(QWinJumpListModelMapper::Title, 42), QVariant(QStringLiteral("42")));
+    const QVariant icon = QWinJumpListModelMapper::toField(QWinJumpListModelMapper::Icon, QVariant());
+    QCOMPARE(icon.userType(), int(QMetaType::QIcon));
+    QVERIFY(qvariant_cast<QIcon>(icon).isNull());
+    QPixmap pixmap(16, 16);
+    pixmap.fill(Qt::blue);
+    const QVariant fromPixmap = QWinJumpListModelMapper::toField(QWinJumpListModelMapper::Icon, pixmap);
+    QCOMPARE(fromPixmap.userType(), int(QMetaType::QIcon));
+    QVERIFY(!qvariant_cast<QIcon>(fromPixmap).isNull());
+}
+
+QTEST_MAIN(tst_QWinJumpListModelMapper)
+
+#include "tst_qwinjumplistmodelmapper.moc"
@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistpruner
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinjumplistpruner.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistpruner.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinrecentdocumentsubmitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwidestringarena.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
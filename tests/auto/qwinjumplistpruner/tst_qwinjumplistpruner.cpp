@@ -0,0 +1,274 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistpruner_p.h"
+
+// Stand-in for the destination list of the shell: BeginList() reports the
+// slots and the destinations removed by the user since the last call, and
+// CommitList() fails if one of them comes back. Destinations beyond the
+// slots are built but never shown.
+class StandInDestinationList
+{
+public:
+    void beginList(int *slotCount, QStringList *removed)
+    {
+        *slotCount = maxSlots;
+        *removed = m_pending;
+        m_pending.clear();
+    }
+
+    bool commitList(const QWinJumpListSnapshot &snapshot)
+    {
+        built = 0;
+        for (const QWinJumpListSnapshot::Category &category : snapshot.categories()) {
+            if (category.type != QWinJumpListSnapshot::Custom || !category.isEffective())
+                continue;
+            for (const QWinJumpListSnapshot::Item &item : category.items) {
+                ++built;
+                if (m_removed.contains(QWinJumpListPruner::key(item.filePath, item.arguments)))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    void remove(const QString &nativePath, const QStringList &arguments = QStringList())
+    {
+        const QString key = QWinJumpListPruner::key(nativePath, arguments);
+        m_removed.insert(key);
+        m_pending.append(key);
+    }
+
+    int maxSlots = 10;
+    int built = 0;
+
+private:
+    QSet<QString> m_removed;
+    QStringList m_pending;
+};
+
+class tst_QWinJumpListPruner : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void unlimited();
+    void trimmed_data();
+    void trimmed();
+    void tasksAndHiddenCategories();
+    void removed();
+    void removedSeparatorsAndCase();
+    void removedFreeSlots();
+
+private:
+    static QWinJumpListSnapshot::Category category(const QString &title, int itemCount,
+                                                   QWinJumpListSnapshot::CategoryType type = QWinJumpListSnapshot::Custom);
+    static QWinJumpListSnapshot model(const QVector<int> &itemCounts);
+    static bool commit(StandInDestinationList *list, QWinJumpListPruner *pruner,
+                       const QWinJumpListSnapshot &snapshot, QWinJumpListSnapshot *committed = nullptr);
+    static QVector<int> itemCounts(const QWinJumpListSnapshot &snapshot);
+};
+
+QWinJumpListSnapshot::Category tst_QWinJumpListPruner::category(const QString &title, int itemCount,
+                                                                QWinJumpListSnapshot::CategoryType type)
+{
+    QWinJumpListSnapshot::Category result;
+    result.type = type;
+    result.title = title;
+    result.visible = true;
+    for (int i = 0; i < itemCount; ++i) {
+        QWinJumpListSnapshot::Item item;
+        item.filePath = QStringLiteral("C:/Users/user/%1/document %2.txt").arg(title).arg(i);
+        result.items.append(item);
+    }
+    return result;
+}
+
+QWinJumpListSnapshot tst_QWinJumpListPruner::model(const QVector<int> &itemCounts)
+{
+    QWinJumpListSnapshot snapshot(QStringLiteral("org.qt-project.app"));
+    for (int i = 0; i < itemCounts.size(); ++i)
+        snapshot.appendCategory(category(QString(QLatin1Char('A' + i)), itemCounts.at(i)));
+    return snapshot;
+}
+
+// Mirrors QWinJumpListPrivate::commitSnapshot().
+bool tst_QWinJumpListPruner::commit(StandInDestinationList *list, QWinJumpListPruner *pruner,
+                                    const QWinJumpListSnapshot &snapshot, QWinJumpListSnapshot *committed)
+{
+    int maxSlots = 0;
+    QStringList removed;
+    list->beginList(&maxSlots, &removed);
+    const QWinJumpListSnapshot pruned = pruner->prune(snapshot, maxSlots, removed);
+    if (committed)
+        *committed = pruned;
+    return list->commitList(pruned);
+}
+
+QVector<int> tst_QWinJumpListPruner::itemCounts(const QWinJumpListSnapshot &snapshot)
+{
+    QVector<int> counts;
+    for (const QWinJumpListSnapshot::Category &category : snapshot.categories())
+        counts.append(category.items.size());
+    return counts;
+}
+
+void tst_QWinJumpListPruner::unlimited()
+{
+    QWinJumpListPruner pruner;
+    QCOMPARE(pruner.maximumSlots(), 0);
+    const QWinJumpListSnapshot snapshot = model({ 50, 20 });
+    const QWinJumpListSnapshot pruned = pruner.prune(snapshot, 0, QStringList());
+    QCOMPARE(itemCounts(pruned), itemCounts(snapshot));
+    QCOMPARE(pruned.categoryHash(0), snapshot.categoryHash(0));
+    QCOMPARE(pruner.prunedCount(), 0);
+}
+
+void tst_QWinJumpListPruner::trimmed_data()
+{
+    QTest::addColumn<QVector<int>>("counts");
+    QTest::addColumn<int>("maxSlots");
+    QTest::addColumn<QVector<int>>("kept");
+
+    QTest::newRow("fits") << QVector<int>{ 3, 2 } << 10 << QVector<int>{ 3, 2 };
+    QTest::newRow("exact") << QVector<int>{ 3, 2 } << 5 << QVector<int>{ 3, 2 };
+    QTest::newRow("round robin") << QVector<int>{ 5, 2, 4 } << 6 << QVector<int>{ 2, 2, 2 };
+    QTest::newRow("short category") << QVector<int>{ 5, 2, 4 } << 8 << QVector<int>{ 3, 2, 3 };
+    QTest::newRow("first ones") << QVector<int>{ 5, 2, 4 } << 2 << QVector<int>{ 1, 1, 0 };
+    QTest::newRow("one long") << QVector<int>{ 100 } << 10 << QVector<int>{ 10 };
+    QTest::newRow("empty category") << QVector<int>{ 4, 0, 4 } << 4 << QVector<int>{ 2, 0, 2 };
+}
+
+void tst_QWinJumpListPruner::trimmed()
+{
+    QFETCH(QVector<int>, counts);
+    QFETCH(int, maxSlots);
+    QFETCH(QVector<int>, kept);
+
+    StandInDestinationList list;
+    list.maxSlots = maxSlots;
+    QWinJumpListPruner pruner;
+    QWinJumpListSnapshot committed;
+    const QWinJumpListSnapshot snapshot = model(counts);
+    QVERIFY(commit(&list, &pruner, snapshot, &committed));
+    QCOMPARE(itemCounts(committed), kept);
+    QCOMPARE(pruner.maximumSlots(), maxSlots);
+    QCOMPARE(list.built, qMin(maxSlots, snapshot.itemCount()));
+    QCOMPARE(pruner.prunedCount(), snapshot.itemCount() - list.built);
+
+    // The kept items are the first ones of their categories.
+    for (int i = 0; i < committed.categories().size(); ++i) {
+        const QVector<QWinJumpListSnapshot::Item> &items = committed.categories().at(i).items;
+        for (int j = 0; j < items.size(); ++j)
+            QVERIFY(items.at(j) == snapshot.categories().at(i).items.at(j));
+    }
+}
+
+void tst_QWinJumpListPruner::tasksAndHiddenCategories()
+{
+    QWinJumpListSnapshot snapshot(QStringLiteral("org.qt-project.app"));
+    snapshot.appendCategory(category(QStringLiteral("Recent"), 0, QWinJumpListSnapshot::Recent));
+    QWinJumpListSnapshot::Category hidden = category(QStringLiteral("Hidden"), 20);
+    hidden.visible = false;
+    snapshot.appendCategory(hidden);
+    snapshot.appendCategory(category(QStringLiteral("A"), 20));
+    snapshot.appendCategory(category(QStringLiteral("Tasks"), 20, QWinJumpListSnapshot::Tasks));
+
+    QWinJumpListPruner pruner;
+    const QWinJumpListSnapshot pruned = pruner.prune(snapshot, 5, QStringList());
+    QCOMPARE(itemCounts(pruned), QVector<int>({ 0, 20, 5, 20 }));
+    QCOMPARE(pruner.prunedCount(), 15);
+}
+
+void tst_QWinJumpListPruner::removed()
+{
+    StandInDestinationList list;
+    QWinJumpListPruner pruner;
+    const QWinJumpListSnapshot snapshot = model({ 3, 3 });
+    QVERIFY(commit(&list, &pruner, snapshot));
+    QVERIFY(pruner.takeRemoved().isEmpty());
+
+    const QString removedPath = snapshot.categories().at(1).items.at(1).filePath;
+    list.remove(removedPath);
+    QWinJumpListSnapshot committed;
+    QVERIFY(commit(&list, &pruner, snapshot, &committed));
+    QCOMPARE(itemCounts(committed), QVector<int>({ 3, 2 }));
+    QCOMPARE(pruner.takeRemoved(), QStringList(QWinJumpListPruner::key(removedPath, QStringList())));
+    QVERIFY(pruner.takeRemoved().isEmpty());
+
+    // The shell reports a removal once; it is remembered for later commits.
+    QVERIFY(commit(&list, &pruner, snapshot, &committed));
+    QCOMPARE(itemCounts(committed), QVector<int>({ 3, 2 }));
+    QVERIFY(pruner.takeRemoved().isEmpty());
+
+    // Without the pruner, the shell refuses the list.
+    QVERIFY(!list.commitList(snapshot));
+}
+
+void tst_QWinJumpListPruner::removedSeparatorsAndCase()
+{
+    StandInDestinationList list;
+    QWinJumpListPruner pruner;
+    QWinJumpListSnapshot snapshot(QStringLiteral("org.qt-project.app"));
+    QWinJumpListSnapshot::Category links = category(QStringLiteral("Links"), 0);
+    QWinJumpListSnapshot::Item link;
+    link.type = QWinJumpListSnapshot::Link;
+    link.filePath = QStringLiteral("C:/Program Files/App/app.exe");
+    link.arguments = QStringList{ QStringLiteral("--open"), QStringLiteral("a b.txt") };
+    links.items.append(link);
+    link.arguments = QStringList{ QStringLiteral("--open"), QStringLiteral("c.txt") };
+    links.items.append(link);
+    snapshot.appendCategory(links);
+
+    list.remove(QStringLiteral("c:\\PROGRAM FILES\\app\\APP.EXE"),
+                QStringList{ QStringLiteral("--open"), QStringLiteral("a b.txt") });
+    QWinJumpListSnapshot committed;
+    QVERIFY(commit(&list, &pruner, snapshot, &committed));
+    QCOMPARE(committed.categories().at(0).items.size(), 1);
+    QCOMPARE(committed.categories().at(0).items.at(0).arguments.last(), QStringLiteral("c.txt"));
+}
+
+void tst_QWinJumpListPruner::removedFreeSlots()
+{
+    StandInDestinationList list;
+    list.maxSlots = 4;
+    QWinJumpListPruner pruner;
+    const QWinJumpListSnapshot snapshot = model({ 6 });
+    list.remove(snapshot.categories().at(0).items.at(0).filePath);
+    QWinJumpListSnapshot committed;
+    QVERIFY(commit(&list, &pruner, snapshot, &committed));
+    QCOMPARE(list.built, 4);
+    QVERIFY(committed.categories().at(0).items.at(0) == snapshot.categories().at(0).items.at(1));
+    QCOMPARE(pruner.prunedCount(), 2);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListPruner)
+
+#include "tst_qwinjumplistpruner.moc"
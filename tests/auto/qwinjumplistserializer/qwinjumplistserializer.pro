@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistserializer
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwidestringarena.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
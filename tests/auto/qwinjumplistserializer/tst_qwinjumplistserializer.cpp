@@ -0,0 +1,203 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistserializer_p.h"
+
+class tst_QWinJumpListSerializer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void link();
+    void optionalFields();
+    void zeroCopy();
+    void iconsResolvedOncePerCommit();
+    void iconFailure();
+    void iconWithoutKey();
+    void arenaReused();
+
+private:
+    static QWinJumpListSnapshot::Item linkItem(qint64 iconKey = 0);
+};
+
+static QString fromArena(const QChar *string)
+{
+    if (!string)
+        return QString();
+    int size = 0;
+    while (!string[size].isNull())
+        ++size;
+    return QString(string, size);
+}
+
+QWinJumpListSnapshot::Item tst_QWinJumpListSerializer::linkItem(qint64 iconKey)
+{
+    QWinJumpListSnapshot::Item item;
+    item.type = QWinJumpListSnapshot::Link;
+    item.filePath = QStringLiteral("C:/Program Files/App/app.exe");
+    item.workingDirectory = QStringLiteral("C:/Users/user");
+    item.title = QStringLiteral("Open");
+    item.description = QStringLiteral("Opens a document");
+    item.arguments = QStringList{ QStringLiteral("--open"), QStringLiteral("C:\\my documents\\") };
+    if (iconKey) {
+        item.iconKey = iconKey;
+        item.iconFrames.append(QImage(16, 16, QImage::Format_ARGB32));
+    }
+    return item;
+}
+
+void tst_QWinJumpListSerializer::link()
+{
+    QWinJumpListSerializer serializer([](const QVector<QImage> &) {
+        return QStringLiteral("C:/Temp/app/qt-jl-icons/0123.ico");
+    });
+    serializer.begin();
+    const QWinJumpListSnapshot::Item item = linkItem(1);
+    const QWinJumpListSerializer::Link link = serializer.link(item);
+
+    QCOMPARE(fromArena(link.path), item.filePath);
+    QCOMPARE(fromArena(link.workingDirectory), item.workingDirectory);
+    QCOMPARE(fromArena(link.title), item.title);
+    QCOMPARE(fromArena(link.description), item.description);
+    QCOMPARE(fromArena(link.arguments), QStringLiteral("--open \"C:\\my documents\\\\\""));
+    QCOMPARE(fromArena(link.iconLocation), QStringLiteral("C:\\Temp\\app\\qt-jl-icons\\0123.ico"));
+}
+
+void tst_QWinJumpListSerializer::optionalFields()
+{
+    QWinJumpListSerializer serializer;
+    serializer.begin();
+    QWinJumpListSnapshot::Item item;
+    item.type = QWinJumpListSnapshot::Link;
+    const QWinJumpListSerializer::Link link = serializer.link(item);
+
+    QVERIFY(link.path && link.path->isNull());
+    QVERIFY(link.title && link.title->isNull());
+    QVERIFY(link.arguments && link.arguments->isNull());
+    QVERIFY(!link.workingDirectory);
+    QVERIFY(!link.description);
+    QVERIFY(!link.iconLocation);
+}
+
+void tst_QWinJumpListSerializer::zeroCopy()
+{
+    QWinJumpListSerializer serializer;
+    serializer.begin();
+    QWinJumpListSnapshot::Item item;
+    item.type = QWinJumpListSnapshot::Link;
+    item.filePath = QDir::tempPath() + QLatin1String("/app.exe");
+    item.title = QString::number(42);
+    const QWinJumpListSerializer::Link link = serializer.link(item);
+
+    QCOMPARE(link.path, item.filePath.constData());
+    QCOMPARE(link.title, item.title.constData());
+}
+
+void tst_QWinJumpListSerializer::iconsResolvedOncePerCommit()
+{
+    int resolved = 0;
+    QWinJumpListSerializer serializer([&resolved](const QVector<QImage> &) {
+        ++resolved;
+        return QStringLiteral("C:/icons/%1.ico").arg(resolved);
+    });
+
+    serializer.begin();
+    const QWinJumpListSnapshot::Item first = linkItem(1);
+    const QWinJumpListSnapshot::Item second = linkItem(2);
+    const QChar *location = serializer.link(first).iconLocation;
+    QCOMPARE(serializer.link(second).iconLocation, serializer.link(second).iconLocation);
+    QCOMPARE(serializer.link(first).iconLocation, location);
+    QCOMPARE(resolved, 2);
+    QCOMPARE(fromArena(location), QStringLiteral("C:\\icons\\1.ico"));
+
+    // A new commit looks icons up again, the files may have been swept.
+    serializer.begin();
+    QCOMPARE(fromArena(serializer.link(first).iconLocation), QStringLiteral("C:\\icons\\3.ico"));
+    QCOMPARE(resolved, 3);
+    QCOMPARE(serializer.iconResolutions(), quint64(3));
+    QCOMPARE(serializer.iconPaths(), (QHash<qint64, QString>{{1, QStringLiteral("C:/icons/3.ico")}}));
+}
+
+void tst_QWinJumpListSerializer::iconFailure()
+{
+    int resolved = 0;
+    QWinJumpListSerializer serializer([&resolved](const QVector<QImage> &) {
+        ++resolved;
+        return QString();
+    });
+    serializer.begin();
+    const QWinJumpListSnapshot::Item item = linkItem(1);
+    QVERIFY(!serializer.link(item).iconLocation);
+    QVERIFY(!serializer.link(item).iconLocation);
+    QCOMPARE(resolved, 1);
+    QVERIFY(serializer.iconPaths().isEmpty());
+}
+
+void tst_QWinJumpListSerializer::iconWithoutKey()
+{
+    int resolved = 0;
+    QWinJumpListSerializer serializer([&resolved](const QVector<QImage> &) {
+        ++resolved;
+        return QStringLiteral("C:/icon.ico");
+    });
+    serializer.begin();
+    QWinJumpListSnapshot::Item item = linkItem(1);
+    item.iconKey = 0;
+    QVERIFY(serializer.link(item).iconLocation);
+    QVERIFY(serializer.link(item).iconLocation);
+    QCOMPARE(resolved, 2);
+}
+
+void tst_QWinJumpListSerializer::arenaReused()
+{
+    QWinJumpListSerializer serializer([](const QVector<QImage> &) {
+        return QStringLiteral("C:/icon.ico");
+    });
+    QVector<QWinJumpListSnapshot::Item> items;
+    for (int i = 0; i < 500; ++i)
+        items.append(linkItem(i % 7 + 1));
+
+    serializer.begin();
+    for (const QWinJumpListSnapshot::Item &item : qAsConst(items))
+        serializer.link(item);
+    const int capacity = serializer.arena().capacity();
+
+    for (int commit = 0; commit < 3; ++commit) {
+        serializer.begin();
+        for (const QWinJumpListSnapshot::Item &item : qAsConst(items))
+            serializer.link(item);
+        QCOMPARE(serializer.arena().chunkCount(), 1);
+        QCOMPARE(serializer.arena().capacity(), capacity);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListSerializer)
+
+#include "tst_qwinjumplistserializer.moc"
@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistsnapshot
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp
@@ -0,0 +1,296 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistsnapshot_p.h"
+
+typedef QWinJumpListSnapshot Snapshot;
+typedef QWinJumpListDiff Diff;
+
+class tst_QWinJumpListSnapshot : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initial();
+    void unchanged();
+    void identifier();
+    void itemChanges_data();
+    void itemChanges();
+    void visibility();
+    void emptyCategories();
+    void knownCategories();
+    void addedAndRemoved();
+    void moved();
+    void duplicateTitles();
+    void largeModel();
+
+private:
+    static Snapshot::Item link(const QString &title, const QString &path = QStringLiteral("C:/app.exe"));
+    static Snapshot::Category category(const QString &title, int itemCount,
+                                       Snapshot::CategoryType type = Snapshot::Custom);
+    static Snapshot model(const QVector<Snapshot::Category> &categories,
+                          const QString &identifier = QStringLiteral("app"));
+};
+
+Snapshot::Item tst_QWinJumpListSnapshot::link(const QString &title, const QString &path)
+{
+    Snapshot::Item item;
+    item.type = Snapshot::Link;
+    item.title = title;
+    item.filePath = path;
+    item.arguments = QStringList{ QStringLiteral("--open"), title };
+    return item;
+}
+
+Snapshot::Category tst_QWinJumpListSnapshot::category(const QString &title, int itemCount,
+                                                      Snapshot::CategoryType type)
+{
+    Snapshot::Category result;
+    result.type = type;
+    result.title = title;
+    result.visible = true;
+    for (int i = 0; i < itemCount; ++i)
+        result.items.append(link(title + QString::number(i)));
+    return result;
+}
+
+Snapshot tst_QWinJumpListSnapshot::model(const QVector<Snapshot::Category> &categories,
+                                         const QString &identifier)
+{
+    Snapshot snapshot(identifier);
+    for (const Snapshot::Category &category : categories)
+        snapshot.appendCategory(category);
+    return snapshot;
+}
+
+void tst_QWinJumpListSnapshot::initial()
+{
+    const Snapshot null;
+    QVERIFY(null.isNull());
+    QVERIFY(!model({}).isNull());
+
+    // Nothing committed yet: even an empty list must be committed once to
+    // replace whatever the shell kept from a previous run.
+    const Diff diff = Diff::compute(null, model({}));
+    QVERIFY(diff.initial);
+    QVERIFY(!diff.isEmpty());
+    QVERIFY(diff.changes.isEmpty());
+
+    const Diff tasks = Diff::compute(null, model({ category(QString(), 2, Snapshot::Tasks) }));
+    QCOMPARE(tasks.changes.size(), 1);
+    QCOMPARE(tasks.changes.at(0).type, Diff::Added);
+}
+
+void tst_QWinJumpListSnapshot::unchanged()
+{
+    const QVector<Snapshot::Category> categories = {
+        category(QString(), 0, Snapshot::Recent),
+        category(QStringLiteral("Projects"), 5),
+        category(QString(), 3, Snapshot::Tasks)
+    };
+    // Built separately, so nothing is shared between the two.
+    const Diff diff = Diff::compute(model(categories), model(categories));
+    QVERIFY(!diff.initial);
+    QVERIFY(!diff.identifierChanged);
+    QVERIFY(diff.changes.isEmpty());
+    QVERIFY(diff.isEmpty());
+}
+
+void tst_QWinJumpListSnapshot::identifier()
+{
+    const QVector<Snapshot::Category> categories = { category(QStringLiteral("Projects"), 2) };
+    const Diff diff = Diff::compute(model(categories, QStringLiteral("a")), model(categories, QStringLiteral("b")));
+    QVERIFY(diff.identifierChanged);
+    QVERIFY(diff.changes.isEmpty());
+    QVERIFY(!diff.isEmpty());
+}
+
+void tst_QWinJumpListSnapshot::itemChanges_data()
+{
+    QTest::addColumn<int>("field");
+
+    QTest::newRow("type") << 0;
+    QTest::newRow("filePath") << 1;
+    QTest::newRow("workingDirectory") << 2;
+    QTest::newRow("title") << 3;
+    QTest::newRow("description") << 4;
+    QTest::newRow("arguments") << 5;
+    QTest::newRow("icon") << 6;
+    QTest::newRow("count") << 7;
+}
+
+void tst_QWinJumpListSnapshot::itemChanges()
+{
+    QFETCH(int, field);
+
+    const Snapshot::Category before = category(QStringLiteral("Projects"), 4);
+    Snapshot::Category after = before;
+    Snapshot::Item &item = after.items[2];
+    switch (field) {
+    case 0: item.type = Snapshot::Destination; break;
+    case 1: item.filePath += QLatin1Char('x'); break;
+    case 2: item.workingDirectory = QStringLiteral("C:/"); break;
+    case 3: item.title += QLatin1Char('x'); break;
+    case 4: item.description = QStringLiteral("Open"); break;
+    case 5: item.arguments.append(QStringLiteral("--new")); break;
+    case 6: item.iconKey = 42; break;
+    case 7: after.items.append(link(QStringLiteral("extra"))); break;
+    }
+    QVERIFY(field == 7 || before.items.at(2) != item);
+
+    const Diff diff = Diff::compute(model({ category(QString(), 1, Snapshot::Tasks), before }),
+                                    model({ category(QString(), 1, Snapshot::Tasks), after }));
+    QCOMPARE(diff.changes.size(), 1);
+    QCOMPARE(diff.changes.at(0).type, Diff::Modified);
+    QCOMPARE(diff.changes.at(0).title, QStringLiteral("Projects"));
+    QCOMPARE(diff.changes.at(0).oldIndex, 1);
+    QCOMPARE(diff.changes.at(0).newIndex, 1);
+}
+
+void tst_QWinJumpListSnapshot::visibility()
+{
+    Snapshot::Category shown = category(QStringLiteral("Projects"), 3);
+    Snapshot::Category hidden = shown;
+    hidden.visible = false;
+
+    const Diff hide = Diff::compute(model({ shown }), model({ hidden }));
+    QCOMPARE(hide.changes.size(), 1);
+    QCOMPARE(hide.changes.at(0).type, Diff::Removed);
+    QCOMPARE(hide.changes.at(0).oldIndex, 0);
+    QCOMPARE(hide.changes.at(0).newIndex, -1);
+
+    const Diff show = Diff::compute(model({ hidden }), model({ shown }));
+    QCOMPARE(show.changes.size(), 1);
+    QCOMPARE(show.changes.at(0).type, Diff::Added);
+    QCOMPARE(show.changes.at(0).newIndex, 0);
+
+    // Hidden categories are not part of the committed list.
+    Snapshot::Category hiddenChanged = hidden;
+    hiddenChanged.items.removeLast();
+    hiddenChanged.title = QStringLiteral("Other");
+    QVERIFY(Diff::compute(model({ hidden }), model({ hiddenChanged })).isEmpty());
+}
+
+void tst_QWinJumpListSnapshot::emptyCategories()
+{
+    // Empty custom categories and task lists are not appended.
+    const Snapshot::Category empty = category(QStringLiteral("Projects"), 0);
+    const Snapshot::Category emptyTasks = category(QString(), 0, Snapshot::Tasks);
+    QVERIFY(Diff::compute(model({}), model({ empty, emptyTasks })).isEmpty());
+    QVERIFY(Diff::compute(model({ empty }), model({})).isEmpty());
+}
+
+void tst_QWinJumpListSnapshot::knownCategories()
+{
+    // The shell fills recent and frequent; only their visibility matters.
+    Snapshot::Category recent = category(QStringLiteral("Recent"), 0, Snapshot::Recent);
+    const Snapshot before = model({ recent });
+    recent.title = QStringLiteral("Renamed");
+    QVERIFY(Diff::compute(before, model({ recent })).isEmpty());
+
+    QVERIFY(!Diff::compute(model({}), before).isEmpty());
+
+    // Task list titles are not shown either.
+    const Snapshot::Category tasks = category(QStringLiteral("Tasks"), 2, Snapshot::Tasks);
+    Snapshot::Category renamedTasks = tasks;
+    renamedTasks.title = QStringLiteral("Renamed");
+    QVERIFY(Diff::compute(model({ tasks }), model({ renamedTasks })).isEmpty());
+
+    // A custom category is not a task list, even with the same items.
+    Snapshot::Category custom = tasks;
+    custom.type = Snapshot::Custom;
+    QCOMPARE(Diff::compute(model({ tasks }), model({ custom })).changes.size(), 2);
+}
+
+void tst_QWinJumpListSnapshot::addedAndRemoved()
+{
+    const Snapshot before = model({ category(QStringLiteral("A"), 1), category(QStringLiteral("B"), 1) });
+    const Snapshot after = model({ category(QStringLiteral("A"), 1), category(QStringLiteral("C"), 1) });
+    const Diff diff = Diff::compute(before, after);
+    QCOMPARE(diff.changes.size(), 2);
+    QCOMPARE(diff.changes.at(0).type, Diff::Added);
+    QCOMPARE(diff.changes.at(0).title, QStringLiteral("C"));
+    QCOMPARE(diff.changes.at(0).newIndex, 1);
+    QCOMPARE(diff.changes.at(1).type, Diff::Removed);
+    QCOMPARE(diff.changes.at(1).title, QStringLiteral("B"));
+    QCOMPARE(diff.changes.at(1).oldIndex, 1);
+}
+
+void tst_QWinJumpListSnapshot::moved()
+{
+    const Snapshot::Category a = category(QStringLiteral("A"), 1);
+    const Snapshot::Category b = category(QStringLiteral("B"), 1);
+    const Snapshot::Category c = category(QStringLiteral("C"), 1);
+    const Diff diff = Diff::compute(model({ a, b, c }), model({ b, c, a }));
+    QCOMPARE(diff.changes.size(), 1);
+    QCOMPARE(diff.changes.at(0).type, Diff::Moved);
+    QCOMPARE(diff.changes.at(0).title, QStringLiteral("A"));
+    QCOMPARE(diff.changes.at(0).oldIndex, 0);
+    QCOMPARE(diff.changes.at(0).newIndex, 2);
+
+    // Hidden categories in between do not count as moves.
+    Snapshot::Category hidden = category(QStringLiteral("H"), 1);
+    hidden.visible = false;
+    QVERIFY(Diff::compute(model({ a, b }), model({ hidden, a, hidden, b })).isEmpty());
+}
+
+void tst_QWinJumpListSnapshot::duplicateTitles()
+{
+    const Snapshot::Category first = category(QStringLiteral("Same"), 1);
+    Snapshot::Category second = category(QStringLiteral("Same"), 2);
+    const Snapshot before = model({ first, second });
+    QVERIFY(Diff::compute(before, model({ first, second })).isEmpty());
+
+    second.items.removeLast();
+    const Diff diff = Diff::compute(before, model({ first, second }));
+    QCOMPARE(diff.changes.size(), 1);
+    QCOMPARE(diff.changes.at(0).type, Diff::Modified);
+    QCOMPARE(diff.changes.at(0).oldIndex, 1);
+}
+
+void tst_QWinJumpListSnapshot::largeModel()
+{
+    QVector<Snapshot::Category> categories;
+    for (int i = 0; i < 10; ++i)
+        categories.append(category(QStringLiteral("Category %1").arg(i), 1000));
+    const Snapshot before = model(categories);
+    QCOMPARE(before.itemCount(), 10000);
+    QVERIFY(Diff::compute(before, model(categories)).isEmpty());
+
+    categories[9].items[999].description = QStringLiteral("changed");
+    const Diff diff = Diff::compute(before, model(categories));
+    QCOMPARE(diff.changes.size(), 1);
+    QCOMPARE(diff.changes.at(0).type, Diff::Modified);
+    QCOMPARE(diff.changes.at(0).newIndex, 9);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListSnapshot)
+
+#include "tst_qwinjumplistsnapshot.moc"
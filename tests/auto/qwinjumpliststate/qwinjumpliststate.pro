@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_qwinjumpliststate
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinjumpliststate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumpliststate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconfilecache.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinicowriter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
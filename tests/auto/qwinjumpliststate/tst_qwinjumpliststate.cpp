@@ -0,0 +1,277 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumpliststate_p.h"
+#include "qwiniconfilecache_p.h"
+
+class tst_QWinJumpListState : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTrip();
+    void resaveRestored();
+    void processIndependent();
+    void knownIconFileKeys();
+    void fingerprintChanges_data();
+    void fingerprintChanges();
+    void invalid_data();
+    void invalid();
+
+private:
+    static QVector<QImage> frames(QRgb color);
+    static QWinJumpListSnapshot::Item link(const QString &title, qint64 iconKey = 0, QRgb color = 0);
+    static QWinJumpListSnapshot::Category category(QWinJumpListSnapshot::CategoryType type, const QString &title,
+                                                   const QVector<QWinJumpListSnapshot::Item> &items);
+    static QWinJumpListSnapshot model(const QString &identifier = QStringLiteral("org.qt-project.app"));
+};
+
+QVector<QImage> tst_QWinJumpListState::frames(QRgb color)
+{
+    QImage small(16, 16, QImage::Format_ARGB32);
+    small.fill(color);
+    QImage large(32, 32, QImage::Format_ARGB32);
+    large.fill(color);
+    return QVector<QImage>{ small, large };
+}
+
+QWinJumpListSnapshot::Item tst_QWinJumpListState::link(const QString &title, qint64 iconKey, QRgb color)
+{
+    QWinJumpListSnapshot::Item item;
+    item.type = QWinJumpListSnapshot::Link;
+    item.filePath = QStringLiteral("C:/Program Files/App/app.exe");
+    item.workingDirectory = QStringLiteral("C:/Users/user");
+    item.title = title;
+    item.description = QStringLiteral("Opens \u00e9t\u00e9.txt");
+    item.arguments = QStringList{ QStringLiteral("--open"), QStringLiteral("C:\\my documents\\"), QString() };
+    if (iconKey) {
+        item.iconKey = iconKey;
+        item.iconFrames = frames(color);
+    }
+    return item;
+}
+
+QWinJumpListSnapshot::Category tst_QWinJumpListState::category(QWinJumpListSnapshot::CategoryType type,
+                                                               const QString &title,
+                                                               const QVector<QWinJumpListSnapshot::Item> &items)
+{
+    QWinJumpListSnapshot::Category result;
+    result.type = type;
+    result.title = title;
+    result.visible = true;
+    result.items = items;
+    return result;
+}
+
+QWinJumpListSnapshot tst_QWinJumpListState::model(const QString &identifier)
+{
+    QWinJumpListSnapshot::Item destination;
+    destination.filePath = QStringLiteral("C:/Users/user/notes.txt");
+    QWinJumpListSnapshot::Item separator;
+    separator.type = QWinJumpListSnapshot::Separator;
+
+    QWinJumpListSnapshot snapshot(identifier);
+    snapshot.appendCategory(category(QWinJumpListSnapshot::Recent, QString(), {}));
+    QWinJumpListSnapshot::Category frequent = category(QWinJumpListSnapshot::Frequent, QString(), {});
+    frequent.visible = false;
+    snapshot.appendCategory(frequent);
+    snapshot.appendCategory(category(QWinJumpListSnapshot::Custom, QStringLiteral("Projects"),
+                                     { destination, link(QStringLiteral("Open"), 1, 0xff0000ff) }));
+    snapshot.appendCategory(category(QWinJumpListSnapshot::Tasks, QString(),
+                                     { link(QStringLiteral("New"), 2, 0xff00ff00), separator,
+                                       link(QStringLiteral("Quit")) }));
+    return snapshot;
+}
+
+void tst_QWinJumpListState::roundTrip()
+{
+    const QWinJumpListSnapshot original = model();
+    const QByteArray state = QWinJumpListState::save(original);
+    QCOMPARE(QWinJumpListState::fingerprint(state).size(), int(QWinJumpListState::FingerprintSize));
+
+    QWinJumpListSnapshot restored;
+    QVERIFY(QWinJumpListState::restore(state, &restored));
+    QVERIFY(!restored.isNull());
+    QCOMPARE(restored.identifier(), original.identifier());
+    QCOMPARE(restored.categories().size(), original.categories().size());
+    QCOMPARE(restored.itemCount(), original.itemCount());
+    for (int i = 0; i < original.categories().size(); ++i) {
+        const QWinJumpListSnapshot::Category &expected = original.categories().at(i);
+        const QWinJumpListSnapshot::Category &actual = restored.categories().at(i);
+        QCOMPARE(actual.type, expected.type);
+        QCOMPARE(actual.title, expected.title);
+        QCOMPARE(actual.visible, expected.visible);
+        QCOMPARE(actual.items.size(), expected.items.size());
+        for (int j = 0; j < expected.items.size(); ++j) {
+            QWinJumpListSnapshot::Item item = expected.items.at(j);
+            const QByteArray iconFileKey = item.iconFrames.isEmpty()
+                ? QByteArray() : QWinIconFileCache::key(item.iconFrames);
+            QCOMPARE(actual.items.at(j).iconFileKey, iconFileKey);
+            QVERIFY(actual.items.at(j).iconFrames.isEmpty());
+            item.iconKey = 0;
+            QVERIFY(actual.items.at(j) == item);
+            QCOMPARE(actual.items.at(j).arguments, item.arguments);
+        }
+    }
+}
+
+// A restored model keeps the keys of its icon files, so it saves to the same
+// state without the icons.
+void tst_QWinJumpListState::resaveRestored()
+{
+    const QByteArray state = QWinJumpListState::save(model());
+    QWinJumpListSnapshot restored;
+    QVERIFY(QWinJumpListState::restore(state, &restored));
+    QCOMPARE(QWinJumpListState::save(restored), state);
+}
+
+// QIcon::cacheKey() differs between runs of an application, the pixels of
+// the icons do not.
+void tst_QWinJumpListState::processIndependent()
+{
+    QWinJumpListSnapshot other(QStringLiteral("org.qt-project.app"));
+    for (QWinJumpListSnapshot::Category category : model().categories()) {
+        for (QWinJumpListSnapshot::Item &item : category.items) {
+            if (item.iconKey)
+                item.iconKey += 1000;
+        }
+        other.appendCategory(category);
+    }
+    QCOMPARE(QWinJumpListState::fingerprint(QWinJumpListState::save(other)),
+             QWinJumpListState::fingerprint(QWinJumpListState::save(model())));
+}
+
+// The keys of the icon files a commit resolved are not computed again.
+void tst_QWinJumpListState::knownIconFileKeys()
+{
+    const QHash<qint64, QByteArray> keys{{1, QByteArrayLiteral("known")}};
+    QWinJumpListSnapshot restored;
+    QVERIFY(QWinJumpListState::restore(QWinJumpListState::save(model(), keys), &restored));
+    const QWinJumpListSnapshot::Category &projects = restored.categories().at(2);
+    QCOMPARE(projects.items.at(1).iconFileKey, QByteArrayLiteral("known"));
+    const QWinJumpListSnapshot::Category &tasks = restored.categories().at(3);
+    QCOMPARE(tasks.items.at(0).iconFileKey, QWinIconFileCache::key(frames(0xff00ff00)));
+}
+
+void tst_QWinJumpListState::fingerprintChanges_data()
+{
+    QTest::addColumn<int>("change");
+
+    QTest::newRow("identifier") << 0;
+    QTest::newRow("title") << 1;
+    QTest::newRow("argument") << 2;
+    QTest::newRow("icon") << 3;
+    QTest::newRow("visible") << 4;
+    QTest::newRow("order") << 5;
+    QTest::newRow("category title") << 6;
+}
+
+void tst_QWinJumpListState::fingerprintChanges()
+{
+    QFETCH(int, change);
+
+    const QWinJumpListSnapshot original = model();
+    QVector<QWinJumpListSnapshot::Category> categories = original.categories();
+    QString identifier = original.identifier();
+    switch (change) {
+    case 0:
+        identifier += QLatin1Char('2');
+        break;
+    case 1:
+        categories[3].items[0].title = QStringLiteral("Create");
+        break;
+    case 2:
+        categories[3].items[0].arguments.last() = QStringLiteral(" ");
+        break;
+    case 3:
+        categories[3].items[0].iconFrames = frames(0xff00ff01);
+        break;
+    case 4:
+        categories[1].visible = true;
+        break;
+    case 5:
+        std::swap(categories[3].items[0], categories[3].items[2]);
+        break;
+    case 6:
+        categories[2].title = QStringLiteral("projects");
+        break;
+    }
+    QWinJumpListSnapshot changed(identifier);
+    for (const QWinJumpListSnapshot::Category &category : qAsConst(categories))
+        changed.appendCategory(category);
+
+    QVERIFY(QWinJumpListState::fingerprint(QWinJumpListState::save(changed))
+            != QWinJumpListState::fingerprint(QWinJumpListState::save(original)));
+}
+
+void tst_QWinJumpListState::invalid_data()
+{
+    QTest::addColumn<QByteArray>("state");
+    QTest::addColumn<bool>("validHeader");
+
+    const QByteArray state = QWinJumpListState::save(model());
+
+    QTest::newRow("empty") << QByteArray() << false;
+    QTest::newRow("header only") << state.left(QWinJumpListState::HeaderSize) << false;
+    QTest::newRow("truncated") << state.left(state.size() - 1) << false;
+    QTest::newRow("trailing data") << state + '\0' << false;
+
+    QByteArray magic = state;
+    magic[0] = 'X';
+    QTest::newRow("magic") << magic << false;
+
+    QByteArray version = state;
+    version[5] = char(QWinJumpListState::Version + 1);
+    QTest::newRow("version") << version << false;
+
+    QByteArray model = state;
+    model[QWinJumpListState::HeaderSize + 5] = char(model.at(QWinJumpListState::HeaderSize + 5) ^ 1);
+    QTest::newRow("model") << model << true;
+
+    QByteArray fingerprint = state;
+    fingerprint[fingerprint.size() - 1] = char(fingerprint.at(fingerprint.size() - 1) ^ 1);
+    QTest::newRow("fingerprint") << fingerprint << true;
+}
+
+void tst_QWinJumpListState::invalid()
+{
+    QFETCH(QByteArray, state);
+    QFETCH(bool, validHeader);
+
+    QCOMPARE(!QWinJumpListState::fingerprint(state).isEmpty(), validHeader);
+    QWinJumpListSnapshot snapshot(QStringLiteral("untouched"));
+    QVERIFY(!QWinJumpListState::restore(state, &snapshot));
+    QCOMPARE(snapshot.identifier(), QStringLiteral("untouched"));
+    QVERIFY(snapshot.categories().isEmpty());
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListState)
+
+#include "tst_qwinjumpliststate.moc"
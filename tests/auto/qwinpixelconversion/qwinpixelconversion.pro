@@ -0,0 +1,8 @@
+CONFIG += testcase
+TARGET = tst_qwinpixelconversion
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinpixelconversion.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
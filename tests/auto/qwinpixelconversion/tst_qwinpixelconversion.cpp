@@ -0,0 +1,303 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+#include <QVector>
+
+#include "qwinpixelconversion_p.h"
+
+Q_DECLARE_METATYPE(QWinPixelConversion::Implementation)
+
+class tst_QWinPixelConversion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void premultiply_data();
+    void premultiply();
+    void unpremultiply_data();
+    void unpremultiply();
+    void oddLengths_data();
+    void oddLengths();
+    void matchesQImage();
+    void fixupDibAlpha();
+    void alphaToMask_data();
+    void alphaToMask();
+    void alphaToMaskMatchesCreateAlphaMask_data();
+    void alphaToMaskMatchesCreateAlphaMask();
+    void alphaToMaskPadding();
+};
+
+static void addImplementationColumn()
+{
+    QTest::addColumn<QWinPixelConversion::Implementation>("implementation");
+
+    QTest::newRow("scalar") << QWinPixelConversion::Scalar;
+    if (QWinPixelConversion::isAvailable(QWinPixelConversion::Sse2))
+        QTest::newRow("sse2") << QWinPixelConversion::Sse2;
+    if (QWinPixelConversion::isAvailable(QWinPixelConversion::Avx2))
+        QTest::newRow("avx2") << QWinPixelConversion::Avx2;
+    if (QWinPixelConversion::isAvailable(QWinPixelConversion::Neon))
+        QTest::newRow("neon") << QWinPixelConversion::Neon;
+}
+
+// Every combination of alpha and color value, with the color in all channels.
+static QVector<quint32> allAlphaColorPairs()
+{
+    QVector<quint32> pixels;
+    pixels.reserve(256 * 256);
+    for (quint32 alpha = 0; alpha < 256; ++alpha) {
+        for (quint32 value = 0; value < 256; ++value)
+            pixels.append(alpha << 24 | value << 16 | (255 - value) << 8 | value);
+    }
+    return pixels;
+}
+
+void tst_QWinPixelConversion::premultiply_data()
+{
+    addImplementationColumn();
+}
+
+void tst_QWinPixelConversion::premultiply()
+{
+    QFETCH(QWinPixelConversion::Implementation, implementation);
+
+    const QVector<quint32> source = allAlphaColorPairs();
+    QVector<quint32> pixels = source;
+    QWinPixelConversion::premultiply(pixels.data(), pixels.size(), implementation);
+    for (int i = 0; i < source.size(); ++i) {
+        if (pixels.at(i) != qPremultiply(source.at(i)))
+            QFAIL(qPrintable(QString::asprintf("Mismatch for %#010x: %#010x != %#010x", source.at(i),
+                                               pixels.at(i), qPremultiply(source.at(i)))));
+    }
+}
+
+void tst_QWinPixelConversion::unpremultiply_data()
+{
+    addImplementationColumn();
+}
+
+void tst_QWinPixelConversion::unpremultiply()
+{
+    QFETCH(QWinPixelConversion::Implementation, implementation);
+
+    // Includes invalid premultiplied values (color > alpha), which must be
+    // clamped the same way as by qUnpremultiply().
+    const QVector<quint32> source = allAlphaColorPairs();
+    QVector<quint32> pixels = source;
+    QWinPixelConversion::unpremultiply(pixels.data(), pixels.size(), implementation);
+    for (int i = 0; i < source.size(); ++i) {
+        if (pixels.at(i) != qUnpremultiply(source.at(i)))
+            QFAIL(qPrintable(QString::asprintf("Mismatch for %#010x: %#010x != %#010x", source.at(i),
+                                               pixels.at(i), qUnpremultiply(source.at(i)))));
+    }
+}
+
+void tst_QWinPixelConversion::oddLengths_data()
+{
+    addImplementationColumn();
+}
+
+void tst_QWinPixelConversion::oddLengths()
+{
+    QFETCH(QWinPixelConversion::Implementation, implementation);
+
+    // Lengths around the vector widths exercise the scalar tails; the guard
+    // pixel must never be touched.
+    const quint32 guard = 0x80402010;
+    for (int length = 0; length < 40; ++length) {
+        QVector<quint32> source(length + 1, guard);
+        for (int i = 0; i < length; ++i)
+            source[i] = quint32(i * 37) << 24 | 0x00c08040;
+        QVector<quint32> pixels = source;
+        QWinPixelConversion::premultiply(pixels.data(), length, implementation);
+        for (int i = 0; i < length; ++i)
+            QCOMPARE(pixels.at(i), qPremultiply(source.at(i)));
+        QCOMPARE(pixels.at(length), guard);
+        QWinPixelConversion::unpremultiply(pixels.data(), length, implementation);
+        for (int i = 0; i < length; ++i)
+            QCOMPARE(pixels.at(i), qUnpremultiply(qPremultiply(source.at(i))));
+        QCOMPARE(pixels.at(length), guard);
+    }
+}
+
+void tst_QWinPixelConversion::matchesQImage()
+{
+    QImage image(37, 23, QImage::Format_ARGB32);
+    for (int y = 0; y < image.height(); ++y) {
+        for (int x = 0; x < image.width(); ++x)
+            image.setPixel(x, y, qRgba(x * 7, y * 11, x * y, (x + y) * 5));
+    }
+
+    // Pad the scan lines to check that bytesPerLine is honored.
+    const int bytesPerLine = image.width() * 4 + 12;
+    QByteArray buffer(bytesPerLine * image.height(), char(0));
+    uchar *bits = reinterpret_cast<uchar *>(buffer.data());
+    for (int y = 0; y < image.height(); ++y)
+        memcpy(bits + y * bytesPerLine, image.constScanLine(y), size_t(image.width()) * 4);
+
+    QWinPixelConversion::premultiplyRows(bits, image.width(), image.height(), bytesPerLine);
+    const QImage premultiplied = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < image.height(); ++y)
+        QVERIFY(!memcmp(bits + y * bytesPerLine, premultiplied.constScanLine(y), size_t(image.width()) * 4));
+
+    QWinPixelConversion::unpremultiplyRows(bits, image.width(), image.height(), bytesPerLine);
+    const QImage unpremultiplied = premultiplied.convertToFormat(QImage::Format_ARGB32);
+    for (int y = 0; y < image.height(); ++y)
+        QVERIFY(!memcmp(bits + y * bytesPerLine, unpremultiplied.constScanLine(y), size_t(image.width()) * 4));
+}
+
+void tst_QWinPixelConversion::fixupDibAlpha()
+{
+    const quint32 source[] = { 0x00000000, 0x00123456, 0x80402010, 0xff000000, 0x01000000, 0x00000001 };
+    const int count = int(sizeof(source) / sizeof(source[0]));
+
+    quint32 pixels[count];
+    memcpy(pixels, source, sizeof(source));
+    QWinPixelConversion::fixupDibAlpha(pixels, count, false);
+    const quint32 alpha[] = { 0x00000000, 0xff123456, 0x80402010, 0xff000000, 0x01000000, 0xff000001 };
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(pixels[i], alpha[i]);
+
+    memcpy(pixels, source, sizeof(source));
+    QWinPixelConversion::fixupDibAlpha(pixels, count, true);
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(pixels[i], source[i] | 0xff000000);
+}
+
+static bool maskBit(const uchar *mask, int maskBytesPerLine, int x, int y)
+{
+    return mask[y * maskBytesPerLine + (x >> 3)] & (0x80 >> (x & 7));
+}
+
+void tst_QWinPixelConversion::alphaToMask_data()
+{
+    addImplementationColumn();
+}
+
+void tst_QWinPixelConversion::alphaToMask()
+{
+    QFETCH(QWinPixelConversion::Implementation, implementation);
+
+    // Every alpha value at every bit position of a 32 pixel group, with
+    // colors that must not influence the result.
+    const int width = 256 + 31;
+    const int height = 32;
+    QVector<quint32> pixels(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x)
+            pixels[y * width + x] = quint32((x + y) & 0xff) << 24 | quint32(x * 0x010203);
+    }
+    const int maskBytesPerLine = QWinPixelConversion::maskBytesPerLine(width);
+    QVector<uchar> mask(maskBytesPerLine * height);
+
+    for (int threshold = -1; threshold <= 257; ++threshold) {
+        for (int polarity = 0; polarity < 2; ++polarity) {
+            const bool setBelow = polarity == QWinPixelConversion::MaskTransparent;
+            QWinPixelConversion::alphaToMask(reinterpret_cast<const uchar *>(pixels.constData()),
+                                             width, height, width * 4, mask.data(), maskBytesPerLine,
+                                             threshold, QWinPixelConversion::MaskPolarity(polarity),
+                                             implementation);
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    const int alpha = int(pixels.at(y * width + x) >> 24);
+                    const bool expected = (alpha < qBound(0, threshold, 256)) == setBelow;
+                    if (maskBit(mask.constData(), maskBytesPerLine, x, y) != expected) {
+                        QFAIL(qPrintable(QString::asprintf("Mismatch for alpha %d, threshold %d, polarity %d at %d",
+                                                           alpha, threshold, polarity, x)));
+                    }
+                }
+            }
+        }
+    }
+}
+
+void tst_QWinPixelConversion::alphaToMaskMatchesCreateAlphaMask_data()
+{
+    QTest::addColumn<QWinPixelConversion::Implementation>("implementation");
+    QTest::addColumn<int>("width");
+
+    const int widths[] = { 1, 7, 8, 15, 16, 17, 31, 32, 33, 48, 63, 64, 65, 256 };
+    for (int implementation = QWinPixelConversion::Scalar; implementation <= QWinPixelConversion::Neon; ++implementation) {
+        const QWinPixelConversion::Implementation impl = QWinPixelConversion::Implementation(implementation);
+        if (!QWinPixelConversion::isAvailable(impl))
+            continue;
+        for (int width : widths) {
+            QTest::addRow("%d-%d", implementation, width) << impl << width;
+        }
+    }
+}
+
+// The masks QtWin::createMask() and QtWin::toHICON() used to produce went
+// through QImage::createAlphaMask() and an inversion.
+void tst_QWinPixelConversion::alphaToMaskMatchesCreateAlphaMask()
+{
+    QFETCH(QWinPixelConversion::Implementation, implementation);
+    QFETCH(int, width);
+
+    const int height = 256;
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < height; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x)
+            line[x] = qPremultiply(qRgba(x, y, 0x55, (x * 13 + y) & 0xff));
+    }
+    QImage reference = image.createAlphaMask().convertToFormat(QImage::Format_Mono);
+    reference.invertPixels();
+
+    const int maskBytesPerLine = QWinPixelConversion::maskBytesPerLine(width);
+    QCOMPARE(maskBytesPerLine, reference.bytesPerLine());
+    QVector<uchar> mask(maskBytesPerLine * height);
+    QWinPixelConversion::alphaToMask(image.constBits(), width, height, image.bytesPerLine(),
+                                     mask.data(), maskBytesPerLine, 128,
+                                     QWinPixelConversion::MaskTransparent, implementation);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x)
+            QCOMPARE(maskBit(mask.constData(), maskBytesPerLine, x, y), maskBit(reference.constBits(), maskBytesPerLine, x, y));
+    }
+}
+
+void tst_QWinPixelConversion::alphaToMaskPadding()
+{
+    const int width = 37;
+    const int height = 3;
+    QVector<quint32> pixels(width * height, 0);
+    const int maskBytesPerLine = 12; // wider than needed
+    QVector<uchar> mask(maskBytesPerLine * height, 0xcd);
+    QWinPixelConversion::alphaToMask(reinterpret_cast<const uchar *>(pixels.constData()),
+                                     width, height, width * 4, mask.data(), maskBytesPerLine);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < maskBytesPerLine * 8; ++x)
+            QCOMPARE(maskBit(mask.constData(), maskBytesPerLine, x, y), x < width);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinPixelConversion)
+
+#include "tst_qwinpixelconversion.moc"
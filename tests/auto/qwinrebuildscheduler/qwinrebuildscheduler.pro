@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwinrebuildscheduler
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinrebuildscheduler.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinrebuildscheduler.cpp
@@ -0,0 +1,265 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinrebuildscheduler_p.h"
+
+Q_DECLARE_METATYPE(QWinRebuildScheduler::Policy)
+
+class tst_QWinRebuildScheduler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void queued();
+    void immediate();
+    void debounced();
+    void minimumInterval_data();
+    void minimumInterval();
+    void earlyTimeout();
+    void flush();
+    void cancel();
+    void requestWhileRunning();
+    void counters();
+};
+
+// Drives a scheduler with a manual clock and a fake timer that fires when
+// the clock is advanced past its deadline.
+class SchedulerFixture
+{
+public:
+    SchedulerFixture()
+        : scheduler([this]() { runs.append(now); })
+    {
+        scheduler.setClock([this]() { return now; });
+        scheduler.setTimer([this](int msec) { timerDeadline = msec < 0 ? -1 : now + msec; });
+    }
+
+    // Advances the clock in 1 ms steps, firing the timer on the way.
+    void advance(qint64 msec)
+    {
+        const qint64 end = now + msec;
+        while (now < end) {
+            ++now;
+            fireTimer();
+        }
+    }
+
+    void fireTimer()
+    {
+        if (timerDeadline >= 0 && now >= timerDeadline) {
+            timerDeadline = -1;
+            scheduler.timeout();
+        }
+    }
+
+    QWinRebuildScheduler scheduler;
+    qint64 now = 1000;
+    qint64 timerDeadline = -1;
+    QVector<qint64> runs;
+};
+
+void tst_QWinRebuildScheduler::queued()
+{
+    SchedulerFixture fixture;
+    QCOMPARE(fixture.scheduler.policy(), QWinRebuildScheduler::Queued);
+
+    for (int i = 0; i < 5; ++i)
+        fixture.scheduler.request();
+    QVERIFY(fixture.scheduler.isPending());
+    QVERIFY(fixture.runs.isEmpty());
+    QCOMPARE(fixture.timerDeadline, fixture.now); // next event loop pass
+
+    fixture.fireTimer();
+    QCOMPARE(fixture.runs, QVector<qint64>{ 1000 });
+    QVERIFY(!fixture.scheduler.isPending());
+
+    fixture.fireTimer();
+    QCOMPARE(fixture.runs.size(), 1);
+}
+
+void tst_QWinRebuildScheduler::immediate()
+{
+    SchedulerFixture fixture;
+    fixture.scheduler.setPolicy(QWinRebuildScheduler::Immediate);
+    fixture.scheduler.request();
+    fixture.scheduler.request();
+    QCOMPARE(fixture.runs.size(), 2);
+    QVERIFY(!fixture.scheduler.isPending());
+    QCOMPARE(fixture.timerDeadline, qint64(-1));
+}
+
+void tst_QWinRebuildScheduler::debounced()
+{
+    SchedulerFixture fixture;
+    fixture.scheduler.setPolicy(QWinRebuildScheduler::Debounced);
+    fixture.scheduler.setDebounceInterval(50);
+
+    // A burst of requests 10 ms apart runs once, 50 ms after the last one.
+    for (int i = 0; i < 10; ++i) {
+        fixture.scheduler.request();
+        fixture.advance(10);
+    }
+    QVERIFY(fixture.runs.isEmpty());
+    fixture.advance(100);
+    QCOMPARE(fixture.runs, QVector<qint64>{ 1000 + 90 + 50 });
+
+    fixture.scheduler.request();
+    fixture.advance(49);
+    QCOMPARE(fixture.runs.size(), 1);
+    fixture.advance(1);
+    QCOMPARE(fixture.runs.size(), 2);
+}
+
+void tst_QWinRebuildScheduler::minimumInterval_data()
+{
+    QTest::addColumn<QWinRebuildScheduler::Policy>("policy");
+
+    QTest::newRow("queued") << QWinRebuildScheduler::Queued;
+    QTest::newRow("immediate") << QWinRebuildScheduler::Immediate;
+    QTest::newRow("debounced") << QWinRebuildScheduler::Debounced;
+}
+
+void tst_QWinRebuildScheduler::minimumInterval()
+{
+    QFETCH(QWinRebuildScheduler::Policy, policy);
+
+    SchedulerFixture fixture;
+    fixture.scheduler.setPolicy(policy);
+    fixture.scheduler.setDebounceInterval(10);
+    fixture.scheduler.setMinimumInterval(100);
+
+    // Requests every 5 ms for one second run at most every 100 ms.
+    for (int i = 0; i < 200; ++i) {
+        fixture.scheduler.request();
+        fixture.advance(5);
+    }
+    fixture.advance(200);
+    QVERIFY(!fixture.scheduler.isPending());
+    // Debouncing waits for the requests to stop.
+    QVERIFY(fixture.runs.size() >= (policy == QWinRebuildScheduler::Debounced ? 1 : 10));
+    QVERIFY(fixture.runs.size() <= 11);
+    for (int i = 1; i < fixture.runs.size(); ++i)
+        QVERIFY(fixture.runs.at(i) - fixture.runs.at(i - 1) >= 100);
+    // The last request is never lost.
+    QVERIFY(fixture.runs.constLast() >= 1000 + 199 * 5);
+}
+
+void tst_QWinRebuildScheduler::earlyTimeout()
+{
+    SchedulerFixture fixture;
+    fixture.scheduler.setPolicy(QWinRebuildScheduler::Debounced);
+    fixture.scheduler.setDebounceInterval(50);
+    fixture.scheduler.request();
+
+    // A timer firing before the due time is restarted for the remainder.
+    fixture.now += 20;
+    fixture.scheduler.timeout();
+    QVERIFY(fixture.runs.isEmpty());
+    QCOMPARE(fixture.timerDeadline, qint64(1050));
+    fixture.advance(30);
+    QCOMPARE(fixture.runs, QVector<qint64>{ 1050 });
+}
+
+void tst_QWinRebuildScheduler::flush()
+{
+    SchedulerFixture fixture;
+    QVERIFY(!fixture.scheduler.flush());
+
+    fixture.scheduler.setPolicy(QWinRebuildScheduler::Debounced);
+    fixture.scheduler.setMinimumInterval(1000);
+    fixture.scheduler.request();
+    QVERIFY(fixture.scheduler.flush());
+    QCOMPARE(fixture.runs.size(), 1);
+    QVERIFY(!fixture.scheduler.isPending());
+    QCOMPARE(fixture.timerDeadline, qint64(-1));
+
+    // Flushing ignores the minimum interval.
+    fixture.scheduler.request();
+    QVERIFY(fixture.scheduler.flush());
+    QCOMPARE(fixture.runs.size(), 2);
+    QVERIFY(!fixture.scheduler.flush());
+}
+
+void tst_QWinRebuildScheduler::cancel()
+{
+    SchedulerFixture fixture;
+    fixture.scheduler.request();
+    fixture.scheduler.cancel();
+    QVERIFY(!fixture.scheduler.isPending());
+    QCOMPARE(fixture.timerDeadline, qint64(-1));
+    fixture.scheduler.timeout();
+    QVERIFY(fixture.runs.isEmpty());
+}
+
+void tst_QWinRebuildScheduler::requestWhileRunning()
+{
+    qint64 now = 0;
+    int runs = 0;
+    int timerStarts = 0;
+    QWinRebuildScheduler *scheduler = nullptr;
+    QWinRebuildScheduler recursive([&]() {
+        if (++runs == 1)
+            scheduler->request();
+    });
+    scheduler = &recursive;
+    recursive.setClock([&now]() { return now; });
+    recursive.setTimer([&timerStarts](int msec) { timerStarts += msec >= 0; });
+    recursive.setPolicy(QWinRebuildScheduler::Immediate);
+
+    // Not run recursively, but scheduled.
+    recursive.request();
+    QCOMPARE(runs, 1);
+    QVERIFY(recursive.isPending());
+    QCOMPARE(timerStarts, 1);
+    recursive.timeout();
+    QCOMPARE(runs, 2);
+}
+
+void tst_QWinRebuildScheduler::counters()
+{
+    SchedulerFixture fixture;
+    fixture.scheduler.setPolicy(QWinRebuildScheduler::Debounced);
+    fixture.scheduler.setDebounceInterval(20);
+    for (int i = 0; i < 100; ++i) {
+        fixture.scheduler.request();
+        fixture.advance(i % 25 == 24 ? 50 : 1);
+    }
+    QCOMPARE(fixture.scheduler.requestedCount(), quint64(100));
+    QCOMPARE(fixture.scheduler.executedCount(), quint64(4));
+    QCOMPARE(fixture.runs.size(), 4);
+
+    fixture.scheduler.resetCounters();
+    QCOMPARE(fixture.scheduler.requestedCount(), quint64(0));
+    QCOMPARE(fixture.scheduler.executedCount(), quint64(0));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRebuildScheduler)
+
+#include "tst_qwinrebuildscheduler.moc"
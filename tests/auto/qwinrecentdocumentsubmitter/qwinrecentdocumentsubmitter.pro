@@ -0,0 +1,10 @@
+CONFIG += testcase
+TARGET = tst_qwinrecentdocumentsubmitter
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinrecentdocumentsubmitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinrecentdocumentsubmitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwidestringarena.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
@@ -0,0 +1,283 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinrecentdocumentsubmitter_p.h"
+
+class tst_QWinRecentDocumentSubmitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void documentKey_data();
+    void documentKey();
+    void submit();
+    void appId();
+    void duplicates();
+    void order();
+    void failures();
+    void icons();
+    void doesNotBlock();
+    void destruction();
+};
+
+static QString fromArena(const QChar *string)
+{
+    if (!string)
+        return QString();
+    int size = 0;
+    while (!string[size].isNull())
+        ++size;
+    return QString(string, size);
+}
+
+// Stand-in for SHAddToRecentDocs(): records the documents it is given, and
+// can be held at a gate to keep the worker busy.
+struct SinkState
+{
+    QMutex mutex;
+    QStringList documents;
+    QStringList appIds;
+    QStringList iconLocations;
+    QSet<QThread *> threads;
+    QSemaphore gate;
+    bool gated = false;
+    QString failingPath;
+    int batchesStarted = 0;
+    int batchesFinished = 0;
+};
+
+class StandInSink : public QWinRecentDocumentSubmitter::Sink
+{
+public:
+    explicit StandInSink(SinkState *state) : m_state(state) {}
+
+    void batchStarted() override
+    {
+        if (m_state->gated)
+            m_state->gate.acquire();
+        QMutexLocker locker(&m_state->mutex);
+        ++m_state->batchesStarted;
+    }
+
+    void batchFinished() override
+    {
+        QMutexLocker locker(&m_state->mutex);
+        ++m_state->batchesFinished;
+    }
+
+    bool add(const QChar *appId, const QWinJumpListSerializer::Link &link) override
+    {
+        QMutexLocker locker(&m_state->mutex);
+        const QString path = fromArena(link.path);
+        if (path == m_state->failingPath)
+            return false;
+        m_state->documents.append(path + QLatin1Char(' ') + fromArena(link.arguments));
+        m_state->appIds.append(appId ? fromArena(appId) : QStringLiteral("<default>"));
+        m_state->iconLocations.append(fromArena(link.iconLocation));
+        m_state->threads.insert(QThread::currentThread());
+        return true;
+    }
+
+private:
+    SinkState *m_state;
+};
+
+static QWinJumpListSnapshot::Item document(const QString &path, const QStringList &arguments = QStringList())
+{
+    QWinJumpListSnapshot::Item item;
+    item.type = QWinJumpListSnapshot::Link;
+    item.filePath = path;
+    item.title = path;
+    item.arguments = arguments;
+    return item;
+}
+
+void tst_QWinRecentDocumentSubmitter::documentKey_data()
+{
+    QTest::addColumn<QString>("path1");
+    QTest::addColumn<QStringList>("arguments1");
+    QTest::addColumn<QString>("path2");
+    QTest::addColumn<QStringList>("arguments2");
+    QTest::addColumn<bool>("same");
+
+    QTest::newRow("equal") << "C:/a.txt" << QStringList() << "C:/a.txt" << QStringList() << true;
+    QTest::newRow("separators") << "C:/dir/a.txt" << QStringList() << "C:\\dir\\a.txt" << QStringList() << true;
+    QTest::newRow("case") << "C:/Dir/A.txt" << QStringList() << "c:/dir/a.TXT" << QStringList() << true;
+    QTest::newRow("other file") << "C:/a.txt" << QStringList() << "C:/b.txt" << QStringList() << false;
+    QTest::newRow("arguments") << "C:/app.exe" << QStringList{ "a" } << "C:/app.exe" << QStringList{ "b" } << false;
+    QTest::newRow("argument split") << "C:/app.exe" << QStringList{ "a b" } << "C:/app.exe" << QStringList{ "a", "b" } << false;
+}
+
+void tst_QWinRecentDocumentSubmitter::documentKey()
+{
+    QFETCH(QString, path1);
+    QFETCH(QStringList, arguments1);
+    QFETCH(QString, path2);
+    QFETCH(QStringList, arguments2);
+    QFETCH(bool, same);
+
+    QCOMPARE(QWinRecentDocumentSubmitter::documentKey(path1, arguments1)
+             == QWinRecentDocumentSubmitter::documentKey(path2, arguments2), same);
+}
+
+void tst_QWinRecentDocumentSubmitter::submit()
+{
+    SinkState state;
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+    QFuture<int> future = submitter.submit(QString(), { document(QStringLiteral("C:/a.txt")),
+                                                        document(QStringLiteral("C:/app.exe"), { QStringLiteral("--open"), QStringLiteral("b c") }) });
+    future.waitForFinished();
+    QCOMPARE(future.result(), 2);
+    QCOMPARE(state.documents, QStringList({ QStringLiteral("C:/a.txt "), QStringLiteral("C:/app.exe --open \"b c\"") }));
+    QCOMPARE(state.batchesStarted, 1);
+    QCOMPARE(state.batchesFinished, 1);
+    QCOMPARE(state.threads.size(), 1);
+    QVERIFY(!state.threads.contains(QThread::currentThread()));
+    QVERIFY(submitter.waitForIdle());
+    QCOMPARE(submitter.statistics().batches, quint64(1));
+    QCOMPARE(submitter.statistics().added, quint64(2));
+}
+
+void tst_QWinRecentDocumentSubmitter::appId()
+{
+    SinkState state;
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+    submitter.submit(QString(), { document(QStringLiteral("C:/a.txt")) });
+    submitter.submit(QStringLiteral("Company.App"), { document(QStringLiteral("C:/a.txt")) });
+    QVERIFY(submitter.waitForIdle());
+    QCOMPARE(state.appIds, QStringList({ QStringLiteral("<default>"), QStringLiteral("Company.App") }));
+}
+
+void tst_QWinRecentDocumentSubmitter::duplicates()
+{
+    SinkState state;
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+    QVector<QWinJumpListSnapshot::Item> items;
+    for (int i = 0; i < 300; ++i)
+        items.append(document(QStringLiteral("C:/Documents/%1.txt").arg(i % 100)));
+    items.append(document(QStringLiteral("c:\\documents\\1.TXT")));
+
+    QFuture<int> future = submitter.submit(QString(), items);
+    QCOMPARE(future.result(), 100);
+    QCOMPARE(state.documents.size(), 100);
+    QCOMPARE(state.documents.constFirst(), QStringLiteral("C:/Documents/0.txt "));
+    QCOMPARE(submitter.statistics().duplicates, quint64(201));
+}
+
+void tst_QWinRecentDocumentSubmitter::order()
+{
+    SinkState state;
+    state.gated = true;
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+    QStringList expected;
+    for (int batch = 0; batch < 5; ++batch) {
+        QVector<QWinJumpListSnapshot::Item> items;
+        for (int i = 0; i < 10; ++i) {
+            const QString path = QStringLiteral("C:/%1-%2.txt").arg(batch).arg(i);
+            items.append(document(path));
+            expected.append(path + QLatin1Char(' '));
+        }
+        submitter.submit(QString(), items);
+    }
+    state.gate.release(5);
+    QVERIFY(submitter.waitForIdle());
+    QCOMPARE(state.documents, expected);
+    QCOMPARE(state.batchesStarted, 5);
+    QCOMPARE(state.batchesFinished, 5);
+    QCOMPARE(state.threads.size(), 1);
+}
+
+void tst_QWinRecentDocumentSubmitter::failures()
+{
+    SinkState state;
+    state.failingPath = QStringLiteral("C:/b.txt");
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+    QFuture<int> future = submitter.submit(QString(), { document(QStringLiteral("C:/a.txt")),
+                                                        document(QStringLiteral("C:/b.txt")),
+                                                        document(QStringLiteral("C:/c.txt")) });
+    QCOMPARE(future.result(), 2);
+    QCOMPARE(submitter.statistics().failed, quint64(1));
+}
+
+void tst_QWinRecentDocumentSubmitter::icons()
+{
+    SinkState state;
+    QAtomicInt resolved;
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state), [&resolved](const QVector<QImage> &) {
+        resolved.ref();
+        return QStringLiteral("C:/icons/1.ico");
+    });
+    QVector<QWinJumpListSnapshot::Item> items;
+    for (int i = 0; i < 3; ++i) {
+        QWinJumpListSnapshot::Item item = document(QStringLiteral("C:/%1.txt").arg(i));
+        item.iconKey = 7;
+        item.iconFrames.append(QImage(16, 16, QImage::Format_ARGB32));
+        items.append(item);
+    }
+    submitter.submit(QString(), items).waitForFinished();
+    const QString location = QStringLiteral("C:\\icons\\1.ico");
+    QCOMPARE(state.iconLocations, QStringList({ location, location, location }));
+    QCOMPARE(resolved.load(), 1);
+}
+
+void tst_QWinRecentDocumentSubmitter::doesNotBlock()
+{
+    SinkState state;
+    state.gated = true;
+    QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+    QFuture<int> future = submitter.submit(QString(), { document(QStringLiteral("C:/a.txt")) });
+    QVERIFY(!future.isFinished());
+    QVERIFY(!submitter.waitForIdle(10));
+    QVERIFY(state.documents.isEmpty());
+
+    state.gate.release();
+    QCOMPARE(future.result(), 1);
+    QVERIFY(submitter.waitForIdle());
+    QVERIFY(submitter.isIdle());
+}
+
+void tst_QWinRecentDocumentSubmitter::destruction()
+{
+    SinkState state;
+    state.gated = true;
+    QFuture<int> future;
+    {
+        QWinRecentDocumentSubmitter submitter(new StandInSink(&state));
+        future = submitter.submit(QString(), { document(QStringLiteral("C:/a.txt")) });
+        submitter.submit(QString(), { document(QStringLiteral("C:/b.txt")) });
+        state.gate.release(2);
+    }
+    QVERIFY(future.isFinished());
+    QCOMPARE(state.documents.size(), 2);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRecentDocumentSubmitter)
+
+#include "tst_qwinrecentdocumentsubmitter.moc"
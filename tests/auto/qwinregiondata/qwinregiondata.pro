@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinregiondata
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinregiondata.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinregiondata.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
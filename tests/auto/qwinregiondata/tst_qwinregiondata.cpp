@@ -0,0 +1,431 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+#include <QRegion>
+#include <QtEndian>
+
+#include "qwinregiondata_p.h"
+
+Q_DECLARE_METATYPE(QWinPixelConversion::Implementation)
+
+class tst_QWinRegionData : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void header();
+    void rectangles();
+    void roundTrip_data();
+    void roundTrip();
+    void emptyRegion();
+    void invalidData_data();
+    void invalidData();
+    void unbandedRectangles();
+    void largerHeader();
+    void simplifiedUnchanged();
+    void simplifiedTolerance();
+    void simplifiedBudget_data();
+    void simplifiedBudget();
+    void simplifiedRoundedRect();
+    void rectsFromAlpha_data();
+    void rectsFromAlpha();
+    void rectsFromAlphaBands();
+    void rectsFromAlphaThreshold();
+    void rectsFromAlphaFormats();
+    void regionDataFromAlpha();
+};
+
+static void addImplementationColumn()
+{
+    QTest::addColumn<QWinPixelConversion::Implementation>("implementation");
+
+    QTest::newRow("scalar") << QWinPixelConversion::Scalar;
+    if (QWinPixelConversion::isAvailable(QWinPixelConversion::Sse2))
+        QTest::newRow("sse2") << QWinPixelConversion::Sse2;
+    if (QWinPixelConversion::isAvailable(QWinPixelConversion::Avx2))
+        QTest::newRow("avx2") << QWinPixelConversion::Avx2;
+    if (QWinPixelConversion::isAvailable(QWinPixelConversion::Neon))
+        QTest::newRow("neon") << QWinPixelConversion::Neon;
+}
+
+// Unites the spans of pixels with alpha of at least threshold, row by row.
+static QRegion alphaRegionReference(const QImage &image, int threshold)
+{
+    QRegion region;
+    for (int y = 0; y < image.height(); ++y) {
+        const QRgb *line = reinterpret_cast<const QRgb *>(image.constScanLine(y));
+        for (int x = 0; x < image.width();) {
+            if (qAlpha(line[x]) < threshold) {
+                ++x;
+                continue;
+            }
+            const int start = x;
+            while (x < image.width() && qAlpha(line[x]) >= threshold)
+                ++x;
+            region += QRect(start, y, x - start, 1);
+        }
+    }
+    return region;
+}
+
+static QImage alphaImage(int width, int height, int pattern)
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+    for (int y = 0; y < height; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            int alpha = 0;
+            switch (pattern) {
+            case 0: // ellipse
+                alpha = (2 * x - width) * (2 * x - width) * height * height
+                        + (2 * y - height) * (2 * y - height) * width * width
+                        < width * width * height * height ? 255 : 0;
+                break;
+            case 1: // gradient
+                alpha = (x * 7 + y * 3) & 0xff;
+                break;
+            default: // stripes of varying width, repeating every 3 rows
+                alpha = ((x / (1 + (y / 3) % 7)) & 1) ? 200 : 100;
+                break;
+            }
+            line[x] = qRgba(x & 0xff, y & 0xff, 0x40, alpha);
+        }
+    }
+    return image;
+}
+
+static quint32 readU32(const QByteArray &data, int offset)
+{
+    return qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data.constData()) + offset);
+}
+
+static qint32 readS32(const QByteArray &data, int offset)
+{
+    return qFromLittleEndian<qint32>(reinterpret_cast<const uchar *>(data.constData()) + offset);
+}
+
+static QRegion checkerboard(int columns, int rows, int cell)
+{
+    QVector<QRect> rects;
+    for (int row = 0; row < rows; ++row) {
+        for (int column = row & 1; column < columns; column += 2)
+            rects.append(QRect(column * cell, row * cell, cell, cell));
+    }
+    QRegion region;
+    region.setRects(rects.constData(), rects.size());
+    return region;
+}
+
+void tst_QWinRegionData::header()
+{
+    const QRegion region = QRegion(10, 20, 30, 40) + QRegion(50, 20, 5, 5);
+    const QByteArray data = QWinRegionData::encode(region);
+    QCOMPARE(data.size(), 32 + region.rectCount() * 16);
+    QCOMPARE(readU32(data, 0), 32u);                        // dwSize
+    QCOMPARE(readU32(data, 4), 1u);                         // iType
+    QCOMPARE(readU32(data, 8), quint32(region.rectCount())); // nCount
+    QCOMPARE(readU32(data, 12), quint32(region.rectCount() * 16)); // nRgnSize
+    QCOMPARE(readS32(data, 16), 10);
+    QCOMPARE(readS32(data, 20), 20);
+    QCOMPARE(readS32(data, 24), 55);
+    QCOMPARE(readS32(data, 28), 60);
+}
+
+void tst_QWinRegionData::rectangles()
+{
+    // RECT has exclusive right and bottom edges.
+    const QRegion region(QRect(-3, 4, 7, 9));
+    const QByteArray data = QWinRegionData::encode(region);
+    QCOMPARE(readU32(data, 8), 1u);
+    QCOMPARE(readS32(data, 32), -3);
+    QCOMPARE(readS32(data, 36), 4);
+    QCOMPARE(readS32(data, 40), 4);
+    QCOMPARE(readS32(data, 44), 13);
+}
+
+void tst_QWinRegionData::roundTrip_data()
+{
+    QTest::addColumn<QRegion>("region");
+
+    QTest::newRow("rect") << QRegion(1, 2, 3, 4);
+    QTest::newRow("two bands") << (QRegion(0, 0, 10, 10) + QRegion(5, 5, 10, 10));
+    QTest::newRow("hole") << (QRegion(0, 0, 100, 100) - QRegion(25, 25, 50, 50));
+    QTest::newRow("ellipse") << QRegion(0, 0, 200, 120, QRegion::Ellipse);
+    QTest::newRow("negative") << QRegion(-500, -300, 1000, 600, QRegion::Ellipse);
+    QTest::newRow("checkerboard") << checkerboard(64, 64, 3);
+}
+
+void tst_QWinRegionData::roundTrip()
+{
+    QFETCH(QRegion, region);
+    const QByteArray data = QWinRegionData::encode(region);
+    QVERIFY(QWinRegionData::isBanded(region.begin(), region.rectCount()));
+
+    const QRegion decoded = QWinRegionData::decode(data);
+    QCOMPARE(decoded, region);
+    QCOMPARE(decoded.rectCount(), region.rectCount());
+    QCOMPARE(decoded.boundingRect(), region.boundingRect());
+}
+
+void tst_QWinRegionData::emptyRegion()
+{
+    const QByteArray data = QWinRegionData::encode(QRegion());
+    QCOMPARE(data.size(), 32);
+    QCOMPARE(readU32(data, 8), 0u);
+    QVERIFY(QWinRegionData::decode(data).isEmpty());
+}
+
+void tst_QWinRegionData::invalidData_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    const QByteArray valid = QWinRegionData::encode(QRegion(0, 0, 10, 10) + QRegion(20, 0, 10, 10));
+    QByteArray wrongType = valid;
+    qToLittleEndian<quint32>(2, wrongType.data() + 4);
+    QByteArray smallHeader = valid;
+    qToLittleEndian<quint32>(16, smallHeader.data());
+    QByteArray hugeHeader = valid;
+    qToLittleEndian<quint32>(0x7fffffff, hugeHeader.data());
+    QByteArray tooManyRects = valid;
+    qToLittleEndian<quint32>(3, tooManyRects.data() + 8);
+    QByteArray overflowingCount = valid;
+    qToLittleEndian<quint32>(0xffffffff, overflowingCount.data() + 8);
+
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("short header") << valid.left(31);
+    QTest::newRow("truncated rects") << valid.left(valid.size() - 1);
+    QTest::newRow("wrong type") << wrongType;
+    QTest::newRow("small header") << smallHeader;
+    QTest::newRow("huge header") << hugeHeader;
+    QTest::newRow("too many rects") << tooManyRects;
+    QTest::newRow("overflowing count") << overflowingCount;
+}
+
+void tst_QWinRegionData::invalidData()
+{
+    QFETCH(QByteArray, data);
+    QVERIFY(QWinRegionData::decode(data).isEmpty());
+}
+
+void tst_QWinRegionData::unbandedRectangles()
+{
+    // Overlapping and unsorted rectangles are not what GetRegionData()
+    // produces, but must still result in their union.
+    const QRect rects[] = { QRect(10, 10, 20, 20), QRect(0, 0, 15, 15), QRect(15, 0, 5, 5) };
+    QVERIFY(!QWinRegionData::isBanded(rects, 3));
+
+    QByteArray data(32 + 3 * 16, Qt::Uninitialized);
+    qToLittleEndian<quint32>(32, data.data());
+    qToLittleEndian<quint32>(1, data.data() + 4);
+    qToLittleEndian<quint32>(3, data.data() + 8);
+    qToLittleEndian<quint32>(3 * 16, data.data() + 12);
+    QRegion expected;
+    for (int i = 0; i < 3; ++i) {
+        char *rect = data.data() + 32 + i * 16;
+        qToLittleEndian<qint32>(rects[i].left(), rect);
+        qToLittleEndian<qint32>(rects[i].top(), rect + 4);
+        qToLittleEndian<qint32>(rects[i].left() + rects[i].width(), rect + 8);
+        qToLittleEndian<qint32>(rects[i].top() + rects[i].height(), rect + 12);
+        expected += rects[i];
+    }
+    QCOMPARE(QWinRegionData::decode(data), expected);
+
+    // Horizontally touching rectangles in one band must be merged by QRegion.
+    const QRect touching[] = { QRect(0, 0, 5, 5), QRect(5, 0, 5, 5) };
+    QVERIFY(!QWinRegionData::isBanded(touching, 2));
+}
+
+void tst_QWinRegionData::largerHeader()
+{
+    // dwSize gives the offset of the rectangles.
+    const QRegion region = QRegion(0, 0, 10, 10, QRegion::Ellipse);
+    const QByteArray encoded = QWinRegionData::encode(region);
+    QByteArray data = encoded.left(32) + QByteArray(8, '\0') + encoded.mid(32);
+    qToLittleEndian<quint32>(40, data.data());
+    QCOMPARE(QWinRegionData::decode(data), region);
+}
+
+void tst_QWinRegionData::simplifiedUnchanged()
+{
+    const QRegion region = QRegion(0, 0, 100, 60, QRegion::Ellipse);
+    QCOMPARE(QWinRegionData::simplified(region, 0), region);
+    QCOMPARE(QWinRegionData::simplified(region, region.rectCount()), region);
+    QVERIFY(QWinRegionData::simplified(QRegion(), 4).isEmpty());
+}
+
+void tst_QWinRegionData::simplifiedTolerance()
+{
+    // Two rectangles 3 pixels apart in one band.
+    const QRegion band = QRegion(0, 0, 10, 10) + QRegion(13, 0, 10, 10);
+    QCOMPARE(QWinRegionData::simplified(band, 0, 2), band);
+    QCOMPARE(QWinRegionData::simplified(band, 0, 3), QRegion(0, 0, 23, 10));
+
+    // Rows whose edges differ by a pixel, and a 2 pixel vertical gap.
+    const QRegion rows = QRegion(0, 0, 10, 5) + QRegion(1, 5, 10, 5) + QRegion(0, 12, 11, 5);
+    QCOMPARE(QWinRegionData::simplified(rows, 0, 0), rows);
+    QCOMPARE(QWinRegionData::simplified(rows, 0, 1).rectCount(), 2);
+    QCOMPARE(QWinRegionData::simplified(rows, 0, 2), QRegion(0, 0, 11, 17));
+}
+
+void tst_QWinRegionData::simplifiedBudget_data()
+{
+    QTest::addColumn<QRegion>("region");
+    QTest::addColumn<int>("maxRects");
+    QTest::addColumn<int>("tolerance");
+
+    const QRegion ellipse(0, 0, 400, 300, QRegion::Ellipse);
+    const QRegion board = checkerboard(20, 20, 5);
+    QRegion text;
+    for (int line = 0; line < 5; ++line) {
+        for (int glyph = 0; glyph < 30; ++glyph) {
+            text += QRegion(glyph * 9, line * 20, 7, 12, QRegion::Ellipse);
+            text -= QRegion(glyph * 9 + 3, line * 20 + 4, 1, 4);
+        }
+    }
+
+    QTest::newRow("ellipse, 1") << ellipse << 1 << 0;
+    QTest::newRow("ellipse, 8") << ellipse << 8 << 0;
+    QTest::newRow("ellipse, 32, tolerance") << ellipse << 32 << 2;
+    QTest::newRow("checkerboard, 10") << board << 10 << 0;
+    QTest::newRow("checkerboard, 100") << board << 100 << 0;
+    QTest::newRow("checkerboard, 50, tolerance") << board << 50 << 5;
+    QTest::newRow("text, 5") << text << 5 << 0;
+    QTest::newRow("text, 64") << text << 64 << 1;
+}
+
+void tst_QWinRegionData::simplifiedBudget()
+{
+    QFETCH(QRegion, region);
+    QFETCH(int, maxRects);
+    QFETCH(int, tolerance);
+
+    const QRegion simplified = QWinRegionData::simplified(region, maxRects, tolerance);
+    QVERIFY(simplified.rectCount() <= maxRects);
+    QVERIFY((region - simplified).isEmpty());
+    QVERIFY(region.boundingRect().contains(simplified.boundingRect()));
+    if (maxRects == 1)
+        QCOMPARE(simplified, QRegion(region.boundingRect()));
+}
+
+void tst_QWinRegionData::simplifiedRoundedRect()
+{
+    // A window with 12 pixel rounded corners: only the corner rows need
+    // approximating, and the cheapest approximation keeps the middle exact.
+    QRegion region(0, 12, 800, 576);
+    region += QRegion(12, 0, 776, 600);
+    for (const QPoint &corner : { QPoint(0, 0), QPoint(776, 0), QPoint(0, 576), QPoint(776, 576) })
+        region += QRegion(corner.x(), corner.y(), 24, 24, QRegion::Ellipse);
+    QVERIFY(region.rectCount() > 7);
+
+    const QRegion simplified = QWinRegionData::simplified(region, 7);
+    QVERIFY(simplified.rectCount() <= 7);
+    QVERIFY((region - simplified).isEmpty());
+    QVERIFY(simplified.contains(QRect(0, 12, 800, 576)));
+    QVERIFY(!simplified.contains(QPoint(0, 0)));
+    QVERIFY(!simplified.contains(QPoint(799, 599)));
+}
+
+void tst_QWinRegionData::rectsFromAlpha_data()
+{
+    addImplementationColumn();
+}
+
+void tst_QWinRegionData::rectsFromAlpha()
+{
+    QFETCH(QWinPixelConversion::Implementation, implementation);
+
+    // Widths around the 16, 32 and 64 pixel steps of the kernels and scanner.
+    const int widths[] = { 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 129, 257 };
+    for (int width : widths) {
+        for (int pattern = 0; pattern < 3; ++pattern) {
+            const QImage image = alphaImage(width, 23, pattern);
+            for (int threshold : { 1, 128, 201 }) {
+                const QVector<QRect> rects = QWinRegionData::rectsFromAlpha(image, threshold, implementation);
+                QVERIFY(QWinRegionData::isBanded(rects.constData(), rects.size()));
+                QRegion region;
+                region.setRects(rects.constData(), rects.size());
+                QCOMPARE(region, alphaRegionReference(image, threshold));
+            }
+        }
+    }
+}
+
+void tst_QWinRegionData::rectsFromAlphaBands()
+{
+    // Identical rows form a single band; a fully opaque image is one rectangle.
+    QImage image(300, 200, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QCOMPARE(QWinRegionData::rectsFromAlpha(image).size(), 0);
+    image.fill(Qt::black);
+    QCOMPARE(QWinRegionData::rectsFromAlpha(image), QVector<QRect>() << QRect(0, 0, 300, 200));
+
+    const QImage stripes = alphaImage(90, 30, 2);
+    const QVector<QRect> rects = QWinRegionData::rectsFromAlpha(stripes);
+    for (const QRect &rect : rects)
+        QCOMPARE(rect.height(), 3);
+}
+
+void tst_QWinRegionData::rectsFromAlphaThreshold()
+{
+    const QImage image = alphaImage(64, 64, 1);
+    QCOMPARE(QWinRegionData::regionFromAlpha(image, 0), QRegion(image.rect()));
+    QCOMPARE(QWinRegionData::regionFromAlpha(image, -5), QRegion(image.rect()));
+    QVERIFY(QWinRegionData::regionFromAlpha(image, 256).isEmpty());
+    QCOMPARE(QWinRegionData::regionFromAlpha(image, 255), alphaRegionReference(image, 255));
+}
+
+void tst_QWinRegionData::rectsFromAlphaFormats()
+{
+    const QImage image = alphaImage(77, 33, 0);
+    const QRegion expected = alphaRegionReference(image, 128);
+    QCOMPARE(QWinRegionData::regionFromAlpha(image.convertToFormat(QImage::Format_ARGB32_Premultiplied)),
+             expected);
+    QCOMPARE(QWinRegionData::regionFromAlpha(image.convertToFormat(QImage::Format_RGBA8888)), expected);
+    QCOMPARE(QWinRegionData::regionFromAlpha(image.convertToFormat(QImage::Format_Alpha8)), expected);
+
+    // Without an alpha channel, every pixel is opaque.
+    const QImage opaque = image.convertToFormat(QImage::Format_RGB32);
+    QCOMPARE(QWinRegionData::regionFromAlpha(opaque), QRegion(opaque.rect()));
+    QVERIFY(QWinRegionData::regionFromAlpha(opaque, 256).isEmpty());
+    QVERIFY(QWinRegionData::regionFromAlpha(QImage()).isEmpty());
+}
+
+void tst_QWinRegionData::regionDataFromAlpha()
+{
+    const QImage image = alphaImage(123, 45, 0);
+    const QByteArray data = QWinRegionData::regionDataFromAlpha(image);
+    const QRegion region = QWinRegionData::regionFromAlpha(image);
+    QCOMPARE(data, QWinRegionData::encode(region));
+    QCOMPARE(QWinRegionData::decode(data), region);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRegionData)
+
+#include "tst_qwinregiondata.moc"
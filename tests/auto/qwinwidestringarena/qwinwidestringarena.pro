@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qwinwidestringarena
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_qwinwidestringarena.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwidestringarena.cpp
@@ -0,0 +1,143 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinwidestringarena_p.h"
+
+class tst_QWinWideStringArena : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void allocate();
+    void zeroCopy();
+    void copies();
+    void nativePath();
+    void growth();
+    void reset();
+    void oversized();
+};
+
+static QString fromArena(const QChar *string)
+{
+    int size = 0;
+    while (!string[size].isNull())
+        ++size;
+    return QString(string, size);
+}
+
+void tst_QWinWideStringArena::allocate()
+{
+    QWinWideStringArena arena(16);
+    QChar *first = arena.allocate(3);
+    QVERIFY(first[3].isNull());
+    QCOMPARE(arena.used(), 4);
+    QChar *second = arena.allocate(0);
+    QCOMPARE(second, first + 4);
+    QVERIFY(second->isNull());
+    QCOMPARE(arena.chunkCount(), 1);
+}
+
+void tst_QWinWideStringArena::zeroCopy()
+{
+    QWinWideStringArena arena;
+    const QString string = QString::number(12345) + QLatin1String("/path");
+    QCOMPARE(arena.string(string), string.constData());
+    QCOMPARE(arena.used(), 0);
+    QCOMPARE(arena.chunkCount(), 0);
+
+    QVERIFY(arena.string(QString())->isNull());
+    QVERIFY(arena.string(QLatin1String(""))->isNull());
+    QCOMPARE(arena.used(), 0);
+}
+
+void tst_QWinWideStringArena::copies()
+{
+    // Raw data is not zero-terminated, literals have no capacity to tell.
+    QWinWideStringArena arena;
+    static const QChar raw[] = { QLatin1Char('a'), QLatin1Char('b'), QLatin1Char('c') };
+    const QString rawString = QString::fromRawData(raw, 2);
+    const QChar *copy = arena.string(rawString);
+    QVERIFY(copy != raw);
+    QCOMPARE(fromArena(copy), QStringLiteral("ab"));
+
+    const QString literal = QStringLiteral("literal");
+    QCOMPARE(fromArena(arena.string(literal)), literal);
+}
+
+void tst_QWinWideStringArena::nativePath()
+{
+    QWinWideStringArena arena;
+    QCOMPARE(fromArena(arena.nativePath(QStringLiteral("C:/Users/a b/icon.ico"))),
+             QStringLiteral("C:\\Users\\a b\\icon.ico"));
+    QVERIFY(arena.nativePath(QString())->isNull());
+}
+
+void tst_QWinWideStringArena::growth()
+{
+    QWinWideStringArena arena(8);
+    QVector<const QChar *> strings;
+    for (int i = 0; i < 100; ++i)
+        strings.append(arena.nativePath(QString::number(i)));
+    QVERIFY(arena.chunkCount() > 1);
+    // Strings survive the growth of the arena.
+    for (int i = 0; i < strings.size(); ++i)
+        QCOMPARE(fromArena(strings.at(i)), QString::number(i));
+}
+
+void tst_QWinWideStringArena::reset()
+{
+    QWinWideStringArena arena(8);
+    for (int i = 0; i < 100; ++i)
+        arena.nativePath(QString::number(i));
+    const int capacity = arena.capacity();
+
+    arena.reset();
+    QCOMPARE(arena.chunkCount(), 1);
+    QCOMPARE(arena.capacity(), capacity);
+    QCOMPARE(arena.used(), 0);
+
+    // The merged chunk fits the same strings again.
+    for (int i = 0; i < 100; ++i)
+        arena.nativePath(QString::number(i));
+    QCOMPARE(arena.chunkCount(), 1);
+    QCOMPARE(arena.capacity(), capacity);
+}
+
+void tst_QWinWideStringArena::oversized()
+{
+    QWinWideStringArena arena(8);
+    const QString path(100, QLatin1Char('/'));
+    QCOMPARE(fromArena(arena.nativePath(path)), QString(100, QLatin1Char('\\')));
+    QVERIFY(arena.capacity() >= 101);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinWideStringArena)
+
+#include "tst_qwinwidestringarena.moc"
@@ -0,0 +1,22 @@
+TEMPLATE = subdirs
+SUBDIRS += \
+    qwinpixelconversion \
+    qwindibsection \
+    qwiniconconversion \
+    qwiniconpyramid \
+    qwinicowriter \
+    qwinregiondata \
+    qwinhresultnames \
+    qwinhresultmessagecache \
+    qwinhresultinfo \
+    qwincomfailurereporter \
+    qwinjumplistsnapshot \
+    qwinrebuildscheduler \
+    qwinjumplistcommitter \
+    qwincommandline \
+    qwinjumplistserializer \
+    qwinrecentdocumentsubmitter \
+    qwinjumpliststate \
+    qwinjumplistmodelmapper
+
+qtHaveModule(qml): SUBDIRS += qquickjumplist
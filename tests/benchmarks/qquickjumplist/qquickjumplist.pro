@@ -0,0 +1,6 @@
+CONFIG += benchmark
+TARGET = tst_bench_qquickjumplist
+QT = core gui qml testlib
+include(../../shared/winextras-imports.pri)
+SOURCES += \
+    tst_bench_qquickjumplist.cpp
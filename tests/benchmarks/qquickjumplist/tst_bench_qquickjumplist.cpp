@@ -0,0 +1,142 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
+
+#include "standinjumplistbackend.h"
+
+// A JumpList of 1000 declared items in 10 categories on the stand-in
+// backend; run with -platform offscreen where there is no display. Changes
+// are compared with what the former JumpList did for every change of a
+// category visibility: read every property of every item by name, before
+// creating a QWinJumpList with a QWinJumpListItem and a QIcon per item.
+class tst_QQuickJumpList : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void create();
+    void itemProperty();
+    void categoryVisibility();
+    void legacyRebuild();
+
+private:
+    enum { CategoryCount = 10, ItemsPerCategory = 100 };
+
+    QQmlEngine m_engine;
+    QQmlComponent *m_component = nullptr;
+    QObject *m_jumpList = nullptr;
+    StandInJumpListBackend *m_backend = nullptr;
+    QList<QObject *> m_links;
+};
+
+void tst_QQuickJumpList::initTestCase()
+{
+    StandInJumpListBackend::registerTypes();
+    QByteArray qml = "import QtWinExtras 1.0\nJumpList {\n";
+    for (int c = 0; c < CategoryCount; ++c) {
+        qml += "    JumpListCategory {\n        title: 'Category " + QByteArray::number(c) + "'\n";
+        for (int i = 0; i < ItemsPerCategory; ++i) {
+            const QByteArray n = QByteArray::number(c * ItemsPerCategory + i);
+            qml += "        JumpListLink { title: 'Document " + n + "'; executablePath: 'C:/App/app.exe';"
+                   " arguments: 'C:/Documents/document " + n + ".txt'; description: 'Opens document "
+                   + n + "'; iconPath: 'C:/App/document.ico' }\n";
+        }
+        qml += "    }\n";
+    }
+    qml += "}\n";
+    m_component = new QQmlComponent(&m_engine);
+    m_component->setData(qml, QUrl());
+    m_jumpList = m_component->create();
+    QVERIFY2(m_jumpList, qPrintable(m_component->errorString()));
+    m_backend = StandInJumpListBackend::instance;
+    const QList<QObject *> children = m_jumpList->findChildren<QObject *>();
+    for (QObject *child : children) {
+        if (child->property("executablePath").isValid())
+            m_links.append(child);
+    }
+    QCOMPARE(m_links.size(), int(CategoryCount * ItemsPerCategory));
+}
+
+void tst_QQuickJumpList::cleanupTestCase()
+{
+    delete m_jumpList;
+    delete m_component;
+}
+
+void tst_QQuickJumpList::create()
+{
+    QBENCHMARK {
+        QScopedPointer<QObject> jumpList(m_component->create());
+        QCOMPARE(StandInJumpListBackend::instance->categories.size(), int(CategoryCount));
+    }
+}
+
+// One backend call per change, whatever the size of the jump list.
+void tst_QQuickJumpList::itemProperty()
+{
+    const int updates = m_backend->updates;
+    QObject *link = m_links.at(m_links.size() / 2);
+    int changes = 0;
+    QBENCHMARK {
+        link->setProperty("title", QString::number(++changes));
+    }
+    QCOMPARE(m_backend->updates, updates + changes);
+}
+
+void tst_QQuickJumpList::categoryVisibility()
+{
+    const int updates = m_backend->updates;
+    QObject *category = m_links.first()->parent();
+    int changes = 0;
+    QBENCHMARK {
+        category->setProperty("visible", bool(++changes % 2));
+    }
+    QCOMPARE(m_backend->updates, updates + changes);
+}
+
+void tst_QQuickJumpList::legacyRebuild()
+{
+    static const char *const names[] = { "executablePath", "arguments", "description", "title", "iconPath" };
+    int size = 0;
+    QBENCHMARK {
+        for (const QObject *link : qAsConst(m_links)) {
+            for (const char *name : names)
+                size += link->property(name).toString().size();
+        }
+    }
+    QVERIFY(size > 0);
+}
+
+QTEST_MAIN(tst_QQuickJumpList)
+
+#include "tst_bench_qquickjumplist.moc"
@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+#include "qwincomfailurereporter_p.h"
+
+// Measures the cost of a failing call during an outage, such as taskbar
+// progress updates while Explorer restarts, where nearly every report is
+// suppressed, and compares it with logging every failure.
+class tst_QWinComFailureReporter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void logEveryFailure();
+    void suppressed();
+    void recentFailures();
+    void threads_data();
+    void threads();
+};
+
+static const int reportCount = 10000;
+static const quint32 accessDenied = 0x80070005;
+
+static void discard(const QByteArray &message)
+{
+    static QAtomicInt sink;
+    sink.fetchAndAddRelaxed(message.size());
+}
+
+void tst_QWinComFailureReporter::logEveryFailure()
+{
+    QWinComFailureReporter reporter;
+    reporter.setSink(discard);
+    reporter.setInitialBackoff(0);
+    reporter.setMaximumBackoff(0);
+    QBENCHMARK {
+        for (int i = 0; i < reportCount; ++i)
+            reporter.report("QWinTaskbarButton", "SetProgressValue()", accessDenied);
+    }
+}
+
+void tst_QWinComFailureReporter::suppressed()
+{
+    QWinComFailureReporter reporter;
+    reporter.setSink(discard);
+    QBENCHMARK {
+        for (int i = 0; i < reportCount; ++i)
+            reporter.report("QWinTaskbarButton", "SetProgressValue()", accessDenied);
+    }
+    QVERIFY(reporter.statistics().suppressed > 0);
+}
+
+void tst_QWinComFailureReporter::recentFailures()
+{
+    QWinComFailureReporter reporter;
+    reporter.setSink(discard);
+    for (int i = 0; i < QWinComFailureReporter::HistorySize; ++i)
+        reporter.report("QWinJumpList", "CommitList()", quint32(i));
+    int total = 0;
+    QBENCHMARK {
+        total += reporter.recentFailures().size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinComFailureReporter::threads_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    for (int threadCount : { 1, 4, 8 })
+        QTest::addRow("%d threads", threadCount) << threadCount;
+}
+
+void tst_QWinComFailureReporter::threads()
+{
+    QFETCH(int, threadCount);
+
+    QWinComFailureReporter reporter;
+    reporter.setSink(discard);
+    QBENCHMARK {
+        QVector<QThread *> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.append(QThread::create([&reporter]() {
+                for (int i = 0; i < reportCount; ++i)
+                    reporter.report("QWinTaskbarButton", "SetProgressValue()", accessDenied);
+            }));
+            threads.constLast()->start();
+        }
+        for (QThread *thread : qAsConst(threads)) {
+            thread->wait();
+            delete thread;
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinComFailureReporter)
+
+#include "tst_bench_qwincomfailurereporter.moc"
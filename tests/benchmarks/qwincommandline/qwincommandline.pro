@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwincommandline
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwincommandline.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
@@ -0,0 +1,140 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QRegularExpression>
+
+#include "qwincommandline_p.h"
+
+class tst_QWinCommandLine : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void join_data();
+    void join();
+    void split_data();
+    void split();
+
+private:
+    static void addRows();
+    static QStringList arguments(const QByteArray &kind);
+};
+
+// The QRegularExpression based quoting QWinJumpList used before, as a baseline.
+static QString legacyCreateArguments(const QStringList &arguments)
+{
+    QString args;
+    for (int i=0; i<arguments.size(); ++i) {
+        QString tmp = arguments.at(i);
+        tmp.replace(QRegularExpression(QLatin1String("(\\\\*)\"")), QLatin1String("\\1\\1\\\""));
+        if (tmp.isEmpty() || tmp.contains(QLatin1Char(' ')) || tmp.contains(QLatin1Char('\t'))) {
+            int i = tmp.length();
+            while (i > 0 && tmp.at(i - 1) == QLatin1Char('\\'))
+                --i;
+            tmp.insert(i, QLatin1Char('"'));
+            tmp.prepend(QLatin1Char('"'));
+        }
+        args += QLatin1Char(' ') + tmp;
+    }
+    return args;
+}
+
+QStringList tst_QWinCommandLine::arguments(const QByteArray &kind)
+{
+    static const int count = 10000;
+    QStringList result;
+    result.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        if (kind == "plain")
+            result.append(QStringLiteral("--option%1").arg(i));
+        else if (kind == "paths")
+            result.append(QStringLiteral("C:\\Program Files\\Application %1\\").arg(i));
+        else
+            result.append(QStringLiteral("say \"hello\\\" %1").arg(i));
+    }
+    return result;
+}
+
+void tst_QWinCommandLine::addRows()
+{
+    QTest::addColumn<QByteArray>("kind");
+    QTest::addColumn<bool>("legacy");
+
+    for (const char *kind : { "plain", "paths", "quotes" }) {
+        QTest::newRow(QByteArray(kind) + "/legacy") << QByteArray(kind) << true;
+        QTest::newRow(QByteArray(kind) + "/single-pass") << QByteArray(kind) << false;
+    }
+}
+
+void tst_QWinCommandLine::join_data()
+{
+    addRows();
+}
+
+void tst_QWinCommandLine::join()
+{
+    QFETCH(QByteArray, kind);
+    QFETCH(bool, legacy);
+
+    const QStringList list = arguments(kind);
+    QString commandLine;
+    if (legacy) {
+        QBENCHMARK {
+            commandLine = legacyCreateArguments(list);
+        }
+    } else {
+        QBENCHMARK {
+            commandLine = QWinCommandLine::join(list);
+        }
+    }
+    QVERIFY(!commandLine.isEmpty());
+}
+
+void tst_QWinCommandLine::split_data()
+{
+    addRows();
+}
+
+void tst_QWinCommandLine::split()
+{
+    QFETCH(QByteArray, kind);
+    QFETCH(bool, legacy);
+
+    const QStringList list = arguments(kind);
+    const QString commandLine = legacy ? legacyCreateArguments(list) : QWinCommandLine::join(list);
+    QStringList parsed;
+    QBENCHMARK {
+        parsed = QWinCommandLine::split(commandLine);
+    }
+    QCOMPARE(parsed, list);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinCommandLine)
+
+#include "tst_bench_qwincommandline.moc"
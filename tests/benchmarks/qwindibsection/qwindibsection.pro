@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwindibsection
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwindibsection.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwindibsection.cpp
@@ -0,0 +1,102 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+
+#include "qwindibsection_p.h"
+
+// Compares handing out a view of DIB memory with copying the pixels into a
+// new QImage, which is what QtWin::imageFromHBITMAP() does.
+class tst_QWinDibSection : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void view_data() { sizes(); }
+    void view();
+    void copy_data() { sizes(); }
+    void copy();
+
+private:
+    static void sizes();
+};
+
+void tst_QWinDibSection::sizes()
+{
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<bool>("bottomUp");
+
+    QTest::newRow("48x48") << QSize(48, 48) << false;
+    QTest::newRow("256x256") << QSize(256, 256) << false;
+    QTest::newRow("1920x1080") << QSize(1920, 1080) << false;
+    QTest::newRow("1920x1080-bottom-up") << QSize(1920, 1080) << true;
+    QTest::newRow("3840x2160") << QSize(3840, 2160) << false;
+}
+
+static QWinDibLayout layoutFor(const QSize &size, bool bottomUp)
+{
+    return QWinDibLayout::fromBitmapInfo(size.width(), bottomUp ? size.height() : -size.height());
+}
+
+void tst_QWinDibSection::view()
+{
+    QFETCH(QSize, size);
+    QFETCH(bool, bottomUp);
+    QWinMallocDibAllocator allocator;
+    const QWinDibLayout layout = layoutFor(size, bottomUp);
+    uchar *bits = nullptr;
+    void *handle = allocator.allocate(layout, &bits);
+    memset(bits, 0x7f, size_t(layout.byteCount()));
+    QBENCHMARK {
+        const QImage image = QWinDibSection::wrap(bits, layout, QImage::Format_ARGB32_Premultiplied);
+        Q_UNUSED(image);
+    }
+    allocator.release(handle);
+}
+
+void tst_QWinDibSection::copy()
+{
+    QFETCH(QSize, size);
+    QFETCH(bool, bottomUp);
+    QWinMallocDibAllocator allocator;
+    const QWinDibLayout layout = layoutFor(size, bottomUp);
+    uchar *bits = nullptr;
+    void *handle = allocator.allocate(layout, &bits);
+    memset(bits, 0x7f, size_t(layout.byteCount()));
+    QBENCHMARK {
+        QImage image(size, QImage::Format_ARGB32_Premultiplied);
+        for (int y = 0; y < size.height(); ++y)
+            memcpy(image.scanLine(y), layout.scanLine(bits, y), size_t(layout.bytesPerLine()));
+    }
+    allocator.release(handle);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinDibSection)
+
+#include "tst_bench_qwindibsection.moc"
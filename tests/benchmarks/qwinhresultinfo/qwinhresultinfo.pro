@@ -0,0 +1,8 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinhresultinfo
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwinhresultinfo.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultinfo.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultnames.cpp
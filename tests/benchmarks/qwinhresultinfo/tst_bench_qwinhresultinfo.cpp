@@ -0,0 +1,139 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinhresultinfo.h"
+
+using QtWin::HResultInfo;
+
+// Measures decoding HRESULTs with HResultInfo against doing so with
+// shifts and masks, as the winerror.h macros do, and formatting them.
+class tst_QWinHResultInfo : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void decodeMacros();
+    void decodeInfo();
+    void facilityName();
+    void name();
+    void debugStream();
+    void stringFormatting();
+
+private:
+    QVector<quint32> m_values;
+};
+
+void tst_QWinHResultInfo::initTestCase()
+{
+    // A mix of Win32, COM, shell and DXGI failures and some successes.
+    const quint32 bases[] = { 0x80070000, 0x80040000, 0x80270000, 0x887A0000, 0x00040000 };
+    for (int i = 0; i < 100000; ++i)
+        m_values.append(bases[i % 5] | quint32((i * 37) & 0xffff));
+}
+
+void tst_QWinHResultInfo::decodeMacros()
+{
+    quint64 total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : qAsConst(m_values)) {
+            if (hresult & 0x80000000u)
+                total += ((hresult >> 16) & 0x1fff) + (hresult & 0xffff);
+        }
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinHResultInfo::decodeInfo()
+{
+    quint64 total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : qAsConst(m_values)) {
+            const HResultInfo info(hresult);
+            if (info.isFailure())
+                total += info.facility() + info.code();
+        }
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinHResultInfo::facilityName()
+{
+    int total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : qAsConst(m_values))
+            total += HResultInfo(hresult).facilityName().size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinHResultInfo::name()
+{
+    int total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : qAsConst(m_values))
+            total += HResultInfo(hresult).name().size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinHResultInfo::debugStream()
+{
+    QString out;
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i) {
+            out.clear();
+            QDebug(&out) << HResultInfo(m_values.at(i));
+        }
+    }
+    QVERIFY(!out.isEmpty());
+}
+
+// The equivalent message built from QString pieces.
+void tst_QWinHResultInfo::stringFormatting()
+{
+    QString out;
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i) {
+            const HResultInfo info(m_values.at(i));
+            out = QString::fromLatin1("0x%1 %2, facility=%3 (%4), code=%5")
+                      .arg(info.value(), 8, 16, QLatin1Char('0'))
+                      .arg(QString(info.name()))
+                      .arg(QString(info.facilityName()))
+                      .arg(info.facility())
+                      .arg(info.code());
+        }
+    }
+    QVERIFY(!out.isEmpty());
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHResultInfo)
+
+#include "tst_bench_qwinhresultinfo.moc"
@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinhresultmessagecache
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwinhresultmessagecache.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultmessagecache.cpp
@@ -0,0 +1,127 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+#include "qwinhresultmessagecache_p.h"
+
+// Compares formatting HRESULT messages on every call with the striped
+// cache, single-threaded and from several threads at once.
+class tst_QWinHResultMessageCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void uncached();
+    void cached();
+    void threads_data();
+    void threads();
+};
+
+// Stand-in for FormatMessage(): looks through a message table and builds
+// the string on the heap, as the system does.
+static QString formatMessage(quint32 hresult, quint32 language)
+{
+    static const char *const templates[] = {
+        "The parameter is incorrect.",
+        "Unspecified error",
+        "No such interface supported",
+        "Element not found.",
+        "The system cannot find the file specified."
+    };
+    QByteArray message;
+    for (int i = 0; i <= int(hresult % 5); ++i)
+        message = QByteArray(templates[i]) + ' ' + QByteArray::number(language);
+    return QString::fromLatin1(message) + QLatin1String("\r\n");
+}
+
+static const int lookupCount = 10000;
+
+static quint32 lookupCode(int i)
+{
+    return 0x80070000 | quint32(i % 16);
+}
+
+void tst_QWinHResultMessageCache::uncached()
+{
+    int total = 0;
+    QBENCHMARK {
+        for (int i = 0; i < lookupCount; ++i)
+            total += formatMessage(lookupCode(i), 1033).size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinHResultMessageCache::cached()
+{
+    QWinHResultMessageCache cache(formatMessage);
+    int total = 0;
+    QBENCHMARK {
+        for (int i = 0; i < lookupCount; ++i)
+            total += cache.message(lookupCode(i), 1033).size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QWinHResultMessageCache::threads_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<int>("stripeCount");
+
+    for (int threadCount : { 1, 4, 8 }) {
+        for (int stripeCount : { 1, 8 })
+            QTest::addRow("%d threads, %d stripes", threadCount, stripeCount) << threadCount << stripeCount;
+    }
+}
+
+void tst_QWinHResultMessageCache::threads()
+{
+    QFETCH(int, threadCount);
+    QFETCH(int, stripeCount);
+
+    QWinHResultMessageCache cache(formatMessage, QWinHResultMessageCache::DefaultCapacity, stripeCount);
+    QBENCHMARK {
+        QVector<QThread *> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.append(QThread::create([&cache, t]() {
+                for (int i = 0; i < lookupCount; ++i)
+                    cache.message(lookupCode(i + t), 1033);
+            }));
+            threads.constLast()->start();
+        }
+        for (QThread *thread : qAsConst(threads)) {
+            thread->wait();
+            delete thread;
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHResultMessageCache)
+
+#include "tst_bench_qwinhresultmessagecache.moc"
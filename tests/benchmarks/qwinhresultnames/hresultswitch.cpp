@@ -0,0 +1,1220 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// This file was generated by util/hresultnames/generate.py from
+// util/hresultnames/hresultnames.txt. Do not edit.
+
+// The switch statement QtWin::errorStringFromHresult() used before the
+// name tables, for comparison.
+
+#include <QtCore/qstring.h>
+
+QString hresultSwitchName(quint32 hresult)
+{
+    switch (hresult) {
+    case 0x8000FFFFu : return QStringLiteral("E_UNEXPECTED");
+    case 0x80004001u : return QStringLiteral("E_NOTIMPL");
+    case 0x8007000Eu : return QStringLiteral("E_OUTOFMEMORY");
+    case 0x80070057u : return QStringLiteral("E_INVALIDARG");
+    case 0x80004002u : return QStringLiteral("E_NOINTERFACE");
+    case 0x80004003u : return QStringLiteral("E_POINTER");
+    case 0x80070006u : return QStringLiteral("E_HANDLE");
+    case 0x80004004u : return QStringLiteral("E_ABORT");
+    case 0x80004005u : return QStringLiteral("E_FAIL");
+    case 0x80070005u : return QStringLiteral("E_ACCESSDENIED");
+    case 0x8000000Au : return QStringLiteral("E_PENDING");
+    case 0x80004006u : return QStringLiteral("CO_E_INIT_TLS");
+    case 0x80004007u : return QStringLiteral("CO_E_INIT_SHARED_ALLOCATOR");
+    case 0x80004008u : return QStringLiteral("CO_E_INIT_MEMORY_ALLOCATOR");
+    case 0x80004009u : return QStringLiteral("CO_E_INIT_CLASS_CACHE");
+    case 0x8000400Au : return QStringLiteral("CO_E_INIT_RPC_CHANNEL");
+    case 0x8000400Bu : return QStringLiteral("CO_E_INIT_TLS_SET_CHANNEL_CONTROL");
+    case 0x8000400Cu : return QStringLiteral("CO_E_INIT_TLS_CHANNEL_CONTROL");
+    case 0x8000400Du : return QStringLiteral("CO_E_INIT_UNACCEPTED_USER_ALLOCATOR");
+    case 0x8000400Eu : return QStringLiteral("CO_E_INIT_SCM_MUTEX_EXISTS");
+    case 0x8000400Fu : return QStringLiteral("CO_E_INIT_SCM_FILE_MAPPING_EXISTS");
+    case 0x80004010u : return QStringLiteral("CO_E_INIT_SCM_MAP_VIEW_OF_FILE");
+    case 0x80004011u : return QStringLiteral("CO_E_INIT_SCM_EXEC_FAILURE");
+    case 0x80004012u : return QStringLiteral("CO_E_INIT_ONLY_SINGLE_THREADED");
+    case 0x80004013u : return QStringLiteral("CO_E_CANT_REMOTE");
+    case 0x80004014u : return QStringLiteral("CO_E_BAD_SERVER_NAME");
+    case 0x80004015u : return QStringLiteral("CO_E_WRONG_SERVER_IDENTITY");
+    case 0x80004016u : return QStringLiteral("CO_E_OLE1DDE_DISABLED");
+    case 0x80004017u : return QStringLiteral("CO_E_RUNAS_SYNTAX");
+    case 0x80004018u : return QStringLiteral("CO_E_CREATEPROCESS_FAILURE");
+    case 0x80004019u : return QStringLiteral("CO_E_RUNAS_CREATEPROCESS_FAILURE");
+    case 0x8000401Au : return QStringLiteral("CO_E_RUNAS_LOGON_FAILURE");
+    case 0x8000401Bu : return QStringLiteral("CO_E_LAUNCH_PERMSSION_DENIED");
+    case 0x8000401Cu : return QStringLiteral("CO_E_START_SERVICE_FAILURE");
+    case 0x8000401Du : return QStringLiteral("CO_E_REMOTE_COMMUNICATION_FAILURE");
+    case 0x8000401Eu : return QStringLiteral("CO_E_SERVER_START_TIMEOUT");
+    case 0x8000401Fu : return QStringLiteral("CO_E_CLSREG_INCONSISTENT");
+    case 0x80004020u : return QStringLiteral("CO_E_IIDREG_INCONSISTENT");
+    case 0x80004021u : return QStringLiteral("CO_E_NOT_SUPPORTED");
+    case 0x80004022u : return QStringLiteral("CO_E_RELOAD_DLL");
+    case 0x80004023u : return QStringLiteral("CO_E_MSI_ERROR");
+    case 0x80004024u : return QStringLiteral("CO_E_ATTEMPT_TO_CREATE_OUTSIDE_CLIENT_CONTEXT");
+    case 0x80004025u : return QStringLiteral("CO_E_SERVER_PAUSED");
+    case 0x80004026u : return QStringLiteral("CO_E_SERVER_NOT_PAUSED");
+    case 0x80004027u : return QStringLiteral("CO_E_CLASS_DISABLED");
+    case 0x80004028u : return QStringLiteral("CO_E_CLRNOTAVAILABLE");
+    case 0x80004029u : return QStringLiteral("CO_E_ASYNC_WORK_REJECTED");
+    case 0x8000402Au : return QStringLiteral("CO_E_SERVER_INIT_TIMEOUT");
+    case 0x8000402Bu : return QStringLiteral("CO_E_NO_SECCTX_IN_ACTIVATE");
+    case 0x80004030u : return QStringLiteral("CO_E_TRACKER_CONFIG");
+    case 0x80004031u : return QStringLiteral("CO_E_THREADPOOL_CONFIG");
+    case 0x80004032u : return QStringLiteral("CO_E_SXS_CONFIG");
+    case 0x80004033u : return QStringLiteral("CO_E_MALFORMED_SPN");
+    case 0x80040000u : return QStringLiteral("OLE_E_OLEVERB");
+    case 0x80040001u : return QStringLiteral("OLE_E_ADVF");
+    case 0x80040002u : return QStringLiteral("OLE_E_ENUM_NOMORE");
+    case 0x80040003u : return QStringLiteral("OLE_E_ADVISENOTSUPPORTED");
+    case 0x80040004u : return QStringLiteral("OLE_E_NOCONNECTION");
+    case 0x80040005u : return QStringLiteral("OLE_E_NOTRUNNING");
+    case 0x80040006u : return QStringLiteral("OLE_E_NOCACHE");
+    case 0x80040007u : return QStringLiteral("OLE_E_BLANK");
+    case 0x80040008u : return QStringLiteral("OLE_E_CLASSDIFF");
+    case 0x80040009u : return QStringLiteral("OLE_E_CANT_GETMONIKER");
+    case 0x8004000Au : return QStringLiteral("OLE_E_CANT_BINDTOSOURCE");
+    case 0x8004000Bu : return QStringLiteral("OLE_E_STATIC");
+    case 0x8004000Cu : return QStringLiteral("OLE_E_PROMPTSAVECANCELLED");
+    case 0x8004000Du : return QStringLiteral("OLE_E_INVALIDRECT");
+    case 0x8004000Eu : return QStringLiteral("OLE_E_WRONGCOMPOBJ");
+    case 0x8004000Fu : return QStringLiteral("OLE_E_INVALIDHWND");
+    case 0x80040010u : return QStringLiteral("OLE_E_NOT_INPLACEACTIVE");
+    case 0x80040011u : return QStringLiteral("OLE_E_CANTCONVERT");
+    case 0x80040012u : return QStringLiteral("OLE_E_NOSTORAGE");
+    case 0x80040064u : return QStringLiteral("DV_E_FORMATETC");
+    case 0x80040065u : return QStringLiteral("DV_E_DVTARGETDEVICE");
+    case 0x80040066u : return QStringLiteral("DV_E_STGMEDIUM");
+    case 0x80040067u : return QStringLiteral("DV_E_STATDATA");
+    case 0x80040068u : return QStringLiteral("DV_E_LINDEX");
+    case 0x80040069u : return QStringLiteral("DV_E_TYMED");
+    case 0x8004006Au : return QStringLiteral("DV_E_CLIPFORMAT");
+    case 0x8004006Bu : return QStringLiteral("DV_E_DVASPECT");
+    case 0x8004006Cu : return QStringLiteral("DV_E_DVTARGETDEVICE_SIZE");
+    case 0x8004006Du : return QStringLiteral("DV_E_NOIVIEWOBJECT");
+    case 0x80040100u : return QStringLiteral("DRAGDROP_E_NOTREGISTERED");
+    case 0x80040101u : return QStringLiteral("DRAGDROP_E_ALREADYREGISTERED");
+    case 0x80040102u : return QStringLiteral("DRAGDROP_E_INVALIDHWND");
+    case 0x80040110u : return QStringLiteral("CLASS_E_NOAGGREGATION");
+    case 0x80040111u : return QStringLiteral("CLASS_E_CLASSNOTAVAILABLE");
+    case 0x80040112u : return QStringLiteral("CLASS_E_NOTLICENSED");
+    case 0x80040140u : return QStringLiteral("VIEW_E_DRAW");
+    case 0x80040150u : return QStringLiteral("REGDB_E_READREGDB");
+    case 0x80040151u : return QStringLiteral("REGDB_E_WRITEREGDB");
+    case 0x80040152u : return QStringLiteral("REGDB_E_KEYMISSING");
+    case 0x80040153u : return QStringLiteral("REGDB_E_INVALIDVALUE");
+    case 0x80040154u : return QStringLiteral("REGDB_E_CLASSNOTREG");
+    case 0x80040155u : return QStringLiteral("REGDB_E_IIDNOTREG");
+    case 0x80040156u : return QStringLiteral("REGDB_E_BADTHREADINGMODEL");
+    case 0x80040160u : return QStringLiteral("CAT_E_CATIDNOEXIST");
+    case 0x80040161u : return QStringLiteral("CAT_E_NODESCRIPTION");
+    case 0x80040164u : return QStringLiteral("CS_E_PACKAGE_NOTFOUND");
+    case 0x80040165u : return QStringLiteral("CS_E_NOT_DELETABLE");
+    case 0x80040166u : return QStringLiteral("CS_E_CLASS_NOTFOUND");
+    case 0x80040167u : return QStringLiteral("CS_E_INVALID_VERSION");
+    case 0x80040168u : return QStringLiteral("CS_E_NO_CLASSSTORE");
+    case 0x80040169u : return QStringLiteral("CS_E_OBJECT_NOTFOUND");
+    case 0x8004016Au : return QStringLiteral("CS_E_OBJECT_ALREADY_EXISTS");
+    case 0x8004016Bu : return QStringLiteral("CS_E_INVALID_PATH");
+    case 0x8004016Cu : return QStringLiteral("CS_E_NETWORK_ERROR");
+    case 0x8004016Du : return QStringLiteral("CS_E_ADMIN_LIMIT_EXCEEDED");
+    case 0x8004016Eu : return QStringLiteral("CS_E_SCHEMA_MISMATCH");
+    case 0x8004016Fu : return QStringLiteral("CS_E_INTERNAL_ERROR");
+    case 0x80040170u : return QStringLiteral("CACHE_E_NOCACHE_UPDATED");
+    case 0x80040180u : return QStringLiteral("OLEOBJ_E_NOVERBS");
+    case 0x80040181u : return QStringLiteral("OLEOBJ_E_INVALIDVERB");
+    case 0x800401A0u : return QStringLiteral("INPLACE_E_NOTUNDOABLE");
+    case 0x800401A1u : return QStringLiteral("INPLACE_E_NOTOOLSPACE");
+    case 0x800401C0u : return QStringLiteral("CONVERT10_E_OLESTREAM_GET");
+    case 0x800401C1u : return QStringLiteral("CONVERT10_E_OLESTREAM_PUT");
+    case 0x800401C2u : return QStringLiteral("CONVERT10_E_OLESTREAM_FMT");
+    case 0x800401C3u : return QStringLiteral("CONVERT10_E_OLESTREAM_BITMAP_TO_DIB");
+    case 0x800401C4u : return QStringLiteral("CONVERT10_E_STG_FMT");
+    case 0x800401C5u : return QStringLiteral("CONVERT10_E_STG_NO_STD_STREAM");
+    case 0x800401C6u : return QStringLiteral("CONVERT10_E_STG_DIB_TO_BITMAP");
+    case 0x800401D0u : return QStringLiteral("CLIPBRD_E_CANT_OPEN");
+    case 0x800401D1u : return QStringLiteral("CLIPBRD_E_CANT_EMPTY");
+    case 0x800401D2u : return QStringLiteral("CLIPBRD_E_CANT_SET");
+    case 0x800401D3u : return QStringLiteral("CLIPBRD_E_BAD_DATA");
+    case 0x800401D4u : return QStringLiteral("CLIPBRD_E_CANT_CLOSE");
+    case 0x800401E0u : return QStringLiteral("MK_E_CONNECTMANUALLY");
+    case 0x800401E1u : return QStringLiteral("MK_E_EXCEEDEDDEADLINE");
+    case 0x800401E2u : return QStringLiteral("MK_E_NEEDGENERIC");
+    case 0x800401E3u : return QStringLiteral("MK_E_UNAVAILABLE");
+    case 0x800401E4u : return QStringLiteral("MK_E_SYNTAX");
+    case 0x800401E5u : return QStringLiteral("MK_E_NOOBJECT");
+    case 0x800401E6u : return QStringLiteral("MK_E_INVALIDEXTENSION");
+    case 0x800401E7u : return QStringLiteral("MK_E_INTERMEDIATEINTERFACENOTSUPPORTED");
+    case 0x800401E8u : return QStringLiteral("MK_E_NOTBINDABLE");
+    case 0x800401E9u : return QStringLiteral("MK_E_NOTBOUND");
+    case 0x800401EAu : return QStringLiteral("MK_E_CANTOPENFILE");
+    case 0x800401EBu : return QStringLiteral("MK_E_MUSTBOTHERUSER");
+    case 0x800401ECu : return QStringLiteral("MK_E_NOINVERSE");
+    case 0x800401EDu : return QStringLiteral("MK_E_NOSTORAGE");
+    case 0x800401EEu : return QStringLiteral("MK_E_NOPREFIX");
+    case 0x800401EFu : return QStringLiteral("MK_E_ENUMERATION_FAILED");
+    case 0x800401F0u : return QStringLiteral("CO_E_NOTINITIALIZED");
+    case 0x800401F1u : return QStringLiteral("CO_E_ALREADYINITIALIZED");
+    case 0x800401F2u : return QStringLiteral("CO_E_CANTDETERMINECLASS");
+    case 0x800401F3u : return QStringLiteral("CO_E_CLASSSTRING");
+    case 0x800401F4u : return QStringLiteral("CO_E_IIDSTRING");
+    case 0x800401F5u : return QStringLiteral("CO_E_APPNOTFOUND");
+    case 0x800401F6u : return QStringLiteral("CO_E_APPSINGLEUSE");
+    case 0x800401F7u : return QStringLiteral("CO_E_ERRORINAPP");
+    case 0x800401F8u : return QStringLiteral("CO_E_DLLNOTFOUND");
+    case 0x800401F9u : return QStringLiteral("CO_E_ERRORINDLL");
+    case 0x800401FAu : return QStringLiteral("CO_E_WRONGOSFORAPP");
+    case 0x800401FBu : return QStringLiteral("CO_E_OBJNOTREG");
+    case 0x800401FCu : return QStringLiteral("CO_E_OBJISREG");
+    case 0x800401FDu : return QStringLiteral("CO_E_OBJNOTCONNECTED");
+    case 0x800401FEu : return QStringLiteral("CO_E_APPDIDNTREG");
+    case 0x800401FFu : return QStringLiteral("CO_E_RELEASED");
+    case 0x00040200u : return QStringLiteral("EVENT_S_SOME_SUBSCRIBERS_FAILED");
+    case 0x80040201u : return QStringLiteral("EVENT_E_ALL_SUBSCRIBERS_FAILED");
+    case 0x00040202u : return QStringLiteral("EVENT_S_NOSUBSCRIBERS");
+    case 0x80040203u : return QStringLiteral("EVENT_E_QUERYSYNTAX");
+    case 0x80040204u : return QStringLiteral("EVENT_E_QUERYFIELD");
+    case 0x80040205u : return QStringLiteral("EVENT_E_INTERNALEXCEPTION");
+    case 0x80040206u : return QStringLiteral("EVENT_E_INTERNALERROR");
+    case 0x80040207u : return QStringLiteral("EVENT_E_INVALID_PER_USER_SID");
+    case 0x80040208u : return QStringLiteral("EVENT_E_USER_EXCEPTION");
+    case 0x80040209u : return QStringLiteral("EVENT_E_TOO_MANY_METHODS");
+    case 0x8004020Au : return QStringLiteral("EVENT_E_MISSING_EVENTCLASS");
+    case 0x8004020Bu : return QStringLiteral("EVENT_E_NOT_ALL_REMOVED");
+    case 0x8004020Cu : return QStringLiteral("EVENT_E_COMPLUS_NOT_INSTALLED");
+    case 0x8004020Du : return QStringLiteral("EVENT_E_CANT_MODIFY_OR_DELETE_UNCONFIGURED_OBJECT");
+    case 0x8004020Eu : return QStringLiteral("EVENT_E_CANT_MODIFY_OR_DELETE_CONFIGURED_OBJECT");
+    case 0x8004020Fu : return QStringLiteral("EVENT_E_INVALID_EVENT_CLASS_PARTITION");
+    case 0x80040210u : return QStringLiteral("EVENT_E_PER_USER_SID_NOT_LOGGED_ON");
+    case 0x8004D000u : return QStringLiteral("XACT_E_ALREADYOTHERSINGLEPHASE");
+    case 0x8004D001u : return QStringLiteral("XACT_E_CANTRETAIN");
+    case 0x8004D002u : return QStringLiteral("XACT_E_COMMITFAILED");
+    case 0x8004D003u : return QStringLiteral("XACT_E_COMMITPREVENTED");
+    case 0x8004D004u : return QStringLiteral("XACT_E_HEURISTICABORT");
+    case 0x8004D005u : return QStringLiteral("XACT_E_HEURISTICCOMMIT");
+    case 0x8004D006u : return QStringLiteral("XACT_E_HEURISTICDAMAGE");
+    case 0x8004D007u : return QStringLiteral("XACT_E_HEURISTICDANGER");
+    case 0x8004D008u : return QStringLiteral("XACT_E_ISOLATIONLEVEL");
+    case 0x8004D009u : return QStringLiteral("XACT_E_NOASYNC");
+    case 0x8004D00Au : return QStringLiteral("XACT_E_NOENLIST");
+    case 0x8004D00Bu : return QStringLiteral("XACT_E_NOISORETAIN");
+    case 0x8004D00Cu : return QStringLiteral("XACT_E_NORESOURCE");
+    case 0x8004D00Du : return QStringLiteral("XACT_E_NOTCURRENT");
+    case 0x8004D00Eu : return QStringLiteral("XACT_E_NOTRANSACTION");
+    case 0x8004D00Fu : return QStringLiteral("XACT_E_NOTSUPPORTED");
+    case 0x8004D010u : return QStringLiteral("XACT_E_UNKNOWNRMGRID");
+    case 0x8004D011u : return QStringLiteral("XACT_E_WRONGSTATE");
+    case 0x8004D012u : return QStringLiteral("XACT_E_WRONGUOW");
+    case 0x8004D013u : return QStringLiteral("XACT_E_XTIONEXISTS");
+    case 0x8004D014u : return QStringLiteral("XACT_E_NOIMPORTOBJECT");
+    case 0x8004D015u : return QStringLiteral("XACT_E_INVALIDCOOKIE");
+    case 0x8004D016u : return QStringLiteral("XACT_E_INDOUBT");
+    case 0x8004D017u : return QStringLiteral("XACT_E_NOTIMEOUT");
+    case 0x8004D018u : return QStringLiteral("XACT_E_ALREADYINPROGRESS");
+    case 0x8004D019u : return QStringLiteral("XACT_E_ABORTED");
+    case 0x8004D01Au : return QStringLiteral("XACT_E_LOGFULL");
+    case 0x8004D01Bu : return QStringLiteral("XACT_E_TMNOTAVAILABLE");
+    case 0x8004D01Cu : return QStringLiteral("XACT_E_CONNECTION_DOWN");
+    case 0x8004D01Du : return QStringLiteral("XACT_E_CONNECTION_DENIED");
+    case 0x8004D01Eu : return QStringLiteral("XACT_E_REENLISTTIMEOUT");
+    case 0x8004D01Fu : return QStringLiteral("XACT_E_TIP_CONNECT_FAILED");
+    case 0x8004D020u : return QStringLiteral("XACT_E_TIP_PROTOCOL_ERROR");
+    case 0x8004D021u : return QStringLiteral("XACT_E_TIP_PULL_FAILED");
+    case 0x8004D022u : return QStringLiteral("XACT_E_DEST_TMNOTAVAILABLE");
+    case 0x8004D023u : return QStringLiteral("XACT_E_TIP_DISABLED");
+    case 0x8004D024u : return QStringLiteral("XACT_E_NETWORK_TX_DISABLED");
+    case 0x8004D025u : return QStringLiteral("XACT_E_PARTNER_NETWORK_TX_DISABLED");
+    case 0x8004D026u : return QStringLiteral("XACT_E_XA_TX_DISABLED");
+    case 0x8004D027u : return QStringLiteral("XACT_E_UNABLE_TO_READ_DTC_CONFIG");
+    case 0x8004D028u : return QStringLiteral("XACT_E_UNABLE_TO_LOAD_DTC_PROXY");
+    case 0x8004D029u : return QStringLiteral("XACT_E_ABORTING");
+    case 0x8004D080u : return QStringLiteral("XACT_E_CLERKNOTFOUND");
+    case 0x8004D081u : return QStringLiteral("XACT_E_CLERKEXISTS");
+    case 0x8004D082u : return QStringLiteral("XACT_E_RECOVERYINPROGRESS");
+    case 0x8004D083u : return QStringLiteral("XACT_E_TRANSACTIONCLOSED");
+    case 0x8004D084u : return QStringLiteral("XACT_E_INVALIDLSN");
+    case 0x8004D085u : return QStringLiteral("XACT_E_REPLAYREQUEST");
+    case 0x0004D000u : return QStringLiteral("XACT_S_ASYNC");
+    case 0x0004D001u : return QStringLiteral("XACT_S_DEFECT");
+    case 0x0004D002u : return QStringLiteral("XACT_S_READONLY");
+    case 0x0004D003u : return QStringLiteral("XACT_S_SOMENORETAIN");
+    case 0x0004D004u : return QStringLiteral("XACT_S_OKINFORM");
+    case 0x0004D005u : return QStringLiteral("XACT_S_MADECHANGESCONTENT");
+    case 0x0004D006u : return QStringLiteral("XACT_S_MADECHANGESINFORM");
+    case 0x0004D007u : return QStringLiteral("XACT_S_ALLNORETAIN");
+    case 0x0004D008u : return QStringLiteral("XACT_S_ABORTING");
+    case 0x0004D009u : return QStringLiteral("XACT_S_SINGLEPHASE");
+    case 0x0004D00Au : return QStringLiteral("XACT_S_LOCALLY_OK");
+    case 0x0004D010u : return QStringLiteral("XACT_S_LASTRESOURCEMANAGER");
+    case 0x8004E002u : return QStringLiteral("CONTEXT_E_ABORTED");
+    case 0x8004E003u : return QStringLiteral("CONTEXT_E_ABORTING");
+    case 0x8004E004u : return QStringLiteral("CONTEXT_E_NOCONTEXT");
+    case 0x8004E005u : return QStringLiteral("CONTEXT_E_WOULD_DEADLOCK");
+    case 0x8004E006u : return QStringLiteral("CONTEXT_E_SYNCH_TIMEOUT");
+    case 0x8004E007u : return QStringLiteral("CONTEXT_E_OLDREF");
+    case 0x8004E00Cu : return QStringLiteral("CONTEXT_E_ROLENOTFOUND");
+    case 0x8004E00Fu : return QStringLiteral("CONTEXT_E_TMNOTAVAILABLE");
+    case 0x8004E021u : return QStringLiteral("CO_E_ACTIVATIONFAILED");
+    case 0x8004E022u : return QStringLiteral("CO_E_ACTIVATIONFAILED_EVENTLOGGED");
+    case 0x8004E023u : return QStringLiteral("CO_E_ACTIVATIONFAILED_CATALOGERROR");
+    case 0x8004E024u : return QStringLiteral("CO_E_ACTIVATIONFAILED_TIMEOUT");
+    case 0x8004E025u : return QStringLiteral("CO_E_INITIALIZATIONFAILED");
+    case 0x8004E026u : return QStringLiteral("CONTEXT_E_NOJIT");
+    case 0x8004E027u : return QStringLiteral("CONTEXT_E_NOTRANSACTION");
+    case 0x8004E028u : return QStringLiteral("CO_E_THREADINGMODEL_CHANGED");
+    case 0x8004E029u : return QStringLiteral("CO_E_NOIISINTRINSICS");
+    case 0x8004E02Au : return QStringLiteral("CO_E_NOCOOKIES");
+    case 0x8004E02Bu : return QStringLiteral("CO_E_DBERROR");
+    case 0x8004E02Cu : return QStringLiteral("CO_E_NOTPOOLED");
+    case 0x8004E02Du : return QStringLiteral("CO_E_NOTCONSTRUCTED");
+    case 0x8004E02Eu : return QStringLiteral("CO_E_NOSYNCHRONIZATION");
+    case 0x8004E02Fu : return QStringLiteral("CO_E_ISOLEVELMISMATCH");
+    case 0x00040000u : return QStringLiteral("OLE_S_USEREG");
+    case 0x00040001u : return QStringLiteral("OLE_S_STATIC");
+    case 0x00040002u : return QStringLiteral("OLE_S_MAC_CLIPFORMAT");
+    case 0x00040100u : return QStringLiteral("DRAGDROP_S_DROP");
+    case 0x00040101u : return QStringLiteral("DRAGDROP_S_CANCEL");
+    case 0x00040102u : return QStringLiteral("DRAGDROP_S_USEDEFAULTCURSORS");
+    case 0x00040130u : return QStringLiteral("DATA_S_SAMEFORMATETC");
+    case 0x00040140u : return QStringLiteral("VIEW_S_ALREADY_FROZEN");
+    case 0x00040170u : return QStringLiteral("CACHE_S_FORMATETC_NOTSUPPORTED");
+    case 0x00040171u : return QStringLiteral("CACHE_S_SAMECACHE");
+    case 0x00040172u : return QStringLiteral("CACHE_S_SOMECACHES_NOTUPDATED");
+    case 0x00040180u : return QStringLiteral("OLEOBJ_S_INVALIDVERB");
+    case 0x00040181u : return QStringLiteral("OLEOBJ_S_CANNOT_DOVERB_NOW");
+    case 0x00040182u : return QStringLiteral("OLEOBJ_S_INVALIDHWND");
+    case 0x000401A0u : return QStringLiteral("INPLACE_S_TRUNCATED");
+    case 0x000401C0u : return QStringLiteral("CONVERT10_S_NO_PRESENTATION");
+    case 0x000401E2u : return QStringLiteral("MK_S_REDUCED_TO_SELF");
+    case 0x000401E4u : return QStringLiteral("MK_S_ME");
+    case 0x000401E5u : return QStringLiteral("MK_S_HIM");
+    case 0x000401E6u : return QStringLiteral("MK_S_US");
+    case 0x000401E7u : return QStringLiteral("MK_S_MONIKERALREADYREGISTERED");
+    case 0x00041300u : return QStringLiteral("SCHED_S_TASK_READY");
+    case 0x00041301u : return QStringLiteral("SCHED_S_TASK_RUNNING");
+    case 0x00041302u : return QStringLiteral("SCHED_S_TASK_DISABLED");
+    case 0x00041303u : return QStringLiteral("SCHED_S_TASK_HAS_NOT_RUN");
+    case 0x00041304u : return QStringLiteral("SCHED_S_TASK_NO_MORE_RUNS");
+    case 0x00041305u : return QStringLiteral("SCHED_S_TASK_NOT_SCHEDULED");
+    case 0x00041306u : return QStringLiteral("SCHED_S_TASK_TERMINATED");
+    case 0x00041307u : return QStringLiteral("SCHED_S_TASK_NO_VALID_TRIGGERS");
+    case 0x00041308u : return QStringLiteral("SCHED_S_EVENT_TRIGGER");
+    case 0x80041309u : return QStringLiteral("SCHED_E_TRIGGER_NOT_FOUND");
+    case 0x8004130Au : return QStringLiteral("SCHED_E_TASK_NOT_READY");
+    case 0x8004130Bu : return QStringLiteral("SCHED_E_TASK_NOT_RUNNING");
+    case 0x8004130Cu : return QStringLiteral("SCHED_E_SERVICE_NOT_INSTALLED");
+    case 0x8004130Du : return QStringLiteral("SCHED_E_CANNOT_OPEN_TASK");
+    case 0x8004130Eu : return QStringLiteral("SCHED_E_INVALID_TASK");
+    case 0x8004130Fu : return QStringLiteral("SCHED_E_ACCOUNT_INFORMATION_NOT_SET");
+    case 0x80041310u : return QStringLiteral("SCHED_E_ACCOUNT_NAME_NOT_FOUND");
+    case 0x80041311u : return QStringLiteral("SCHED_E_ACCOUNT_DBASE_CORRUPT");
+    case 0x80041312u : return QStringLiteral("SCHED_E_NO_SECURITY_SERVICES");
+    case 0x80041313u : return QStringLiteral("SCHED_E_UNKNOWN_OBJECT_VERSION");
+    case 0x80041314u : return QStringLiteral("SCHED_E_UNSUPPORTED_ACCOUNT_OPTION");
+    case 0x80041315u : return QStringLiteral("SCHED_E_SERVICE_NOT_RUNNING");
+    case 0x80080001u : return QStringLiteral("CO_E_CLASS_CREATE_FAILED");
+    case 0x80080002u : return QStringLiteral("CO_E_SCM_ERROR");
+    case 0x80080003u : return QStringLiteral("CO_E_SCM_RPC_FAILURE");
+    case 0x80080004u : return QStringLiteral("CO_E_BAD_PATH");
+    case 0x80080005u : return QStringLiteral("CO_E_SERVER_EXEC_FAILURE");
+    case 0x80080006u : return QStringLiteral("CO_E_OBJSRV_RPC_FAILURE");
+    case 0x80080007u : return QStringLiteral("MK_E_NO_NORMALIZED");
+    case 0x80080008u : return QStringLiteral("CO_E_SERVER_STOPPING");
+    case 0x80080009u : return QStringLiteral("MEM_E_INVALID_ROOT");
+    case 0x80080010u : return QStringLiteral("MEM_E_INVALID_LINK");
+    case 0x80080011u : return QStringLiteral("MEM_E_INVALID_SIZE");
+    case 0x00080012u : return QStringLiteral("CO_S_NOTALLINTERFACES");
+    case 0x00080013u : return QStringLiteral("CO_S_MACHINENAMENOTFOUND");
+    case 0x80020001u : return QStringLiteral("DISP_E_UNKNOWNINTERFACE");
+    case 0x80020003u : return QStringLiteral("DISP_E_MEMBERNOTFOUND");
+    case 0x80020004u : return QStringLiteral("DISP_E_PARAMNOTFOUND");
+    case 0x80020005u : return QStringLiteral("DISP_E_TYPEMISMATCH");
+    case 0x80020006u : return QStringLiteral("DISP_E_UNKNOWNNAME");
+    case 0x80020007u : return QStringLiteral("DISP_E_NONAMEDARGS");
+    case 0x80020008u : return QStringLiteral("DISP_E_BADVARTYPE");
+    case 0x80020009u : return QStringLiteral("DISP_E_EXCEPTION");
+    case 0x8002000Au : return QStringLiteral("DISP_E_OVERFLOW");
+    case 0x8002000Bu : return QStringLiteral("DISP_E_BADINDEX");
+    case 0x8002000Cu : return QStringLiteral("DISP_E_UNKNOWNLCID");
+    case 0x8002000Du : return QStringLiteral("DISP_E_ARRAYISLOCKED");
+    case 0x8002000Eu : return QStringLiteral("DISP_E_BADPARAMCOUNT");
+    case 0x8002000Fu : return QStringLiteral("DISP_E_PARAMNOTOPTIONAL");
+    case 0x80020010u : return QStringLiteral("DISP_E_BADCALLEE");
+    case 0x80020011u : return QStringLiteral("DISP_E_NOTACOLLECTION");
+    case 0x80020012u : return QStringLiteral("DISP_E_DIVBYZERO");
+    case 0x80020013u : return QStringLiteral("DISP_E_BUFFERTOOSMALL");
+    case 0x80028016u : return QStringLiteral("TYPE_E_BUFFERTOOSMALL");
+    case 0x80028017u : return QStringLiteral("TYPE_E_FIELDNOTFOUND");
+    case 0x80028018u : return QStringLiteral("TYPE_E_INVDATAREAD");
+    case 0x80028019u : return QStringLiteral("TYPE_E_UNSUPFORMAT");
+    case 0x8002801Cu : return QStringLiteral("TYPE_E_REGISTRYACCESS");
+    case 0x8002801Du : return QStringLiteral("TYPE_E_LIBNOTREGISTERED");
+    case 0x80028027u : return QStringLiteral("TYPE_E_UNDEFINEDTYPE");
+    case 0x80028028u : return QStringLiteral("TYPE_E_QUALIFIEDNAMEDISALLOWED");
+    case 0x80028029u : return QStringLiteral("TYPE_E_INVALIDSTATE");
+    case 0x8002802Au : return QStringLiteral("TYPE_E_WRONGTYPEKIND");
+    case 0x8002802Bu : return QStringLiteral("TYPE_E_ELEMENTNOTFOUND");
+    case 0x8002802Cu : return QStringLiteral("TYPE_E_AMBIGUOUSNAME");
+    case 0x8002802Du : return QStringLiteral("TYPE_E_NAMECONFLICT");
+    case 0x8002802Eu : return QStringLiteral("TYPE_E_UNKNOWNLCID");
+    case 0x8002802Fu : return QStringLiteral("TYPE_E_DLLFUNCTIONNOTFOUND");
+    case 0x800288BDu : return QStringLiteral("TYPE_E_BADMODULEKIND");
+    case 0x800288C5u : return QStringLiteral("TYPE_E_SIZETOOBIG");
+    case 0x800288C6u : return QStringLiteral("TYPE_E_DUPLICATEID");
+    case 0x800288CFu : return QStringLiteral("TYPE_E_INVALIDID");
+    case 0x80028CA0u : return QStringLiteral("TYPE_E_TYPEMISMATCH");
+    case 0x80028CA1u : return QStringLiteral("TYPE_E_OUTOFBOUNDS");
+    case 0x80028CA2u : return QStringLiteral("TYPE_E_IOERROR");
+    case 0x80028CA3u : return QStringLiteral("TYPE_E_CANTCREATETMPFILE");
+    case 0x80029C4Au : return QStringLiteral("TYPE_E_CANTLOADLIBRARY");
+    case 0x80029C83u : return QStringLiteral("TYPE_E_INCONSISTENTPROPFUNCS");
+    case 0x80029C84u : return QStringLiteral("TYPE_E_CIRCULARTYPE");
+    case 0x80030001u : return QStringLiteral("STG_E_INVALIDFUNCTION");
+    case 0x80030002u : return QStringLiteral("STG_E_FILENOTFOUND");
+    case 0x80030003u : return QStringLiteral("STG_E_PATHNOTFOUND");
+    case 0x80030004u : return QStringLiteral("STG_E_TOOMANYOPENFILES");
+    case 0x80030005u : return QStringLiteral("STG_E_ACCESSDENIED");
+    case 0x80030006u : return QStringLiteral("STG_E_INVALIDHANDLE");
+    case 0x80030008u : return QStringLiteral("STG_E_INSUFFICIENTMEMORY");
+    case 0x80030009u : return QStringLiteral("STG_E_INVALIDPOINTER");
+    case 0x80030012u : return QStringLiteral("STG_E_NOMOREFILES");
+    case 0x80030013u : return QStringLiteral("STG_E_DISKISWRITEPROTECTED");
+    case 0x80030019u : return QStringLiteral("STG_E_SEEKERROR");
+    case 0x8003001Du : return QStringLiteral("STG_E_WRITEFAULT");
+    case 0x8003001Eu : return QStringLiteral("STG_E_READFAULT");
+    case 0x80030020u : return QStringLiteral("STG_E_SHAREVIOLATION");
+    case 0x80030021u : return QStringLiteral("STG_E_LOCKVIOLATION");
+    case 0x80030050u : return QStringLiteral("STG_E_FILEALREADYEXISTS");
+    case 0x80030057u : return QStringLiteral("STG_E_INVALIDPARAMETER");
+    case 0x80030070u : return QStringLiteral("STG_E_MEDIUMFULL");
+    case 0x800300F0u : return QStringLiteral("STG_E_PROPSETMISMATCHED");
+    case 0x800300FAu : return QStringLiteral("STG_E_ABNORMALAPIEXIT");
+    case 0x800300FBu : return QStringLiteral("STG_E_INVALIDHEADER");
+    case 0x800300FCu : return QStringLiteral("STG_E_INVALIDNAME");
+    case 0x800300FDu : return QStringLiteral("STG_E_UNKNOWN");
+    case 0x800300FEu : return QStringLiteral("STG_E_UNIMPLEMENTEDFUNCTION");
+    case 0x800300FFu : return QStringLiteral("STG_E_INVALIDFLAG");
+    case 0x80030100u : return QStringLiteral("STG_E_INUSE");
+    case 0x80030101u : return QStringLiteral("STG_E_NOTCURRENT");
+    case 0x80030102u : return QStringLiteral("STG_E_REVERTED");
+    case 0x80030103u : return QStringLiteral("STG_E_CANTSAVE");
+    case 0x80030104u : return QStringLiteral("STG_E_OLDFORMAT");
+    case 0x80030105u : return QStringLiteral("STG_E_OLDDLL");
+    case 0x80030106u : return QStringLiteral("STG_E_SHAREREQUIRED");
+    case 0x80030107u : return QStringLiteral("STG_E_NOTFILEBASEDSTORAGE");
+    case 0x80030108u : return QStringLiteral("STG_E_EXTANTMARSHALLINGS");
+    case 0x80030109u : return QStringLiteral("STG_E_DOCFILECORRUPT");
+    case 0x80030110u : return QStringLiteral("STG_E_BADBASEADDRESS");
+    case 0x80030111u : return QStringLiteral("STG_E_DOCFILETOOLARGE");
+    case 0x80030112u : return QStringLiteral("STG_E_NOTSIMPLEFORMAT");
+    case 0x80030201u : return QStringLiteral("STG_E_INCOMPLETE");
+    case 0x80030202u : return QStringLiteral("STG_E_TERMINATED");
+    case 0x00030200u : return QStringLiteral("STG_S_CONVERTED");
+    case 0x00030201u : return QStringLiteral("STG_S_BLOCK");
+    case 0x00030202u : return QStringLiteral("STG_S_RETRYNOW");
+    case 0x00030203u : return QStringLiteral("STG_S_MONITORING");
+    case 0x00030204u : return QStringLiteral("STG_S_MULTIPLEOPENS");
+    case 0x00030205u : return QStringLiteral("STG_S_CONSOLIDATIONFAILED");
+    case 0x00030206u : return QStringLiteral("STG_S_CANNOTCONSOLIDATE");
+    case 0x80030305u : return QStringLiteral("STG_E_STATUS_COPY_PROTECTION_FAILURE");
+    case 0x80030306u : return QStringLiteral("STG_E_CSS_AUTHENTICATION_FAILURE");
+    case 0x80030307u : return QStringLiteral("STG_E_CSS_KEY_NOT_PRESENT");
+    case 0x80030308u : return QStringLiteral("STG_E_CSS_KEY_NOT_ESTABLISHED");
+    case 0x80030309u : return QStringLiteral("STG_E_CSS_SCRAMBLED_SECTOR");
+    case 0x8003030Au : return QStringLiteral("STG_E_CSS_REGION_MISMATCH");
+    case 0x8003030Bu : return QStringLiteral("STG_E_RESETS_EXHAUSTED");
+    case 0x80010001u : return QStringLiteral("RPC_E_CALL_REJECTED");
+    case 0x80010002u : return QStringLiteral("RPC_E_CALL_CANCELED");
+    case 0x80010003u : return QStringLiteral("RPC_E_CANTPOST_INSENDCALL");
+    case 0x80010004u : return QStringLiteral("RPC_E_CANTCALLOUT_INASYNCCALL");
+    case 0x80010005u : return QStringLiteral("RPC_E_CANTCALLOUT_INEXTERNALCALL");
+    case 0x80010006u : return QStringLiteral("RPC_E_CONNECTION_TERMINATED");
+    case 0x80010007u : return QStringLiteral("RPC_E_SERVER_DIED");
+    case 0x80010008u : return QStringLiteral("RPC_E_CLIENT_DIED");
+    case 0x80010009u : return QStringLiteral("RPC_E_INVALID_DATAPACKET");
+    case 0x8001000Au : return QStringLiteral("RPC_E_CANTTRANSMIT_CALL");
+    case 0x8001000Bu : return QStringLiteral("RPC_E_CLIENT_CANTMARSHAL_DATA");
+    case 0x8001000Cu : return QStringLiteral("RPC_E_CLIENT_CANTUNMARSHAL_DATA");
+    case 0x8001000Du : return QStringLiteral("RPC_E_SERVER_CANTMARSHAL_DATA");
+    case 0x8001000Eu : return QStringLiteral("RPC_E_SERVER_CANTUNMARSHAL_DATA");
+    case 0x8001000Fu : return QStringLiteral("RPC_E_INVALID_DATA");
+    case 0x80010010u : return QStringLiteral("RPC_E_INVALID_PARAMETER");
+    case 0x80010011u : return QStringLiteral("RPC_E_CANTCALLOUT_AGAIN");
+    case 0x80010012u : return QStringLiteral("RPC_E_SERVER_DIED_DNE");
+    case 0x80010100u : return QStringLiteral("RPC_E_SYS_CALL_FAILED");
+    case 0x80010101u : return QStringLiteral("RPC_E_OUT_OF_RESOURCES");
+    case 0x80010102u : return QStringLiteral("RPC_E_ATTEMPTED_MULTITHREAD");
+    case 0x80010103u : return QStringLiteral("RPC_E_NOT_REGISTERED");
+    case 0x80010104u : return QStringLiteral("RPC_E_FAULT");
+    case 0x80010105u : return QStringLiteral("RPC_E_SERVERFAULT");
+    case 0x80010106u : return QStringLiteral("RPC_E_CHANGED_MODE");
+    case 0x80010107u : return QStringLiteral("RPC_E_INVALIDMETHOD");
+    case 0x80010108u : return QStringLiteral("RPC_E_DISCONNECTED");
+    case 0x80010109u : return QStringLiteral("RPC_E_RETRY");
+    case 0x8001010Au : return QStringLiteral("RPC_E_SERVERCALL_RETRYLATER");
+    case 0x8001010Bu : return QStringLiteral("RPC_E_SERVERCALL_REJECTED");
+    case 0x8001010Cu : return QStringLiteral("RPC_E_INVALID_CALLDATA");
+    case 0x8001010Du : return QStringLiteral("RPC_E_CANTCALLOUT_ININPUTSYNCCALL");
+    case 0x8001010Eu : return QStringLiteral("RPC_E_WRONG_THREAD");
+    case 0x8001010Fu : return QStringLiteral("RPC_E_THREAD_NOT_INIT");
+    case 0x80010110u : return QStringLiteral("RPC_E_VERSION_MISMATCH");
+    case 0x80010111u : return QStringLiteral("RPC_E_INVALID_HEADER");
+    case 0x80010112u : return QStringLiteral("RPC_E_INVALID_EXTENSION");
+    case 0x80010113u : return QStringLiteral("RPC_E_INVALID_IPID");
+    case 0x80010114u : return QStringLiteral("RPC_E_INVALID_OBJECT");
+    case 0x80010115u : return QStringLiteral("RPC_S_CALLPENDING");
+    case 0x80010116u : return QStringLiteral("RPC_S_WAITONTIMER");
+    case 0x80010117u : return QStringLiteral("RPC_E_CALL_COMPLETE");
+    case 0x80010118u : return QStringLiteral("RPC_E_UNSECURE_CALL");
+    case 0x80010119u : return QStringLiteral("RPC_E_TOO_LATE");
+    case 0x8001011Au : return QStringLiteral("RPC_E_NO_GOOD_SECURITY_PACKAGES");
+    case 0x8001011Bu : return QStringLiteral("RPC_E_ACCESS_DENIED");
+    case 0x8001011Cu : return QStringLiteral("RPC_E_REMOTE_DISABLED");
+    case 0x8001011Du : return QStringLiteral("RPC_E_INVALID_OBJREF");
+    case 0x8001011Eu : return QStringLiteral("RPC_E_NO_CONTEXT");
+    case 0x8001011Fu : return QStringLiteral("RPC_E_TIMEOUT");
+    case 0x80010120u : return QStringLiteral("RPC_E_NO_SYNC");
+    case 0x80010121u : return QStringLiteral("RPC_E_FULLSIC_REQUIRED");
+    case 0x80010122u : return QStringLiteral("RPC_E_INVALID_STD_NAME");
+    case 0x80010123u : return QStringLiteral("CO_E_FAILEDTOIMPERSONATE");
+    case 0x80010124u : return QStringLiteral("CO_E_FAILEDTOGETSECCTX");
+    case 0x80010125u : return QStringLiteral("CO_E_FAILEDTOOPENTHREADTOKEN");
+    case 0x80010126u : return QStringLiteral("CO_E_FAILEDTOGETTOKENINFO");
+    case 0x80010127u : return QStringLiteral("CO_E_TRUSTEEDOESNTMATCHCLIENT");
+    case 0x80010128u : return QStringLiteral("CO_E_FAILEDTOQUERYCLIENTBLANKET");
+    case 0x80010129u : return QStringLiteral("CO_E_FAILEDTOSETDACL");
+    case 0x8001012Au : return QStringLiteral("CO_E_ACCESSCHECKFAILED");
+    case 0x8001012Bu : return QStringLiteral("CO_E_NETACCESSAPIFAILED");
+    case 0x8001012Cu : return QStringLiteral("CO_E_WRONGTRUSTEENAMESYNTAX");
+    case 0x8001012Du : return QStringLiteral("CO_E_INVALIDSID");
+    case 0x8001012Eu : return QStringLiteral("CO_E_CONVERSIONFAILED");
+    case 0x8001012Fu : return QStringLiteral("CO_E_NOMATCHINGSIDFOUND");
+    case 0x80010130u : return QStringLiteral("CO_E_LOOKUPACCSIDFAILED");
+    case 0x80010131u : return QStringLiteral("CO_E_NOMATCHINGNAMEFOUND");
+    case 0x80010132u : return QStringLiteral("CO_E_LOOKUPACCNAMEFAILED");
+    case 0x80010133u : return QStringLiteral("CO_E_SETSERLHNDLFAILED");
+    case 0x80010134u : return QStringLiteral("CO_E_FAILEDTOGETWINDIR");
+    case 0x80010135u : return QStringLiteral("CO_E_PATHTOOLONG");
+    case 0x80010136u : return QStringLiteral("CO_E_FAILEDTOGENUUID");
+    case 0x80010137u : return QStringLiteral("CO_E_FAILEDTOCREATEFILE");
+    case 0x80010138u : return QStringLiteral("CO_E_FAILEDTOCLOSEHANDLE");
+    case 0x80010139u : return QStringLiteral("CO_E_EXCEEDSYSACLLIMIT");
+    case 0x8001013Au : return QStringLiteral("CO_E_ACESINWRONGORDER");
+    case 0x8001013Bu : return QStringLiteral("CO_E_INCOMPATIBLESTREAMVERSION");
+    case 0x8001013Cu : return QStringLiteral("CO_E_FAILEDTOOPENPROCESSTOKEN");
+    case 0x8001013Du : return QStringLiteral("CO_E_DECODEFAILED");
+    case 0x8001013Fu : return QStringLiteral("CO_E_ACNOTINITIALIZED");
+    case 0x80010140u : return QStringLiteral("CO_E_CANCEL_DISABLED");
+    case 0x8001FFFFu : return QStringLiteral("RPC_E_UNEXPECTED");
+    case 0xC0090001u : return QStringLiteral("ERROR_AUDITING_DISABLED");
+    case 0xC0090002u : return QStringLiteral("ERROR_ALL_SIDS_FILTERED");
+    case 0x80090001u : return QStringLiteral("NTE_BAD_UID");
+    case 0x80090002u : return QStringLiteral("NTE_BAD_HASH");
+    case 0x80090003u : return QStringLiteral("NTE_BAD_KEY");
+    case 0x80090004u : return QStringLiteral("NTE_BAD_LEN");
+    case 0x80090005u : return QStringLiteral("NTE_BAD_DATA");
+    case 0x80090006u : return QStringLiteral("NTE_BAD_SIGNATURE");
+    case 0x80090007u : return QStringLiteral("NTE_BAD_VER");
+    case 0x80090008u : return QStringLiteral("NTE_BAD_ALGID");
+    case 0x80090009u : return QStringLiteral("NTE_BAD_FLAGS");
+    case 0x8009000Au : return QStringLiteral("NTE_BAD_TYPE");
+    case 0x8009000Bu : return QStringLiteral("NTE_BAD_KEY_STATE");
+    case 0x8009000Cu : return QStringLiteral("NTE_BAD_HASH_STATE");
+    case 0x8009000Du : return QStringLiteral("NTE_NO_KEY");
+    case 0x8009000Eu : return QStringLiteral("NTE_NO_MEMORY");
+    case 0x8009000Fu : return QStringLiteral("NTE_EXISTS");
+    case 0x80090010u : return QStringLiteral("NTE_PERM");
+    case 0x80090011u : return QStringLiteral("NTE_NOT_FOUND");
+    case 0x80090012u : return QStringLiteral("NTE_DOUBLE_ENCRYPT");
+    case 0x80090013u : return QStringLiteral("NTE_BAD_PROVIDER");
+    case 0x80090014u : return QStringLiteral("NTE_BAD_PROV_TYPE");
+    case 0x80090015u : return QStringLiteral("NTE_BAD_PUBLIC_KEY");
+    case 0x80090016u : return QStringLiteral("NTE_BAD_KEYSET");
+    case 0x80090017u : return QStringLiteral("NTE_PROV_TYPE_NOT_DEF");
+    case 0x80090018u : return QStringLiteral("NTE_PROV_TYPE_ENTRY_BAD");
+    case 0x80090019u : return QStringLiteral("NTE_KEYSET_NOT_DEF");
+    case 0x8009001Au : return QStringLiteral("NTE_KEYSET_ENTRY_BAD");
+    case 0x8009001Bu : return QStringLiteral("NTE_PROV_TYPE_NO_MATCH");
+    case 0x8009001Cu : return QStringLiteral("NTE_SIGNATURE_FILE_BAD");
+    case 0x8009001Du : return QStringLiteral("NTE_PROVIDER_DLL_FAIL");
+    case 0x8009001Eu : return QStringLiteral("NTE_PROV_DLL_NOT_FOUND");
+    case 0x8009001Fu : return QStringLiteral("NTE_BAD_KEYSET_PARAM");
+    case 0x80090020u : return QStringLiteral("NTE_FAIL");
+    case 0x80090021u : return QStringLiteral("NTE_SYS_ERR");
+    case 0x80090022u : return QStringLiteral("NTE_SILENT_CONTEXT");
+    case 0x80090023u : return QStringLiteral("NTE_TOKEN_KEYSET_STORAGE_FULL");
+    case 0x80090024u : return QStringLiteral("NTE_TEMPORARY_PROFILE");
+    case 0x80090025u : return QStringLiteral("NTE_FIXEDPARAMETER");
+    case 0x80090300u : return QStringLiteral("SEC_E_INSUFFICIENT_MEMORY");
+    case 0x80090301u : return QStringLiteral("SEC_E_INVALID_HANDLE");
+    case 0x80090302u : return QStringLiteral("SEC_E_UNSUPPORTED_FUNCTION");
+    case 0x80090303u : return QStringLiteral("SEC_E_TARGET_UNKNOWN");
+    case 0x80090304u : return QStringLiteral("SEC_E_INTERNAL_ERROR");
+    case 0x80090305u : return QStringLiteral("SEC_E_SECPKG_NOT_FOUND");
+    case 0x80090306u : return QStringLiteral("SEC_E_NOT_OWNER");
+    case 0x80090307u : return QStringLiteral("SEC_E_CANNOT_INSTALL");
+    case 0x80090308u : return QStringLiteral("SEC_E_INVALID_TOKEN");
+    case 0x80090309u : return QStringLiteral("SEC_E_CANNOT_PACK");
+    case 0x8009030Au : return QStringLiteral("SEC_E_QOP_NOT_SUPPORTED");
+    case 0x8009030Bu : return QStringLiteral("SEC_E_NO_IMPERSONATION");
+    case 0x8009030Cu : return QStringLiteral("SEC_E_LOGON_DENIED");
+    case 0x8009030Du : return QStringLiteral("SEC_E_UNKNOWN_CREDENTIALS");
+    case 0x8009030Eu : return QStringLiteral("SEC_E_NO_CREDENTIALS");
+    case 0x8009030Fu : return QStringLiteral("SEC_E_MESSAGE_ALTERED");
+    case 0x80090310u : return QStringLiteral("SEC_E_OUT_OF_SEQUENCE");
+    case 0x80090311u : return QStringLiteral("SEC_E_NO_AUTHENTICATING_AUTHORITY");
+    case 0x00090312u : return QStringLiteral("SEC_I_CONTINUE_NEEDED");
+    case 0x00090313u : return QStringLiteral("SEC_I_COMPLETE_NEEDED");
+    case 0x00090314u : return QStringLiteral("SEC_I_COMPLETE_AND_CONTINUE");
+    case 0x00090315u : return QStringLiteral("SEC_I_LOCAL_LOGON");
+    case 0x80090316u : return QStringLiteral("SEC_E_BAD_PKGID");
+    case 0x80090317u : return QStringLiteral("SEC_E_CONTEXT_EXPIRED");
+    case 0x00090317u : return QStringLiteral("SEC_I_CONTEXT_EXPIRED");
+    case 0x80090318u : return QStringLiteral("SEC_E_INCOMPLETE_MESSAGE");
+    case 0x80090320u : return QStringLiteral("SEC_E_INCOMPLETE_CREDENTIALS");
+    case 0x80090321u : return QStringLiteral("SEC_E_BUFFER_TOO_SMALL");
+    case 0x00090320u : return QStringLiteral("SEC_I_INCOMPLETE_CREDENTIALS");
+    case 0x00090321u : return QStringLiteral("SEC_I_RENEGOTIATE");
+    case 0x80090322u : return QStringLiteral("SEC_E_WRONG_PRINCIPAL");
+    case 0x00090323u : return QStringLiteral("SEC_I_NO_LSA_CONTEXT");
+    case 0x80090324u : return QStringLiteral("SEC_E_TIME_SKEW");
+    case 0x80090325u : return QStringLiteral("SEC_E_UNTRUSTED_ROOT");
+    case 0x80090326u : return QStringLiteral("SEC_E_ILLEGAL_MESSAGE");
+    case 0x80090327u : return QStringLiteral("SEC_E_CERT_UNKNOWN");
+    case 0x80090328u : return QStringLiteral("SEC_E_CERT_EXPIRED");
+    case 0x80090329u : return QStringLiteral("SEC_E_ENCRYPT_FAILURE");
+    case 0x80090330u : return QStringLiteral("SEC_E_DECRYPT_FAILURE");
+    case 0x80090331u : return QStringLiteral("SEC_E_ALGORITHM_MISMATCH");
+    case 0x80090332u : return QStringLiteral("SEC_E_SECURITY_QOS_FAILED");
+    case 0x80090333u : return QStringLiteral("SEC_E_UNFINISHED_CONTEXT_DELETED");
+    case 0x80090334u : return QStringLiteral("SEC_E_NO_TGT_REPLY");
+    case 0x80090335u : return QStringLiteral("SEC_E_NO_IP_ADDRESSES");
+    case 0x80090336u : return QStringLiteral("SEC_E_WRONG_CREDENTIAL_HANDLE");
+    case 0x80090337u : return QStringLiteral("SEC_E_CRYPTO_SYSTEM_INVALID");
+    case 0x80090338u : return QStringLiteral("SEC_E_MAX_REFERRALS_EXCEEDED");
+    case 0x80090339u : return QStringLiteral("SEC_E_MUST_BE_KDC");
+    case 0x8009033Au : return QStringLiteral("SEC_E_STRONG_CRYPTO_NOT_SUPPORTED");
+    case 0x8009033Bu : return QStringLiteral("SEC_E_TOO_MANY_PRINCIPALS");
+    case 0x8009033Cu : return QStringLiteral("SEC_E_NO_PA_DATA");
+    case 0x8009033Du : return QStringLiteral("SEC_E_PKINIT_NAME_MISMATCH");
+    case 0x8009033Eu : return QStringLiteral("SEC_E_SMARTCARD_LOGON_REQUIRED");
+    case 0x8009033Fu : return QStringLiteral("SEC_E_SHUTDOWN_IN_PROGRESS");
+    case 0x80090340u : return QStringLiteral("SEC_E_KDC_INVALID_REQUEST");
+    case 0x80090341u : return QStringLiteral("SEC_E_KDC_UNABLE_TO_REFER");
+    case 0x80090342u : return QStringLiteral("SEC_E_KDC_UNKNOWN_ETYPE");
+    case 0x80090343u : return QStringLiteral("SEC_E_UNSUPPORTED_PREAUTH");
+    case 0x80090345u : return QStringLiteral("SEC_E_DELEGATION_REQUIRED");
+    case 0x80090346u : return QStringLiteral("SEC_E_BAD_BINDINGS");
+    case 0x80090347u : return QStringLiteral("SEC_E_MULTIPLE_ACCOUNTS");
+    case 0x80090348u : return QStringLiteral("SEC_E_NO_KERB_KEY");
+    case 0x80090349u : return QStringLiteral("SEC_E_CERT_WRONG_USAGE");
+    case 0x80090350u : return QStringLiteral("SEC_E_DOWNGRADE_DETECTED");
+    case 0x80090351u : return QStringLiteral("SEC_E_SMARTCARD_CERT_REVOKED");
+    case 0x80090352u : return QStringLiteral("SEC_E_ISSUING_CA_UNTRUSTED");
+    case 0x80090353u : return QStringLiteral("SEC_E_REVOCATION_OFFLINE_C");
+    case 0x80090354u : return QStringLiteral("SEC_E_PKINIT_CLIENT_FAILURE");
+    case 0x80090355u : return QStringLiteral("SEC_E_SMARTCARD_CERT_EXPIRED");
+    case 0x80090356u : return QStringLiteral("SEC_E_NO_S4U_PROT_SUPPORT");
+    case 0x80090357u : return QStringLiteral("SEC_E_CROSSREALM_DELEGATION_FAILURE");
+    case 0x80090358u : return QStringLiteral("SEC_E_REVOCATION_OFFLINE_KDC");
+    case 0x80090359u : return QStringLiteral("SEC_E_ISSUING_CA_UNTRUSTED_KDC");
+    case 0x8009035Au : return QStringLiteral("SEC_E_KDC_CERT_EXPIRED");
+    case 0x8009035Bu : return QStringLiteral("SEC_E_KDC_CERT_REVOKED");
+    case 0x80091001u : return QStringLiteral("CRYPT_E_MSG_ERROR");
+    case 0x80091002u : return QStringLiteral("CRYPT_E_UNKNOWN_ALGO");
+    case 0x80091003u : return QStringLiteral("CRYPT_E_OID_FORMAT");
+    case 0x80091004u : return QStringLiteral("CRYPT_E_INVALID_MSG_TYPE");
+    case 0x80091005u : return QStringLiteral("CRYPT_E_UNEXPECTED_ENCODING");
+    case 0x80091006u : return QStringLiteral("CRYPT_E_AUTH_ATTR_MISSING");
+    case 0x80091007u : return QStringLiteral("CRYPT_E_HASH_VALUE");
+    case 0x80091008u : return QStringLiteral("CRYPT_E_INVALID_INDEX");
+    case 0x80091009u : return QStringLiteral("CRYPT_E_ALREADY_DECRYPTED");
+    case 0x8009100Au : return QStringLiteral("CRYPT_E_NOT_DECRYPTED");
+    case 0x8009100Bu : return QStringLiteral("CRYPT_E_RECIPIENT_NOT_FOUND");
+    case 0x8009100Cu : return QStringLiteral("CRYPT_E_CONTROL_TYPE");
+    case 0x8009100Du : return QStringLiteral("CRYPT_E_ISSUER_SERIALNUMBER");
+    case 0x8009100Eu : return QStringLiteral("CRYPT_E_SIGNER_NOT_FOUND");
+    case 0x8009100Fu : return QStringLiteral("CRYPT_E_ATTRIBUTES_MISSING");
+    case 0x80091010u : return QStringLiteral("CRYPT_E_STREAM_MSG_NOT_READY");
+    case 0x80091011u : return QStringLiteral("CRYPT_E_STREAM_INSUFFICIENT_DATA");
+    case 0x00091012u : return QStringLiteral("CRYPT_I_NEW_PROTECTION_REQUIRED");
+    case 0x80092001u : return QStringLiteral("CRYPT_E_BAD_LEN");
+    case 0x80092002u : return QStringLiteral("CRYPT_E_BAD_ENCODE");
+    case 0x80092003u : return QStringLiteral("CRYPT_E_FILE_ERROR");
+    case 0x80092004u : return QStringLiteral("CRYPT_E_NOT_FOUND");
+    case 0x80092005u : return QStringLiteral("CRYPT_E_EXISTS");
+    case 0x80092006u : return QStringLiteral("CRYPT_E_NO_PROVIDER");
+    case 0x80092007u : return QStringLiteral("CRYPT_E_SELF_SIGNED");
+    case 0x80092008u : return QStringLiteral("CRYPT_E_DELETED_PREV");
+    case 0x80092009u : return QStringLiteral("CRYPT_E_NO_MATCH");
+    case 0x8009200Au : return QStringLiteral("CRYPT_E_UNEXPECTED_MSG_TYPE");
+    case 0x8009200Bu : return QStringLiteral("CRYPT_E_NO_KEY_PROPERTY");
+    case 0x8009200Cu : return QStringLiteral("CRYPT_E_NO_DECRYPT_CERT");
+    case 0x8009200Du : return QStringLiteral("CRYPT_E_BAD_MSG");
+    case 0x8009200Eu : return QStringLiteral("CRYPT_E_NO_SIGNER");
+    case 0x8009200Fu : return QStringLiteral("CRYPT_E_PENDING_CLOSE");
+    case 0x80092010u : return QStringLiteral("CRYPT_E_REVOKED");
+    case 0x80092011u : return QStringLiteral("CRYPT_E_NO_REVOCATION_DLL");
+    case 0x80092012u : return QStringLiteral("CRYPT_E_NO_REVOCATION_CHECK");
+    case 0x80092013u : return QStringLiteral("CRYPT_E_REVOCATION_OFFLINE");
+    case 0x80092014u : return QStringLiteral("CRYPT_E_NOT_IN_REVOCATION_DATABASE");
+    case 0x80092020u : return QStringLiteral("CRYPT_E_INVALID_NUMERIC_STRING");
+    case 0x80092021u : return QStringLiteral("CRYPT_E_INVALID_PRINTABLE_STRING");
+    case 0x80092022u : return QStringLiteral("CRYPT_E_INVALID_IA5_STRING");
+    case 0x80092023u : return QStringLiteral("CRYPT_E_INVALID_X500_STRING");
+    case 0x80092024u : return QStringLiteral("CRYPT_E_NOT_CHAR_STRING");
+    case 0x80092025u : return QStringLiteral("CRYPT_E_FILERESIZED");
+    case 0x80092026u : return QStringLiteral("CRYPT_E_SECURITY_SETTINGS");
+    case 0x80092027u : return QStringLiteral("CRYPT_E_NO_VERIFY_USAGE_DLL");
+    case 0x80092028u : return QStringLiteral("CRYPT_E_NO_VERIFY_USAGE_CHECK");
+    case 0x80092029u : return QStringLiteral("CRYPT_E_VERIFY_USAGE_OFFLINE");
+    case 0x8009202Au : return QStringLiteral("CRYPT_E_NOT_IN_CTL");
+    case 0x8009202Bu : return QStringLiteral("CRYPT_E_NO_TRUSTED_SIGNER");
+    case 0x8009202Cu : return QStringLiteral("CRYPT_E_MISSING_PUBKEY_PARA");
+    case 0x80093000u : return QStringLiteral("CRYPT_E_OSS_ERROR");
+    case 0x80093001u : return QStringLiteral("OSS_MORE_BUF");
+    case 0x80093002u : return QStringLiteral("OSS_NEGATIVE_UINTEGER");
+    case 0x80093003u : return QStringLiteral("OSS_PDU_RANGE");
+    case 0x80093004u : return QStringLiteral("OSS_MORE_INPUT");
+    case 0x80093005u : return QStringLiteral("OSS_DATA_ERROR");
+    case 0x80093006u : return QStringLiteral("OSS_BAD_ARG");
+    case 0x80093007u : return QStringLiteral("OSS_BAD_VERSION");
+    case 0x80093008u : return QStringLiteral("OSS_OUT_MEMORY");
+    case 0x80093009u : return QStringLiteral("OSS_PDU_MISMATCH");
+    case 0x8009300Au : return QStringLiteral("OSS_LIMITED");
+    case 0x8009300Bu : return QStringLiteral("OSS_BAD_PTR");
+    case 0x8009300Cu : return QStringLiteral("OSS_BAD_TIME");
+    case 0x8009300Du : return QStringLiteral("OSS_INDEFINITE_NOT_SUPPORTED");
+    case 0x8009300Eu : return QStringLiteral("OSS_MEM_ERROR");
+    case 0x8009300Fu : return QStringLiteral("OSS_BAD_TABLE");
+    case 0x80093010u : return QStringLiteral("OSS_TOO_LONG");
+    case 0x80093011u : return QStringLiteral("OSS_CONSTRAINT_VIOLATED");
+    case 0x80093012u : return QStringLiteral("OSS_FATAL_ERROR");
+    case 0x80093013u : return QStringLiteral("OSS_ACCESS_SERIALIZATION_ERROR");
+    case 0x80093014u : return QStringLiteral("OSS_NULL_TBL");
+    case 0x80093015u : return QStringLiteral("OSS_NULL_FCN");
+    case 0x80093016u : return QStringLiteral("OSS_BAD_ENCRULES");
+    case 0x80093017u : return QStringLiteral("OSS_UNAVAIL_ENCRULES");
+    case 0x80093018u : return QStringLiteral("OSS_CANT_OPEN_TRACE_WINDOW");
+    case 0x80093019u : return QStringLiteral("OSS_UNIMPLEMENTED");
+    case 0x8009301Au : return QStringLiteral("OSS_OID_DLL_NOT_LINKED");
+    case 0x8009301Bu : return QStringLiteral("OSS_CANT_OPEN_TRACE_FILE");
+    case 0x8009301Cu : return QStringLiteral("OSS_TRACE_FILE_ALREADY_OPEN");
+    case 0x8009301Du : return QStringLiteral("OSS_TABLE_MISMATCH");
+    case 0x8009301Eu : return QStringLiteral("OSS_TYPE_NOT_SUPPORTED");
+    case 0x8009301Fu : return QStringLiteral("OSS_REAL_DLL_NOT_LINKED");
+    case 0x80093020u : return QStringLiteral("OSS_REAL_CODE_NOT_LINKED");
+    case 0x80093021u : return QStringLiteral("OSS_OUT_OF_RANGE");
+    case 0x80093022u : return QStringLiteral("OSS_COPIER_DLL_NOT_LINKED");
+    case 0x80093023u : return QStringLiteral("OSS_CONSTRAINT_DLL_NOT_LINKED");
+    case 0x80093024u : return QStringLiteral("OSS_COMPARATOR_DLL_NOT_LINKED");
+    case 0x80093025u : return QStringLiteral("OSS_COMPARATOR_CODE_NOT_LINKED");
+    case 0x80093026u : return QStringLiteral("OSS_MEM_MGR_DLL_NOT_LINKED");
+    case 0x80093027u : return QStringLiteral("OSS_PDV_DLL_NOT_LINKED");
+    case 0x80093028u : return QStringLiteral("OSS_PDV_CODE_NOT_LINKED");
+    case 0x80093029u : return QStringLiteral("OSS_API_DLL_NOT_LINKED");
+    case 0x8009302Au : return QStringLiteral("OSS_BERDER_DLL_NOT_LINKED");
+    case 0x8009302Bu : return QStringLiteral("OSS_PER_DLL_NOT_LINKED");
+    case 0x8009302Cu : return QStringLiteral("OSS_OPEN_TYPE_ERROR");
+    case 0x8009302Du : return QStringLiteral("OSS_MUTEX_NOT_CREATED");
+    case 0x8009302Eu : return QStringLiteral("OSS_CANT_CLOSE_TRACE_FILE");
+    case 0x80093100u : return QStringLiteral("CRYPT_E_ASN1_ERROR");
+    case 0x80093101u : return QStringLiteral("CRYPT_E_ASN1_INTERNAL");
+    case 0x80093102u : return QStringLiteral("CRYPT_E_ASN1_EOD");
+    case 0x80093103u : return QStringLiteral("CRYPT_E_ASN1_CORRUPT");
+    case 0x80093104u : return QStringLiteral("CRYPT_E_ASN1_LARGE");
+    case 0x80093105u : return QStringLiteral("CRYPT_E_ASN1_CONSTRAINT");
+    case 0x80093106u : return QStringLiteral("CRYPT_E_ASN1_MEMORY");
+    case 0x80093107u : return QStringLiteral("CRYPT_E_ASN1_OVERFLOW");
+    case 0x80093108u : return QStringLiteral("CRYPT_E_ASN1_BADPDU");
+    case 0x80093109u : return QStringLiteral("CRYPT_E_ASN1_BADARGS");
+    case 0x8009310Au : return QStringLiteral("CRYPT_E_ASN1_BADREAL");
+    case 0x8009310Bu : return QStringLiteral("CRYPT_E_ASN1_BADTAG");
+    case 0x8009310Cu : return QStringLiteral("CRYPT_E_ASN1_CHOICE");
+    case 0x8009310Du : return QStringLiteral("CRYPT_E_ASN1_RULE");
+    case 0x8009310Eu : return QStringLiteral("CRYPT_E_ASN1_UTF8");
+    case 0x80093133u : return QStringLiteral("CRYPT_E_ASN1_PDU_TYPE");
+    case 0x80093134u : return QStringLiteral("CRYPT_E_ASN1_NYI");
+    case 0x80093201u : return QStringLiteral("CRYPT_E_ASN1_EXTENDED");
+    case 0x80093202u : return QStringLiteral("CRYPT_E_ASN1_NOEOD");
+    case 0x80094001u : return QStringLiteral("CERTSRV_E_BAD_REQUESTSUBJECT");
+    case 0x80094002u : return QStringLiteral("CERTSRV_E_NO_REQUEST");
+    case 0x80094003u : return QStringLiteral("CERTSRV_E_BAD_REQUESTSTATUS");
+    case 0x80094004u : return QStringLiteral("CERTSRV_E_PROPERTY_EMPTY");
+    case 0x80094005u : return QStringLiteral("CERTSRV_E_INVALID_CA_CERTIFICATE");
+    case 0x80094006u : return QStringLiteral("CERTSRV_E_SERVER_SUSPENDED");
+    case 0x80094007u : return QStringLiteral("CERTSRV_E_ENCODING_LENGTH");
+    case 0x80094008u : return QStringLiteral("CERTSRV_E_ROLECONFLICT");
+    case 0x80094009u : return QStringLiteral("CERTSRV_E_RESTRICTEDOFFICER");
+    case 0x8009400Au : return QStringLiteral("CERTSRV_E_KEY_ARCHIVAL_NOT_CONFIGURED");
+    case 0x8009400Bu : return QStringLiteral("CERTSRV_E_NO_VALID_KRA");
+    case 0x8009400Cu : return QStringLiteral("CERTSRV_E_BAD_REQUEST_KEY_ARCHIVAL");
+    case 0x8009400Du : return QStringLiteral("CERTSRV_E_NO_CAADMIN_DEFINED");
+    case 0x8009400Eu : return QStringLiteral("CERTSRV_E_BAD_RENEWAL_CERT_ATTRIBUTE");
+    case 0x8009400Fu : return QStringLiteral("CERTSRV_E_NO_DB_SESSIONS");
+    case 0x80094010u : return QStringLiteral("CERTSRV_E_ALIGNMENT_FAULT");
+    case 0x80094011u : return QStringLiteral("CERTSRV_E_ENROLL_DENIED");
+    case 0x80094012u : return QStringLiteral("CERTSRV_E_TEMPLATE_DENIED");
+    case 0x80094013u : return QStringLiteral("CERTSRV_E_DOWNLEVEL_DC_SSL_OR_UPGRADE");
+    case 0x80094800u : return QStringLiteral("CERTSRV_E_UNSUPPORTED_CERT_TYPE");
+    case 0x80094801u : return QStringLiteral("CERTSRV_E_NO_CERT_TYPE");
+    case 0x80094802u : return QStringLiteral("CERTSRV_E_TEMPLATE_CONFLICT");
+    case 0x80094803u : return QStringLiteral("CERTSRV_E_SUBJECT_ALT_NAME_REQUIRED");
+    case 0x80094804u : return QStringLiteral("CERTSRV_E_ARCHIVED_KEY_REQUIRED");
+    case 0x80094805u : return QStringLiteral("CERTSRV_E_SMIME_REQUIRED");
+    case 0x80094806u : return QStringLiteral("CERTSRV_E_BAD_RENEWAL_SUBJECT");
+    case 0x80094807u : return QStringLiteral("CERTSRV_E_BAD_TEMPLATE_VERSION");
+    case 0x80094808u : return QStringLiteral("CERTSRV_E_TEMPLATE_POLICY_REQUIRED");
+    case 0x80094809u : return QStringLiteral("CERTSRV_E_SIGNATURE_POLICY_REQUIRED");
+    case 0x8009480Au : return QStringLiteral("CERTSRV_E_SIGNATURE_COUNT");
+    case 0x8009480Bu : return QStringLiteral("CERTSRV_E_SIGNATURE_REJECTED");
+    case 0x8009480Cu : return QStringLiteral("CERTSRV_E_ISSUANCE_POLICY_REQUIRED");
+    case 0x8009480Du : return QStringLiteral("CERTSRV_E_SUBJECT_UPN_REQUIRED");
+    case 0x8009480Eu : return QStringLiteral("CERTSRV_E_SUBJECT_DIRECTORY_GUID_REQUIRED");
+    case 0x8009480Fu : return QStringLiteral("CERTSRV_E_SUBJECT_DNS_REQUIRED");
+    case 0x80094810u : return QStringLiteral("CERTSRV_E_ARCHIVED_KEY_UNEXPECTED");
+    case 0x80094811u : return QStringLiteral("CERTSRV_E_KEY_LENGTH");
+    case 0x80094812u : return QStringLiteral("CERTSRV_E_SUBJECT_EMAIL_REQUIRED");
+    case 0x80094813u : return QStringLiteral("CERTSRV_E_UNKNOWN_CERT_TYPE");
+    case 0x80094814u : return QStringLiteral("CERTSRV_E_CERT_TYPE_OVERLAP");
+    case 0x80095000u : return QStringLiteral("XENROLL_E_KEY_NOT_EXPORTABLE");
+    case 0x80095001u : return QStringLiteral("XENROLL_E_CANNOT_ADD_ROOT_CERT");
+    case 0x80095002u : return QStringLiteral("XENROLL_E_RESPONSE_KA_HASH_NOT_FOUND");
+    case 0x80095003u : return QStringLiteral("XENROLL_E_RESPONSE_UNEXPECTED_KA_HASH");
+    case 0x80095004u : return QStringLiteral("XENROLL_E_RESPONSE_KA_HASH_MISMATCH");
+    case 0x80095005u : return QStringLiteral("XENROLL_E_KEYSPEC_SMIME_MISMATCH");
+    case 0x80096001u : return QStringLiteral("TRUST_E_SYSTEM_ERROR");
+    case 0x80096002u : return QStringLiteral("TRUST_E_NO_SIGNER_CERT");
+    case 0x80096003u : return QStringLiteral("TRUST_E_COUNTER_SIGNER");
+    case 0x80096004u : return QStringLiteral("TRUST_E_CERT_SIGNATURE");
+    case 0x80096005u : return QStringLiteral("TRUST_E_TIME_STAMP");
+    case 0x80096010u : return QStringLiteral("TRUST_E_BAD_DIGEST");
+    case 0x80096019u : return QStringLiteral("TRUST_E_BASIC_CONSTRAINTS");
+    case 0x8009601Eu : return QStringLiteral("TRUST_E_FINANCIAL_CRITERIA");
+    case 0x80097001u : return QStringLiteral("MSSIPOTF_E_OUTOFMEMRANGE");
+    case 0x80097002u : return QStringLiteral("MSSIPOTF_E_CANTGETOBJECT");
+    case 0x80097003u : return QStringLiteral("MSSIPOTF_E_NOHEADTABLE");
+    case 0x80097004u : return QStringLiteral("MSSIPOTF_E_BAD_MAGICNUMBER");
+    case 0x80097005u : return QStringLiteral("MSSIPOTF_E_BAD_OFFSET_TABLE");
+    case 0x80097006u : return QStringLiteral("MSSIPOTF_E_TABLE_TAGORDER");
+    case 0x80097007u : return QStringLiteral("MSSIPOTF_E_TABLE_LONGWORD");
+    case 0x80097008u : return QStringLiteral("MSSIPOTF_E_BAD_FIRST_TABLE_PLACEMENT");
+    case 0x80097009u : return QStringLiteral("MSSIPOTF_E_TABLES_OVERLAP");
+    case 0x8009700Au : return QStringLiteral("MSSIPOTF_E_TABLE_PADBYTES");
+    case 0x8009700Bu : return QStringLiteral("MSSIPOTF_E_FILETOOSMALL");
+    case 0x8009700Cu : return QStringLiteral("MSSIPOTF_E_TABLE_CHECKSUM");
+    case 0x8009700Du : return QStringLiteral("MSSIPOTF_E_FILE_CHECKSUM");
+    case 0x80097010u : return QStringLiteral("MSSIPOTF_E_FAILED_POLICY");
+    case 0x80097011u : return QStringLiteral("MSSIPOTF_E_FAILED_HINTS_CHECK");
+    case 0x80097012u : return QStringLiteral("MSSIPOTF_E_NOT_OPENTYPE");
+    case 0x80097013u : return QStringLiteral("MSSIPOTF_E_FILE");
+    case 0x80097014u : return QStringLiteral("MSSIPOTF_E_CRYPT");
+    case 0x80097015u : return QStringLiteral("MSSIPOTF_E_BADVERSION");
+    case 0x80097016u : return QStringLiteral("MSSIPOTF_E_DSIG_STRUCTURE");
+    case 0x80097017u : return QStringLiteral("MSSIPOTF_E_PCONST_CHECK");
+    case 0x80097018u : return QStringLiteral("MSSIPOTF_E_STRUCTURE");
+    case 0x800B0001u : return QStringLiteral("TRUST_E_PROVIDER_UNKNOWN");
+    case 0x800B0002u : return QStringLiteral("TRUST_E_ACTION_UNKNOWN");
+    case 0x800B0003u : return QStringLiteral("TRUST_E_SUBJECT_FORM_UNKNOWN");
+    case 0x800B0004u : return QStringLiteral("TRUST_E_SUBJECT_NOT_TRUSTED");
+    case 0x800B0005u : return QStringLiteral("DIGSIG_E_ENCODE");
+    case 0x800B0006u : return QStringLiteral("DIGSIG_E_DECODE");
+    case 0x800B0007u : return QStringLiteral("DIGSIG_E_EXTENSIBILITY");
+    case 0x800B0008u : return QStringLiteral("DIGSIG_E_CRYPTO");
+    case 0x800B0009u : return QStringLiteral("PERSIST_E_SIZEDEFINITE");
+    case 0x800B000Au : return QStringLiteral("PERSIST_E_SIZEINDEFINITE");
+    case 0x800B000Bu : return QStringLiteral("PERSIST_E_NOTSELFSIZING");
+    case 0x800B0100u : return QStringLiteral("TRUST_E_NOSIGNATURE");
+    case 0x800B0101u : return QStringLiteral("CERT_E_EXPIRED");
+    case 0x800B0102u : return QStringLiteral("CERT_E_VALIDITYPERIODNESTING");
+    case 0x800B0103u : return QStringLiteral("CERT_E_ROLE");
+    case 0x800B0104u : return QStringLiteral("CERT_E_PATHLENCONST");
+    case 0x800B0105u : return QStringLiteral("CERT_E_CRITICAL");
+    case 0x800B0106u : return QStringLiteral("CERT_E_PURPOSE");
+    case 0x800B0107u : return QStringLiteral("CERT_E_ISSUERCHAINING");
+    case 0x800B0108u : return QStringLiteral("CERT_E_MALFORMED");
+    case 0x800B0109u : return QStringLiteral("CERT_E_UNTRUSTEDROOT");
+    case 0x800B010Au : return QStringLiteral("CERT_E_CHAINING");
+    case 0x800B010Bu : return QStringLiteral("TRUST_E_FAIL");
+    case 0x800B010Cu : return QStringLiteral("CERT_E_REVOKED");
+    case 0x800B010Du : return QStringLiteral("CERT_E_UNTRUSTEDTESTROOT");
+    case 0x800B010Eu : return QStringLiteral("CERT_E_REVOCATION_FAILURE");
+    case 0x800B010Fu : return QStringLiteral("CERT_E_CN_NO_MATCH");
+    case 0x800B0110u : return QStringLiteral("CERT_E_WRONG_USAGE");
+    case 0x800B0111u : return QStringLiteral("TRUST_E_EXPLICIT_DISTRUST");
+    case 0x800B0112u : return QStringLiteral("CERT_E_UNTRUSTEDCA");
+    case 0x800B0113u : return QStringLiteral("CERT_E_INVALID_POLICY");
+    case 0x800B0114u : return QStringLiteral("CERT_E_INVALID_NAME");
+    case 0x800F0000u : return QStringLiteral("SPAPI_E_EXPECTED_SECTION_NAME");
+    case 0x800F0001u : return QStringLiteral("SPAPI_E_BAD_SECTION_NAME_LINE");
+    case 0x800F0002u : return QStringLiteral("SPAPI_E_SECTION_NAME_TOO_LONG");
+    case 0x800F0003u : return QStringLiteral("SPAPI_E_GENERAL_SYNTAX");
+    case 0x800F0100u : return QStringLiteral("SPAPI_E_WRONG_INF_STYLE");
+    case 0x800F0101u : return QStringLiteral("SPAPI_E_SECTION_NOT_FOUND");
+    case 0x800F0102u : return QStringLiteral("SPAPI_E_LINE_NOT_FOUND");
+    case 0x800F0103u : return QStringLiteral("SPAPI_E_NO_BACKUP");
+    case 0x800F0200u : return QStringLiteral("SPAPI_E_NO_ASSOCIATED_CLASS");
+    case 0x800F0201u : return QStringLiteral("SPAPI_E_CLASS_MISMATCH");
+    case 0x800F0202u : return QStringLiteral("SPAPI_E_DUPLICATE_FOUND");
+    case 0x800F0203u : return QStringLiteral("SPAPI_E_NO_DRIVER_SELECTED");
+    case 0x800F0204u : return QStringLiteral("SPAPI_E_KEY_DOES_NOT_EXIST");
+    case 0x800F0205u : return QStringLiteral("SPAPI_E_INVALID_DEVINST_NAME");
+    case 0x800F0206u : return QStringLiteral("SPAPI_E_INVALID_CLASS");
+    case 0x800F0207u : return QStringLiteral("SPAPI_E_DEVINST_ALREADY_EXISTS");
+    case 0x800F0208u : return QStringLiteral("SPAPI_E_DEVINFO_NOT_REGISTERED");
+    case 0x800F0209u : return QStringLiteral("SPAPI_E_INVALID_REG_PROPERTY");
+    case 0x800F020Au : return QStringLiteral("SPAPI_E_NO_INF");
+    case 0x800F020Bu : return QStringLiteral("SPAPI_E_NO_SUCH_DEVINST");
+    case 0x800F020Cu : return QStringLiteral("SPAPI_E_CANT_LOAD_CLASS_ICON");
+    case 0x800F020Du : return QStringLiteral("SPAPI_E_INVALID_CLASS_INSTALLER");
+    case 0x800F020Eu : return QStringLiteral("SPAPI_E_DI_DO_DEFAULT");
+    case 0x800F020Fu : return QStringLiteral("SPAPI_E_DI_NOFILECOPY");
+    case 0x800F0210u : return QStringLiteral("SPAPI_E_INVALID_HWPROFILE");
+    case 0x800F0211u : return QStringLiteral("SPAPI_E_NO_DEVICE_SELECTED");
+    case 0x800F0212u : return QStringLiteral("SPAPI_E_DEVINFO_LIST_LOCKED");
+    case 0x800F0213u : return QStringLiteral("SPAPI_E_DEVINFO_DATA_LOCKED");
+    case 0x800F0214u : return QStringLiteral("SPAPI_E_DI_BAD_PATH");
+    case 0x800F0215u : return QStringLiteral("SPAPI_E_NO_CLASSINSTALL_PARAMS");
+    case 0x800F0216u : return QStringLiteral("SPAPI_E_FILEQUEUE_LOCKED");
+    case 0x800F0217u : return QStringLiteral("SPAPI_E_BAD_SERVICE_INSTALLSECT");
+    case 0x800F0218u : return QStringLiteral("SPAPI_E_NO_CLASS_DRIVER_LIST");
+    case 0x800F0219u : return QStringLiteral("SPAPI_E_NO_ASSOCIATED_SERVICE");
+    case 0x800F021Au : return QStringLiteral("SPAPI_E_NO_DEFAULT_DEVICE_INTERFACE");
+    case 0x800F021Bu : return QStringLiteral("SPAPI_E_DEVICE_INTERFACE_ACTIVE");
+    case 0x800F021Cu : return QStringLiteral("SPAPI_E_DEVICE_INTERFACE_REMOVED");
+    case 0x800F021Du : return QStringLiteral("SPAPI_E_BAD_INTERFACE_INSTALLSECT");
+    case 0x800F021Eu : return QStringLiteral("SPAPI_E_NO_SUCH_INTERFACE_CLASS");
+    case 0x800F021Fu : return QStringLiteral("SPAPI_E_INVALID_REFERENCE_STRING");
+    case 0x800F0220u : return QStringLiteral("SPAPI_E_INVALID_MACHINENAME");
+    case 0x800F0221u : return QStringLiteral("SPAPI_E_REMOTE_COMM_FAILURE");
+    case 0x800F0222u : return QStringLiteral("SPAPI_E_MACHINE_UNAVAILABLE");
+    case 0x800F0223u : return QStringLiteral("SPAPI_E_NO_CONFIGMGR_SERVICES");
+    case 0x800F0224u : return QStringLiteral("SPAPI_E_INVALID_PROPPAGE_PROVIDER");
+    case 0x800F0225u : return QStringLiteral("SPAPI_E_NO_SUCH_DEVICE_INTERFACE");
+    case 0x800F0226u : return QStringLiteral("SPAPI_E_DI_POSTPROCESSING_REQUIRED");
+    case 0x800F0227u : return QStringLiteral("SPAPI_E_INVALID_COINSTALLER");
+    case 0x800F0228u : return QStringLiteral("SPAPI_E_NO_COMPAT_DRIVERS");
+    case 0x800F0229u : return QStringLiteral("SPAPI_E_NO_DEVICE_ICON");
+    case 0x800F022Au : return QStringLiteral("SPAPI_E_INVALID_INF_LOGCONFIG");
+    case 0x800F022Bu : return QStringLiteral("SPAPI_E_DI_DONT_INSTALL");
+    case 0x800F022Cu : return QStringLiteral("SPAPI_E_INVALID_FILTER_DRIVER");
+    case 0x800F022Du : return QStringLiteral("SPAPI_E_NON_WINDOWS_NT_DRIVER");
+    case 0x800F022Eu : return QStringLiteral("SPAPI_E_NON_WINDOWS_DRIVER");
+    case 0x800F022Fu : return QStringLiteral("SPAPI_E_NO_CATALOG_FOR_OEM_INF");
+    case 0x800F0230u : return QStringLiteral("SPAPI_E_DEVINSTALL_QUEUE_NONNATIVE");
+    case 0x800F0231u : return QStringLiteral("SPAPI_E_NOT_DISABLEABLE");
+    case 0x800F0232u : return QStringLiteral("SPAPI_E_CANT_REMOVE_DEVINST");
+    case 0x800F0233u : return QStringLiteral("SPAPI_E_INVALID_TARGET");
+    case 0x800F0234u : return QStringLiteral("SPAPI_E_DRIVER_NONNATIVE");
+    case 0x800F0235u : return QStringLiteral("SPAPI_E_IN_WOW64");
+    case 0x800F0236u : return QStringLiteral("SPAPI_E_SET_SYSTEM_RESTORE_POINT");
+    case 0x800F0237u : return QStringLiteral("SPAPI_E_INCORRECTLY_COPIED_INF");
+    case 0x800F0238u : return QStringLiteral("SPAPI_E_SCE_DISABLED");
+    case 0x800F0239u : return QStringLiteral("SPAPI_E_UNKNOWN_EXCEPTION");
+    case 0x800F023Au : return QStringLiteral("SPAPI_E_PNP_REGISTRY_ERROR");
+    case 0x800F023Bu : return QStringLiteral("SPAPI_E_REMOTE_REQUEST_UNSUPPORTED");
+    case 0x800F023Cu : return QStringLiteral("SPAPI_E_NOT_AN_INSTALLED_OEM_INF");
+    case 0x800F023Du : return QStringLiteral("SPAPI_E_INF_IN_USE_BY_DEVICES");
+    case 0x800F023Eu : return QStringLiteral("SPAPI_E_DI_FUNCTION_OBSOLETE");
+    case 0x800F023Fu : return QStringLiteral("SPAPI_E_NO_AUTHENTICODE_CATALOG");
+    case 0x800F0240u : return QStringLiteral("SPAPI_E_AUTHENTICODE_DISALLOWED");
+    case 0x800F0241u : return QStringLiteral("SPAPI_E_AUTHENTICODE_TRUSTED_PUBLISHER");
+    case 0x800F0242u : return QStringLiteral("SPAPI_E_AUTHENTICODE_TRUST_NOT_ESTABLISHED");
+    case 0x800F0243u : return QStringLiteral("SPAPI_E_AUTHENTICODE_PUBLISHER_NOT_TRUSTED");
+    case 0x800F0244u : return QStringLiteral("SPAPI_E_SIGNATURE_OSATTRIBUTE_MISMATCH");
+    case 0x800F0245u : return QStringLiteral("SPAPI_E_ONLY_VALIDATE_VIA_AUTHENTICODE");
+    case 0x800F0300u : return QStringLiteral("SPAPI_E_UNRECOVERABLE_STACK_OVERFLOW");
+    case 0x800F1000u : return QStringLiteral("SPAPI_E_ERROR_NOT_INSTALLED");
+    case 0x80100001u : return QStringLiteral("SCARD_F_INTERNAL_ERROR");
+    case 0x80100002u : return QStringLiteral("SCARD_E_CANCELLED");
+    case 0x80100003u : return QStringLiteral("SCARD_E_INVALID_HANDLE");
+    case 0x80100004u : return QStringLiteral("SCARD_E_INVALID_PARAMETER");
+    case 0x80100005u : return QStringLiteral("SCARD_E_INVALID_TARGET");
+    case 0x80100006u : return QStringLiteral("SCARD_E_NO_MEMORY");
+    case 0x80100007u : return QStringLiteral("SCARD_F_WAITED_TOO_LONG");
+    case 0x80100008u : return QStringLiteral("SCARD_E_INSUFFICIENT_BUFFER");
+    case 0x80100009u : return QStringLiteral("SCARD_E_UNKNOWN_READER");
+    case 0x8010000Au : return QStringLiteral("SCARD_E_TIMEOUT");
+    case 0x8010000Bu : return QStringLiteral("SCARD_E_SHARING_VIOLATION");
+    case 0x8010000Cu : return QStringLiteral("SCARD_E_NO_SMARTCARD");
+    case 0x8010000Du : return QStringLiteral("SCARD_E_UNKNOWN_CARD");
+    case 0x8010000Eu : return QStringLiteral("SCARD_E_CANT_DISPOSE");
+    case 0x8010000Fu : return QStringLiteral("SCARD_E_PROTO_MISMATCH");
+    case 0x80100010u : return QStringLiteral("SCARD_E_NOT_READY");
+    case 0x80100011u : return QStringLiteral("SCARD_E_INVALID_VALUE");
+    case 0x80100012u : return QStringLiteral("SCARD_E_SYSTEM_CANCELLED");
+    case 0x80100013u : return QStringLiteral("SCARD_F_COMM_ERROR");
+    case 0x80100014u : return QStringLiteral("SCARD_F_UNKNOWN_ERROR");
+    case 0x80100015u : return QStringLiteral("SCARD_E_INVALID_ATR");
+    case 0x80100016u : return QStringLiteral("SCARD_E_NOT_TRANSACTED");
+    case 0x80100017u : return QStringLiteral("SCARD_E_READER_UNAVAILABLE");
+    case 0x80100018u : return QStringLiteral("SCARD_P_SHUTDOWN");
+    case 0x80100019u : return QStringLiteral("SCARD_E_PCI_TOO_SMALL");
+    case 0x8010001Au : return QStringLiteral("SCARD_E_READER_UNSUPPORTED");
+    case 0x8010001Bu : return QStringLiteral("SCARD_E_DUPLICATE_READER");
+    case 0x8010001Cu : return QStringLiteral("SCARD_E_CARD_UNSUPPORTED");
+    case 0x8010001Du : return QStringLiteral("SCARD_E_NO_SERVICE");
+    case 0x8010001Eu : return QStringLiteral("SCARD_E_SERVICE_STOPPED");
+    case 0x8010001Fu : return QStringLiteral("SCARD_E_UNEXPECTED");
+    case 0x80100020u : return QStringLiteral("SCARD_E_ICC_INSTALLATION");
+    case 0x80100021u : return QStringLiteral("SCARD_E_ICC_CREATEORDER");
+    case 0x80100022u : return QStringLiteral("SCARD_E_UNSUPPORTED_FEATURE");
+    case 0x80100023u : return QStringLiteral("SCARD_E_DIR_NOT_FOUND");
+    case 0x80100024u : return QStringLiteral("SCARD_E_FILE_NOT_FOUND");
+    case 0x80100025u : return QStringLiteral("SCARD_E_NO_DIR");
+    case 0x80100026u : return QStringLiteral("SCARD_E_NO_FILE");
+    case 0x80100027u : return QStringLiteral("SCARD_E_NO_ACCESS");
+    case 0x80100028u : return QStringLiteral("SCARD_E_WRITE_TOO_MANY");
+    case 0x80100029u : return QStringLiteral("SCARD_E_BAD_SEEK");
+    case 0x8010002Au : return QStringLiteral("SCARD_E_INVALID_CHV");
+    case 0x8010002Bu : return QStringLiteral("SCARD_E_UNKNOWN_RES_MNG");
+    case 0x8010002Cu : return QStringLiteral("SCARD_E_NO_SUCH_CERTIFICATE");
+    case 0x8010002Du : return QStringLiteral("SCARD_E_CERTIFICATE_UNAVAILABLE");
+    case 0x8010002Eu : return QStringLiteral("SCARD_E_NO_READERS_AVAILABLE");
+    case 0x8010002Fu : return QStringLiteral("SCARD_E_COMM_DATA_LOST");
+    case 0x80100030u : return QStringLiteral("SCARD_E_NO_KEY_CONTAINER");
+    case 0x80100031u : return QStringLiteral("SCARD_E_SERVER_TOO_BUSY");
+    case 0x80100065u : return QStringLiteral("SCARD_W_UNSUPPORTED_CARD");
+    case 0x80100066u : return QStringLiteral("SCARD_W_UNRESPONSIVE_CARD");
+    case 0x80100067u : return QStringLiteral("SCARD_W_UNPOWERED_CARD");
+    case 0x80100068u : return QStringLiteral("SCARD_W_RESET_CARD");
+    case 0x80100069u : return QStringLiteral("SCARD_W_REMOVED_CARD");
+    case 0x8010006Au : return QStringLiteral("SCARD_W_SECURITY_VIOLATION");
+    case 0x8010006Bu : return QStringLiteral("SCARD_W_WRONG_CHV");
+    case 0x8010006Cu : return QStringLiteral("SCARD_W_CHV_BLOCKED");
+    case 0x8010006Du : return QStringLiteral("SCARD_W_EOF");
+    case 0x8010006Eu : return QStringLiteral("SCARD_W_CANCELLED_BY_USER");
+    case 0x8010006Fu : return QStringLiteral("SCARD_W_CARD_NOT_AUTHENTICATED");
+    case 0x80100070u : return QStringLiteral("SCARD_W_CACHE_ITEM_NOT_FOUND");
+    case 0x80100071u : return QStringLiteral("SCARD_W_CACHE_ITEM_STALE");
+    case 0x80110401u : return QStringLiteral("COMADMIN_E_OBJECTERRORS");
+    case 0x80110402u : return QStringLiteral("COMADMIN_E_OBJECTINVALID");
+    case 0x80110403u : return QStringLiteral("COMADMIN_E_KEYMISSING");
+    case 0x80110404u : return QStringLiteral("COMADMIN_E_ALREADYINSTALLED");
+    case 0x80110407u : return QStringLiteral("COMADMIN_E_APP_FILE_WRITEFAIL");
+    case 0x80110408u : return QStringLiteral("COMADMIN_E_APP_FILE_READFAIL");
+    case 0x80110409u : return QStringLiteral("COMADMIN_E_APP_FILE_VERSION");
+    case 0x8011040Au : return QStringLiteral("COMADMIN_E_BADPATH");
+    case 0x8011040Bu : return QStringLiteral("COMADMIN_E_APPLICATIONEXISTS");
+    case 0x8011040Cu : return QStringLiteral("COMADMIN_E_ROLEEXISTS");
+    case 0x8011040Du : return QStringLiteral("COMADMIN_E_CANTCOPYFILE");
+    case 0x8011040Fu : return QStringLiteral("COMADMIN_E_NOUSER");
+    case 0x80110410u : return QStringLiteral("COMADMIN_E_INVALIDUSERIDS");
+    case 0x80110411u : return QStringLiteral("COMADMIN_E_NOREGISTRYCLSID");
+    case 0x80110412u : return QStringLiteral("COMADMIN_E_BADREGISTRYPROGID");
+    case 0x80110413u : return QStringLiteral("COMADMIN_E_AUTHENTICATIONLEVEL");
+    case 0x80110414u : return QStringLiteral("COMADMIN_E_USERPASSWDNOTVALID");
+    case 0x80110418u : return QStringLiteral("COMADMIN_E_CLSIDORIIDMISMATCH");
+    case 0x80110419u : return QStringLiteral("COMADMIN_E_REMOTEINTERFACE");
+    case 0x8011041Au : return QStringLiteral("COMADMIN_E_DLLREGISTERSERVER");
+    case 0x8011041Bu : return QStringLiteral("COMADMIN_E_NOSERVERSHARE");
+    case 0x8011041Du : return QStringLiteral("COMADMIN_E_DLLLOADFAILED");
+    case 0x8011041Eu : return QStringLiteral("COMADMIN_E_BADREGISTRYLIBID");
+    case 0x8011041Fu : return QStringLiteral("COMADMIN_E_APPDIRNOTFOUND");
+    case 0x80110423u : return QStringLiteral("COMADMIN_E_REGISTRARFAILED");
+    case 0x80110424u : return QStringLiteral("COMADMIN_E_COMPFILE_DOESNOTEXIST");
+    case 0x80110425u : return QStringLiteral("COMADMIN_E_COMPFILE_LOADDLLFAIL");
+    case 0x80110426u : return QStringLiteral("COMADMIN_E_COMPFILE_GETCLASSOBJ");
+    case 0x80110427u : return QStringLiteral("COMADMIN_E_COMPFILE_CLASSNOTAVAIL");
+    case 0x80110428u : return QStringLiteral("COMADMIN_E_COMPFILE_BADTLB");
+    case 0x80110429u : return QStringLiteral("COMADMIN_E_COMPFILE_NOTINSTALLABLE");
+    case 0x8011042Au : return QStringLiteral("COMADMIN_E_NOTCHANGEABLE");
+    case 0x8011042Bu : return QStringLiteral("COMADMIN_E_NOTDELETEABLE");
+    case 0x8011042Cu : return QStringLiteral("COMADMIN_E_SESSION");
+    case 0x8011042Du : return QStringLiteral("COMADMIN_E_COMP_MOVE_LOCKED");
+    case 0x8011042Eu : return QStringLiteral("COMADMIN_E_COMP_MOVE_BAD_DEST");
+    case 0x80110430u : return QStringLiteral("COMADMIN_E_REGISTERTLB");
+    case 0x80110433u : return QStringLiteral("COMADMIN_E_SYSTEMAPP");
+    case 0x80110434u : return QStringLiteral("COMADMIN_E_COMPFILE_NOREGISTRAR");
+    case 0x80110435u : return QStringLiteral("COMADMIN_E_COREQCOMPINSTALLED");
+    case 0x80110436u : return QStringLiteral("COMADMIN_E_SERVICENOTINSTALLED");
+    case 0x80110437u : return QStringLiteral("COMADMIN_E_PROPERTYSAVEFAILED");
+    case 0x80110438u : return QStringLiteral("COMADMIN_E_OBJECTEXISTS");
+    case 0x80110439u : return QStringLiteral("COMADMIN_E_COMPONENTEXISTS");
+    case 0x8011043Bu : return QStringLiteral("COMADMIN_E_REGFILE_CORRUPT");
+    case 0x8011043Cu : return QStringLiteral("COMADMIN_E_PROPERTY_OVERFLOW");
+    case 0x8011043Eu : return QStringLiteral("COMADMIN_E_NOTINREGISTRY");
+    case 0x8011043Fu : return QStringLiteral("COMADMIN_E_OBJECTNOTPOOLABLE");
+    case 0x80110446u : return QStringLiteral("COMADMIN_E_APPLID_MATCHES_CLSID");
+    case 0x80110447u : return QStringLiteral("COMADMIN_E_ROLE_DOES_NOT_EXIST");
+    case 0x80110448u : return QStringLiteral("COMADMIN_E_START_APP_NEEDS_COMPONENTS");
+    case 0x80110449u : return QStringLiteral("COMADMIN_E_REQUIRES_DIFFERENT_PLATFORM");
+    case 0x8011044Au : return QStringLiteral("COMADMIN_E_CAN_NOT_EXPORT_APP_PROXY");
+    case 0x8011044Bu : return QStringLiteral("COMADMIN_E_CAN_NOT_START_APP");
+    case 0x8011044Cu : return QStringLiteral("COMADMIN_E_CAN_NOT_EXPORT_SYS_APP");
+    case 0x8011044Du : return QStringLiteral("COMADMIN_E_CANT_SUBSCRIBE_TO_COMPONENT");
+    case 0x8011044Eu : return QStringLiteral("COMADMIN_E_EVENTCLASS_CANT_BE_SUBSCRIBER");
+    case 0x8011044Fu : return QStringLiteral("COMADMIN_E_LIB_APP_PROXY_INCOMPATIBLE");
+    case 0x80110450u : return QStringLiteral("COMADMIN_E_BASE_PARTITION_ONLY");
+    case 0x80110451u : return QStringLiteral("COMADMIN_E_START_APP_DISABLED");
+    case 0x80110457u : return QStringLiteral("COMADMIN_E_CAT_DUPLICATE_PARTITION_NAME");
+    case 0x80110458u : return QStringLiteral("COMADMIN_E_CAT_INVALID_PARTITION_NAME");
+    case 0x80110459u : return QStringLiteral("COMADMIN_E_CAT_PARTITION_IN_USE");
+    case 0x8011045Au : return QStringLiteral("COMADMIN_E_FILE_PARTITION_DUPLICATE_FILES");
+    case 0x8011045Bu : return QStringLiteral("COMADMIN_E_CAT_IMPORTED_COMPONENTS_NOT_ALLOWED");
+    case 0x8011045Cu : return QStringLiteral("COMADMIN_E_AMBIGUOUS_APPLICATION_NAME");
+    case 0x8011045Du : return QStringLiteral("COMADMIN_E_AMBIGUOUS_PARTITION_NAME");
+    case 0x80110472u : return QStringLiteral("COMADMIN_E_REGDB_NOTINITIALIZED");
+    case 0x80110473u : return QStringLiteral("COMADMIN_E_REGDB_NOTOPEN");
+    case 0x80110474u : return QStringLiteral("COMADMIN_E_REGDB_SYSTEMERR");
+    case 0x80110475u : return QStringLiteral("COMADMIN_E_REGDB_ALREADYRUNNING");
+    case 0x80110480u : return QStringLiteral("COMADMIN_E_MIG_VERSIONNOTSUPPORTED");
+    case 0x80110481u : return QStringLiteral("COMADMIN_E_MIG_SCHEMANOTFOUND");
+    case 0x80110482u : return QStringLiteral("COMADMIN_E_CAT_BITNESSMISMATCH");
+    case 0x80110483u : return QStringLiteral("COMADMIN_E_CAT_UNACCEPTABLEBITNESS");
+    case 0x80110484u : return QStringLiteral("COMADMIN_E_CAT_WRONGAPPBITNESS");
+    case 0x80110485u : return QStringLiteral("COMADMIN_E_CAT_PAUSE_RESUME_NOT_SUPPORTED");
+    case 0x80110486u : return QStringLiteral("COMADMIN_E_CAT_SERVERFAULT");
+    case 0x80110600u : return QStringLiteral("COMQC_E_APPLICATION_NOT_QUEUED");
+    case 0x80110601u : return QStringLiteral("COMQC_E_NO_QUEUEABLE_INTERFACES");
+    case 0x80110602u : return QStringLiteral("COMQC_E_QUEUING_SERVICE_NOT_AVAILABLE");
+    case 0x80110603u : return QStringLiteral("COMQC_E_NO_IPERSISTSTREAM");
+    case 0x80110604u : return QStringLiteral("COMQC_E_BAD_MESSAGE");
+    case 0x80110605u : return QStringLiteral("COMQC_E_UNAUTHENTICATED");
+    case 0x80110606u : return QStringLiteral("COMQC_E_UNTRUSTED_ENQUEUER");
+    case 0x80110701u : return QStringLiteral("MSDTC_E_DUPLICATE_RESOURCE");
+    case 0x80110808u : return QStringLiteral("COMADMIN_E_OBJECT_PARENT_MISSING");
+    case 0x80110809u : return QStringLiteral("COMADMIN_E_OBJECT_DOES_NOT_EXIST");
+    case 0x8011080Au : return QStringLiteral("COMADMIN_E_APP_NOT_RUNNING");
+    case 0x8011080Bu : return QStringLiteral("COMADMIN_E_INVALID_PARTITION");
+    case 0x8011080Du : return QStringLiteral("COMADMIN_E_SVCAPP_NOT_POOLABLE_OR_RECYCLABLE");
+    case 0x8011080Eu : return QStringLiteral("COMADMIN_E_USER_IN_SET");
+    case 0x8011080Fu : return QStringLiteral("COMADMIN_E_CANTRECYCLELIBRARYAPPS");
+    case 0x80110811u : return QStringLiteral("COMADMIN_E_CANTRECYCLESERVICEAPPS");
+    case 0x80110812u : return QStringLiteral("COMADMIN_E_PROCESSALREADYRECYCLED");
+    case 0x80110813u : return QStringLiteral("COMADMIN_E_PAUSEDPROCESSMAYNOTBERECYCLED");
+    case 0x80110814u : return QStringLiteral("COMADMIN_E_CANTMAKEINPROCSERVICE");
+    case 0x80110815u : return QStringLiteral("COMADMIN_E_PROGIDINUSEBYCLSID");
+    case 0x80110816u : return QStringLiteral("COMADMIN_E_DEFAULT_PARTITION_NOT_IN_SET");
+    case 0x80110817u : return QStringLiteral("COMADMIN_E_RECYCLEDPROCESSMAYNOTBEPAUSED");
+    case 0x80110818u : return QStringLiteral("COMADMIN_E_PARTITION_ACCESSDENIED");
+    case 0x80110819u : return QStringLiteral("COMADMIN_E_PARTITION_MSI_ONLY");
+    case 0x8011081Au : return QStringLiteral("COMADMIN_E_LEGACYCOMPS_NOT_ALLOWED_IN_1_0_FORMAT");
+    case 0x8011081Bu : return QStringLiteral("COMADMIN_E_LEGACYCOMPS_NOT_ALLOWED_IN_NONBASE_PARTITIONS");
+    case 0x8011081Cu : return QStringLiteral("COMADMIN_E_COMP_MOVE_SOURCE");
+    case 0x8011081Du : return QStringLiteral("COMADMIN_E_COMP_MOVE_DEST");
+    case 0x8011081Eu : return QStringLiteral("COMADMIN_E_COMP_MOVE_PRIVATE");
+    case 0x8011081Fu : return QStringLiteral("COMADMIN_E_BASEPARTITION_REQUIRED_IN_SET");
+    case 0x80110820u : return QStringLiteral("COMADMIN_E_CANNOT_ALIAS_EVENTCLASS");
+    case 0x80110821u : return QStringLiteral("COMADMIN_E_PRIVATE_ACCESSDENIED");
+    case 0x80110822u : return QStringLiteral("COMADMIN_E_SAFERINVALID");
+    case 0x80110823u : return QStringLiteral("COMADMIN_E_REGISTRY_ACCESSDENIED");
+    case 0x80110824u : return QStringLiteral("COMADMIN_E_PARTITIONS_DISABLED");
+    case 0x80042301u : return QStringLiteral("VSS_E_BAD_STATE");
+    case 0x800423F7u : return QStringLiteral("VSS_E_LEGACY_PROVIDER");
+    case 0x800423FFu : return QStringLiteral("VSS_E_RESYNC_IN_PROGRESS");
+    case 0x8004232Bu : return QStringLiteral("VSS_E_SNAPSHOT_NOT_IN_SET");
+    case 0x80042312u : return QStringLiteral("VSS_E_MAXIMUM_NUMBER_OF_VOLUMES_REACHED");
+    case 0x80042317u : return QStringLiteral("VSS_E_MAXIMUM_NUMBER_OF_SNAPSHOTS_REACHED");
+    case 0x8004232Cu : return QStringLiteral("VSS_E_NESTED_VOLUME_LIMIT");
+    case 0x80042308u : return QStringLiteral("VSS_E_OBJECT_NOT_FOUND");
+    case 0x80042304u : return QStringLiteral("VSS_E_PROVIDER_NOT_REGISTERED");
+    case 0x80042306u : return QStringLiteral("VSS_E_PROVIDER_VETO");
+    case 0x8004230Cu : return QStringLiteral("VSS_E_VOLUME_NOT_SUPPORTED");
+    case 0x8004230Eu : return QStringLiteral("VSS_E_VOLUME_NOT_SUPPORTED_BY_PROVIDER");
+    case 0x80042302u : return QStringLiteral("VSS_E_UNEXPECTED");
+    case 0x8004230Fu : return QStringLiteral("VSS_E_UNEXPECTED_PROVIDER_ERROR");
+    case 0x8004232Au : return QStringLiteral("VSS_E_UNSELECTED_VOLUME");
+    case 0x800423FEu : return QStringLiteral("VSS_E_CANNOT_REVERT_DISKID");
+    case 0x80042311u : return QStringLiteral("VSS_E_INVALID_XML_DOCUMENT");
+    case 0x8004230Du : return QStringLiteral("VSS_E_OBJECT_ALREADY_EXISTS");
+    case 0x80284001u : return QStringLiteral("TBS_E_INTERNAL_ERROR");
+    case 0x80284002u : return QStringLiteral("TBS_E_BAD_PARAMETER");
+    case 0x80284003u : return QStringLiteral("TBS_E_INVALID_OUTPUT_POINTER");
+    case 0x80284005u : return QStringLiteral("TBS_E_INSUFFICIENT_BUFFER");
+    case 0x80284006u : return QStringLiteral("TBS_E_IOERROR");
+    case 0x80284007u : return QStringLiteral("TBS_E_INVALID_CONTEXT_PARAM");
+    case 0x80284008u : return QStringLiteral("TBS_E_SERVICE_NOT_RUNNING");
+    case 0x80284009u : return QStringLiteral("TBS_E_TOO_MANY_TBS_CONTEXTS");
+    case 0x8028400Bu : return QStringLiteral("TBS_E_SERVICE_START_PENDING");
+    case 0x8028400Eu : return QStringLiteral("TBS_E_BUFFER_TOO_LARGE");
+    case 0x8028400Fu : return QStringLiteral("TBS_E_TPM_NOT_FOUND");
+    case 0x80284010u : return QStringLiteral("TBS_E_SERVICE_DISABLED");
+    case 0x80284016u : return QStringLiteral("TBS_E_DEACTIVATED");
+    case 0x80320001u : return QStringLiteral("FWP_E_CALLOUT_NOT_FOUND");
+    case 0x80320002u : return QStringLiteral("FWP_E_CONDITION_NOT_FOUND");
+    case 0x80320003u : return QStringLiteral("FWP_E_FILTER_NOT_FOUND");
+    case 0x80320004u : return QStringLiteral("FWP_E_LAYER_NOT_FOUND");
+    case 0x80320005u : return QStringLiteral("FWP_E_PROVIDER_NOT_FOUND");
+    case 0x80320006u : return QStringLiteral("FWP_E_PROVIDER_CONTEXT_NOT_FOUND");
+    case 0x80320007u : return QStringLiteral("FWP_E_SUBLAYER_NOT_FOUND");
+    case 0x80320008u : return QStringLiteral("FWP_E_NOT_FOUND");
+    case 0x80320009u : return QStringLiteral("FWP_E_ALREADY_EXISTS");
+    case 0x8032000Au : return QStringLiteral("FWP_E_IN_USE");
+    case 0x8032000Bu : return QStringLiteral("FWP_E_DYNAMIC_SESSION_IN_PROGRESS");
+    case 0x8032000Cu : return QStringLiteral("FWP_E_WRONG_SESSION");
+    case 0x8032000Du : return QStringLiteral("FWP_E_NO_TXN_IN_PROGRESS");
+    case 0x8032000Eu : return QStringLiteral("FWP_E_TXN_IN_PROGRESS");
+    case 0x8032000Fu : return QStringLiteral("FWP_E_TXN_ABORTED");
+    case 0x80320010u : return QStringLiteral("FWP_E_SESSION_ABORTED");
+    case 0x80320011u : return QStringLiteral("FWP_E_INCOMPATIBLE_TXN");
+    case 0x80320012u : return QStringLiteral("FWP_E_TIMEOUT");
+    case 0x80320013u : return QStringLiteral("FWP_E_NET_EVENTS_DISABLED");
+    case 0x80320014u : return QStringLiteral("FWP_E_INCOMPATIBLE_LAYER");
+    case 0x80320015u : return QStringLiteral("FWP_E_KM_CLIENTS_ONLY");
+    case 0x80320016u : return QStringLiteral("FWP_E_LIFETIME_MISMATCH");
+    case 0x80320017u : return QStringLiteral("FWP_E_BUILTIN_OBJECT");
+    case 0x80320018u : return QStringLiteral("FWP_E_TOO_MANY_CALLOUTS");
+    case 0x80320019u : return QStringLiteral("FWP_E_NOTIFICATION_DROPPED");
+    case 0x8032001Au : return QStringLiteral("FWP_E_TRAFFIC_MISMATCH");
+    case 0x8032001Bu : return QStringLiteral("FWP_E_INCOMPATIBLE_SA_STATE");
+    case 0x8032001Cu : return QStringLiteral("FWP_E_NULL_POINTER");
+    case 0x8032001Du : return QStringLiteral("FWP_E_INVALID_ENUMERATOR");
+    case 0x8032001Eu : return QStringLiteral("FWP_E_INVALID_FLAGS");
+    case 0x8032001Fu : return QStringLiteral("FWP_E_INVALID_NET_MASK");
+    case 0x80320020u : return QStringLiteral("FWP_E_INVALID_RANGE");
+    case 0x80320021u : return QStringLiteral("FWP_E_INVALID_INTERVAL");
+    case 0x80320022u : return QStringLiteral("FWP_E_ZERO_LENGTH_ARRAY");
+    case 0x80320023u : return QStringLiteral("FWP_E_NULL_DISPLAY_NAME");
+    case 0x80320024u : return QStringLiteral("FWP_E_INVALID_ACTION_TYPE");
+    case 0x80320025u : return QStringLiteral("FWP_E_INVALID_WEIGHT");
+    case 0x80320026u : return QStringLiteral("FWP_E_MATCH_TYPE_MISMATCH");
+    case 0x80320027u : return QStringLiteral("FWP_E_TYPE_MISMATCH");
+    case 0x80320028u : return QStringLiteral("FWP_E_OUT_OF_BOUNDS");
+    case 0x80320029u : return QStringLiteral("FWP_E_RESERVED");
+    case 0x8032002Au : return QStringLiteral("FWP_E_DUPLICATE_CONDITION");
+    case 0x8032002Bu : return QStringLiteral("FWP_E_DUPLICATE_KEYMOD");
+    case 0x8032002Cu : return QStringLiteral("FWP_E_ACTION_INCOMPATIBLE_WITH_LAYER");
+    case 0x8032002Du : return QStringLiteral("FWP_E_ACTION_INCOMPATIBLE_WITH_SUBLAYER");
+    case 0x8032002Eu : return QStringLiteral("FWP_E_CONTEXT_INCOMPATIBLE_WITH_LAYER");
+    case 0x8032002Fu : return QStringLiteral("FWP_E_CONTEXT_INCOMPATIBLE_WITH_CALLOUT");
+    case 0x80320030u : return QStringLiteral("FWP_E_INCOMPATIBLE_AUTH_METHOD");
+    case 0x80320031u : return QStringLiteral("FWP_E_INCOMPATIBLE_DH_GROUP");
+    case 0x80320032u : return QStringLiteral("FWP_E_EM_NOT_SUPPORTED");
+    case 0x80320033u : return QStringLiteral("FWP_E_NEVER_MATCH");
+    case 0x80320034u : return QStringLiteral("FWP_E_PROVIDER_CONTEXT_MISMATCH");
+    case 0x80320035u : return QStringLiteral("FWP_E_INVALID_PARAMETER");
+    case 0x80320036u : return QStringLiteral("FWP_E_TOO_MANY_SUBLAYERS");
+    case 0x80320037u : return QStringLiteral("FWP_E_CALLOUT_NOTIFICATION_FAILED");
+    case 0x80320038u : return QStringLiteral("FWP_E_INVALID_AUTH_TRANSFORM");
+    case 0x80320039u : return QStringLiteral("FWP_E_INVALID_CIPHER_TRANSFORM");
+    default : return QString();
+    }
+}
@@ -0,0 +1,8 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinhresultnames
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwinhresultnames.cpp \
+    hresultswitch.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresultnames.cpp
@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinhresultnames_p.h"
+
+QString hresultSwitchName(quint32 hresult); // generated, see util/hresultnames
+
+// Compares looking up HRESULT names in the generated tables with the
+// switch statement that QtWin::errorStringFromHresult() used to be.
+class tst_QWinHResultNames : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void tableLatin1_data() { lookups(); }
+    void tableLatin1();
+    void tableString_data() { lookups(); }
+    void tableString();
+    void switchString_data() { lookups(); }
+    void switchString();
+    void reverseLookup();
+
+private:
+    static void lookups();
+
+    QVector<quint32> m_known;
+    QVector<quint32> m_unknown;
+};
+
+void tst_QWinHResultNames::initTestCase()
+{
+    for (int i = 0; i < QWinHResultNames::builtInCount(); ++i)
+        m_known.append(QWinHResultNames::builtInValue(i));
+    // Shuffle deterministically, so that branch prediction does not benefit
+    // from the sorted order.
+    for (int i = m_known.size() - 1; i > 0; --i)
+        qSwap(m_known[i], m_known[(i * 7919) % (i + 1)]);
+    for (quint32 hresult : qAsConst(m_known))
+        m_unknown.append(hresult ^ 0x00400000);
+}
+
+void tst_QWinHResultNames::lookups()
+{
+    QTest::addColumn<bool>("known");
+
+    QTest::newRow("known") << true;
+    QTest::newRow("unknown") << false;
+}
+
+void tst_QWinHResultNames::tableLatin1()
+{
+    QFETCH(bool, known);
+    const QVector<quint32> &values = known ? m_known : m_unknown;
+    int total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : values)
+            total += QWinHResultNames::name(hresult).size();
+    }
+    QVERIFY(total >= 0);
+}
+
+void tst_QWinHResultNames::tableString()
+{
+    QFETCH(bool, known);
+    const QVector<quint32> &values = known ? m_known : m_unknown;
+    int total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : values)
+            total += QString(QWinHResultNames::name(hresult)).size();
+    }
+    QVERIFY(total >= 0);
+}
+
+void tst_QWinHResultNames::switchString()
+{
+    QFETCH(bool, known);
+    const QVector<quint32> &values = known ? m_known : m_unknown;
+    int total = 0;
+    QBENCHMARK {
+        for (quint32 hresult : values)
+            total += hresultSwitchName(hresult).size();
+    }
+    QVERIFY(total >= 0);
+}
+
+void tst_QWinHResultNames::reverseLookup()
+{
+    QVector<QLatin1String> names;
+    for (quint32 hresult : qAsConst(m_known))
+        names.append(QWinHResultNames::name(hresult));
+    quint32 total = 0;
+    QBENCHMARK {
+        for (const QLatin1String &name : qAsConst(names)) {
+            quint32 hresult = 0;
+            QWinHResultNames::value(name, &hresult);
+            total += hresult;
+        }
+    }
+    Q_UNUSED(total);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHResultNames)
+
+#include "tst_bench_qwinhresultnames.moc"
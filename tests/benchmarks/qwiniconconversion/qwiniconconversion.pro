@@ -0,0 +1,9 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwiniconconversion
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwiniconconversion.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconconversion.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+#include <QThreadPool>
+#include <QVector>
+
+#include "qwiniconconversion_p.h"
+
+// Measures how the pixel stage of QtWin::toHICONs() and QtWin::fromHICONs()
+// scales with the number of threads.
+class tst_QWinIconConversion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void prepareIconPixels_data() { threadCounts(); }
+    void prepareIconPixels();
+    void applyIconMask_data() { threadCounts(); }
+    void applyIconMask();
+
+private:
+    static void threadCounts();
+};
+
+enum { IconCount = 256, IconSize = 256 };
+
+void tst_QWinIconConversion::threadCounts()
+{
+    QTest::addColumn<int>("threads");
+
+    const int ideal = QThread::idealThreadCount();
+    for (int threads = 1; threads < ideal; threads *= 2)
+        QTest::newRow(QByteArray::number(threads).constData()) << threads;
+    QTest::newRow(QByteArray::number(ideal).constData()) << ideal;
+}
+
+static QImage testIcon(int seed)
+{
+    QImage image(IconSize, IconSize, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < IconSize; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < IconSize; ++x)
+            line[x] = qPremultiply(qRgba(x + seed, y, seed, (x * y + seed) & 0xff));
+    }
+    return image;
+}
+
+void tst_QWinIconConversion::prepareIconPixels()
+{
+    QFETCH(int, threads);
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    const int maskBytesPerLine = QWinIconConversion::maskBytesPerLine(IconSize);
+    QVector<QImage> icons;
+    QVector<QByteArray> colors;
+    QVector<QByteArray> masks;
+    for (int i = 0; i < IconCount; ++i) {
+        icons.append(testIcon(i));
+        colors.append(QByteArray(IconSize * IconSize * 4, 0));
+        masks.append(QByteArray(maskBytesPerLine * IconSize, 0));
+    }
+
+    QBENCHMARK {
+        QWinIconConversion::forEach(IconCount, [&](int i) {
+            QWinIconConversion::prepareIconPixels(icons.at(i),
+                                                  reinterpret_cast<uchar *>(colors[i].data()),
+                                                  reinterpret_cast<uchar *>(masks[i].data()),
+                                                  maskBytesPerLine);
+        }, &pool);
+    }
+}
+
+void tst_QWinIconConversion::applyIconMask()
+{
+    QFETCH(int, threads);
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    // Icons without alpha channel take the slow path through the mask. The
+    // pass is destructive, so the measurement includes copying each icon.
+    QImage mask(IconSize, IconSize, QImage::Format_RGB32);
+    for (int y = 0; y < IconSize; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(mask.scanLine(y));
+        for (int x = 0; x < IconSize; ++x)
+            line[x] = (x + y) & 1 ? 0xffffffff : 0xff000000;
+    }
+    QImage opaque(IconSize, IconSize, QImage::Format_ARGB32_Premultiplied);
+    opaque.fill(0);
+
+    QBENCHMARK {
+        QWinIconConversion::forEach(IconCount, [&](int) {
+            QImage icon = opaque.copy();
+            QWinIconConversion::applyIconMask(&icon, mask);
+        }, &pool);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinIconConversion)
+
+#include "tst_bench_qwiniconconversion.moc"
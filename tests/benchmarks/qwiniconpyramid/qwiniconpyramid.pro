@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwiniconpyramid
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwiniconpyramid.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconpyramid.cpp
@@ -0,0 +1,138 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QIcon>
+#include <QIconEngine>
+#include <QImage>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPixmap>
+#include <QPixmapCache>
+#include <QRadialGradient>
+
+#include "qwiniconpyramid_p.h"
+
+// Compares producing the full set of shell icon sizes with one QIcon::pixmap()
+// call per size against rendering once and deriving the rest.
+class tst_QWinIconPyramid : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void iconPixmaps_data() { icons(); }
+    void iconPixmaps();
+    void pyramid_data() { icons(); }
+    void pyramid();
+    void halved();
+
+private:
+    static void icons();
+};
+
+// Stands in for a scalable (SVG) icon, which is rendered for every size.
+class PaintedIconEngine : public QIconEngine
+{
+public:
+    void paint(QPainter *painter, const QRect &rect, QIcon::Mode, QIcon::State) override
+    {
+        painter->setRenderHint(QPainter::Antialiasing);
+        QRadialGradient background(rect.center(), rect.width() / 2);
+        background.setColorAt(0, QColor(0x80, 0xc0, 0xff));
+        background.setColorAt(1, QColor(0x10, 0x40, 0x80));
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(background);
+        painter->drawEllipse(rect.adjusted(1, 1, -1, -1));
+
+        QPainterPath path;
+        path.moveTo(rect.left() + rect.width() * 0.25, rect.top() + rect.height() * 0.55);
+        path.cubicTo(rect.left() + rect.width() * 0.4, rect.bottom() - rect.height() * 0.2,
+                     rect.left() + rect.width() * 0.5, rect.top() + rect.height() * 0.3,
+                     rect.right() - rect.width() * 0.2, rect.top() + rect.height() * 0.25);
+        QLinearGradient stroke(rect.topLeft(), rect.bottomRight());
+        stroke.setColorAt(0, Qt::white);
+        stroke.setColorAt(1, QColor(0xff, 0xff, 0xff, 0x80));
+        painter->setPen(QPen(QBrush(stroke), rect.width() / 10.0, Qt::SolidLine, Qt::RoundCap));
+        painter->setBrush(Qt::NoBrush);
+        painter->drawPath(path);
+    }
+
+    QIconEngine *clone() const override { return new PaintedIconEngine; }
+};
+
+void tst_QWinIconPyramid::icons()
+{
+    QTest::addColumn<QIcon>("icon");
+
+    QTest::newRow("painted") << QIcon(new PaintedIconEngine);
+    QIcon pixmapIcon;
+    pixmapIcon.addPixmap(QIcon(new PaintedIconEngine).pixmap(256));
+    QTest::newRow("pixmap") << pixmapIcon;
+}
+
+void tst_QWinIconPyramid::iconPixmaps()
+{
+    QFETCH(QIcon, icon);
+    const QVector<int> sizes = QWinIconPyramid::standardSizes();
+    QBENCHMARK {
+        QPixmapCache::clear(); // QIcon caches scaled pixmaps
+        for (int size : sizes) {
+            const QImage image = icon.pixmap(size).toImage();
+            Q_UNUSED(image);
+        }
+    }
+}
+
+void tst_QWinIconPyramid::pyramid()
+{
+    QFETCH(QIcon, icon);
+    const QVector<int> sizes = QWinIconPyramid::standardSizes();
+    QBENCHMARK {
+        QPixmapCache::clear();
+        const QWinIconPyramid pyramid(icon);
+        for (int size : sizes) {
+            const QImage image = pyramid.image(size);
+            Q_UNUSED(image);
+        }
+    }
+}
+
+void tst_QWinIconPyramid::halved()
+{
+    const QImage image = QIcon(new PaintedIconEngine).pixmap(256).toImage()
+        .convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    QBENCHMARK {
+        const QImage result = QWinIconPyramid::halved(image);
+        Q_UNUSED(result);
+    }
+}
+
+QTEST_MAIN(tst_QWinIconPyramid)
+
+#include "tst_bench_qwiniconpyramid.moc"
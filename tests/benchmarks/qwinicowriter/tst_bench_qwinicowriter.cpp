@@ -0,0 +1,125 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QBuffer>
+#include <QImage>
+#include <QImageWriter>
+
+#include "qwinicowriter_p.h"
+
+// Compares writing a multi-resolution icon file with the native writer
+// against the ico image format plugin.
+class tst_QWinIcoWriter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void native_data() { frameSets(); }
+    void native();
+    void plugin_data() { frameSets(); }
+    void plugin();
+    void encodePng();
+    void encodeBitmap();
+
+private:
+    static void frameSets();
+};
+
+static QImage testImage(int size)
+{
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < size; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < size; ++x) {
+            const int dx = x - size / 2;
+            const int dy = y - size / 2;
+            const int alpha = qBound(0, 255 - (dx * dx + dy * dy) * 1024 / (size * size), 255);
+            line[x] = qPremultiply(qRgba(x * 255 / size, y * 255 / size, 0x80, alpha));
+        }
+    }
+    return image;
+}
+
+void tst_QWinIcoWriter::frameSets()
+{
+    QTest::addColumn<QVector<QImage> >("frames");
+
+    QTest::newRow("16") << (QVector<QImage>() << testImage(16));
+    QTest::newRow("16,32") << (QVector<QImage>() << testImage(16) << testImage(32));
+    QTest::newRow("16,20,24,32,48,64,256")
+        << (QVector<QImage>() << testImage(16) << testImage(20) << testImage(24) << testImage(32)
+                              << testImage(48) << testImage(64) << testImage(256));
+}
+
+void tst_QWinIcoWriter::native()
+{
+    QFETCH(QVector<QImage>, frames);
+    QBENCHMARK {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        QWinIcoWriter::write(&buffer, frames);
+    }
+}
+
+void tst_QWinIcoWriter::plugin()
+{
+    QFETCH(QVector<QImage>, frames);
+    if (!QImageWriter::supportedImageFormats().contains("ico"))
+        QSKIP("The ico image format plugin is not available.");
+    // The plugin writes one image per call; QPixmap::save() wrote a single
+    // size this way.
+    QBENCHMARK {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        QImageWriter writer(&buffer, "ico");
+        writer.write(frames.constLast());
+    }
+}
+
+void tst_QWinIcoWriter::encodePng()
+{
+    const QImage image = testImage(256);
+    QBENCHMARK {
+        const QByteArray png = QWinIcoWriter::encodePng(image);
+        Q_UNUSED(png);
+    }
+}
+
+void tst_QWinIcoWriter::encodeBitmap()
+{
+    const QImage image = testImage(48);
+    QBENCHMARK {
+        const QByteArray bitmap = QWinIcoWriter::encodeBitmap(image);
+        Q_UNUSED(bitmap);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinIcoWriter)
+
+#include "tst_bench_qwinicowriter.moc"
@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistcommitter_p.h"
+
+// Compares the time the GUI thread spends committing a jump list of 10000
+// items itself with handing it to the committer, and measures how many
+// commits run when snapshots are submitted faster than they are committed.
+class tst_QWinJumpListCommitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void guiThread_data();
+    void guiThread();
+    void bursts();
+
+private:
+    QWinJumpListSnapshot m_snapshot;
+};
+
+// Stand-in for the shell: builds every shell link's argument string, which
+// is a fraction of what creating the links costs.
+class StandInBackend : public QWinJumpListCommitter::Backend
+{
+public:
+    QWinJumpListCommitter::Result commit(const QWinJumpListSnapshot &snapshot,
+                                         const std::function<bool()> &isSuperseded) override
+    {
+        int total = 0;
+        for (const QWinJumpListSnapshot::Category &category : snapshot.categories()) {
+            if (isSuperseded && isSuperseded())
+                return QWinJumpListCommitter::Aborted;
+            for (const QWinJumpListSnapshot::Item &item : category.items)
+                total += item.arguments.join(QLatin1Char(' ')).size() + item.title.size();
+        }
+        return total > 0 ? QWinJumpListCommitter::Committed : QWinJumpListCommitter::Failed;
+    }
+};
+
+void tst_QWinJumpListCommitter::initTestCase()
+{
+    m_snapshot = QWinJumpListSnapshot(QStringLiteral("org.qt-project.app"));
+    for (int c = 0; c < 10; ++c) {
+        QWinJumpListSnapshot::Category category;
+        category.title = QStringLiteral("Category %1").arg(c);
+        category.visible = true;
+        for (int i = 0; i < 1000; ++i) {
+            QWinJumpListSnapshot::Item item;
+            item.type = QWinJumpListSnapshot::Link;
+            item.title = QStringLiteral("Document %1").arg(i);
+            item.arguments = QStringList{ QStringLiteral("--open"),
+                                          QStringLiteral("C:/Users/user/Documents/document%1.txt").arg(i) };
+            category.items.append(item);
+        }
+        m_snapshot.appendCategory(category);
+    }
+}
+
+void tst_QWinJumpListCommitter::guiThread_data()
+{
+    QTest::addColumn<bool>("asynchronous");
+
+    QTest::newRow("synchronous") << false;
+    QTest::newRow("asynchronous") << true;
+}
+
+void tst_QWinJumpListCommitter::guiThread()
+{
+    QFETCH(bool, asynchronous);
+
+    if (!asynchronous) {
+        StandInBackend backend;
+        QBENCHMARK {
+            QCOMPARE(backend.commit(m_snapshot, std::function<bool()>()), QWinJumpListCommitter::Committed);
+        }
+        return;
+    }
+
+    QWinJumpListCommitter committer(new StandInBackend);
+    QBENCHMARK {
+        committer.submit(m_snapshot);
+    }
+    QVERIFY(committer.waitForIdle());
+}
+
+void tst_QWinJumpListCommitter::bursts()
+{
+    QWinJumpListCommitter committer(new StandInBackend);
+    QBENCHMARK {
+        QFuture<bool> last;
+        for (int i = 0; i < 100; ++i)
+            last = committer.submit(m_snapshot);
+        last.waitForFinished();
+        QCOMPARE(last.result(), true);
+    }
+    // Every submission is either committed or superseded by a later one.
+    QVERIFY(committer.waitForIdle());
+    const QWinJumpListCommitter::Statistics statistics = committer.statistics();
+    QCOMPARE(statistics.failed, quint64(0));
+    QVERIFY(statistics.committed > 0);
+    QCOMPARE(statistics.committed + statistics.superseded, statistics.submitted);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinJumpListCommitter)
+
+#include "tst_bench_qwinjumplistcommitter.moc"
@@ -0,0 +1,9 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinjumplistmodelmapper
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistmodelmapper_p.h
+SOURCES += \
+    tst_bench_qwinjumplistmodelmapper.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistmodelmapper.cpp
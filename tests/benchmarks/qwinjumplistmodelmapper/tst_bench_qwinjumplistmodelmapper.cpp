@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/QStandardItemModel>
+
+#include "qwinjumplistmodelmapper_p.h"
+
+// Counts what reaches the category.
+class StandInSink : public QWinJumpListModelMapper::Sink
+{
+public:
+    void insertItems(int, int count) override { items += count; }
+    void removeItems(int, int count) override { items -= count; }
+    void setField(int, QWinJumpListModelMapper::Field, const QVariant &) override { ++fieldsSet; }
+
+    int items = 0;
+    int fieldsSet = 0;
+};
+
+class tst_QWinJumpListModelMapper : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void changeRow_data();
+    void changeRow();
+};
+
+void tst_QWinJumpListModelMapper::changeRow_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("incremental");
+
+    for (int count : { 10, 100, 1000 }) {
+        const QByteArray name = QByteArray::number(count);
+        QTest::newRow(name + "/rebuilt") << count << false;
+        QTest::newRow(name + "/incremental") << count << true;
+    }
+}
+
+// Renames one row of a model, comparing the category following the change
+// of the row with the category making all of its items again, as when the
+// items are cleared and added whenever the model changes.
+void tst_QWinJumpListModelMapper::changeRow()
+{
+    QFETCH(int, count);
+    QFETCH(bool, incremental);
+
+    QStandardItemModel model;
+    for (int i = 0; i < count; ++i) {
+        QStandardItem *item = new QStandardItem(QStringLiteral("Document %1").arg(i));
+        item->setData(QStringLiteral("C:/Users/user/Documents/document %1.txt").arg(i), Qt::UserRole);
+        item->setData(QStringList{QStringLiteral("--open"), QString::number(i)}, Qt::UserRole + 1);
+        model.appendRow(item);
+    }
+    StandInSink sink;
+    QWinJumpListModelMapper mapper(&sink);
+    if (incremental)
+        mapper.setModel(&model);
+
+    int revision = 0;
+    QBENCHMARK {
+        QStandardItem *item = model.item(revision % count);
+        item->setText(QStringLiteral("Renamed %1").arg(++revision));
+        if (!incremental) {
+            mapper.setModel(&model);
+            mapper.setModel(nullptr);
+        }
+    }
+    QCOMPARE(sink.items, incremental ? count : 0);
+}
+
+QTEST_MAIN(tst_QWinJumpListModelMapper)
+
+#include "tst_bench_qwinjumplistmodelmapper.moc"
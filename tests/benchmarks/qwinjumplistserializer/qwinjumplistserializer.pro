@@ -0,0 +1,9 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinjumplistserializer
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwidestringarena.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
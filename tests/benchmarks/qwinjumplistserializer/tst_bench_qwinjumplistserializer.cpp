@@ -0,0 +1,256 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistserializer_p.h"
+#include "qwincommandline_p.h"
+
+// Counts heap allocations of the whole process by interposing the allocator
+// of glibc, which QString and operator new end up in.
+#if defined(__GLIBC__)
+#  define COUNTS_ALLOCATIONS
+static QBasicAtomicInt allocationCount = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+
+void *malloc(size_t size) __THROW
+{
+    allocationCount.ref();
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) __THROW
+{
+    allocationCount.ref();
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) __THROW
+{
+    allocationCount.ref();
+    return __libc_realloc(pointer, size);
+}
+}
+#endif
+
+// Stands in for IShellLinkW, which copies every string it is given.
+class StandInLink
+{
+public:
+    template <typename Char>
+    void setString(const Char *string)
+    {
+        if (!string)
+            return;
+        for (; *string; ++string)
+            m_checksum = m_checksum * 31 + uint(*string);
+    }
+
+    uint checksum() const { return m_checksum; }
+
+private:
+    uint m_checksum = 0;
+};
+
+static QString iconPath(const QVector<QImage> &)
+{
+    static const QString path = QDir::tempPath() + QLatin1String("/app/qt-jl-icons/da39a3ee5e6b4b0d3255bfef95601890afd80709.ico");
+    return path;
+}
+
+// The serialization QWinJumpList used before: a buffer per link sized for
+// its longest string, the arguments and the icon path as temporary strings
+// and an icon lookup per link.
+static void legacySerialize(const QWinJumpListSnapshot::Item &item, StandInLink *link)
+{
+    const QString args = QWinCommandLine::join(item.arguments);
+    QString iconPath;
+    if (!item.iconFrames.isEmpty())
+        iconPath = ::iconPath(item.iconFrames);
+    const int bufferSize = qMax(args.size(),
+                                qMax(item.workingDirectory.size(),
+                                     qMax(item.description.size(),
+                                          qMax(item.title.size(),
+                                               qMax(item.filePath.size(), iconPath.size()))))) + 1;
+    wchar_t *buffer = new wchar_t[bufferSize];
+    if (!item.description.isEmpty()) {
+        buffer[item.description.toWCharArray(buffer)] = 0;
+        link->setString(buffer);
+    }
+    buffer[item.filePath.toWCharArray(buffer)] = 0;
+    link->setString(buffer);
+    if (!item.workingDirectory.isEmpty()) {
+        buffer[item.workingDirectory.toWCharArray(buffer)] = 0;
+        link->setString(buffer);
+    }
+    buffer[args.toWCharArray(buffer)] = 0;
+    link->setString(buffer);
+    if (!iconPath.isEmpty()) {
+        buffer[QDir::toNativeSeparators(iconPath).toWCharArray(buffer)] = 0;
+        link->setString(buffer);
+    }
+    buffer[item.title.toWCharArray(buffer)] = 0;
+    link->setString(buffer);
+    delete[] buffer;
+}
+
+static void serialize(QWinJumpListSerializer *serializer, const QWinJumpListSnapshot::Item &item,
+                      StandInLink *link)
+{
+    const QWinJumpListSerializer::Link fields = serializer->link(item);
+    link->setString(fields.description);
+    link->setString(fields.path);
+    link->setString(fields.workingDirectory);
+    link->setString(fields.arguments);
+    link->setString(fields.iconLocation);
+    link->setString(fields.title);
+}
+
+class tst_QWinJumpListSerializer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void commit_data();
+    void commit();
+    void allocations_data();
+    void allocations();
+
+private:
+    static void addRows();
+    static QVector<QWinJumpListSnapshot::Item> items(int count);
+    static uint runCommit(bool legacy, QWinJumpListSerializer *serializer,
+                          const QVector<QWinJumpListSnapshot::Item> &list);
+};
+
+// Items as taken from a model, with a few distinct icons.
+QVector<QWinJumpListSnapshot::Item> tst_QWinJumpListSerializer::items(int count)
+{
+    const QString program = QDir::tempPath() + QLatin1String("/app/app.exe");
+    QVector<QWinJumpListSnapshot::Item> result;
+    result.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        QWinJumpListSnapshot::Item item;
+        item.type = QWinJumpListSnapshot::Link;
+        item.filePath = program;
+        item.workingDirectory = QDir::homePath();
+        item.title = QStringLiteral("Document %1").arg(i);
+        item.description = QStringLiteral("Opens document %1 in a new window").arg(i);
+        item.arguments = QStringList{ QStringLiteral("--new-window"),
+                                      QStringLiteral("C:\\Users\\user\\My Documents\\document %1.txt").arg(i) };
+        item.iconKey = i % 4 + 1;
+        item.iconFrames.append(QImage(16, 16, QImage::Format_ARGB32));
+        result.append(item);
+    }
+    return result;
+}
+
+uint tst_QWinJumpListSerializer::runCommit(bool legacy, QWinJumpListSerializer *serializer,
+                                           const QVector<QWinJumpListSnapshot::Item> &list)
+{
+    StandInLink link;
+    if (legacy) {
+        for (const QWinJumpListSnapshot::Item &item : list)
+            legacySerialize(item, &link);
+    } else {
+        serializer->begin();
+        for (const QWinJumpListSnapshot::Item &item : list)
+            serialize(serializer, item, &link);
+    }
+    return link.checksum();
+}
+
+void tst_QWinJumpListSerializer::addRows()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("legacy");
+
+    for (int count : { 10, 100, 1000 }) {
+        const QByteArray name = QByteArray::number(count);
+        QTest::newRow(name + "/legacy") << count << true;
+        QTest::newRow(name + "/arena") << count << false;
+    }
+}
+
+void tst_QWinJumpListSerializer::commit_data()
+{
+    addRows();
+}
+
+void tst_QWinJumpListSerializer::commit()
+{
+    QFETCH(int, count);
+    QFETCH(bool, legacy);
+
+    const QVector<QWinJumpListSnapshot::Item> list = items(count);
+    QWinJumpListSerializer serializer(iconPath);
+    uint checksum = 0;
+    QBENCHMARK {
+        checksum += runCommit(legacy, &serializer, list);
+    }
+    Q_UNUSED(checksum);
+}
+
+void tst_QWinJumpListSerializer::allocations_data()
+{
+    addRows();
+}
+
+// Reports the allocations per item of a commit once the serializer has
+// settled; the first commit grows the arena, the second merges its chunks.
+void tst_QWinJumpListSerializer::allocations()
+{
+#ifdef COUNTS_ALLOCATIONS
+    QFETCH(int, count);
+    QFETCH(bool, legacy);
+
+    const QVector<QWinJumpListSnapshot::Item> list = items(count);
+    QWinJumpListSerializer serializer(iconPath);
+    iconPath(QVector<QImage>());
+    runCommit(legacy, &serializer, list);
+    runCommit(legacy, &serializer, list);
+
+    const int before = allocationCount.load();
+    runCommit(legacy, &serializer, list);
+    const int allocations = allocationCount.load() - before;
+
+    QTest::setBenchmarkResult(qreal(allocations) / count, QTest::Events);
+    if (!legacy)
+        QCOMPARE(allocations, 0);
+#else
+    QSKIP("Counting allocations requires glibc");
+#endif
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListSerializer)
+
+#include "tst_bench_qwinjumplistserializer.moc"
@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistsnapshot_p.h"
+
+typedef QWinJumpListSnapshot Snapshot;
+typedef QWinJumpListDiff Diff;
+
+// Measures what deciding whether to rebuild costs for a jump list model of
+// 10000 items: taking the snapshot, and diffing it against the committed
+// one when nothing, the last item or the first category changed.
+class tst_QWinJumpListSnapshot : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void takeSnapshot();
+    void diff_data();
+    void diff();
+
+private:
+    QVector<Snapshot::Category> m_categories;
+};
+
+static const int categoryCount = 10;
+static const int itemsPerCategory = 1000;
+
+static Snapshot model(const QVector<Snapshot::Category> &categories)
+{
+    Snapshot snapshot(QStringLiteral("org.qt-project.app"));
+    for (const Snapshot::Category &category : categories)
+        snapshot.appendCategory(category);
+    return snapshot;
+}
+
+void tst_QWinJumpListSnapshot::initTestCase()
+{
+    for (int c = 0; c < categoryCount; ++c) {
+        Snapshot::Category category;
+        category.title = QStringLiteral("Category %1").arg(c);
+        category.visible = true;
+        for (int i = 0; i < itemsPerCategory; ++i) {
+            Snapshot::Item item;
+            item.type = Snapshot::Link;
+            item.title = QStringLiteral("Document %1").arg(i);
+            item.filePath = QStringLiteral("C:/Program Files/App/app.exe");
+            item.workingDirectory = QStringLiteral("C:/Users/user/Documents");
+            item.arguments = QStringList{ QStringLiteral("--open"),
+                                          QStringLiteral("C:/Users/user/Documents/%1/document%2.txt").arg(c).arg(i) };
+            item.iconKey = c + 1;
+            category.items.append(item);
+        }
+        m_categories.append(category);
+    }
+}
+
+void tst_QWinJumpListSnapshot::takeSnapshot()
+{
+    QBENCHMARK {
+        // Copies the strings as taking a snapshot of the live model does.
+        QVector<Snapshot::Category> categories = m_categories;
+        for (Snapshot::Category &category : categories) {
+            for (Snapshot::Item &item : category.items)
+                item.title = QString(item.title.constData(), item.title.size());
+        }
+        const Snapshot snapshot = model(categories);
+        QCOMPARE(snapshot.itemCount(), categoryCount * itemsPerCategory);
+    }
+}
+
+void tst_QWinJumpListSnapshot::diff_data()
+{
+    QTest::addColumn<int>("change");
+
+    QTest::newRow("unchanged") << 0;
+    QTest::newRow("last item") << 1;
+    QTest::newRow("first category") << 2;
+}
+
+void tst_QWinJumpListSnapshot::diff()
+{
+    QFETCH(int, change);
+
+    QVector<Snapshot::Category> categories = m_categories;
+    if (change == 1)
+        categories.last().items.last().description = QStringLiteral("changed");
+    else if (change == 2)
+        categories.first().title = QStringLiteral("Renamed");
+
+    // Detach every string so that equal items are compared character by
+    // character, as they are after taking a new snapshot.
+    for (Snapshot::Category &category : categories) {
+        for (Snapshot::Item &item : category.items) {
+            item.title = QString(item.title.constData(), item.title.size());
+            item.arguments[1] = QString(item.arguments.at(1).constData(), item.arguments.at(1).size());
+        }
+    }
+    const Snapshot committed = model(m_categories);
+    const Snapshot current = model(categories);
+
+    QBENCHMARK {
+        const Diff diff = Diff::compute(committed, current);
+        QCOMPARE(diff.isEmpty(), change == 0);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListSnapshot)
+
+#include "tst_bench_qwinjumplistsnapshot.moc"
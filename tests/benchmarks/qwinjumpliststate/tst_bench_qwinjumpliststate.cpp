@@ -0,0 +1,148 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumpliststate_p.h"
+
+// Measures what the startup check of QWinJumpList adds to its first rebuild:
+// saving the model, which hashes the pixels of every distinct icon once, and
+// comparing fingerprints. Restoring is the other use of the format.
+class tst_QWinJumpListState : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void save_data();
+    void save();
+    void startupCheck_data();
+    void startupCheck();
+    void restore_data();
+    void restore();
+
+private:
+    static QWinJumpListSnapshot model(int itemCount);
+};
+
+// Links spread over categories of 10, sharing 8 icons of two sizes each.
+QWinJumpListSnapshot tst_QWinJumpListState::model(int itemCount)
+{
+    QVector<QVector<QImage>> icons;
+    for (int i = 0; i < 8; ++i) {
+        QImage small(16, 16, QImage::Format_ARGB32);
+        small.fill(qRgba(i * 30, 0, 0, 255));
+        QImage large(32, 32, QImage::Format_ARGB32);
+        large.fill(qRgba(i * 30, 0, 0, 255));
+        icons.append(QVector<QImage>{ small, large });
+    }
+
+    QWinJumpListSnapshot snapshot(QStringLiteral("org.qt-project.app"));
+    QWinJumpListSnapshot::Category category;
+    category.visible = true;
+    for (int i = 0; i < itemCount; ++i) {
+        QWinJumpListSnapshot::Item item;
+        item.type = QWinJumpListSnapshot::Link;
+        item.filePath = QStringLiteral("C:/Program Files/App/app.exe");
+        item.title = QStringLiteral("Document %1").arg(i);
+        item.description = QStringLiteral("Opens document %1").arg(i);
+        item.arguments = QStringList{ QStringLiteral("--open"),
+                                      QStringLiteral("C:/Users/user/Documents/document %1.txt").arg(i) };
+        item.iconKey = i % icons.size() + 1;
+        item.iconFrames = icons.at(i % icons.size());
+        category.items.append(item);
+        if (category.items.size() == 10 || i == itemCount - 1) {
+            category.title = QStringLiteral("Category %1").arg(i / 10);
+            snapshot.appendCategory(category);
+            category.items.clear();
+        }
+    }
+    return snapshot;
+}
+
+void tst_QWinJumpListState::save_data()
+{
+    QTest::addColumn<int>("itemCount");
+
+    QTest::newRow("10") << 10;
+    QTest::newRow("100") << 100;
+    QTest::newRow("1000") << 1000;
+}
+
+void tst_QWinJumpListState::save()
+{
+    QFETCH(int, itemCount);
+
+    const QWinJumpListSnapshot snapshot = model(itemCount);
+    QByteArray state;
+    QBENCHMARK {
+        state = QWinJumpListState::save(snapshot);
+    }
+    QVERIFY(!QWinJumpListState::fingerprint(state).isEmpty());
+}
+
+void tst_QWinJumpListState::startupCheck_data()
+{
+    save_data();
+}
+
+// The persisted state is read from memory here; the file is a few
+// kilobytes per hundred items.
+void tst_QWinJumpListState::startupCheck()
+{
+    QFETCH(int, itemCount);
+
+    const QWinJumpListSnapshot snapshot = model(itemCount);
+    const QByteArray persisted = QWinJumpListState::save(snapshot);
+    bool unchanged = false;
+    QBENCHMARK {
+        unchanged = QWinJumpListState::fingerprint(persisted)
+                == QWinJumpListState::fingerprint(QWinJumpListState::save(snapshot));
+    }
+    QVERIFY(unchanged);
+}
+
+void tst_QWinJumpListState::restore_data()
+{
+    save_data();
+}
+
+void tst_QWinJumpListState::restore()
+{
+    QFETCH(int, itemCount);
+
+    const QByteArray state = QWinJumpListState::save(model(itemCount));
+    QWinJumpListSnapshot snapshot;
+    QBENCHMARK {
+        QVERIFY(QWinJumpListState::restore(state, &snapshot));
+    }
+    QCOMPARE(snapshot.itemCount(), itemCount);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListState)
+
+#include "tst_bench_qwinjumpliststate.moc"
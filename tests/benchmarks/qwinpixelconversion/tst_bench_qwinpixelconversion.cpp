@@ -0,0 +1,176 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+
+#include "qwinpixelconversion_p.h"
+
+// Compares the DIB conversion kernels used by QtWin::toHBITMAP() with the
+// generic QImage conversions they replace. The kernel variants include the
+// copy into the (DIB) buffer to make the numbers comparable.
+class tst_QWinPixelConversion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void premultiplyKernel_data() { sizes(); }
+    void premultiplyKernel();
+    void premultiplyQImage_data() { sizes(); }
+    void premultiplyQImage();
+    void unpremultiplyKernel_data() { sizes(); }
+    void unpremultiplyKernel();
+    void unpremultiplyQImage_data() { sizes(); }
+    void unpremultiplyQImage();
+    void alphaToMaskKernel_data();
+    void alphaToMaskKernel();
+    void alphaToMaskQImage_data() { sizes(); }
+    void alphaToMaskQImage();
+
+private:
+    static void sizes();
+};
+
+void tst_QWinPixelConversion::sizes()
+{
+    QTest::addColumn<QSize>("size");
+
+    QTest::newRow("16x16") << QSize(16, 16);
+    QTest::newRow("32x32") << QSize(32, 32);
+    QTest::newRow("48x48") << QSize(48, 48);
+    QTest::newRow("256x256") << QSize(256, 256);
+    QTest::newRow("1280x720") << QSize(1280, 720);
+    QTest::newRow("1920x1080") << QSize(1920, 1080);
+    QTest::newRow("3840x2160") << QSize(3840, 2160);
+}
+
+static QImage testImage(const QSize &size, QImage::Format format)
+{
+    QImage image(size, QImage::Format_ARGB32);
+    for (int y = 0; y < size.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < size.width(); ++x) {
+            // Mostly opaque with translucent edges, like icons and thumbnails.
+            const int alpha = (x < 4 || y < 4) ? (x * 61 + y * 17) & 0xff : 255;
+            line[x] = qRgba(x & 0xff, y & 0xff, (x ^ y) & 0xff, alpha);
+        }
+    }
+    return image.convertToFormat(format);
+}
+
+void tst_QWinPixelConversion::premultiplyKernel()
+{
+    QFETCH(QSize, size);
+    const QImage image = testImage(size, QImage::Format_ARGB32);
+    QByteArray buffer(int(image.sizeInBytes()), Qt::Uninitialized);
+    uchar *bits = reinterpret_cast<uchar *>(buffer.data());
+    QBENCHMARK {
+        memcpy(bits, image.constBits(), size_t(buffer.size()));
+        QWinPixelConversion::premultiplyRows(bits, size.width(), size.height(), size.width() * 4);
+    }
+}
+
+void tst_QWinPixelConversion::premultiplyQImage()
+{
+    QFETCH(QSize, size);
+    const QImage image = testImage(size, QImage::Format_ARGB32);
+    QBENCHMARK {
+        const QImage converted = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        Q_UNUSED(converted);
+    }
+}
+
+void tst_QWinPixelConversion::unpremultiplyKernel()
+{
+    QFETCH(QSize, size);
+    const QImage image = testImage(size, QImage::Format_ARGB32_Premultiplied);
+    QByteArray buffer(int(image.sizeInBytes()), Qt::Uninitialized);
+    uchar *bits = reinterpret_cast<uchar *>(buffer.data());
+    QBENCHMARK {
+        memcpy(bits, image.constBits(), size_t(buffer.size()));
+        QWinPixelConversion::unpremultiplyRows(bits, size.width(), size.height(), size.width() * 4);
+    }
+}
+
+void tst_QWinPixelConversion::unpremultiplyQImage()
+{
+    QFETCH(QSize, size);
+    const QImage image = testImage(size, QImage::Format_ARGB32_Premultiplied);
+    QBENCHMARK {
+        const QImage converted = image.convertToFormat(QImage::Format_ARGB32);
+        Q_UNUSED(converted);
+    }
+}
+
+void tst_QWinPixelConversion::alphaToMaskKernel_data()
+{
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<int>("implementation");
+
+    const QSize sizes[] = { QSize(32, 32), QSize(256, 256), QSize(1920, 1080) };
+    const char *names[] = { "scalar", "sse2", "avx2", "neon" };
+    for (int implementation = QWinPixelConversion::Scalar; implementation <= QWinPixelConversion::Neon; ++implementation) {
+        if (!QWinPixelConversion::isAvailable(QWinPixelConversion::Implementation(implementation)))
+            continue;
+        for (const QSize &size : sizes) {
+            QTest::addRow("%s-%dx%d", names[implementation], size.width(), size.height())
+                << size << implementation;
+        }
+    }
+}
+
+void tst_QWinPixelConversion::alphaToMaskKernel()
+{
+    QFETCH(QSize, size);
+    QFETCH(int, implementation);
+    const QImage image = testImage(size, QImage::Format_ARGB32_Premultiplied);
+    const int maskBytesPerLine = QWinPixelConversion::maskBytesPerLine(size.width());
+    QByteArray mask(maskBytesPerLine * size.height(), Qt::Uninitialized);
+    QBENCHMARK {
+        QWinPixelConversion::alphaToMask(image.constBits(), size.width(), size.height(),
+                                         image.bytesPerLine(), reinterpret_cast<uchar *>(mask.data()),
+                                         maskBytesPerLine, 128, QWinPixelConversion::MaskTransparent,
+                                         QWinPixelConversion::Implementation(implementation));
+    }
+}
+
+// What QtWin::createMask(QBitmap::fromImage(image.createAlphaMask())) and
+// QPixmap::mask() do before the bits reach GDI.
+void tst_QWinPixelConversion::alphaToMaskQImage()
+{
+    QFETCH(QSize, size);
+    const QImage image = testImage(size, QImage::Format_ARGB32_Premultiplied);
+    QBENCHMARK {
+        QImage mask = image.createAlphaMask().convertToFormat(QImage::Format_Mono);
+        mask.invertPixels();
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinPixelConversion)
+
+#include "tst_bench_qwinpixelconversion.moc"
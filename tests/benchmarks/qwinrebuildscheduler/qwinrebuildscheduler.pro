@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinrebuildscheduler
+QT = core testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwinrebuildscheduler.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinrebuildscheduler.cpp
@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinrebuildscheduler_p.h"
+
+Q_DECLARE_METATYPE(QWinRebuildScheduler::Policy)
+
+// Simulates adding recent documents in bursts, with a rebuild costing about
+// as much as recommitting a jump list of 50 items, and compares the time
+// spent rebuilding and the number of rebuilds for each policy.
+class tst_QWinRebuildScheduler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void bursts_data();
+    void bursts();
+};
+
+static const int burstCount = 20;
+static const int burstSize = 50;
+
+// Stand-in for a rebuild: builds every shell link's argument string.
+static int rebuild()
+{
+    int total = 0;
+    for (int i = 0; i < burstSize; ++i) {
+        const QString arguments = QStringLiteral("--open \"C:/Users/user/Documents/document%1.txt\"").arg(i);
+        total += arguments.size();
+    }
+    return total;
+}
+
+void tst_QWinRebuildScheduler::bursts_data()
+{
+    QTest::addColumn<QWinRebuildScheduler::Policy>("policy");
+    QTest::addColumn<int>("minimumInterval");
+    QTest::addColumn<int>("executed"); // rebuilds per run
+
+    QTest::newRow("immediate") << QWinRebuildScheduler::Immediate << 0 << burstCount * burstSize;
+    // The first change of a burst and, 100 ms later, the rest.
+    QTest::newRow("immediate, 100 ms apart") << QWinRebuildScheduler::Immediate << 100 << burstCount * 2;
+    QTest::newRow("queued") << QWinRebuildScheduler::Queued << 0 << burstCount * burstSize;
+    QTest::newRow("debounced") << QWinRebuildScheduler::Debounced << 0 << burstCount;
+}
+
+void tst_QWinRebuildScheduler::bursts()
+{
+    QFETCH(QWinRebuildScheduler::Policy, policy);
+    QFETCH(int, minimumInterval);
+    QFETCH(int, executed);
+
+    int total = 0;
+    qint64 now = 0;
+    qint64 timerDeadline = -1;
+    QWinRebuildScheduler scheduler([&total]() { total += rebuild(); });
+    scheduler.setClock([&now]() { return now; });
+    scheduler.setTimer([&now, &timerDeadline](int msec) { timerDeadline = msec < 0 ? -1 : now + msec; });
+    scheduler.setPolicy(policy);
+    scheduler.setMinimumInterval(minimumInterval);
+
+    QBENCHMARK {
+        scheduler.resetCounters();
+        // Each burst adds one document per event loop pass, 1 ms apart,
+        // and is followed by a second without changes.
+        for (int burst = 0; burst < burstCount; ++burst) {
+            for (int i = 0; i < burstSize + 1000; ++i) {
+                if (i < burstSize)
+                    scheduler.request();
+                ++now;
+                if (timerDeadline >= 0 && now >= timerDeadline) {
+                    timerDeadline = -1;
+                    scheduler.timeout();
+                }
+            }
+        }
+    }
+    QVERIFY(total > 0);
+    QCOMPARE(scheduler.requestedCount(), quint64(burstCount * burstSize));
+    QCOMPARE(scheduler.executedCount(), quint64(executed));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRebuildScheduler)
+
+#include "tst_bench_qwinrebuildscheduler.moc"
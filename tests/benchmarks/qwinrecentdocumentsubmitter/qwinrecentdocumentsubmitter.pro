@@ -0,0 +1,10 @@
+CONFIG += benchmark
+TARGET = tst_bench_qwinrecentdocumentsubmitter
+QT = core gui testlib
+include(../../shared/winextras-portable.pri)
+SOURCES += \
+    tst_bench_qwinrecentdocumentsubmitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinrecentdocumentsubmitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistserializer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwidestringarena.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
@@ -0,0 +1,107 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinrecentdocumentsubmitter_p.h"
+
+// Stands in for creating a shell link and SHAddToRecentDocs() by keeping
+// the thread busy for 50 microseconds per document.
+class StandInSink : public QWinRecentDocumentSubmitter::Sink
+{
+public:
+    bool add(const QChar *, const QWinJumpListSerializer::Link &) override
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.nsecsElapsed() < 50000)
+            ;
+        return true;
+    }
+};
+
+class tst_QWinRecentDocumentSubmitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void addDocuments_data();
+    void addDocuments();
+};
+
+void tst_QWinRecentDocumentSubmitter::addDocuments_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("batched");
+
+    for (int count : { 100, 500 }) {
+        const QByteArray name = QByteArray::number(count);
+        QTest::newRow(name + "/one by one") << count << false;
+        QTest::newRow(name + "/batched") << count << true;
+    }
+}
+
+// Measures how long the calling thread, usually the GUI thread, is busy
+// when adding documents to a recent category, as when restoring a session.
+// Every other document is a duplicate.
+void tst_QWinRecentDocumentSubmitter::addDocuments()
+{
+    QFETCH(int, count);
+    QFETCH(bool, batched);
+
+    QVector<QWinJumpListSnapshot::Item> items;
+    for (int i = 0; i < count; ++i) {
+        QWinJumpListSnapshot::Item item;
+        item.type = QWinJumpListSnapshot::Link;
+        item.filePath = QStringLiteral("C:/Users/user/Documents/document %1.txt").arg(i / 2);
+        item.title = item.filePath;
+        items.append(item);
+    }
+
+    QWinRecentDocumentSubmitter submitter(new StandInSink);
+    StandInSink sink;
+    QWinJumpListSerializer serializer;
+    QElapsedTimer timer;
+    timer.start();
+    if (batched) {
+        submitter.submit(QString(), items);
+    } else {
+        // What addItem() does for every item.
+        for (const QWinJumpListSnapshot::Item &item : qAsConst(items)) {
+            serializer.begin();
+            sink.add(nullptr, serializer.link(item));
+        }
+    }
+    const qint64 elapsed = timer.nsecsElapsed();
+    QVERIFY(submitter.waitForIdle());
+    QTest::setBenchmarkResult(qreal(elapsed) / 1000000, QTest::WalltimeMilliseconds);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRecentDocumentSubmitter)
+
+#include "tst_bench_qwinrecentdocumentsubmitter.moc"
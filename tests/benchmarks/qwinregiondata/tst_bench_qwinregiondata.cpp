@@ -0,0 +1,232 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QImage>
+#include <QRegion>
+
+#include "qwinregiondata_p.h"
+
+// Compares converting regions of up to 10000 rectangles through one RGNDATA
+// buffer against uniting them one rectangle at a time, which is what
+// QtWin::fromHRGN() used to do, and measures simplifying such regions and
+// extracting them from the alpha channel of 4K images.
+class tst_QWinRegionData : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encode_data() { regions(); }
+    void encode();
+    void decode_data() { regions(); }
+    void decode();
+    void perRectUnion_data() { regions(); }
+    void perRectUnion();
+    void simplified_data();
+    void simplified();
+    void rectsFromAlpha_data();
+    void rectsFromAlpha();
+    void spanUnion_data();
+    void spanUnion();
+
+private:
+    static void regions();
+};
+
+static QRegion checkerboard(int columns, int rows)
+{
+    QVector<QRect> rects;
+    for (int row = 0; row < rows; ++row) {
+        for (int column = row & 1; column < 2 * columns; column += 2)
+            rects.append(QRect(column * 4, row * 4, 4, 4));
+    }
+    QRegion region;
+    region.setRects(rects.constData(), rects.size());
+    return region;
+}
+
+void tst_QWinRegionData::regions()
+{
+    QTest::addColumn<QRegion>("region");
+
+    QTest::newRow("100") << checkerboard(10, 10);
+    QTest::newRow("1000") << checkerboard(25, 40);
+    QTest::newRow("10000") << checkerboard(100, 100);
+}
+
+void tst_QWinRegionData::encode()
+{
+    QFETCH(QRegion, region);
+    QBENCHMARK {
+        const QByteArray data = QWinRegionData::encode(region);
+        Q_UNUSED(data);
+    }
+}
+
+void tst_QWinRegionData::decode()
+{
+    QFETCH(QRegion, region);
+    const QByteArray data = QWinRegionData::encode(region);
+    QCOMPARE(QWinRegionData::decode(data), region);
+    QBENCHMARK {
+        const QRegion decoded = QWinRegionData::decode(data);
+        Q_UNUSED(decoded);
+    }
+}
+
+void tst_QWinRegionData::perRectUnion()
+{
+    QFETCH(QRegion, region);
+    const QRect *rects = region.begin();
+    const int count = region.rectCount();
+    QBENCHMARK {
+        QRegion united;
+        for (int i = 0; i < count; ++i)
+            united += rects[i];
+    }
+}
+
+void tst_QWinRegionData::simplified_data()
+{
+    QTest::addColumn<QRegion>("region");
+    QTest::addColumn<int>("maxRects");
+    QTest::addColumn<int>("tolerance");
+
+    const QRegion ellipse(0, 0, 3840, 2160, QRegion::Ellipse);
+    const QRegion board = checkerboard(100, 100);
+    QTest::newRow("ellipse, 16") << ellipse << 16 << 0;
+    QTest::newRow("ellipse, 64, tolerance 2") << ellipse << 64 << 2;
+    QTest::newRow("checkerboard 10000, 16") << board << 16 << 0;
+    QTest::newRow("checkerboard 10000, 1000") << board << 1000 << 0;
+    QTest::newRow("checkerboard 10000, tolerance 4") << board << 0 << 4;
+}
+
+void tst_QWinRegionData::simplified()
+{
+    QFETCH(QRegion, region);
+    QFETCH(int, maxRects);
+    QFETCH(int, tolerance);
+    const QRegion result = QWinRegionData::simplified(region, maxRects, tolerance);
+    QVERIFY(maxRects <= 0 || result.rectCount() <= maxRects);
+    QVERIFY(region.subtracted(result).isEmpty());
+    QBENCHMARK {
+        const QRegion simplified = QWinRegionData::simplified(region, maxRects, tolerance);
+        Q_UNUSED(simplified);
+    }
+}
+
+// 3840x2160 masks: an ellipse, a rounded window with a soft shadow, and
+// scattered glyph-like blobs.
+static QImage mask(int pattern)
+{
+    const int width = 3840;
+    const int height = 2160;
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < height; ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            int alpha = 0;
+            if (pattern == 0) {
+                const qint64 dx = 2 * x - width;
+                const qint64 dy = 2 * y - height;
+                alpha = dx * dx * height * height + dy * dy * width * width
+                        < qint64(width) * width * height * height ? 255 : 0;
+            } else if (pattern == 1) {
+                const int edge = qMin(qMin(x, width - 1 - x), qMin(y, height - 1 - y));
+                alpha = qMin(edge * 8, 255);
+            } else {
+                alpha = ((x / 7) * 31 + (y / 11) * 17) % 5 == 0 && (x % 7) < 5 && (y % 11) < 9 ? 255 : 0;
+            }
+            line[x] = qPremultiply(qRgba(0x20, 0x40, 0x80, alpha));
+        }
+    }
+    return image;
+}
+
+void tst_QWinRegionData::rectsFromAlpha_data()
+{
+    QTest::addColumn<int>("pattern");
+    QTest::addColumn<int>("implementation");
+
+    const char *patterns[] = { "ellipse", "shadow", "glyphs" };
+    const char *names[] = { "scalar", "sse2", "avx2", "neon" };
+    for (int implementation = QWinPixelConversion::Scalar; implementation <= QWinPixelConversion::Neon; ++implementation) {
+        if (!QWinPixelConversion::isAvailable(QWinPixelConversion::Implementation(implementation)))
+            continue;
+        for (int pattern = 0; pattern < 3; ++pattern)
+            QTest::addRow("%s-%s", names[implementation], patterns[pattern]) << pattern << implementation;
+    }
+}
+
+void tst_QWinRegionData::rectsFromAlpha()
+{
+    QFETCH(int, pattern);
+    QFETCH(int, implementation);
+    const QImage image = mask(pattern);
+    QBENCHMARK {
+        const QVector<QRect> rects = QWinRegionData::rectsFromAlpha(
+            image, 128, QWinPixelConversion::Implementation(implementation));
+        Q_UNUSED(rects);
+    }
+}
+
+void tst_QWinRegionData::spanUnion_data()
+{
+    // The glyphs mask has too many spans to finish in reasonable time.
+    QTest::addColumn<int>("pattern");
+
+    QTest::newRow("ellipse") << 0;
+    QTest::newRow("shadow") << 1;
+}
+
+// Uniting a QRegion with every opaque span, the straightforward approach.
+void tst_QWinRegionData::spanUnion()
+{
+    QFETCH(int, pattern);
+    const QImage image = mask(pattern);
+    QBENCHMARK {
+        QRegion region;
+        for (int y = 0; y < image.height(); ++y) {
+            const QRgb *line = reinterpret_cast<const QRgb *>(image.constScanLine(y));
+            for (int x = 0; x < image.width();) {
+                if (qAlpha(line[x]) < 128) {
+                    ++x;
+                    continue;
+                }
+                const int start = x;
+                while (x < image.width() && qAlpha(line[x]) >= 128)
+                    ++x;
+                region += QRect(start, y, x - start, 1);
+            }
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRegionData)
+
+#include "tst_bench_qwinregiondata.moc"
@@ -0,0 +1,72 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "standinjumplistbackend.h"
+
+#include "qquickjumplist_p.h"
+#include "qquickjumplistcategory_p.h"
+#include "qquickjumplistitem_p.h"
+
+#include <QtCore/qurl.h>
+#include <QtQml/qqml.h>
+
+QT_BEGIN_NAMESPACE
+
+StandInJumpListBackend *StandInJumpListBackend::instance = nullptr;
+
+QQuickJumpListBackend *QQuickJumpListBackend::create()
+{
+    return new StandInJumpListBackend;
+}
+
+StandInJumpListBackend::StandInJumpListBackend()
+{
+    instance = this;
+}
+
+StandInJumpListBackend::~StandInJumpListBackend()
+{
+    qDeleteAll(categories);
+    if (instance == this)
+        instance = nullptr;
+}
+
+void StandInJumpListBackend::registerTypes()
+{
+    const char *uri = "QtWinExtras";
+    qmlRegisterType<QQuickJumpList>(uri, 1, 0, "JumpList");
+    qmlRegisterType<QQuickJumpListItem>(uri, 1, 0, "JumpListItem");
+    qmlRegisterType<QQuickJumpListCategory>(uri, 1, 0, "JumpListCategory");
+    qmlRegisterType<QQuickJumpListCategory, 1>(uri, 1, 1, "JumpListCategory");
+    const QString directory = QStringLiteral(WINEXTRAS_IMPORTS_DIR);
+    qmlRegisterType(QUrl::fromLocalFile(directory + QLatin1String("/JumpListLink.qml")), uri, 1, 0, "JumpListLink");
+    qmlRegisterType(QUrl::fromLocalFile(directory + QLatin1String("/JumpListDestination.qml")), uri, 1, 0, "JumpListDestination");
+    qmlRegisterType(QUrl::fromLocalFile(directory + QLatin1String("/JumpListSeparator.qml")), uri, 1, 0, "JumpListSeparator");
+}
+
+QT_END_NAMESPACE
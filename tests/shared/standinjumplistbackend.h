@@ -0,0 +1,138 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef STANDINJUMPLISTBACKEND_H
+#define STANDINJUMPLISTBACKEND_H
+
+#include "qquickjumplistbackend_p.h"
+
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Records what QQuickJumpList does to the jump list: the categories and
+// items it creates, and every property it sets. Linked in place of the
+// backend of the shell; see winextras-imports.pri.
+class StandInJumpListBackend : public QQuickJumpListBackend
+{
+public:
+    class Item : public QQuickJumpListBackend::Item
+    {
+    public:
+        Item(ItemType type, int *updates) : type(type), m_updates(updates) {}
+
+        void setFilePath(const QString &value) override { filePath = value; updated(); }
+        void setArguments(const QStringList &value) override { arguments = value; updated(); }
+        void setDescription(const QString &value) override { description = value; updated(); }
+        void setTitle(const QString &value) override { title = value; updated(); }
+        void setIconPath(const QString &value) override { iconPath = value; updated(); }
+
+        ItemType type;
+        QString filePath;
+        QStringList arguments;
+        QString description;
+        QString title;
+        QString iconPath;
+        int updates = 0;
+
+    private:
+        void updated() { ++updates; ++*m_updates; }
+
+        int *m_updates;
+    };
+
+    class Category : public QQuickJumpListBackend::Category
+    {
+    public:
+        explicit Category(int *updates) : m_updates(updates) {}
+        ~Category() { qDeleteAll(items); }
+
+        void setTitle(const QString &value) override { title = value; ++*m_updates; }
+        void setVisible(bool value) override { visible = value; ++*m_updates; }
+        Item *addItem(ItemType type) override
+        {
+            items.append(new Item(type, m_updates));
+            return items.constLast();
+        }
+        void setModel(QAbstractItemModel *value, int filePathRole, int titleRole,
+                      int argumentsRole, int iconRole) override
+        {
+            model = value;
+            roles = {filePathRole, titleRole, argumentsRole, iconRole};
+            ++modelUpdates;
+        }
+        void clear() override
+        {
+            qDeleteAll(items);
+            items.clear();
+            model = nullptr;
+            roles.clear();
+            ++clears;
+        }
+
+        QString title;
+        bool visible = false;
+        QVector<Item *> items;
+        QAbstractItemModel *model = nullptr;
+        QVector<int> roles; // file path, title, arguments, icon
+        int modelUpdates = 0;
+        int clears = 0;
+
+    private:
+        int *m_updates;
+    };
+
+    StandInJumpListBackend();
+    ~StandInJumpListBackend();
+
+    Category *recent() override { return &m_recent; }
+    Category *frequent() override { return &m_frequent; }
+    Category *tasks() override { return &m_tasks; }
+    Category *addCategory() override
+    {
+        categories.append(new Category(&updates));
+        return categories.constLast();
+    }
+
+    // Registers the JumpList types as the plugin does.
+    static void registerTypes();
+    // The backend created last, or null if it was destroyed.
+    static StandInJumpListBackend *instance;
+
+    QVector<Category *> categories;
+    int updates = 0; // setter calls on categories and items
+
+private:
+    Category m_recent{&updates};
+    Category m_frequent{&updates};
+    Category m_tasks{&updates};
+};
+
+QT_END_NAMESPACE
+
+#endif // STANDINJUMPLISTBACKEND_H
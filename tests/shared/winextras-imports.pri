@@ -0,0 +1,17 @@
+# Builds the JumpList QML types directly into a test, on top of a stand-in
+# for the jump list of the shell, so that they can be tested and benchmarked
+# on any platform.
+WINEXTRAS_IMPORTS_DIR = $$PWD/../../src/imports/winextras
+INCLUDEPATH += $$WINEXTRAS_IMPORTS_DIR $$PWD
+QT += qml
+DEFINES += QT_NO_FOREACH WINEXTRAS_IMPORTS_DIR=\\\"$$WINEXTRAS_IMPORTS_DIR\\\"
+HEADERS += \
+    $$WINEXTRAS_IMPORTS_DIR/qquickjumplist_p.h \
+    $$WINEXTRAS_IMPORTS_DIR/qquickjumplistcategory_p.h \
+    $$WINEXTRAS_IMPORTS_DIR/qquickjumplistitem_p.h \
+    $$PWD/standinjumplistbackend.h
+SOURCES += \
+    $$WINEXTRAS_IMPORTS_DIR/qquickjumplist.cpp \
+    $$WINEXTRAS_IMPORTS_DIR/qquickjumplistcategory.cpp \
+    $$WINEXTRAS_IMPORTS_DIR/qquickjumplistitem.cpp \
+    $$PWD/standinjumplistbackend.cpp
@@ -0,0 +1,7 @@
+# Builds the platform independent parts of QtWinExtras directly into a test,
+# so that they can be tested and benchmarked on any platform.
+WINEXTRAS_SOURCE_DIR = $$PWD/../../src/winextras
+INCLUDEPATH += $$WINEXTRAS_SOURCE_DIR $$PWD/include
+QT += core-private gui-private
+CONFIG += simd
+DEFINES += QT_NO_FOREACH
@@ -1,2 +1,3 @@
 TEMPLATE = subdirs
-win32: SUBDIRS += auto manual
+SUBDIRS += auto benchmarks
+win32: SUBDIRS += manual
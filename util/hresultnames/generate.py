@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+#############################################################################
+##
+## Copyright (C) 2018 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the utilities of the Qt Toolkit.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+"""Generates the HRESULT name tables of QtWinExtras.
+
+Reads hresultnames.txt and writes
+
+  src/winextras/qwinhresultnames_data_p.h
+      the names in one pooled char array, a table of (HRESULT, offset, size)
+      entries sorted by HRESULT, and the table indices sorted by name;
+
+  tests/benchmarks/qwinhresultnames/hresultswitch.cpp
+      the equivalent switch statement returning a QStringLiteral per case,
+      which the tables replaced, for comparison in the benchmark.
+
+Usage: generate.py [path to the qtwinextras source tree]
+"""
+
+import os
+import sys
+
+
+def read_names(path):
+    entries = []
+    values = set()
+    names = set()
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            value, name = line.split()
+            value = int(value, 16) & 0xffffffff
+            if value in values or name in names:
+                sys.exit('%s:%d: duplicate entry %s' % (path, number, line))
+            values.add(value)
+            names.add(name)
+            entries.append((value, name))
+    return entries
+
+
+def license_header(path):
+    with open(path) as f:
+        text = f.read()
+    return text[:text.index('*/') + 2] + '\n'
+
+
+def write_tables(path, license, entries):
+    entries = sorted(entries)
+    pool = []
+    offset = 0
+    table = []
+    for value, name in entries:
+        table.append((value, offset, len(name)))
+        pool.append(name)
+        offset += len(name) + 1
+    if offset > 0xffff:
+        sys.exit('The name pool no longer fits 16 bit offsets.')
+    order = sorted(range(len(entries)), key=lambda i: entries[i][1])
+
+    out = [license,
+           '//',
+           '//  W A R N I N G',
+           '//  -------------',
+           '//',
+           '// This file is not part of the Qt API.  It exists purely as an',
+           '// implementation detail.  This header file may change from version to',
+           '// version without notice, or even be removed.',
+           '//',
+           '// We mean it.',
+           '//',
+           '',
+           '// This file was generated by util/hresultnames/generate.py from',
+           '// util/hresultnames/hresultnames.txt. Do not edit.',
+           '',
+           '#ifndef QWINHRESULTNAMES_DATA_P_H',
+           '#define QWINHRESULTNAMES_DATA_P_H',
+           '',
+           '#include <QtCore/qglobal.h>',
+           '',
+           'QT_BEGIN_NAMESPACE',
+           '',
+           'struct QWinHResultNameEntry',
+           '{',
+           '    quint32 hresult;',
+           '    quint16 offset; // into qt_hresultNamePool',
+           '    quint16 size;',
+           '};',
+           '',
+           'static const int qt_hresultNameCount = %d;' % len(entries),
+           '',
+           '// Sorted by HRESULT.',
+           'static Q_DECL_CONSTEXPR const QWinHResultNameEntry qt_hresultNameTable[] = {']
+    for value, offset, size in table:
+        out.append('    { 0x%08X, %5d, %2d },' % (value, offset, size))
+    out += ['};',
+            '',
+            '// Indices into qt_hresultNameTable, sorted by name.',
+            'static Q_DECL_CONSTEXPR const quint16 qt_hresultNameOrder[] = {']
+    for start in range(0, len(order), 12):
+        out.append('    ' + ', '.join('%4d' % i for i in order[start:start + 12]) + ',')
+    out += ['};',
+            '',
+            'static const char qt_hresultNamePool[] =']
+    for name in pool:
+        out.append('    "%s\\0"' % name)
+    out += ['    ;',
+            '',
+            'QT_END_NAMESPACE',
+            '',
+            '#endif // QWINHRESULTNAMES_DATA_P_H',
+            '']
+    with open(path, 'w', newline='\n') as f:
+        f.write('\n'.join(out))
+
+
+def write_switch(path, license, entries):
+    out = [license,
+           '// This file was generated by util/hresultnames/generate.py from',
+           '// util/hresultnames/hresultnames.txt. Do not edit.',
+           '',
+           '// The switch statement QtWin::errorStringFromHresult() used before the',
+           '// name tables, for comparison.',
+           '',
+           '#include <QtCore/qstring.h>',
+           '',
+           'QString hresultSwitchName(quint32 hresult)',
+           '{',
+           '    switch (hresult) {']
+    for value, name in entries:
+        out.append('    case 0x%08Xu : return QStringLiteral("%s");' % (value, name))
+    out += ['    default : return QString();',
+            '    }',
+            '}',
+            '']
+    with open(path, 'w', newline='\n') as f:
+        f.write('\n'.join(out))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, '..', '..')
+    entries = read_names(os.path.join(here, 'hresultnames.txt'))
+    src = os.path.join(root, 'src', 'winextras')
+    benchmark = os.path.join(root, 'tests', 'benchmarks', 'qwinhresultnames')
+    write_tables(os.path.join(src, 'qwinhresultnames_data_p.h'),
+                 license_header(os.path.join(src, 'qwinicowriter.cpp')), entries)
+    write_switch(os.path.join(benchmark, 'hresultswitch.cpp'),
+                 license_header(os.path.join(root, 'tests', 'auto', 'qwinicowriter', 'tst_qwinicowriter.cpp')),
+                 entries)
+
+
+if __name__ == '__main__':
+    main()